@@ -0,0 +1,352 @@
+// FFI microbenchmarks for Uika.
+// This module defines a UikaBenchRunner reified actor with a RunBenchmarks()
+// BlueprintCallable function. Place it in a level and wire BeginPlay to
+// RunBenchmarks (or run `ke * RunBenchmarks` from the console) to time the
+// main Rust <-> UE crossings in a live UE environment.
+//
+// Results are written as JSON to $UIKA_BENCH_OUT (default: uika_bench.json in
+// the working directory). When $UIKA_BENCH_BASELINE names an earlier result
+// file, every benchmark slower than the baseline by more than
+// $UIKA_BENCH_TOLERANCE (default 0.15 = 15%) is reported as a regression.
+
+use std::collections::HashMap;
+use std::hint::black_box;
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::sync::Arc;
+use std::time::{Duration, Instant};
+
+use uika::{uclass, uclass_impl};
+use uika::ffi::FNameHandle;
+use uika::runtime::{
+    check_ffi, ffi_dispatch, ulog, DynamicCall, FName, OwnedStruct, ParamFrame,
+    Transform, UeClass, UObjectRef, UikaResult,
+    LOG_DISPLAY, LOG_ERROR, LOG_WARNING,
+};
+use uika::bindings::core_ue::FTransform;
+use uika::bindings::engine::{Actor, ActorExt, World};
+use uika::bindings::manual::{
+    transform::OwnedFTransformExt,
+    world_ext::WorldSpawnExt,
+};
+
+// ---------------------------------------------------------------------------
+// UikaBenchRunner — reified actor
+// ---------------------------------------------------------------------------
+
+#[uclass(parent = Actor)]
+pub struct UikaBenchRunner {
+    #[uproperty(BlueprintReadWrite)]
+    counter: i32,
+}
+
+// ---------------------------------------------------------------------------
+// Harness
+// ---------------------------------------------------------------------------
+
+/// Minimum wall time of one timed batch; iteration counts are doubled until
+/// a batch reaches it.
+const TARGET_BATCH: Duration = Duration::from_millis(2);
+const MAX_ITERS: u64 = 1 << 22;
+const SAMPLES: usize = 7;
+
+struct BenchResult {
+    name: &'static str,
+    iters: u64,
+    /// Median over `SAMPLES` batches.
+    ns_per_iter: f64,
+    min_ns_per_iter: f64,
+}
+
+#[derive(Default)]
+struct Bench {
+    results: Vec<BenchResult>,
+}
+
+impl Bench {
+    /// Time `f` and record the result. An error from `f` aborts this
+    /// benchmark only.
+    fn run(&mut self, name: &'static str, mut f: impl FnMut() -> UikaResult<()>) {
+        match Self::measure(&mut f) {
+            Ok((iters, median, min)) => {
+                ulog!(LOG_DISPLAY, "[UikaBench] {:<40} {:>12.1} ns/iter (min {:.1}, {} iters)", name, median, min, iters);
+                self.results.push(BenchResult { name, iters, ns_per_iter: median, min_ns_per_iter: min });
+            }
+            Err(e) => {
+                ulog!(LOG_ERROR, "[UikaBench] {}: failed -- {:?}", name, e);
+            }
+        }
+    }
+
+    fn measure(f: &mut impl FnMut() -> UikaResult<()>) -> UikaResult<(u64, f64, f64)> {
+        // Warm up caches (handle lookups, frame plans) and calibrate.
+        let mut iters = 1u64;
+        loop {
+            let start = Instant::now();
+            for _ in 0..iters {
+                f()?;
+            }
+            if start.elapsed() >= TARGET_BATCH || iters >= MAX_ITERS {
+                break;
+            }
+            iters *= 2;
+        }
+
+        let mut samples = [0f64; SAMPLES];
+        for sample in &mut samples {
+            let start = Instant::now();
+            for _ in 0..iters {
+                f()?;
+            }
+            *sample = start.elapsed().as_nanos() as f64 / iters as f64;
+        }
+        samples.sort_by(f64::total_cmp);
+        Ok((iters, samples[SAMPLES / 2], samples[0]))
+    }
+
+    fn to_json(&self) -> String {
+        let mut out = String::from("{\n  \"uika_bench\": 1,\n  \"results\": [\n");
+        for (i, r) in self.results.iter().enumerate() {
+            out.push_str(&format!(
+                "    {{\"name\": \"{}\", \"iters\": {}, \"ns_per_iter\": {:.3}, \"min_ns_per_iter\": {:.3}}}{}\n",
+                r.name,
+                r.iters,
+                r.ns_per_iter,
+                r.min_ns_per_iter,
+                if i + 1 < self.results.len() { "," } else { "" },
+            ));
+        }
+        out.push_str("  ]\n}\n");
+        out
+    }
+}
+
+/// Read `name -> ns_per_iter` from a file written by `Bench::to_json`
+/// (one result object per line).
+fn parse_baseline(json: &str) -> HashMap<String, f64> {
+    let field = |line: &str, key: &str| -> Option<String> {
+        let start = line.find(&format!("\"{key}\": "))? + key.len() + 4;
+        let rest = &line[start..];
+        let rest = rest.strip_prefix('"').unwrap_or(rest);
+        let end = rest.find(|c: char| c == '"' || c == ',' || c == '}')?;
+        Some(rest[..end].to_string())
+    };
+    json.lines()
+        .filter_map(|line| {
+            let name = field(line, "name")?;
+            let ns = field(line, "ns_per_iter")?.parse().ok()?;
+            Some((name, ns))
+        })
+        .collect()
+}
+
+fn identity_transform() -> OwnedStruct<FTransform> {
+    FTransform::from_transform(Transform::IDENTITY)
+}
+
+fn get_world(actor: &UObjectRef<Actor>) -> UikaResult<UObjectRef<World>> {
+    let world_h = uika::runtime::world::get_world_raw(actor.checked()?.raw())?;
+    Ok(unsafe { UObjectRef::from_raw(world_h) })
+}
+
+// ---------------------------------------------------------------------------
+// Implementation
+// ---------------------------------------------------------------------------
+
+#[uclass_impl]
+impl UikaBenchRunner {
+    #[ufunction(BlueprintCallable)]
+    fn run_benchmarks(&mut self) {
+        ulog!(LOG_DISPLAY, "[UikaBench] Starting FFI benchmarks...");
+        let self_ref: UObjectRef<Actor> = unsafe { UObjectRef::from_raw(self.__obj) };
+        let mut bench = Bench::default();
+
+        self.bench_properties(&mut bench, &self_ref);
+        self.bench_containers(&mut bench, &self_ref);
+        self.bench_calls(&mut bench, &self_ref);
+        self.bench_delegates(&mut bench, &self_ref);
+        self.bench_spawn(&mut bench, &self_ref);
+
+        self.write_results(&bench);
+    }
+
+    /// Target of the reified-function benchmark (ProcessEvent ->
+    /// execCallRustFunction -> Rust).
+    #[ufunction(BlueprintCallable)]
+    fn bench_noop(&mut self, value: i32) -> i32 {
+        value.wrapping_add(1)
+    }
+
+    fn bench_properties(&self, bench: &mut Bench, self_ref: &UObjectRef<Actor>) {
+        bench.run("property.i32.get", || {
+            black_box(self.counter());
+            Ok(())
+        });
+        let mut v = 0;
+        bench.run("property.i32.set", || {
+            v += 1;
+            self.set_counter(v);
+            Ok(())
+        });
+        bench.run("string.get_name", || {
+            black_box(self_ref.get_name()?);
+            Ok(())
+        });
+    }
+
+    /// Actor::Tags (TArray<FName>) is a raw-format array: `to_vec` is the
+    /// array_copy_all path, `get` the per-element path.
+    fn bench_containers(&self, bench: &mut Bench, self_ref: &UObjectRef<Actor>) {
+        let Ok(c) = self_ref.checked() else { return };
+        let tags = c.tags();
+        let names: Vec<FNameHandle> = (0..64).map(|i| FName::new(&format!("BenchTag{i}")).handle()).collect();
+        if let Err(e) = tags.set_all(&names) {
+            ulog!(LOG_ERROR, "[UikaBench] container setup failed -- {:?}", e);
+            return;
+        }
+
+        bench.run("array.copy_all.64", || {
+            black_box(tags.to_vec()?);
+            Ok(())
+        });
+        bench.run("array.get_each.64", || {
+            for i in 0..64 {
+                black_box(tags.get(i)?);
+            }
+            Ok(())
+        });
+        bench.run("array.with_slice.64", || {
+            // SAFETY: nothing touches the array while the length is read.
+            black_box(unsafe { tags.with_slice(|s| s.len()) }?);
+            Ok(())
+        });
+        bench.run("array.set_all.64", || tags.set_all(&names));
+
+        let _ = tags.clear();
+    }
+
+    fn bench_calls(&self, bench: &mut Bench, self_ref: &UObjectRef<Actor>) {
+        let Ok(c) = self_ref.checked() else { return };
+        let tag = FName::new("NoSuchBenchTag").handle();
+
+        bench.run("call.func_table.actor_has_tag", || {
+            black_box(c.actor_has_tag(tag));
+            Ok(())
+        });
+        bench.run("call.dynamic_call.actor_has_tag", || {
+            let mut call = DynamicCall::new(self_ref, "ActorHasTag")?;
+            call.set("Tag", tag)?;
+            black_box(call.call()?.get::<bool>("ReturnValue")?);
+            Ok(())
+        });
+        if let Ok(mut frame) = ParamFrame::for_function(self_ref, "ActorHasTag") {
+            bench.run("call.param_frame.actor_has_tag", || {
+                frame.set("Tag", tag)?;
+                frame.call(self_ref)?;
+                black_box(frame.get::<bool>("ReturnValue")?);
+                Ok(())
+            });
+        }
+
+        // Calling BenchNoop on this actor would hand the Rust side a second
+        // `&mut` to the instance behind `&self`; target a separate runner.
+        let Ok(world) = get_world(self_ref) else { return };
+        let runner: UObjectRef<Actor> = match world.spawn_actor::<UikaBenchRunner>(&identity_transform()) {
+            Ok(r) => unsafe { UObjectRef::from_raw(r.raw()) },
+            Err(e) => {
+                ulog!(LOG_ERROR, "[UikaBench] cannot spawn ProcessEvent target -- {:?}", e);
+                return;
+            }
+        };
+        if let Ok(mut frame) = ParamFrame::for_function(&runner, "BenchNoop") {
+            bench.run("call.reified.process_event", || {
+                frame.set("Value", 1i32)?;
+                frame.call(&runner)?;
+                black_box(frame.get::<i32>("ReturnValue")?);
+                Ok(())
+            });
+        }
+        if let Ok(r) = runner.checked() {
+            r.k2_destroy_actor();
+        }
+    }
+
+    /// Broadcast OnActorBeginOverlap from Rust: UE multicast dispatch ->
+    /// UUikaDelegateProxy::ProcessEvent -> Rust closure.
+    fn bench_delegates(&self, bench: &mut Bench, self_ref: &UObjectRef<Actor>) {
+        let Ok(c) = self_ref.checked() else { return };
+        let fired = Arc::new(AtomicU64::new(0));
+        let counter = fired.clone();
+        let Ok(_binding) = c.on_actor_begin_overlap().add(move |_overlapped, _other| {
+            counter.fetch_add(1, Ordering::Relaxed);
+        }) else {
+            return;
+        };
+
+        let name = "OnActorBeginOverlap";
+        let prop = unsafe {
+            ffi_dispatch::reflection_find_property(Actor::static_class(), name.as_ptr(), name.len() as u32)
+        };
+        if prop.is_null() {
+            ulog!(LOG_WARNING, "[UikaBench] {} not found, skipping delegate benchmark", name);
+            return;
+        }
+        let obj = self.__obj;
+        bench.run("delegate.broadcast.proxy", || {
+            // (OverlappedActor, OtherActor)
+            let mut params = [obj, obj];
+            check_ffi(unsafe {
+                ffi_dispatch::delegate_broadcast_multicast(obj, prop, params.as_mut_ptr() as *mut u8)
+            })
+        });
+        if fired.load(Ordering::Relaxed) == 0 {
+            ulog!(LOG_WARNING, "[UikaBench] delegate.broadcast.proxy: callback never fired");
+        }
+    }
+
+    fn bench_spawn(&self, bench: &mut Bench, self_ref: &UObjectRef<Actor>) {
+        let Ok(world) = get_world(self_ref) else { return };
+        let t = identity_transform();
+        bench.run("world.spawn_destroy_actor", || {
+            let spawned: UObjectRef<Actor> = world.spawn_actor(&t)?;
+            spawned.checked()?.k2_destroy_actor();
+            Ok(())
+        });
+    }
+
+    fn write_results(&self, bench: &Bench) {
+        let out_path = std::env::var("UIKA_BENCH_OUT").unwrap_or_else(|_| "uika_bench.json".into());
+        match std::fs::write(&out_path, bench.to_json()) {
+            Ok(()) => ulog!(LOG_DISPLAY, "[UikaBench] {} results written to {}", bench.results.len(), out_path),
+            Err(e) => ulog!(LOG_ERROR, "[UikaBench] cannot write {}: {}", out_path, e),
+        }
+
+        let Ok(baseline_path) = std::env::var("UIKA_BENCH_BASELINE") else { return };
+        let baseline = match std::fs::read_to_string(&baseline_path) {
+            Ok(text) => parse_baseline(&text),
+            Err(e) => {
+                ulog!(LOG_ERROR, "[UikaBench] cannot read baseline {}: {}", baseline_path, e);
+                return;
+            }
+        };
+        let tolerance: f64 = std::env::var("UIKA_BENCH_TOLERANCE")
+            .ok()
+            .and_then(|s| s.parse().ok())
+            .unwrap_or(0.15);
+
+        let mut regressions = 0;
+        for r in &bench.results {
+            let Some(&base) = baseline.get(r.name) else {
+                ulog!(LOG_DISPLAY, "[UikaBench] {}: new (no baseline)", r.name);
+                continue;
+            };
+            let ratio = r.ns_per_iter / base.max(f64::EPSILON);
+            if ratio > 1.0 + tolerance {
+                regressions += 1;
+                ulog!(LOG_WARNING, "[UikaBench] REGRESSION {}: {:.1} -> {:.1} ns/iter ({:+.0}%)",
+                    r.name, base, r.ns_per_iter, (ratio - 1.0) * 100.0);
+            }
+        }
+        ulog!(LOG_DISPLAY, "[UikaBench] {} regressions vs {} (tolerance {:.0}%)",
+            regressions, baseline_path, tolerance * 100.0);
+    }
+}
@@ -1,4 +1,5 @@
 uika::entry!();
 
+mod bench;
 mod game_demo;
 mod test_integration;
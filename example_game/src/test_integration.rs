@@ -5,7 +5,7 @@
 
 use uika::{uclass, uclass_impl};
 use uika::runtime::{
-    ulog, DynamicCall, FName, OwnedStruct, Pinned, TWeakObjectPtr,
+    ulog, Checked, DynamicCall, FName, OwnedStruct, Pinned, TWeakObjectPtr,
     Transform, UeClass, UObjectRef, UikaError, UikaResult,
     LOG_DISPLAY, LOG_ERROR,
 };
@@ -13,7 +13,8 @@ use uika::bindings::core_ue::{
     FQuat, FRotator, FTransform, FVector,
 };
 use uika::bindings::engine::{
-    Actor, ActorExt, Pawn, PawnExt, World,
+    Actor, ActorExt, KismetSystemLibrary, KismetSystemLibraryExt, Pawn, PawnExt,
+    PlayerController, World,
     EAttachmentRule,
 };
 use uika::bindings::manual::{
@@ -182,6 +183,9 @@ impl UikaTestRunner {
         // S. Deferred Spawn (P1-2)
         self.test_deferred_spawn(&self_ref);
 
+        // T. Async Asset Loading
+        self.test_async_asset_load(&self_ref);
+
         // O. Hot Reload Validation
         self.test_hot_reload();
 
@@ -1334,6 +1338,48 @@ impl UikaTestRunner {
         });
     }
 
+    // -----------------------------------------------------------------------
+    // T. Async Asset Loading (1 test)
+    // -----------------------------------------------------------------------
+
+    fn test_async_asset_load(&mut self, self_ref: &UObjectRef<Actor>) {
+        // T1: loaded objects stay alive across a GC until the result is dropped
+        run_test!(self, "T1: async_load_result_survives_gc", {
+            use uika::bindings::core_ue::Object;
+            use uika::runtime::world::{load_object_async_raw, ASSET_LOAD_PRIORITY_DEFAULT};
+
+            // An unreferenced transient object: only the load result can keep it.
+            let obj: UObjectRef<Actor> = world_ext::new_object_transient()?;
+            let path = format!("/Engine/Transient.{}", obj.get_name()?);
+            let weak = TWeakObjectPtr::from_ref(&obj);
+
+            // Already in memory, so the request completes inside the call.
+            let mut load = load_object_async_raw(
+                uika::ffi::UClassHandle::null(), &path, ASSET_LOAD_PRIORITY_DEFAULT,
+            )?;
+            let assets = load.try_take().ok_or_else(|| {
+                UikaError::InvalidOperation("load of an in-memory object should complete at once".into())
+            })??;
+            assert_true(assets.first() == Some(&obj.raw()), "load should resolve to the object")?;
+
+            let world_ctx: UObjectRef<Object> = unsafe { UObjectRef::from_raw(self_ref.raw()) };
+            let no_player: UObjectRef<PlayerController> =
+                unsafe { UObjectRef::from_raw(uika::ffi::UObjectHandle::null()) };
+            let collect = |ctx: UObjectRef<Object>| {
+                <Checked<KismetSystemLibrary> as KismetSystemLibraryExt>::execute_console_command(
+                    ctx, "obj gc", no_player,
+                );
+            };
+
+            collect(world_ctx);
+            assert_true(weak.is_valid(), "object should survive GC while the result is held")?;
+
+            drop(assets);
+            collect(world_ctx);
+            assert_false(weak.is_valid(), "object should be collected once the result is dropped")
+        });
+    }
+
     // -----------------------------------------------------------------------
     // O. Hot Reload Validation (2 tests)
     // -----------------------------------------------------------------------
@@ -1,8 +1,40 @@
 #include "UUikaReifiedClass.h"
+#include "UUikaReifiedFunction.h"
 #include "UikaApiTable.h"
+#include "UikaTrace.h"
 #include "UikaModule.h"
 #include "Components/SceneComponent.h"
 #include "GameFramework/Actor.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/UObjectGlobals.h"
+
+// Object tracker registration (defined in UikaLifecycleApiImpl.cpp).
+extern void UikaTrackReifiedInstance(const UObjectBase* Object, UUikaReifiedClass* ReifiedClass);
+
+namespace
+{
+    // Blueprint child class -> nearest reified ancestor. Keys carry the object
+    // serial number, so a recycled class address never hits a stale entry, and
+    // a live child keeps its reified super alive. Entries of collected
+    // classes (every Blueprint recompile leaves some) are pruned after GC.
+    TMap<TObjectKey<UClass>, UUikaReifiedClass*> GReifiedAncestors;
+    FRWLock GReifiedAncestorsLock;
+    FDelegateHandle GPostGarbageCollectHandle;
+}
+
+// Drop the entries of collected classes (post-GC, game thread).
+static void PruneReifiedAncestors()
+{
+    FWriteScopeLock Lock(GReifiedAncestorsLock);
+    for (auto It = GReifiedAncestors.CreateIterator(); It; ++It)
+    {
+        if (!It.Key().ResolveObjectPtr())
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
 
 UClass* UUikaReifiedClass::GetAuthoritativeClass()
 {
@@ -12,16 +44,179 @@ UClass* UUikaReifiedClass::GetAuthoritativeClass()
     return this;
 }
 
-void UUikaReifiedClass::UikaClassConstructor(const FObjectInitializer& ObjectInitializer)
+void UUikaReifiedClass::BuildDispatchTables()
 {
-    // 1. Find the UUikaReifiedClass in the hierarchy. The immediate class may be
-    //    a Blueprint child (e.g. SKEL_new_MacroTestActor_C), so walk up.
-    UUikaReifiedClass* ReifiedClass = nullptr;
-    for (UClass* Cls = ObjectInitializer.GetClass(); Cls; Cls = Cls->GetSuperClass())
+    FunctionDispatch.Reset();
+    for (TFieldIterator<UFunction> FuncIt(this, EFieldIteratorFlags::ExcludeSuper); FuncIt; ++FuncIt)
+    {
+        if (UUikaReifiedFunction* Func = Cast<UUikaReifiedFunction>(*FuncIt))
+        {
+            Func->BuildParamPlan();
+            FunctionDispatch.Add(Func->GetFName(), Func);
+        }
+    }
+}
+
+void UUikaReifiedClass::BuildConstructionPlan()
+{
+    const int32 Count = ComponentDefs.Num();
+    TMap<FName, int32> ByName;
+    ByName.Reserve(Count);
+    for (int32 i = 0; i < Count; ++i)
+    {
+        ByName.Add(ComponentDefs[i].SubobjectName, i);
+    }
+
+    // Resolve attach parents by name; parents may be declared after children.
+    TArray<int32> Parent;
+    Parent.Init(INDEX_NONE, Count);
+    for (int32 i = 0; i < Count; ++i)
+    {
+        const FUikaComponentDef& Def = ComponentDefs[i];
+        if (Def.bIsRoot || Def.AttachParentName == NAME_None)
+        {
+            continue;
+        }
+        const int32* Found = ByName.Find(Def.AttachParentName);
+        const UClass* ParentClass = Found ? ComponentDefs[*Found].ComponentClass : nullptr;
+        if (Found && *Found != i && ParentClass && ParentClass->IsChildOf(USceneComponent::StaticClass()))
+        {
+            Parent[i] = *Found;
+        }
+        else
+        {
+            UE_LOG(LogUika, Warning,
+                TEXT("[Uika] %s: attach parent '%s' of subobject '%s' is not a scene component subobject; left unattached"),
+                *GetName(), *Def.AttachParentName.ToString(), *Def.SubobjectName.ToString());
+        }
+    }
+
+    // Emit every def after its parent chain, otherwise in declaration order.
+    TArray<int32> PlanIndex;
+    PlanIndex.Init(INDEX_NONE, Count);
+    TArray<int32, TInlineAllocator<16>> Chain;
+    ConstructionPlan.Reset(Count);
+    for (int32 i = 0; i < Count; ++i)
+    {
+        Chain.Reset();
+        for (int32 j = i; j != INDEX_NONE && PlanIndex[j] == INDEX_NONE; j = Parent[j])
+        {
+            if (Chain.Contains(j))
+            {
+                UE_LOG(LogUika, Warning,
+                    TEXT("[Uika] %s: attachment cycle through subobject '%s'; left unattached"),
+                    *GetName(), *ComponentDefs[Chain.Last()].SubobjectName.ToString());
+                Parent[Chain.Last()] = INDEX_NONE;
+                break;
+            }
+            Chain.Add(j);
+        }
+        for (int32 k = Chain.Num() - 1; k >= 0; --k)
+        {
+            const int32 DefIndex = Chain[k];
+            const FUikaComponentDef& Def = ComponentDefs[DefIndex];
+            FUikaConstructionStep& Step = ConstructionPlan.AddDefaulted_GetRef();
+            Step.SubobjectName = Def.SubobjectName;
+            Step.ComponentClass = Def.ComponentClass;
+            Step.AttachParent = Parent[DefIndex] != INDEX_NONE ? PlanIndex[Parent[DefIndex]] : INDEX_NONE;
+            Step.bIsRoot = Def.bIsRoot;
+            Step.bIsTransient = Def.bIsTransient;
+            Step.bIsScene = Def.ComponentClass && Def.ComponentClass->IsChildOf(USceneComponent::StaticClass());
+            PlanIndex[DefIndex] = ConstructionPlan.Num() - 1;
+        }
+    }
+}
+
+UUikaReifiedClass* UUikaReifiedClass::FindReifiedClass(UClass* Cls)
+{
+    if (UUikaReifiedClass* Direct = Cast<UUikaReifiedClass>(Cls))
+    {
+        return Direct;
+    }
+    if (!Cls)
     {
-        ReifiedClass = Cast<UUikaReifiedClass>(Cls);
-        if (ReifiedClass) break;
+        return nullptr;
     }
+
+    const TObjectKey<UClass> Key(Cls);
+    {
+        FReadScopeLock Lock(GReifiedAncestorsLock);
+        if (UUikaReifiedClass* const* Found = GReifiedAncestors.Find(Key))
+        {
+#if WITH_EDITOR
+            // Blueprint compiles may reparent a class in place.
+            if (Cls->IsChildOf(*Found))
+#endif
+            {
+                return *Found;
+            }
+        }
+    }
+
+    UUikaReifiedClass* Found = nullptr;
+    for (UClass* Super = Cls->GetSuperClass(); Super && !Found; Super = Super->GetSuperClass())
+    {
+        Found = Cast<UUikaReifiedClass>(Super);
+    }
+    if (Found)
+    {
+        FWriteScopeLock Lock(GReifiedAncestorsLock);
+        GReifiedAncestors.Add(Key, Found);
+    }
+    return Found;
+}
+
+void UUikaReifiedClass::ReserveRustDataSlot()
+{
+    for (UClass* Cls = GetSuperClass(); Cls; Cls = Cls->GetSuperClass())
+    {
+        if (UUikaReifiedClass* Parent = Cast<UUikaReifiedClass>(Cls))
+        {
+            RustDataOffset = Parent->RustDataOffset;
+            return;
+        }
+    }
+
+    // Zero-initialized with the rest of the object: a fresh instance has no
+    // Rust data until construct_rust_instance returns.
+    RustDataOffset = Align(PropertiesSize, static_cast<int32>(alignof(void*)));
+    PropertiesSize = RustDataOffset + static_cast<int32>(sizeof(void*));
+    MinAlignment = FMath::Max(MinAlignment, static_cast<int32>(alignof(void*)));
+}
+
+void UUikaReifiedClass::AddLiveInstance(UObject* Obj)
+{
+    FScopeLock Lock(&LiveInstancesLock);
+    LiveInstances.Add(Obj);
+}
+
+void UUikaReifiedClass::RemoveLiveInstance(const UObjectBase* Obj)
+{
+    FScopeLock Lock(&LiveInstancesLock);
+    LiveInstances.Remove(static_cast<UObject*>(const_cast<UObjectBase*>(Obj)));
+}
+
+void UUikaReifiedClass::GetLiveInstances(TArray<UObject*>& Out) const
+{
+    FScopeLock Lock(&LiveInstancesLock);
+    Out.Reserve(Out.Num() + LiveInstances.Num());
+    for (UObject* Obj : LiveInstances)
+    {
+        Out.Add(Obj);
+    }
+}
+
+int32 UUikaReifiedClass::NumLiveInstances() const
+{
+    FScopeLock Lock(&LiveInstancesLock);
+    return LiveInstances.Num();
+}
+
+void UUikaReifiedClass::UikaClassConstructor(const FObjectInitializer& ObjectInitializer)
+{
+    // 1. Find the UUikaReifiedClass in the hierarchy. The immediate class may be
+    //    a Blueprint child (e.g. SKEL_new_MacroTestActor_C).
+    UUikaReifiedClass* ReifiedClass = FindReifiedClass(ObjectInitializer.GetClass());
     if (!ReifiedClass)
     {
         UE_LOG(LogUika, Error, TEXT("[Uika] UikaClassConstructor called on non-reified class!"));
@@ -35,55 +230,69 @@ void UUikaReifiedClass::UikaClassConstructor(const FObjectInitializer& ObjectIni
         NativeSuper->ClassConstructor(ObjectInitializer);
     }
 
-    // 3. Create default subobjects from Rust-registered definitions.
+    // 3. Create default subobjects from the compiled construction plan.
     UObject* Obj = ObjectInitializer.GetObj();
-    if (ReifiedClass->ComponentDefs.Num() > 0)
+    const TArray<FUikaConstructionStep>& Plan = ReifiedClass->ConstructionPlan;
+    if (Plan.Num() > 0)
     {
-        TMap<FName, USceneComponent*> CreatedComponents;
+        // Scene component of each step; parents precede their children.
+        USceneComponent** Created = static_cast<USceneComponent**>(
+            FMemory_Alloca(Plan.Num() * sizeof(USceneComponent*)));
+        AActor* Actor = Cast<AActor>(Obj);
 
-        for (const FUikaComponentDef& Def : ReifiedClass->ComponentDefs)
+        for (int32 i = 0; i < Plan.Num(); ++i)
         {
+            const FUikaConstructionStep& Step = Plan[i];
             UObject* Sub = ObjectInitializer.CreateDefaultSubobject(
-                Obj, Def.SubobjectName,
-                Def.ComponentClass, Def.ComponentClass,
-                /*bIsRequired=*/true, Def.bIsTransient);
+                Obj, Step.SubobjectName,
+                Step.ComponentClass, Step.ComponentClass,
+                /*bIsRequired=*/true, Step.bIsTransient);
 
-            if (!Sub) continue;
+            // CreateDefaultSubobject returns ComponentClass or a subclass.
+            USceneComponent* SceneComp = Step.bIsScene ? static_cast<USceneComponent*>(Sub) : nullptr;
+            Created[i] = SceneComp;
+            if (!SceneComp) continue;
 
-            USceneComponent* SceneComp = Cast<USceneComponent>(Sub);
-            if (SceneComp)
+            if (Step.bIsRoot)
             {
-                CreatedComponents.Add(Def.SubobjectName, SceneComp);
+                if (Actor) Actor->SetRootComponent(SceneComp);
             }
-
-            if (Def.bIsRoot)
-            {
-                if (AActor* Actor = Cast<AActor>(Obj))
-                {
-                    if (SceneComp) Actor->SetRootComponent(SceneComp);
-                }
-            }
-            else if (Def.AttachParentName != NAME_None)
+            else if (Step.AttachParent != INDEX_NONE && Created[Step.AttachParent])
             {
-                if (SceneComp)
-                {
-                    if (USceneComponent** Parent = CreatedComponents.Find(Def.AttachParentName))
-                    {
-                        SceneComp->SetupAttachment(*Parent);
-                    }
-                }
+                SceneComp->SetupAttachment(Created[Step.AttachParent]);
             }
         }
     }
 
-    // 4. Notify Rust to construct its instance data.
+    // 4. Track the instance for batched destroy notification and register it
+    //    with its reified class, then notify Rust to construct its instance data.
+    const bool bIsCDO = Obj->HasAnyFlags(RF_ClassDefaultObject);
+    UikaTrackReifiedInstance(Obj, ReifiedClass);
+    if (!bIsCDO)
+    {
+        ReifiedClass->AddLiveInstance(Obj);
+    }
     const FUikaRustCallbacks* Callbacks = GetUikaRustCallbacks();
     if (Callbacks && Callbacks->construct_rust_instance)
     {
-        bool bIsCDO = Obj->HasAnyFlags(RF_ClassDefaultObject);
-        Callbacks->construct_rust_instance(
+        UIKA_TRACE_SCOPE(Uika_ConstructRustInstance);
+        ReifiedClass->SetRustData(Obj, Callbacks->construct_rust_instance(
             UikaUObjectHandle{ Obj },
             ReifiedClass->RustTypeId,
-            bIsCDO);
+            bIsCDO));
     }
 }
+
+// Module hooks (called from UikaModule.cpp).
+void UikaReifiedClassRegisterHooks()
+{
+    GPostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&PruneReifiedAncestors);
+}
+
+void UikaReifiedClassUnregisterHooks()
+{
+    FCoreUObjectDelegates::GetPostGarbageCollect().Remove(GPostGarbageCollectHandle);
+    GPostGarbageCollectHandle.Reset();
+    FWriteScopeLock Lock(GReifiedAncestorsLock);
+    GReifiedAncestors.Empty();
+}
@@ -1,62 +1,103 @@
 #include "UUikaReifiedFunction.h"
 #include "UUikaReifiedClass.h"
 #include "UikaApiTable.h"
+#include "UikaTrace.h"
 #include "UikaModule.h"
 
-DEFINE_FUNCTION(UUikaReifiedFunction::execCallRustFunction)
+void UUikaReifiedFunction::BuildParamPlan()
 {
-    // ---------------------------------------------------------------
-    // Step 1: Find the UUikaReifiedFunction being called.
-    //
-    // When called from bytecode (EX_FinalFunction / EX_LocalFinalFunction),
-    // Stack.Node is the CALLER's function (e.g., the Ubergraph), not ours.
-    // UFunction::Invoke() sets Stack.CurrentNativeFunction before calling
-    // our Func pointer, so we use that to identify ourselves.
-    // ---------------------------------------------------------------
+    FUikaParamPlan Plan;
+    Plan.FrameSize = PropertiesSize;
+    if (const UUikaReifiedClass* Owner = Cast<UUikaReifiedClass>(GetOuter()))
+    {
+        Plan.RustDataOffset = Owner->RustDataOffset;
+    }
+
+    // Walk ChildProperties directly: TFieldIterator uses the PropertyLink
+    // chain which may not be populated for dynamically-created functions.
+    for (FField* Field = ChildProperties; Field; Field = Field->Next)
+    {
+        FProperty* Prop = CastField<FProperty>(Field);
+        if (!Prop || !Prop->HasAnyPropertyFlags(CPF_Parm)) continue;
+
+        if (Prop->HasAnyPropertyFlags(CPF_ReturnParm))
+        {
+            Plan.ReturnProp = Prop;
+            Plan.ReturnOffset = Prop->GetOffset_ForUFunction();
+            Plan.ReturnSize = Prop->GetSize();
+            Plan.bReturnIsPod = Prop->HasAnyPropertyFlags(CPF_IsPlainOldData);
+        }
+        else
+        {
+            Plan.Inputs.Add(Prop);
+        }
 
-    UUikaReifiedFunction* ReifiedFunc = nullptr;
+        if (!Prop->HasAnyPropertyFlags(CPF_IsPlainOldData | CPF_NoDestructor))
+        {
+            Plan.NeedsDestroy.Add(Prop);
+        }
+    }
 
-    if (Stack.CurrentNativeFunction)
+    Plan.bBuilt = true;
+    ParamPlan = MoveTemp(Plan);
+}
+
+// Resolve the UUikaReifiedFunction being executed.
+//
+// When called from bytecode (EX_FinalFunction / EX_LocalFinalFunction),
+// Stack.Node is the CALLER's function (e.g., the Ubergraph), not ours.
+// UFunction::Invoke() sets Stack.CurrentNativeFunction before calling our
+// Func pointer, so that is the fast path. The fallback is one hash lookup in
+// the reified class's FunctionDispatch table (no FindFunctionByName walk).
+static UUikaReifiedFunction* ResolveReifiedFunction(const FFrame& Stack, UObject* Self)
+{
+    UFunction* Candidates[2] = { Stack.CurrentNativeFunction, Stack.Node };
+    for (UFunction* Func : Candidates)
     {
-        ReifiedFunc = Cast<UUikaReifiedFunction>(Stack.CurrentNativeFunction);
+        if (Func && Func->GetClass() == UUikaReifiedFunction::StaticClass())
+        {
+            return static_cast<UUikaReifiedFunction*>(Func);
+        }
     }
-    if (!ReifiedFunc)
+
+    UFunction* LookupFunc = Stack.CurrentNativeFunction ? Stack.CurrentNativeFunction : Stack.Node;
+    if (!LookupFunc || !Self)
     {
-        ReifiedFunc = Cast<UUikaReifiedFunction>(Stack.Node);
+        return nullptr;
     }
-    if (!ReifiedFunc)
+
+    // Overrides: the reified function is a super function of the one invoked.
+    for (UFunction* F = LookupFunc->GetSuperFunction(); F; F = F->GetSuperFunction())
     {
-        UFunction* StartFunc = Stack.CurrentNativeFunction
-            ? Stack.CurrentNativeFunction : Stack.Node;
-        for (UFunction* F = StartFunc ? StartFunc->GetSuperFunction() : nullptr;
-             F; F = F->GetSuperFunction())
+        if (UUikaReifiedFunction* Reified = Cast<UUikaReifiedFunction>(F))
         {
-            ReifiedFunc = Cast<UUikaReifiedFunction>(F);
-            if (ReifiedFunc) break;
+            return Reified;
         }
     }
-    if (!ReifiedFunc && P_THIS)
+
+    const FName FuncName = LookupFunc->GetFName();
+    for (UClass* Cls = Self->GetClass(); Cls; Cls = Cls->GetSuperClass())
     {
-        UFunction* LookupFunc = Stack.CurrentNativeFunction
-            ? Stack.CurrentNativeFunction : Stack.Node;
-        if (LookupFunc)
+        if (UUikaReifiedClass* RC = Cast<UUikaReifiedClass>(Cls))
         {
-            FName FuncName = LookupFunc->GetFName();
-            for (UClass* Cls = P_THIS->GetClass(); Cls; Cls = Cls->GetSuperClass())
+            if (UUikaReifiedFunction* const* Found = RC->FunctionDispatch.Find(FuncName))
             {
-                if (UUikaReifiedClass* RC = Cast<UUikaReifiedClass>(Cls))
-                {
-                    if (UFunction* Found = RC->FindFunctionByName(
-                            FuncName, EIncludeSuperFlag::ExcludeSuper))
-                    {
-                        ReifiedFunc = Cast<UUikaReifiedFunction>(Found);
-                        if (ReifiedFunc) break;
-                    }
-                }
+                return *Found;
             }
         }
     }
+    return nullptr;
+}
+
+DEFINE_FUNCTION(UUikaReifiedFunction::execCallRustFunction)
+{
+    UIKA_TRACE_SCOPE(Uika_CallRustFunction);
+
+    // ---------------------------------------------------------------
+    // Step 1: Find the UUikaReifiedFunction being called.
+    // ---------------------------------------------------------------
 
+    UUikaReifiedFunction* ReifiedFunc = ResolveReifiedFunction(Stack, P_THIS);
     if (!ReifiedFunc)
     {
         UE_LOG(LogUika, Error,
@@ -76,14 +117,17 @@ DEFINE_FUNCTION(UUikaReifiedFunction::execCallRustFunction)
     //   Locals already contain our params.
     //
     // Bytecode path (Stack.Node != ReifiedFunc):
-    //   Read each input param from the bytecode using Stack.Step(),
-    //   then P_FINISH to skip past EX_EndFunctionParms.
-    //
-    // NOTE: We walk ChildProperties directly instead of TFieldIterator
-    // because TFieldIterator uses the PropertyLink chain which may not
-    // be populated for dynamically-created functions.
+    //   Read each input param from the bytecode using Stack.Step() in the
+    //   order recorded by the param plan, then P_FINISH to skip past
+    //   EX_EndFunctionParms.
     // ---------------------------------------------------------------
 
+    if (!ReifiedFunc->ParamPlan.bBuilt)
+    {
+        ReifiedFunc->BuildParamPlan();
+    }
+    const FUikaParamPlan& Plan = ReifiedFunc->ParamPlan;
+
     const bool bFromProcessEvent = (Stack.Node == ReifiedFunc);
     uint8* ParamsPtr = nullptr;
 
@@ -94,21 +138,13 @@ DEFINE_FUNCTION(UUikaReifiedFunction::execCallRustFunction)
     }
     else
     {
-        const int32 PropsSize = ReifiedFunc->PropertiesSize;
-        if (PropsSize > 0)
+        if (Plan.FrameSize > 0)
         {
-            ParamsPtr = (uint8*)FMemory_Alloca(PropsSize);
-            FMemory::Memzero(ParamsPtr, PropsSize);
+            ParamsPtr = (uint8*)FMemory_Alloca(Plan.FrameSize);
+            FMemory::Memzero(ParamsPtr, Plan.FrameSize);
 
-            // Walk ChildProperties directly to read input params from bytecode.
-            for (FField* Field = ReifiedFunc->ChildProperties; Field; Field = Field->Next)
+            for (FProperty* Prop : Plan.Inputs)
             {
-                FProperty* Prop = CastField<FProperty>(Field);
-                if (!Prop) continue;
-                // Skip return value — only read input params from bytecode.
-                if (Prop->HasAnyPropertyFlags(CPF_ReturnParm)) continue;
-                if (!Prop->HasAnyPropertyFlags(CPF_Parm)) continue;
-
                 Stack.Step(Stack.Object, ParamsPtr + Prop->GetOffset_ForUFunction());
             }
         }
@@ -122,33 +158,36 @@ DEFINE_FUNCTION(UUikaReifiedFunction::execCallRustFunction)
     const FUikaRustCallbacks* Callbacks = GetUikaRustCallbacks();
     if (Callbacks && Callbacks->invoke_rust_function)
     {
+        // Rust data straight from the instance slot: no registry lookup.
+        void* RustData = (P_THIS && Plan.RustDataOffset != INDEX_NONE)
+            ? *reinterpret_cast<void**>(reinterpret_cast<uint8*>(P_THIS) + Plan.RustDataOffset)
+            : nullptr;
         Callbacks->invoke_rust_function(
             ReifiedFunc->CallbackId,
             UikaUObjectHandle{ P_THIS },
+            RustData,
             ParamsPtr);
     }
 
     // Copy return value to RESULT_PARAM.
-    if (RESULT_PARAM && ParamsPtr)
+    if (RESULT_PARAM && ParamsPtr && Plan.ReturnProp)
     {
-        if (FProperty* RetProp = ReifiedFunc->GetReturnProperty())
+        if (Plan.bReturnIsPod)
+        {
+            FMemory::Memcpy(RESULT_PARAM, ParamsPtr + Plan.ReturnOffset, Plan.ReturnSize);
+        }
+        else
         {
-            RetProp->CopyCompleteValue(
-                RESULT_PARAM,
-                ParamsPtr + RetProp->GetOffset_ForUFunction());
+            Plan.ReturnProp->CopyCompleteValue(RESULT_PARAM, ParamsPtr + Plan.ReturnOffset);
         }
     }
 
     // Destroy temporary parameter values for the bytecode path.
     if (!bFromProcessEvent && ParamsPtr)
     {
-        for (FField* Field = ReifiedFunc->ChildProperties; Field; Field = Field->Next)
+        for (FProperty* Prop : Plan.NeedsDestroy)
         {
-            FProperty* Prop = CastField<FProperty>(Field);
-            if (Prop && Prop->HasAnyPropertyFlags(CPF_Parm))
-            {
-                Prop->DestroyValue_InContainer(ParamsPtr);
-            }
+            Prop->DestroyValue_InContainer(ParamsPtr);
         }
     }
 }
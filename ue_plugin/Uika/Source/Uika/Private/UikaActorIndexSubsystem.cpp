@@ -0,0 +1,220 @@
+#include "UikaActorIndexSubsystem.h"
+
+#include "Algo/BinarySearch.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+
+// Oldest changes are trimmed once the log holds twice this many entries,
+// keeping at least this much history.
+static constexpr int32 UikaActorChangeLogCapacity = 16 * 1024;
+
+// ---------------------------------------------------------------------------
+// Lifecycle
+// ---------------------------------------------------------------------------
+
+void UUikaActorIndexSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    UWorld* World = GetWorld();
+    if (!World) return;
+
+    SpawnedHandle = World->AddOnActorSpawnedHandler(
+        FOnActorSpawned::FDelegate::CreateUObject(this, &UUikaActorIndexSubsystem::HandleActorSpawned));
+    DestroyedHandle = World->AddOnActorDestroyedHandler(
+        FOnActorDestroyed::FDelegate::CreateUObject(this, &UUikaActorIndexSubsystem::HandleActorDestroyed));
+    LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(
+        this, &UUikaActorIndexSubsystem::HandleLevelAdded);
+    LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(
+        this, &UUikaActorIndexSubsystem::HandleLevelRemoved);
+}
+
+void UUikaActorIndexSubsystem::Deinitialize()
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->RemoveOnActorSpawnedHandler(SpawnedHandle);
+        World->RemoveOnActorDestroyededHandler(DestroyedHandle);
+    }
+    FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+    FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+
+    Buckets.Empty();
+    Changes.Empty();
+    HistoryFloor = Generation;
+
+    Super::Deinitialize();
+}
+
+// ---------------------------------------------------------------------------
+// Queries
+// ---------------------------------------------------------------------------
+
+const TArray<UUikaActorIndexSubsystem::FEntry>& UUikaActorIndexSubsystem::GetActors(UClass* Class)
+{
+    FClassBucket* Bucket = Buckets.Find(Class);
+    if (!Bucket)
+    {
+        Bucket = &Buckets.Add(Class);
+        Bucket->Class = Class;
+        for (TActorIterator<AActor> It(GetWorld(), Class); It; ++It)
+        {
+            BucketAdd(*Bucket, *It);
+        }
+        return Bucket->Entries;
+    }
+
+    // Actors can vanish without a destroy event (GC after a failed spawn,
+    // editor-only teardown); drop those so the caller sees an exact count.
+    for (int32 Slot = Bucket->Entries.Num() - 1; Slot >= 0; --Slot)
+    {
+        if (!Bucket->Entries[Slot].Weak.IsValid())
+        {
+            BucketRemoveAt(*Bucket, Slot);
+        }
+    }
+    return Bucket->Entries;
+}
+
+bool UUikaActorIndexSubsystem::GetChanges(UClass* Class, uint64 Since, TArray<const FChange*>& OutChanges) const
+{
+    if (Since < HistoryFloor || Since > Generation)
+    {
+        return false;
+    }
+
+    const int32 Start = Algo::UpperBoundBy(Changes, Since, &FChange::Generation);
+    for (int32 Index = Start; Index < Changes.Num(); ++Index)
+    {
+        const FChange& Change = Changes[Index];
+        const UClass* ActorClass = Change.Class.Get();
+        if (ActorClass && ActorClass->IsChildOf(Class))
+        {
+            OutChanges.Add(&Change);
+        }
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// World / level events
+// ---------------------------------------------------------------------------
+
+void UUikaActorIndexSubsystem::HandleActorSpawned(AActor* Actor)
+{
+    if (IsValid(Actor))
+    {
+        AddActor(Actor);
+    }
+}
+
+void UUikaActorIndexSubsystem::HandleActorDestroyed(AActor* Actor)
+{
+    if (Actor)
+    {
+        RemoveActor(Actor);
+    }
+}
+
+// Streamed-in actors never fire OnActorSpawned, and streamed-out ones never
+// fire OnActorDestroyed, so levels are folded in and out actor by actor.
+void UUikaActorIndexSubsystem::HandleLevelAdded(ULevel* Level, UWorld* World)
+{
+    if (!Level || World != GetWorld()) return;
+    for (AActor* Actor : Level->Actors)
+    {
+        if (IsValid(Actor))
+        {
+            AddActor(Actor);
+        }
+    }
+}
+
+void UUikaActorIndexSubsystem::HandleLevelRemoved(ULevel* Level, UWorld* World)
+{
+    if (!Level || World != GetWorld()) return;
+    for (AActor* Actor : Level->Actors)
+    {
+        if (Actor)
+        {
+            RemoveActor(Actor);
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Index maintenance
+// ---------------------------------------------------------------------------
+
+void UUikaActorIndexSubsystem::AddActor(AActor* Actor)
+{
+    for (auto It = Buckets.CreateIterator(); It; ++It)
+    {
+        UClass* Class = It.Value().Class.Get();
+        if (!Class)
+        {
+            It.RemoveCurrent();
+            continue;
+        }
+        if (Actor->IsA(Class))
+        {
+            BucketAdd(It.Value(), Actor);
+        }
+    }
+    RecordChange(Actor, true);
+}
+
+void UUikaActorIndexSubsystem::RemoveActor(AActor* Actor)
+{
+    for (auto& Pair : Buckets)
+    {
+        BucketRemove(Pair.Value, Actor);
+    }
+    RecordChange(Actor, false);
+}
+
+void UUikaActorIndexSubsystem::RecordChange(AActor* Actor, bool bAdded)
+{
+    Changes.Add(FChange{ ++Generation, Actor, Actor->GetClass(), bAdded });
+
+    if (Changes.Num() >= 2 * UikaActorChangeLogCapacity)
+    {
+        const int32 Trim = Changes.Num() - UikaActorChangeLogCapacity;
+        HistoryFloor = Changes[Trim - 1].Generation;
+        Changes.RemoveAt(0, Trim, EAllowShrinking::No);
+    }
+}
+
+void UUikaActorIndexSubsystem::BucketAdd(FClassBucket& Bucket, AActor* Actor)
+{
+    if (const int32* Slot = Bucket.Slots.Find(Actor))
+    {
+        // Same address: either already indexed, or a stale entry whose memory
+        // was reused by a new actor. Either way the slot now tracks Actor.
+        Bucket.Entries[*Slot].Weak = Actor;
+        return;
+    }
+    Bucket.Slots.Add(Actor, Bucket.Entries.Add(FEntry{ Actor, Actor }));
+}
+
+void UUikaActorIndexSubsystem::BucketRemove(FClassBucket& Bucket, AActor* Actor)
+{
+    if (const int32* Slot = Bucket.Slots.Find(Actor))
+    {
+        BucketRemoveAt(Bucket, *Slot);
+    }
+}
+
+void UUikaActorIndexSubsystem::BucketRemoveAt(FClassBucket& Bucket, int32 Slot)
+{
+    Bucket.Slots.Remove(Bucket.Entries[Slot].Actor);
+    const int32 Last = Bucket.Entries.Num() - 1;
+    if (Slot != Last)
+    {
+        Bucket.Entries[Slot] = Bucket.Entries[Last];
+        Bucket.Slots[Bucket.Entries[Slot].Actor] = Slot;
+    }
+    Bucket.Entries.RemoveAt(Last, 1, EAllowShrinking::No);
+}
@@ -0,0 +1,180 @@
+#include "UikaActorPoolSubsystem.h"
+#include "UikaApiTable.h"
+#include "UikaTrace.h"
+#include "UUikaReifiedClass.h"
+
+#include "Components/ActorComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+extern const FUikaRustCallbacks* GetUikaRustCallbacks();
+
+// Tell Rust a reified actor entered or left the pool. Blueprint children of a
+// reified class are handled by walking up to the reified ancestor.
+static void NotifyRustPoolTransition(AActor* Actor, bool bAcquire)
+{
+    const FUikaRustCallbacks* Callbacks = GetUikaRustCallbacks();
+    if (!Callbacks) return;
+
+    for (UClass* Cls = Actor->GetClass(); Cls; Cls = Cls->GetSuperClass())
+    {
+        if (UUikaReifiedClass* ReifiedClass = Cast<UUikaReifiedClass>(Cls))
+        {
+            auto Fn = bAcquire ? Callbacks->on_pool_acquire : Callbacks->on_pool_release;
+            if (Fn)
+            {
+                UIKA_TRACE_SCOPE(Uika_PoolTransition);
+                Fn(UikaUObjectHandle{ Actor }, ReifiedClass->RustTypeId);
+            }
+            return;
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Lifecycle
+// ---------------------------------------------------------------------------
+
+void UUikaActorPoolSubsystem::Deinitialize()
+{
+    // Pooled actors belong to the world's levels and go down with them.
+    FreeLists.Empty();
+    Pooled.Empty();
+    Super::Deinitialize();
+}
+
+// ---------------------------------------------------------------------------
+// Activation
+// ---------------------------------------------------------------------------
+
+void UUikaActorPoolSubsystem::Deactivate(AActor* Actor)
+{
+    Actor->SetActorHiddenInGame(true);
+    Actor->SetActorEnableCollision(false);
+    Actor->SetActorTickEnabled(false);
+    Actor->ForEachComponent(false, [](UActorComponent* Component)
+    {
+        Component->SetComponentTickEnabled(false);
+    });
+
+    if (UPrimitiveComponent* Root = Cast<UPrimitiveComponent>(Actor->GetRootComponent()))
+    {
+        if (Root->IsSimulatingPhysics())
+        {
+            Root->SetPhysicsLinearVelocity(FVector::ZeroVector);
+            Root->SetPhysicsAngularVelocityInRadians(FVector::ZeroVector);
+        }
+    }
+}
+
+// Visibility, collision and ticking go back to the class defaults rather than
+// unconditionally on, so actors that start hidden or tick-less stay that way.
+void UUikaActorPoolSubsystem::Activate(AActor* Actor, const FTransform& Transform)
+{
+    const AActor* Defaults = Actor->GetClass()->GetDefaultObject<AActor>();
+
+    Actor->SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+    Actor->SetActorHiddenInGame(Defaults->IsHidden());
+    Actor->SetActorEnableCollision(Defaults->GetActorEnableCollision());
+    Actor->SetActorTickEnabled(Actor->PrimaryActorTick.bStartWithTickEnabled);
+    Actor->ForEachComponent(false, [](UActorComponent* Component)
+    {
+        Component->SetComponentTickEnabled(Component->PrimaryComponentTick.bStartWithTickEnabled);
+    });
+}
+
+AActor* UUikaActorPoolSubsystem::SpawnPooled(UClass* Class, const FTransform& Transform)
+{
+    FActorSpawnParameters Params;
+    Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    return GetWorld()->SpawnActor(Class, &Transform, Params);
+}
+
+// ---------------------------------------------------------------------------
+// Pool operations
+// ---------------------------------------------------------------------------
+
+int32 UUikaActorPoolSubsystem::Prewarm(UClass* Class, int32 Count)
+{
+    TArray<TWeakObjectPtr<AActor>>& Free = FreeLists.FindOrAdd(Class);
+    Free.Reserve(Free.Num() + Count);
+
+    int32 Spawned = 0;
+    for (int32 i = 0; i < Count; ++i)
+    {
+        AActor* Actor = SpawnPooled(Class, FTransform::Identity);
+        if (!Actor) break;
+        Deactivate(Actor);
+        NotifyRustPoolTransition(Actor, false);
+        Free.Add(Actor);
+        Pooled.Add(Actor);
+        ++Spawned;
+    }
+    return Spawned;
+}
+
+AActor* UUikaActorPoolSubsystem::Acquire(UClass* Class, const FTransform& Transform, bool& bOutReused)
+{
+    bOutReused = false;
+    if (TArray<TWeakObjectPtr<AActor>>* Free = FreeLists.Find(Class))
+    {
+        // Entries destroyed while parked (level teardown, explicit Destroy)
+        // are simply skipped.
+        while (Free->Num() > 0)
+        {
+            AActor* Actor = Free->Pop(EAllowShrinking::No).Get();
+            if (!IsValid(Actor)) continue;
+
+            Pooled.Remove(Actor);
+            Activate(Actor, Transform);
+            NotifyRustPoolTransition(Actor, true);
+            bOutReused = true;
+            return Actor;
+        }
+    }
+
+    // A fresh actor was never released, so it has no pool transition to
+    // report: its Rust instance was just constructed.
+    return SpawnPooled(Class, Transform);
+}
+
+bool UUikaActorPoolSubsystem::Release(AActor* Actor)
+{
+    if (!IsValid(Actor) || Actor->IsActorBeingDestroyed() || Pooled.Contains(Actor))
+    {
+        return false;
+    }
+
+    Deactivate(Actor);
+    NotifyRustPoolTransition(Actor, false);
+    FreeLists.FindOrAdd(Actor->GetClass()).Add(Actor);
+    Pooled.Add(Actor);
+    return true;
+}
+
+int32 UUikaActorPoolSubsystem::Clear(UClass* Class)
+{
+    int32 Destroyed = 0;
+    for (auto It = FreeLists.CreateIterator(); It; ++It)
+    {
+        if (Class && It.Key() != TObjectKey<UClass>(Class)) continue;
+
+        for (const TWeakObjectPtr<AActor>& Weak : It.Value())
+        {
+            if (AActor* Actor = Weak.Get())
+            {
+                Pooled.Remove(Actor);
+                if (Actor->Destroy()) ++Destroyed;
+            }
+        }
+        It.RemoveCurrent();
+    }
+    return Destroyed;
+}
+
+int32 UUikaActorPoolSubsystem::NumFree(UClass* Class) const
+{
+    const TArray<TWeakObjectPtr<AActor>>* Free = FreeLists.Find(Class);
+    return Free ? Free->Num() : 0;
+}
@@ -0,0 +1,220 @@
+// UikaClassTick.cpp — class-level tick for reified actor classes.
+//
+// A class opted in through FUikaReifyApi::enable_class_tick gets one
+// FTickFunction per game world instead of one per actor. Each tick gathers
+// the class's live instances that are due and hands them to Rust in a single
+// FUikaRustCallbacks::tick_class call, together with each instance's Rust
+// data pointer from its slot, so a crowd of N actors costs one crossing per
+// frame rather than N ProcessEvent dispatches.
+
+#include "UikaApiTable.h"
+#include "UUikaReifiedClass.h"
+#include "UikaActorPoolSubsystem.h"
+#include "UikaModule.h"
+#include "UikaTrace.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "Engine/EngineBaseTypes.h"
+#include "GameFramework/Actor.h"
+#include "UObject/UObjectIterator.h"
+
+extern const FUikaRustCallbacks* GetUikaRustCallbacks();
+
+namespace
+{
+    struct FUikaClassTickFunction : public FTickFunction
+    {
+        TWeakObjectPtr<UUikaReifiedClass> Class;
+        UWorld* World = nullptr;
+
+        // Scratch reused across frames.
+        TArray<UObject*> Instances;
+        TArray<FUikaTickInstance> Batch;
+
+        virtual void ExecuteTick(float DeltaTime, ELevelTick TickType,
+            ENamedThreads::Type CurrentThread,
+            const FGraphEventRef& MyCompletionGraphEvent) override;
+
+        virtual FString DiagnosticMessage() override
+        {
+            return FString::Printf(TEXT("UikaClassTick[%s]"),
+                Class.IsValid() ? *Class->GetName() : TEXT("<dead>"));
+        }
+
+        virtual FName DiagnosticContext(bool bDetailed) override
+        {
+            return Class.IsValid() ? Class->GetFName() : NAME_None;
+        }
+    };
+
+    struct FUikaClassTickEntry
+    {
+        TWeakObjectPtr<UUikaReifiedClass> Class;
+        ETickingGroup TickGroup = TG_PrePhysics;
+    };
+
+    // Opted-in classes, and their tick functions per world.
+    TArray<FUikaClassTickEntry> GTickClasses;
+    TMap<UWorld*, TArray<TUniquePtr<FUikaClassTickFunction>>> GWorldTicks;
+
+    FDelegateHandle GWorldInitHandle;
+    FDelegateHandle GWorldCleanupHandle;
+}
+
+void FUikaClassTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType,
+    ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+    UUikaReifiedClass* ReifiedClass = Class.Get();
+    const FUikaRustCallbacks* Callbacks = GetUikaRustCallbacks();
+    if (!ReifiedClass || !Callbacks || !Callbacks->tick_class || TickType == LEVELTICK_ViewportsOnly)
+    {
+        return;
+    }
+
+    UIKA_TRACE_SCOPE(Uika_ClassTick);
+
+    const UUikaActorPoolSubsystem* Pool = World->GetSubsystem<UUikaActorPoolSubsystem>();
+    Instances.Reset();
+    Batch.Reset();
+    ReifiedClass->GetLiveInstances(Instances);
+    for (UObject* Obj : Instances)
+    {
+        AActor* Actor = Cast<AActor>(Obj);
+        if (!IsValid(Actor) || Actor->GetWorld() != World
+            || !Actor->HasActorBegunPlay() || Actor->IsActorBeingDestroyed()
+            || (Pool && Pool->IsPooled(Actor)))
+        {
+            continue;
+        }
+        if (void* Data = ReifiedClass->GetRustData(Actor))
+        {
+            Batch.Add(FUikaTickInstance{ UikaUObjectHandle{ Actor }, Data });
+        }
+    }
+
+    if (Batch.Num() > 0)
+    {
+        Callbacks->tick_class(ReifiedClass->RustTypeId, Batch.GetData(),
+            static_cast<uint32>(Batch.Num()), DeltaTime);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Registration
+// ---------------------------------------------------------------------------
+
+static bool IsClassTickWorld(const UWorld* World)
+{
+    return World && World->IsGameWorld() && World->PersistentLevel;
+}
+
+static void RegisterClassTick(UWorld* World, const FUikaClassTickEntry& Entry)
+{
+    TArray<TUniquePtr<FUikaClassTickFunction>>& Ticks = GWorldTicks.FindOrAdd(World);
+    for (TUniquePtr<FUikaClassTickFunction>& Existing : Ticks)
+    {
+        if (Existing->Class == Entry.Class)
+        {
+            // Re-enabled (hot reload or a new group): re-register in place.
+            Existing->UnRegisterTickFunction();
+            Existing->TickGroup = Entry.TickGroup;
+            Existing->RegisterTickFunction(World->PersistentLevel);
+            return;
+        }
+    }
+
+    TUniquePtr<FUikaClassTickFunction> Tick = MakeUnique<FUikaClassTickFunction>();
+    Tick->Class = Entry.Class;
+    Tick->World = World;
+    Tick->TickGroup = Entry.TickGroup;
+    Tick->bCanEverTick = true;
+    Tick->bStartWithTickEnabled = true;
+    Tick->bTickEvenWhenPaused = false;
+    Tick->RegisterTickFunction(World->PersistentLevel);
+    Ticks.Add(MoveTemp(Tick));
+}
+
+static void UnregisterWorldTicks(UWorld* World)
+{
+    if (TArray<TUniquePtr<FUikaClassTickFunction>>* Ticks = GWorldTicks.Find(World))
+    {
+        for (TUniquePtr<FUikaClassTickFunction>& Tick : *Ticks)
+        {
+            Tick->UnRegisterTickFunction();
+        }
+        GWorldTicks.Remove(World);
+    }
+}
+
+static void OnPostWorldInitialization(UWorld* World, const UWorld::InitializationValues)
+{
+    if (!IsClassTickWorld(World))
+    {
+        return;
+    }
+    for (const FUikaClassTickEntry& Entry : GTickClasses)
+    {
+        if (Entry.Class.IsValid())
+        {
+            RegisterClassTick(World, Entry);
+        }
+    }
+}
+
+static void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+    UnregisterWorldTicks(World);
+}
+
+EUikaErrorCode UikaClassTickEnable(UUikaReifiedClass* Class, uint32 TickGroup)
+{
+    if (!Class || !Class->IsChildOf(AActor::StaticClass()))
+    {
+        return EUikaErrorCode::InvalidCast;
+    }
+    if (TickGroup >= TG_MAX)
+    {
+        return EUikaErrorCode::InvalidOperation;
+    }
+
+    FUikaClassTickEntry* Entry = GTickClasses.FindByPredicate(
+        [Class](const FUikaClassTickEntry& E) { return E.Class == Class; });
+    if (!Entry)
+    {
+        Entry = &GTickClasses.AddDefaulted_GetRef();
+        Entry->Class = Class;
+    }
+    Entry->TickGroup = static_cast<ETickingGroup>(TickGroup);
+
+    // Worlds already running (a class registered by a hot-reloaded DLL).
+    for (TObjectIterator<UWorld> It; It; ++It)
+    {
+        if (IsClassTickWorld(*It) && It->bIsWorldInitialized)
+        {
+            RegisterClassTick(*It, *Entry);
+        }
+    }
+    return EUikaErrorCode::Ok;
+}
+
+void UikaClassTickRegisterHooks()
+{
+    GWorldInitHandle = FWorldDelegates::OnPostWorldInitialization.AddStatic(&OnPostWorldInitialization);
+    GWorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddStatic(&OnWorldCleanup);
+}
+
+void UikaClassTickUnregisterHooks()
+{
+    FWorldDelegates::OnPostWorldInitialization.Remove(GWorldInitHandle);
+    FWorldDelegates::OnWorldCleanup.Remove(GWorldCleanupHandle);
+    GWorldInitHandle.Reset();
+    GWorldCleanupHandle.Reset();
+
+    TArray<UWorld*> Worlds;
+    GWorldTicks.GetKeys(Worlds);
+    for (UWorld* World : Worlds)
+    {
+        UnregisterWorldTicks(World);
+    }
+    GTickClasses.Reset();
+}
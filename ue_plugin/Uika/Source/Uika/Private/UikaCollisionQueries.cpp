@@ -0,0 +1,347 @@
+// UikaCollisionQueries.cpp — batched line / sweep / overlap queries for Rust.
+//
+// trace_batch runs every request in one tight loop on the game thread.
+// trace_batch_async submits them as UWorld async traces; the physics work
+// runs on task threads after the frame, and the results are collected during
+// the next world tick (the only frame in which UWorld keeps them queryable),
+// compacted into FUikaTraceHit and handed to Rust in one callback.
+
+#include "UikaApiTable.h"
+#include "UikaModule.h"
+#include "UikaTrace.h"
+#include "Algo/AnyOf.h"
+#include "CollisionQueryParams.h"
+#include "CollisionShape.h"
+#include "Engine/EngineTypes.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "WorldCollision.h"
+
+extern const FUikaRustCallbacks* GetUikaRustCallbacks();
+
+namespace
+{
+    struct FUikaTraceBatch
+    {
+        UWorld* World = nullptr;
+        uint64 CallbackId = 0;
+        // GFrameCounter at submission; collected on a later world tick.
+        uint64 SubmitFrame = 0;
+        TArray<FUikaTraceRequest> Requests;
+        TArray<FTraceHandle> Handles;
+    };
+
+    TMap<uint64, FUikaTraceBatch> GTraceBatches;
+    uint64 GNextTraceBatchId = 1;
+
+    // Reused across collections so steady-state batches allocate nothing.
+    TArray<FUikaTraceHit> GTraceHits;
+    FTraceDatum GTraceDatum;
+    FOverlapDatum GOverlapDatum;
+    TArray<FOverlapResult> GOverlaps;
+
+    FDelegateHandle GTracePostActorTickHandle;
+    FDelegateHandle GTraceWorldCleanupHandle;
+}
+
+// ---------------------------------------------------------------------------
+// Helpers
+// ---------------------------------------------------------------------------
+
+static FVector ToFVector(const FUikaVector& V)
+{
+    return FVector(V.x, V.y, V.z);
+}
+
+static FUikaVector ToUikaVector(const FVector& V)
+{
+    return FUikaVector{ V.X, V.Y, V.Z, 0.0 };
+}
+
+static EUikaErrorCode ValidateRequests(const FUikaTraceRequest* Requests, uint32 Count)
+{
+    for (uint32 i = 0; i < Count; ++i)
+    {
+        if (Requests[i].kind > UIKA_TRACE_OVERLAP_SPHERE || Requests[i].channel >= ECC_MAX)
+        {
+            return EUikaErrorCode::InvalidOperation;
+        }
+    }
+    return EUikaErrorCode::Ok;
+}
+
+// Reuse one FCollisionQueryParams for a whole batch.
+static void SetupQueryParams(FCollisionQueryParams& Params, const FUikaTraceRequest& Request)
+{
+    Params.bTraceComplex = (Request.flags & UIKA_TRACE_COMPLEX) != 0;
+    Params.ClearIgnoredActors();
+    if (const AActor* Ignore = Cast<AActor>(static_cast<UObject*>(Request.ignore.ptr)))
+    {
+        Params.AddIgnoredActor(Ignore);
+    }
+}
+
+static void WriteHit(const FHitResult* Hit, FUikaTraceHit& Out)
+{
+    Out = FUikaTraceHit{};
+    if (!Hit)
+    {
+        return;
+    }
+    Out.location = ToUikaVector(Hit->ImpactPoint);
+    Out.normal = ToUikaVector(Hit->ImpactNormal);
+    Out.actor = UikaUObjectHandle{ Hit->GetActor() };
+    Out.component = UikaUObjectHandle{ Hit->GetComponent() };
+    Out.distance = Hit->Distance;
+    Out.time = Hit->Time;
+    Out.count = 1;
+    Out.flags = Hit->bBlockingHit ? UIKA_TRACE_HIT_BLOCKING : 0;
+}
+
+static void WriteOverlaps(const FUikaTraceRequest& Request, const TArray<FOverlapResult>& Overlaps, FUikaTraceHit& Out)
+{
+    Out = FUikaTraceHit{};
+    if (Overlaps.Num() == 0)
+    {
+        return;
+    }
+    const FOverlapResult& First = Overlaps[0];
+    Out.location = Request.start;
+    Out.actor = UikaUObjectHandle{ First.GetActor() };
+    Out.component = UikaUObjectHandle{ First.GetComponent() };
+    Out.count = static_cast<uint32>(Overlaps.Num());
+    Out.flags = Algo::AnyOf(Overlaps, [](const FOverlapResult& O) { return O.bBlockingHit; })
+        ? UIKA_TRACE_HIT_BLOCKING : 0;
+}
+
+// ---------------------------------------------------------------------------
+// Synchronous batches
+// ---------------------------------------------------------------------------
+
+EUikaErrorCode UikaTraceBatch(UikaUObjectHandle WorldHandle, const FUikaTraceRequest* Requests, uint32 Count,
+    FUikaTraceHit* OutHits)
+{
+    UWorld* World = Cast<UWorld>(static_cast<UObject*>(WorldHandle.ptr));
+    if (!World || (Count && (!Requests || !OutHits))) return EUikaErrorCode::NullArgument;
+    const EUikaErrorCode Valid = ValidateRequests(Requests, Count);
+    if (Valid != EUikaErrorCode::Ok) return Valid;
+
+    UIKA_TRACE_SCOPE(Uika_TraceBatch);
+    FCollisionQueryParams Params(SCENE_QUERY_STAT(UikaTraceBatch), false);
+    FHitResult Hit;
+    for (uint32 i = 0; i < Count; ++i)
+    {
+        const FUikaTraceRequest& Request = Requests[i];
+        const ECollisionChannel Channel = static_cast<ECollisionChannel>(Request.channel);
+        SetupQueryParams(Params, Request);
+        switch (Request.kind)
+        {
+        case UIKA_TRACE_LINE:
+        {
+            const bool bHit = World->LineTraceSingleByChannel(
+                Hit, ToFVector(Request.start), ToFVector(Request.end), Channel, Params);
+            WriteHit(bHit ? &Hit : nullptr, OutHits[i]);
+            break;
+        }
+        case UIKA_TRACE_SWEEP_SPHERE:
+        {
+            const bool bHit = World->SweepSingleByChannel(
+                Hit, ToFVector(Request.start), ToFVector(Request.end), FQuat::Identity, Channel,
+                FCollisionShape::MakeSphere(Request.radius), Params);
+            WriteHit(bHit ? &Hit : nullptr, OutHits[i]);
+            break;
+        }
+        default:
+        {
+            GOverlaps.Reset();
+            World->OverlapMultiByChannel(
+                GOverlaps, ToFVector(Request.start), FQuat::Identity, Channel,
+                FCollisionShape::MakeSphere(Request.radius), Params);
+            WriteOverlaps(Request, GOverlaps, OutHits[i]);
+            break;
+        }
+        }
+    }
+    return EUikaErrorCode::Ok;
+}
+
+// ---------------------------------------------------------------------------
+// Asynchronous batches
+// ---------------------------------------------------------------------------
+
+static void DeliverTraceBatch(uint64 BatchId, uint64 CallbackId, uint32 Status)
+{
+    const FUikaRustCallbacks* Callbacks = GetUikaRustCallbacks();
+    if (Callbacks && Callbacks->invoke_delegate_callback)
+    {
+        UIKA_TRACE_SCOPE(Uika_TraceBatchCallback);
+        const bool bOk = Status == UIKA_TRACE_BATCH_OK;
+        FUikaTraceBatchResult Result{
+            BatchId,
+            bOk ? GTraceHits.GetData() : nullptr,
+            bOk ? static_cast<uint32>(GTraceHits.Num()) : 0u,
+            Status };
+        Callbacks->invoke_delegate_callback(CallbackId, reinterpret_cast<uint8*>(&Result));
+    }
+}
+
+EUikaErrorCode UikaTraceBatchAsync(UikaUObjectHandle WorldHandle, const FUikaTraceRequest* Requests, uint32 Count,
+    uint64 CallbackId, uint64* OutBatch)
+{
+    UWorld* World = Cast<UWorld>(static_cast<UObject*>(WorldHandle.ptr));
+    if (!World || !OutBatch || (Count && !Requests)) return EUikaErrorCode::NullArgument;
+    *OutBatch = 0;
+    const EUikaErrorCode Valid = ValidateRequests(Requests, Count);
+    if (Valid != EUikaErrorCode::Ok) return Valid;
+
+    UIKA_TRACE_SCOPE(Uika_TraceBatchSubmit);
+    const uint64 BatchId = GNextTraceBatchId++;
+    FUikaTraceBatch& Batch = GTraceBatches.Add(BatchId);
+    Batch.World = World;
+    Batch.CallbackId = CallbackId;
+    Batch.SubmitFrame = GFrameCounter;
+    Batch.Requests.Append(Requests, Count);
+    Batch.Handles.Reserve(Count);
+
+    FCollisionQueryParams Params(SCENE_QUERY_STAT(UikaTraceBatchAsync), false);
+    const FCollisionResponseParams& Response = FCollisionResponseParams::DefaultResponseParam;
+    for (uint32 i = 0; i < Count; ++i)
+    {
+        const FUikaTraceRequest& Request = Requests[i];
+        const ECollisionChannel Channel = static_cast<ECollisionChannel>(Request.channel);
+        SetupQueryParams(Params, Request);
+        switch (Request.kind)
+        {
+        case UIKA_TRACE_LINE:
+            Batch.Handles.Add(World->AsyncLineTraceByChannel(EAsyncTraceType::Single,
+                ToFVector(Request.start), ToFVector(Request.end), Channel, Params, Response, nullptr, i));
+            break;
+        case UIKA_TRACE_SWEEP_SPHERE:
+            Batch.Handles.Add(World->AsyncSweepByChannel(EAsyncTraceType::Single,
+                ToFVector(Request.start), ToFVector(Request.end), FQuat::Identity, Channel,
+                FCollisionShape::MakeSphere(Request.radius), Params, Response, nullptr, i));
+            break;
+        default:
+            Batch.Handles.Add(World->AsyncOverlapByChannel(
+                ToFVector(Request.start), FQuat::Identity, Channel,
+                FCollisionShape::MakeSphere(Request.radius), Params, Response, nullptr, i));
+            break;
+        }
+    }
+
+    *OutBatch = BatchId;
+    return EUikaErrorCode::Ok;
+}
+
+static void CollectTraceBatch(const FUikaTraceBatch& Batch)
+{
+    UWorld* World = Batch.World;
+    GTraceHits.SetNumUninitialized(Batch.Requests.Num(), EAllowShrinking::No);
+    for (int32 i = 0; i < Batch.Requests.Num(); ++i)
+    {
+        const FUikaTraceRequest& Request = Batch.Requests[i];
+        FUikaTraceHit& Out = GTraceHits[i];
+        if (Request.kind == UIKA_TRACE_OVERLAP_SPHERE)
+        {
+            // Copy-assign into the reused datum keeps its array capacity.
+            if (World->QueryOverlapData(Batch.Handles[i], GOverlapDatum))
+            {
+                WriteOverlaps(Request, GOverlapDatum.OutOverlaps, Out);
+            }
+            else
+            {
+                Out = FUikaTraceHit{};
+            }
+        }
+        else
+        {
+            const bool bHave = World->QueryTraceData(Batch.Handles[i], GTraceDatum);
+            WriteHit(bHave && GTraceDatum.OutHits.Num() > 0 ? &GTraceDatum.OutHits[0] : nullptr, Out);
+        }
+    }
+}
+
+// UWorld resets its async trace buffers at the start of each tick, making the
+// previous frame's results queryable for exactly this tick.
+static void OnTracePostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+    if (GTraceBatches.Num() == 0)
+    {
+        return;
+    }
+    UIKA_TRACE_SCOPE(Uika_TraceBatchCollect);
+    TArray<uint64, TInlineAllocator<16>> Ready;
+    for (const TPair<uint64, FUikaTraceBatch>& Pair : GTraceBatches)
+    {
+        if (Pair.Value.World == World && Pair.Value.SubmitFrame < GFrameCounter)
+        {
+            Ready.Add(Pair.Key);
+        }
+    }
+    Ready.Sort();
+    for (const uint64 BatchId : Ready)
+    {
+        // Remove before the callback: it may submit or cancel batches.
+        FUikaTraceBatch Batch;
+        if (!GTraceBatches.RemoveAndCopyValue(BatchId, Batch))
+        {
+            continue;
+        }
+        CollectTraceBatch(Batch);
+        DeliverTraceBatch(BatchId, Batch.CallbackId, UIKA_TRACE_BATCH_OK);
+    }
+}
+
+// Cancel a pending batch. Its callback still fires, synchronously, with
+// UIKA_TRACE_BATCH_CANCELLED so the Rust side can release its state.
+EUikaErrorCode UikaCancelTraceBatch(uint64 BatchId)
+{
+    FUikaTraceBatch Batch;
+    if (!GTraceBatches.RemoveAndCopyValue(BatchId, Batch))
+    {
+        return EUikaErrorCode::InvalidOperation;
+    }
+    DeliverTraceBatch(BatchId, Batch.CallbackId, UIKA_TRACE_BATCH_CANCELLED);
+    return EUikaErrorCode::Ok;
+}
+
+static void OnTraceWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+    TArray<uint64> Dead;
+    for (const TPair<uint64, FUikaTraceBatch>& Pair : GTraceBatches)
+    {
+        if (Pair.Value.World == World)
+        {
+            Dead.Add(Pair.Key);
+        }
+    }
+    for (const uint64 BatchId : Dead)
+    {
+        UikaCancelTraceBatch(BatchId);
+    }
+}
+
+// Drop every pending batch without calling back: the callback ids belong to
+// the Rust DLL being unloaded.
+void UikaTraceBatchCancelAll()
+{
+    GTraceBatches.Reset();
+}
+
+void UikaTraceBatchRegisterHooks()
+{
+    GTracePostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddStatic(&OnTracePostActorTick);
+    GTraceWorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddStatic(&OnTraceWorldCleanup);
+}
+
+void UikaTraceBatchUnregisterHooks()
+{
+    FWorldDelegates::OnWorldPostActorTick.Remove(GTracePostActorTickHandle);
+    FWorldDelegates::OnWorldCleanup.Remove(GTraceWorldCleanupHandle);
+    GTracePostActorTickHandle.Reset();
+    GTraceWorldCleanupHandle.Reset();
+    UikaTraceBatchCancelAll();
+    GTraceHits.Empty();
+    GOverlaps.Empty();
+}
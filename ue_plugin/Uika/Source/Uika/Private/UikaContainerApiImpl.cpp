@@ -5,6 +5,9 @@
 #include "UikaApiTable.h"
 #include "UObject/UnrealType.h"
 #include "UObject/UObjectGlobals.h"
+#include "GameFramework/Actor.h"
+#include "Components/SceneComponent.h"
+#include "Algo/StableSort.h"
 
 // ---------------------------------------------------------------------------
 // Validity macro (same as PropertyApiImpl)
@@ -30,12 +33,23 @@
 // Raw-copyable check: types where TArray memory can be memcpy'd directly
 // ---------------------------------------------------------------------------
 
+// Structs qualify when STRUCT_IsPlainOldData is set (FVector, FRotator,
+// FLinearColor, ...): their ICppStructOps reports a trivially copyable type,
+// so CopyScriptStruct would be a memcpy anyway.
+static bool IsPodStructProperty(const FStructProperty* StructProp)
+{
+    return StructProp->Struct && (StructProp->Struct->StructFlags & STRUCT_IsPlainOldData);
+}
+
 static bool IsRawCopyableElement(FProperty* InnerProp)
 {
+    if (const FStructProperty* StructProp = CastField<FStructProperty>(InnerProp))
+    {
+        return IsPodStructProperty(StructProp);
+    }
     return !CastField<FStrProperty>(InnerProp)
         && !CastField<FTextProperty>(InnerProp)
-        && !CastField<FObjectPropertyBase>(InnerProp)
-        && !CastField<FStructProperty>(InnerProp);
+        && !CastField<FObjectPropertyBase>(InnerProp);
 }
 
 // ---------------------------------------------------------------------------
@@ -76,7 +90,14 @@ static void ReadElement(FProperty* InnerProp, const void* ElemPtr,
     }
     else if (FStructProperty* StructProp = CastField<FStructProperty>(InnerProp))
     {
-        StructProp->Struct->CopyScriptStruct(OutBuf, ElemPtr);
+        if (IsPodStructProperty(StructProp))
+        {
+            FMemory::Memcpy(OutBuf, ElemPtr, StructProp->GetSize());
+        }
+        else
+        {
+            StructProp->Struct->CopyScriptStruct(OutBuf, ElemPtr);
+        }
         if (OutWritten) *OutWritten = StructProp->GetSize();
     }
     else
@@ -116,7 +137,14 @@ static void WriteElement(FProperty* InnerProp, void* ElemPtr,
     }
     else if (FStructProperty* StructProp = CastField<FStructProperty>(InnerProp))
     {
-        StructProp->Struct->CopyScriptStruct(ElemPtr, InBuf);
+        if (IsPodStructProperty(StructProp))
+        {
+            FMemory::Memcpy(ElemPtr, InBuf, StructProp->GetSize());
+        }
+        else
+        {
+            StructProp->Struct->CopyScriptStruct(ElemPtr, InBuf);
+        }
     }
     else
     {
@@ -126,6 +154,54 @@ static void WriteElement(FProperty* InnerProp, void* ElemPtr,
     }
 }
 
+// ---------------------------------------------------------------------------
+// Framed element helpers (bulk and chunked copies)
+// ---------------------------------------------------------------------------
+
+// Exact number of bytes ReadElement writes for one element, computed without
+// converting or copying (strings only measure their UTF-8 length).
+static uint32 ElementReadSize(FProperty* InnerProp, const void* ElemPtr)
+{
+    if (FStrProperty* StrProp = CastField<FStrProperty>(InnerProp))
+    {
+        const FString& Str = StrProp->GetPropertyValue(ElemPtr);
+        return sizeof(uint32) + FPlatformString::ConvertedLength<UTF8CHAR>(*Str, Str.Len());
+    }
+    if (FTextProperty* TextProp = CastField<FTextProperty>(InnerProp))
+    {
+        const FString& Str = TextProp->GetPropertyValue(ElemPtr).ToString();
+        return sizeof(uint32) + FPlatformString::ConvertedLength<UTF8CHAR>(*Str, Str.Len());
+    }
+    if (CastField<FObjectPropertyBase>(InnerProp))
+    {
+        return sizeof(void*);
+    }
+    return InnerProp->GetSize();
+}
+
+// Size of one [u32 written][data] frame.
+static uint64 FramedElementSize(FProperty* InnerProp, const void* ElemPtr)
+{
+    return sizeof(uint32) + ElementReadSize(InnerProp, ElemPtr);
+}
+
+// Append one [u32 written][data] frame at Offset. Callers check the space
+// with FramedElementSize first, so the element is never truncated.
+static void WriteFramedElement(FProperty* InnerProp, const void* ElemPtr,
+                               uint8* OutBuf, uint32 DataSize, uint32& Offset)
+{
+    uint32 Written = 0;
+    ReadElement(InnerProp, ElemPtr, OutBuf + Offset + sizeof(uint32), DataSize, &Written);
+    FMemory::Memcpy(OutBuf + Offset, &Written, sizeof(uint32));
+    Offset += sizeof(uint32) + Written;
+}
+
+// Clamp a computed size into the u32 the FFI reports.
+static uint32 ClampCopySize(uint64 Size)
+{
+    return static_cast<uint32>(FMath::Min<uint64>(Size, MAX_uint32));
+}
+
 // ---------------------------------------------------------------------------
 // Helper to get inner property from container property types
 // ---------------------------------------------------------------------------
@@ -514,12 +590,109 @@ static EUikaErrorCode SetGetElementImpl(UikaUObjectHandle Obj, UikaFPropertyHand
     return EUikaErrorCode::IndexOutOfRange;
 }
 
+// ---------------------------------------------------------------------------
+// Cursor iteration (TMap / TSet)
+// ---------------------------------------------------------------------------
+// A cursor is the internal sparse index of the next entry. Advancing scans
+// forward from the current slot, so a full pass is O(MaxIndex) in total
+// instead of O(n) per element as with the logical-index getters.
+
+// First valid sparse index at or after Start, or INDEX_NONE.
+template <typename HelperType>
+static int32 NextValidIndex(const HelperType& Helper, int32 Start)
+{
+    const int32 MaxIndex = Helper.GetMaxIndex();
+    for (int32 i = Start; i < MaxIndex; ++i)
+    {
+        if (Helper.IsValidIndex(i))
+        {
+            return i;
+        }
+    }
+    return INDEX_NONE;
+}
+
+static int32 MapIterBeginImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop)
+{
+    UIKA_CHECK_VALID_I32(Obj);
+    FMapProperty* MapProp = CastField<FMapProperty>(static_cast<FProperty*>(Prop.ptr));
+    if (!MapProp) return INDEX_NONE;
+
+    FScriptMapHelper Helper(MapProp, MapProp->ContainerPtrToValuePtr<void>(Object));
+    return NextValidIndex(Helper, 0);
+}
+
+static EUikaErrorCode MapIterNextImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop,
+                                       int32* Cursor,
+                                       uint8* OutKeyBuf, uint32 KeyBufSize, uint32* OutKeyWritten,
+                                       uint8* OutValBuf, uint32 ValBufSize, uint32* OutValWritten)
+{
+    UIKA_CHECK_VALID(Obj);
+    if (!Cursor) return EUikaErrorCode::NullArgument;
+    FMapProperty* MapProp = CastField<FMapProperty>(static_cast<FProperty*>(Prop.ptr));
+    if (!MapProp) return EUikaErrorCode::TypeMismatch;
+
+    FScriptMapHelper Helper(MapProp, MapProp->ContainerPtrToValuePtr<void>(Object));
+    const int32 Index = *Cursor;
+    if (Index < 0 || !Helper.IsValidIndex(Index))
+    {
+        return EUikaErrorCode::IndexOutOfRange;
+    }
+
+    ReadElement(MapProp->KeyProp, Helper.GetKeyPtr(Index), OutKeyBuf, KeyBufSize, OutKeyWritten);
+    ReadElement(MapProp->ValueProp, Helper.GetValuePtr(Index), OutValBuf, ValBufSize, OutValWritten);
+    *Cursor = NextValidIndex(Helper, Index + 1);
+    return EUikaErrorCode::Ok;
+}
+
+static int32 SetIterBeginImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop)
+{
+    UIKA_CHECK_VALID_I32(Obj);
+    FSetProperty* SetProp = CastField<FSetProperty>(static_cast<FProperty*>(Prop.ptr));
+    if (!SetProp) return INDEX_NONE;
+
+    FScriptSetHelper Helper(SetProp, SetProp->ContainerPtrToValuePtr<void>(Object));
+    return NextValidIndex(Helper, 0);
+}
+
+static EUikaErrorCode SetIterNextImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop,
+                                       int32* Cursor,
+                                       uint8* OutBuf, uint32 BufSize, uint32* OutWritten)
+{
+    UIKA_CHECK_VALID(Obj);
+    if (!Cursor) return EUikaErrorCode::NullArgument;
+    FSetProperty* SetProp = CastField<FSetProperty>(static_cast<FProperty*>(Prop.ptr));
+    if (!SetProp) return EUikaErrorCode::TypeMismatch;
+
+    FScriptSetHelper Helper(SetProp, SetProp->ContainerPtrToValuePtr<void>(Object));
+    const int32 Index = *Cursor;
+    if (Index < 0 || !Helper.IsValidIndex(Index))
+    {
+        return EUikaErrorCode::IndexOutOfRange;
+    }
+
+    ReadElement(SetProp->ElementProp, Helper.GetElementPtr(Index), OutBuf, BufSize, OutWritten);
+    *Cursor = NextValidIndex(Helper, Index + 1);
+    return EUikaErrorCode::Ok;
+}
+
 // ---------------------------------------------------------------------------
 // Bulk copy/set — single FFI call for entire container
 // ---------------------------------------------------------------------------
 // Format: [u32 written_1][data_1][u32 written_2][data_2]...
 // For maps: [u32 key_written][key_data][u32 val_written][val_data] per pair.
 
+// Exact framed size of array elements [Start, Num).
+static uint64 ArrayFramedSize(FScriptArrayHelper& Helper, FProperty* Inner, int32 Start)
+{
+    uint64 Size = 0;
+    for (int32 i = Start; i < Helper.Num(); ++i)
+    {
+        Size += FramedElementSize(Inner, Helper.GetRawPtr(i));
+    }
+    return Size;
+}
+
 static EUikaErrorCode ArrayCopyAllImpl(
     UikaUObjectHandle Obj, UikaFPropertyHandle Prop,
     uint8* OutBuf, uint32 BufSize, uint32* OutTotalWritten, int32* OutCount)
@@ -553,45 +726,18 @@ static EUikaErrorCode ArrayCopyAllImpl(
         return EUikaErrorCode::Ok;
     }
 
-    // Framed path: [u32 written][data] per element
+    // Framed path: [u32 written][data] per element. On overflow, report the
+    // exact required size (written so far + measured remainder).
     uint32 Offset = 0;
-
     for (int32 i = 0; i < Count; i++)
     {
-        // Check if we have room for at least the length prefix
-        if (Offset + sizeof(uint32) > BufSize)
-        {
-            // Estimate total size needed: extrapolate from what we've written so far
-            if (OutTotalWritten && i > 0)
-            {
-                uint32 AvgPerElem = Offset / i;
-                *OutTotalWritten = AvgPerElem * Count + sizeof(uint32) * Count;
-            }
-            return EUikaErrorCode::BufferTooSmall;
-        }
-
-        uint32 ElemWritten = 0;
-        uint32 Remaining = BufSize - Offset - sizeof(uint32);
-        ReadElement(Inner, Helper.GetRawPtr(i),
-                    OutBuf + Offset + sizeof(uint32), Remaining, &ElemWritten);
-
-        if (Offset + sizeof(uint32) + ElemWritten > BufSize)
+        const uint64 Frame = FramedElementSize(Inner, Helper.GetRawPtr(i));
+        if (Offset + Frame > BufSize)
         {
-            // Element was partially written or didn't fit
-            if (OutTotalWritten && i > 0)
-            {
-                uint32 AvgPerElem = (Offset + sizeof(uint32) + ElemWritten) / (i + 1);
-                *OutTotalWritten = AvgPerElem * Count;
-            }
-            else if (OutTotalWritten)
-            {
-                *OutTotalWritten = (sizeof(uint32) + ElemWritten) * Count;
-            }
+            if (OutTotalWritten) *OutTotalWritten = ClampCopySize(Offset + ArrayFramedSize(Helper, Inner, i));
             return EUikaErrorCode::BufferTooSmall;
         }
-
-        FMemory::Memcpy(OutBuf + Offset, &ElemWritten, sizeof(uint32));
-        Offset += sizeof(uint32) + ElemWritten;
+        WriteFramedElement(Inner, Helper.GetRawPtr(i), OutBuf, static_cast<uint32>(Frame - sizeof(uint32)), Offset);
     }
 
     if (OutTotalWritten) *OutTotalWritten = Offset;
@@ -612,6 +758,7 @@ static EUikaErrorCode ArraySetAllImpl(
     // Fast path: raw memcpy for fixed-size primitive types (negative count = raw format)
     if (Count < 0)
     {
+        if (!IsRawCopyableElement(Inner)) return EUikaErrorCode::TypeMismatch;
         int32 ActualCount = -Count;
         uint32 ElemSize = Inner->GetSize();
         uint32 TotalSize = ActualCount * ElemSize;
@@ -653,6 +800,70 @@ static EUikaErrorCode ArraySetAllImpl(
     return EUikaErrorCode::Ok;
 }
 
+// Exact framed size of valid map pairs at sparse index >= Start.
+static uint64 MapFramedSize(FScriptMapHelper& Helper, FMapProperty* MapProp, int32 Start)
+{
+    uint64 Size = 0;
+    for (int32 i = NextValidIndex(Helper, Start); i != INDEX_NONE; i = NextValidIndex(Helper, i + 1))
+    {
+        Size += FramedElementSize(MapProp->KeyProp, Helper.GetKeyPtr(i))
+              + FramedElementSize(MapProp->ValueProp, Helper.GetValuePtr(i));
+    }
+    return Size;
+}
+
+// Exact framed size of valid set elements at sparse index >= Start.
+static uint64 SetFramedSize(FScriptSetHelper& Helper, FSetProperty* SetProp, int32 Start)
+{
+    uint64 Size = 0;
+    for (int32 i = NextValidIndex(Helper, Start); i != INDEX_NONE; i = NextValidIndex(Helper, i + 1))
+    {
+        Size += FramedElementSize(SetProp->ElementProp, Helper.GetElementPtr(i));
+    }
+    return Size;
+}
+
+// Write framed map pairs from sparse index Start while whole pairs fit.
+// Returns the sparse index of the first pair not written (INDEX_NONE = done).
+static int32 WriteMapPairs(FScriptMapHelper& Helper, FMapProperty* MapProp, int32 Start,
+                           uint8* OutBuf, uint32 BufSize, uint32& Offset, int32& OutWrittenCount)
+{
+    OutWrittenCount = 0;
+    int32 i = NextValidIndex(Helper, Start);
+    for (; i != INDEX_NONE; i = NextValidIndex(Helper, i + 1))
+    {
+        const uint64 KeyFrame = FramedElementSize(MapProp->KeyProp, Helper.GetKeyPtr(i));
+        const uint64 ValFrame = FramedElementSize(MapProp->ValueProp, Helper.GetValuePtr(i));
+        if (Offset + KeyFrame + ValFrame > BufSize)
+        {
+            break;
+        }
+        WriteFramedElement(MapProp->KeyProp, Helper.GetKeyPtr(i), OutBuf, static_cast<uint32>(KeyFrame - sizeof(uint32)), Offset);
+        WriteFramedElement(MapProp->ValueProp, Helper.GetValuePtr(i), OutBuf, static_cast<uint32>(ValFrame - sizeof(uint32)), Offset);
+        ++OutWrittenCount;
+    }
+    return i;
+}
+
+// Set counterpart of WriteMapPairs.
+static int32 WriteSetElements(FScriptSetHelper& Helper, FSetProperty* SetProp, int32 Start,
+                              uint8* OutBuf, uint32 BufSize, uint32& Offset, int32& OutWrittenCount)
+{
+    OutWrittenCount = 0;
+    int32 i = NextValidIndex(Helper, Start);
+    for (; i != INDEX_NONE; i = NextValidIndex(Helper, i + 1))
+    {
+        const uint64 Frame = FramedElementSize(SetProp->ElementProp, Helper.GetElementPtr(i));
+        if (Offset + Frame > BufSize)
+        {
+            break;
+        }
+        WriteFramedElement(SetProp->ElementProp, Helper.GetElementPtr(i), OutBuf, static_cast<uint32>(Frame - sizeof(uint32)), Offset);
+        ++OutWrittenCount;
+    }
+    return i;
+}
+
 static EUikaErrorCode MapCopyAllImpl(
     UikaUObjectHandle Obj, UikaFPropertyHandle Prop,
     uint8* OutBuf, uint32 BufSize, uint32* OutTotalWritten, int32* OutCount)
@@ -662,107 +873,879 @@ static EUikaErrorCode MapCopyAllImpl(
     if (!MapProp) return EUikaErrorCode::TypeMismatch;
 
     FScriptMapHelper Helper(MapProp, MapProp->ContainerPtrToValuePtr<void>(Object));
-    int32 Count = Helper.Num();
-    if (OutCount) *OutCount = Count;
+    if (OutCount) *OutCount = Helper.Num();
 
-    FProperty* KeyProp = MapProp->KeyProp;
-    FProperty* ValueProp = MapProp->ValueProp;
     uint32 Offset = 0;
-    int32 MaxIndex = Helper.GetMaxIndex();
-
-    for (int32 i = 0; i < MaxIndex; ++i)
+    int32 Written = 0;
+    const int32 Stop = WriteMapPairs(Helper, MapProp, 0, OutBuf, BufSize, Offset, Written);
+    if (Stop != INDEX_NONE)
     {
-        if (!Helper.IsValidIndex(i)) continue;
-
-        // Key: [u32 written][data]
-        if (Offset + sizeof(uint32) > BufSize)
-        {
-            if (OutTotalWritten) *OutTotalWritten = BufSize * 2; // rough estimate
-            return EUikaErrorCode::BufferTooSmall;
-        }
+        if (OutTotalWritten) *OutTotalWritten = ClampCopySize(Offset + MapFramedSize(Helper, MapProp, Stop));
+        return EUikaErrorCode::BufferTooSmall;
+    }
 
-        uint32 KeyWritten = 0;
-        uint32 Remaining = BufSize - Offset - sizeof(uint32);
-        ReadElement(KeyProp, Helper.GetKeyPtr(i),
-                    OutBuf + Offset + sizeof(uint32), Remaining, &KeyWritten);
+    if (OutTotalWritten) *OutTotalWritten = Offset;
+    return EUikaErrorCode::Ok;
+}
 
-        if (Offset + sizeof(uint32) + KeyWritten > BufSize)
-        {
-            if (OutTotalWritten) *OutTotalWritten = BufSize * 2;
-            return EUikaErrorCode::BufferTooSmall;
-        }
+static EUikaErrorCode SetCopyAllImpl(
+    UikaUObjectHandle Obj, UikaFPropertyHandle Prop,
+    uint8* OutBuf, uint32 BufSize, uint32* OutTotalWritten, int32* OutCount)
+{
+    UIKA_CHECK_VALID(Obj);
+    FSetProperty* SetProp = CastField<FSetProperty>(static_cast<FProperty*>(Prop.ptr));
+    if (!SetProp) return EUikaErrorCode::TypeMismatch;
 
-        FMemory::Memcpy(OutBuf + Offset, &KeyWritten, sizeof(uint32));
-        Offset += sizeof(uint32) + KeyWritten;
+    FScriptSetHelper Helper(SetProp, SetProp->ContainerPtrToValuePtr<void>(Object));
+    if (OutCount) *OutCount = Helper.Num();
 
-        // Value: [u32 written][data]
-        if (Offset + sizeof(uint32) > BufSize)
-        {
-            if (OutTotalWritten) *OutTotalWritten = BufSize * 2;
-            return EUikaErrorCode::BufferTooSmall;
-        }
+    uint32 Offset = 0;
+    int32 Written = 0;
+    const int32 Stop = WriteSetElements(Helper, SetProp, 0, OutBuf, BufSize, Offset, Written);
+    if (Stop != INDEX_NONE)
+    {
+        if (OutTotalWritten) *OutTotalWritten = ClampCopySize(Offset + SetFramedSize(Helper, SetProp, Stop));
+        return EUikaErrorCode::BufferTooSmall;
+    }
 
-        uint32 ValWritten = 0;
-        Remaining = BufSize - Offset - sizeof(uint32);
-        ReadElement(ValueProp, Helper.GetValuePtr(i),
-                    OutBuf + Offset + sizeof(uint32), Remaining, &ValWritten);
+    if (OutTotalWritten) *OutTotalWritten = Offset;
+    return EUikaErrorCode::Ok;
+}
 
-        if (Offset + sizeof(uint32) + ValWritten > BufSize)
-        {
-            if (OutTotalWritten) *OutTotalWritten = BufSize * 2;
-            return EUikaErrorCode::BufferTooSmall;
-        }
+// ---------------------------------------------------------------------------
+// Exact-size queries and chunked copies
+// ---------------------------------------------------------------------------
+// *_copy_size reports exactly what *_copy_all would write, without writing.
+// *_copy_chunk writes as many whole frames as fit, starting at *Cursor
+// (0 = begin; logical index for arrays, sparse index for maps/sets), then
+// stores the resume cursor (-1 = done). A chunk whose first frame does not
+// fit fails with BufferTooSmall and OutWritten = that frame's exact size.
+
+static EUikaErrorCode ArrayCopySizeImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop,
+                                        uint32* OutSize, int32* OutCount)
+{
+    UIKA_CHECK_VALID(Obj);
+    if (!OutSize) return EUikaErrorCode::NullArgument;
+    FArrayProperty* ArrayProp = CastField<FArrayProperty>(static_cast<FProperty*>(Prop.ptr));
+    if (!ArrayProp) return EUikaErrorCode::TypeMismatch;
 
-        FMemory::Memcpy(OutBuf + Offset, &ValWritten, sizeof(uint32));
-        Offset += sizeof(uint32) + ValWritten;
+    FScriptArrayHelper Helper(ArrayProp, ArrayProp->ContainerPtrToValuePtr<void>(Object));
+    const int32 Count = Helper.Num();
+    if (IsRawCopyableElement(ArrayProp->Inner))
+    {
+        *OutSize = ClampCopySize(static_cast<uint64>(Count) * ArrayProp->Inner->GetSize());
+        if (OutCount) *OutCount = -Count;
+        return EUikaErrorCode::Ok;
     }
+    *OutSize = ClampCopySize(ArrayFramedSize(Helper, ArrayProp->Inner, 0));
+    if (OutCount) *OutCount = Count;
+    return EUikaErrorCode::Ok;
+}
 
-    if (OutTotalWritten) *OutTotalWritten = Offset;
+static EUikaErrorCode MapCopySizeImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop,
+                                      uint32* OutSize, int32* OutCount)
+{
+    UIKA_CHECK_VALID(Obj);
+    if (!OutSize) return EUikaErrorCode::NullArgument;
+    FMapProperty* MapProp = CastField<FMapProperty>(static_cast<FProperty*>(Prop.ptr));
+    if (!MapProp) return EUikaErrorCode::TypeMismatch;
+
+    FScriptMapHelper Helper(MapProp, MapProp->ContainerPtrToValuePtr<void>(Object));
+    *OutSize = ClampCopySize(MapFramedSize(Helper, MapProp, 0));
+    if (OutCount) *OutCount = Helper.Num();
     return EUikaErrorCode::Ok;
 }
 
-static EUikaErrorCode SetCopyAllImpl(
-    UikaUObjectHandle Obj, UikaFPropertyHandle Prop,
-    uint8* OutBuf, uint32 BufSize, uint32* OutTotalWritten, int32* OutCount)
+static EUikaErrorCode SetCopySizeImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop,
+                                      uint32* OutSize, int32* OutCount)
 {
     UIKA_CHECK_VALID(Obj);
+    if (!OutSize) return EUikaErrorCode::NullArgument;
     FSetProperty* SetProp = CastField<FSetProperty>(static_cast<FProperty*>(Prop.ptr));
     if (!SetProp) return EUikaErrorCode::TypeMismatch;
 
     FScriptSetHelper Helper(SetProp, SetProp->ContainerPtrToValuePtr<void>(Object));
-    int32 Count = Helper.Num();
-    if (OutCount) *OutCount = Count;
+    *OutSize = ClampCopySize(SetFramedSize(Helper, SetProp, 0));
+    if (OutCount) *OutCount = Helper.Num();
+    return EUikaErrorCode::Ok;
+}
 
-    FProperty* ElementProp = SetProp->ElementProp;
-    uint32 Offset = 0;
-    int32 MaxIndex = Helper.GetMaxIndex();
+static EUikaErrorCode ArrayCopyChunkImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop,
+                                         int32* Cursor, uint8* OutBuf, uint32 BufSize,
+                                         uint32* OutWritten, int32* OutCount)
+{
+    UIKA_CHECK_VALID(Obj);
+    if (!Cursor || !OutWritten || !OutCount || (!OutBuf && BufSize > 0)) return EUikaErrorCode::NullArgument;
+    FArrayProperty* ArrayProp = CastField<FArrayProperty>(static_cast<FProperty*>(Prop.ptr));
+    if (!ArrayProp) return EUikaErrorCode::TypeMismatch;
 
-    for (int32 i = 0; i < MaxIndex; ++i)
-    {
-        if (!Helper.IsValidIndex(i)) continue;
+    FScriptArrayHelper Helper(ArrayProp, ArrayProp->ContainerPtrToValuePtr<void>(Object));
+    FProperty* Inner = ArrayProp->Inner;
+    const int32 Num = Helper.Num();
+    int32 Index = *Cursor;
+    if (Index < 0 || Index > Num) return EUikaErrorCode::IndexOutOfRange;
 
-        if (Offset + sizeof(uint32) > BufSize)
+    uint32 Offset = 0;
+    if (IsRawCopyableElement(Inner))
+    {
+        const uint32 ElemSize = Inner->GetSize();
+        const int32 Fit = static_cast<int32>(FMath::Min<int64>(Num - Index, BufSize / ElemSize));
+        if (Fit == 0 && Index < Num)
         {
-            if (OutTotalWritten) *OutTotalWritten = BufSize * 2;
+            *OutWritten = ElemSize;
             return EUikaErrorCode::BufferTooSmall;
         }
-
-        uint32 ElemWritten = 0;
-        uint32 Remaining = BufSize - Offset - sizeof(uint32);
-        ReadElement(ElementProp, Helper.GetElementPtr(i),
-                    OutBuf + Offset + sizeof(uint32), Remaining, &ElemWritten);
-
-        if (Offset + sizeof(uint32) + ElemWritten > BufSize)
+        if (Fit > 0)
         {
-            if (OutTotalWritten) *OutTotalWritten = BufSize * 2;
-            return EUikaErrorCode::BufferTooSmall;
+            FMemory::Memcpy(OutBuf, Helper.GetRawPtr(Index), Fit * ElemSize);
+        }
+        Offset = Fit * ElemSize;
+        Index += Fit;
+        *OutCount = -Fit;  // negative = raw format
+    }
+    else
+    {
+        int32 Written = 0;
+        for (; Index < Num; ++Index)
+        {
+            const uint64 Frame = FramedElementSize(Inner, Helper.GetRawPtr(Index));
+            if (Offset + Frame > BufSize)
+            {
+                if (Written == 0)
+                {
+                    *OutWritten = ClampCopySize(Frame);
+                    return EUikaErrorCode::BufferTooSmall;
+                }
+                break;
+            }
+            WriteFramedElement(Inner, Helper.GetRawPtr(Index), OutBuf, static_cast<uint32>(Frame - sizeof(uint32)), Offset);
+            ++Written;
         }
+        *OutCount = Written;
+    }
+
+    *OutWritten = Offset;
+    *Cursor = Index < Num ? Index : -1;
+    return EUikaErrorCode::Ok;
+}
+
+static EUikaErrorCode MapCopyChunkImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop,
+                                       int32* Cursor, uint8* OutBuf, uint32 BufSize,
+                                       uint32* OutWritten, int32* OutCount)
+{
+    UIKA_CHECK_VALID(Obj);
+    if (!Cursor || !OutWritten || !OutCount || (!OutBuf && BufSize > 0)) return EUikaErrorCode::NullArgument;
+    if (*Cursor < 0) return EUikaErrorCode::IndexOutOfRange;
+    FMapProperty* MapProp = CastField<FMapProperty>(static_cast<FProperty*>(Prop.ptr));
+    if (!MapProp) return EUikaErrorCode::TypeMismatch;
 
-        FMemory::Memcpy(OutBuf + Offset, &ElemWritten, sizeof(uint32));
-        Offset += sizeof(uint32) + ElemWritten;
+    FScriptMapHelper Helper(MapProp, MapProp->ContainerPtrToValuePtr<void>(Object));
+    uint32 Offset = 0;
+    int32 Written = 0;
+    const int32 Stop = WriteMapPairs(Helper, MapProp, *Cursor, OutBuf, BufSize, Offset, Written);
+    if (Stop != INDEX_NONE && Written == 0)
+    {
+        *OutWritten = ClampCopySize(FramedElementSize(MapProp->KeyProp, Helper.GetKeyPtr(Stop))
+                                  + FramedElementSize(MapProp->ValueProp, Helper.GetValuePtr(Stop)));
+        return EUikaErrorCode::BufferTooSmall;
     }
 
-    if (OutTotalWritten) *OutTotalWritten = Offset;
+    *OutWritten = Offset;
+    *OutCount = Written;
+    *Cursor = Stop;
+    return EUikaErrorCode::Ok;
+}
+
+static EUikaErrorCode SetCopyChunkImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop,
+                                       int32* Cursor, uint8* OutBuf, uint32 BufSize,
+                                       uint32* OutWritten, int32* OutCount)
+{
+    UIKA_CHECK_VALID(Obj);
+    if (!Cursor || !OutWritten || !OutCount || (!OutBuf && BufSize > 0)) return EUikaErrorCode::NullArgument;
+    if (*Cursor < 0) return EUikaErrorCode::IndexOutOfRange;
+    FSetProperty* SetProp = CastField<FSetProperty>(static_cast<FProperty*>(Prop.ptr));
+    if (!SetProp) return EUikaErrorCode::TypeMismatch;
+
+    FScriptSetHelper Helper(SetProp, SetProp->ContainerPtrToValuePtr<void>(Object));
+    uint32 Offset = 0;
+    int32 Written = 0;
+    const int32 Stop = WriteSetElements(Helper, SetProp, *Cursor, OutBuf, BufSize, Offset, Written);
+    if (Stop != INDEX_NONE && Written == 0)
+    {
+        *OutWritten = ClampCopySize(FramedElementSize(SetProp->ElementProp, Helper.GetElementPtr(Stop)));
+        return EUikaErrorCode::BufferTooSmall;
+    }
+
+    *OutWritten = Offset;
+    *OutCount = Written;
+    *Cursor = Stop;
+    return EUikaErrorCode::Ok;
+}
+
+// ---------------------------------------------------------------------------
+// In-place TArray data (raw-copyable inner types only)
+// ---------------------------------------------------------------------------
+// The returned pointer aliases the TArray allocation and stays valid until
+// the array is next resized or destroyed.
+
+static EUikaErrorCode ArrayDataImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop,
+                                    uint8** OutData, int32* OutLen, uint32* OutElemSize)
+{
+    UIKA_CHECK_VALID(Obj);
+    if (!OutData || !OutLen || !OutElemSize) return EUikaErrorCode::NullArgument;
+    FArrayProperty* ArrayProp = CastField<FArrayProperty>(static_cast<FProperty*>(Prop.ptr));
+    if (!ArrayProp || !IsRawCopyableElement(ArrayProp->Inner)) return EUikaErrorCode::TypeMismatch;
+
+    FScriptArrayHelper Helper(ArrayProp, ArrayProp->ContainerPtrToValuePtr<void>(Object));
+    *OutData = Helper.Num() > 0 ? Helper.GetRawPtr(0) : nullptr;
+    *OutLen = Helper.Num();
+    *OutElemSize = ArrayProp->Inner->GetSize();
+    return EUikaErrorCode::Ok;
+}
+
+static EUikaErrorCode ArrayReserveImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop, int32 Capacity)
+{
+    UIKA_CHECK_VALID(Obj);
+    FArrayProperty* ArrayProp = CastField<FArrayProperty>(static_cast<FProperty*>(Prop.ptr));
+    if (!ArrayProp || !IsRawCopyableElement(ArrayProp->Inner)) return EUikaErrorCode::TypeMismatch;
+    if (Capacity < 0) return EUikaErrorCode::IndexOutOfRange;
+
+    void* ValuePtr = ArrayProp->ContainerPtrToValuePtr<void>(Object);
+    FScriptArrayHelper Helper(ArrayProp, ValuePtr);
+    const int32 Num = Helper.Num();
+    if (Capacity <= Num + static_cast<FScriptArray*>(ValuePtr)->GetSlack())
+    {
+        return EUikaErrorCode::Ok;
+    }
+
+    // FScriptArrayHelper only sets slack on empty, so stash the (trivially
+    // copyable) contents, reallocate once, and put them back.
+    const uint32 ElemSize = ArrayProp->Inner->GetSize();
+    TArray<uint8> Saved;
+    if (Num > 0)
+    {
+        Saved.Append(Helper.GetRawPtr(0), Num * ElemSize);
+    }
+    Helper.EmptyValues(Capacity);
+    if (Num > 0)
+    {
+        Helper.AddUninitializedValues(Num);
+        FMemory::Memcpy(Helper.GetRawPtr(0), Saved.GetData(), Num * ElemSize);
+    }
+    return EUikaErrorCode::Ok;
+}
+
+static EUikaErrorCode ArrayAppendRawImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop,
+                                         const uint8* InData, int32 Count, uint8** OutData)
+{
+    UIKA_CHECK_VALID(Obj);
+    FArrayProperty* ArrayProp = CastField<FArrayProperty>(static_cast<FProperty*>(Prop.ptr));
+    if (!ArrayProp || !IsRawCopyableElement(ArrayProp->Inner)) return EUikaErrorCode::TypeMismatch;
+    if (Count < 0) return EUikaErrorCode::IndexOutOfRange;
+
+    FScriptArrayHelper Helper(ArrayProp, ArrayProp->ContainerPtrToValuePtr<void>(Object));
+    const int32 Start = Helper.Num();
+    if (Count > 0)
+    {
+        Helper.AddUninitializedValues(Count);
+        const uint32 TotalSize = Count * ArrayProp->Inner->GetSize();
+        if (InData)
+        {
+            FMemory::Memcpy(Helper.GetRawPtr(Start), InData, TotalSize);
+        }
+        else
+        {
+            FMemory::Memzero(Helper.GetRawPtr(Start), TotalSize);
+        }
+    }
+    if (OutData) *OutData = Count > 0 ? Helper.GetRawPtr(Start) : nullptr;
+    return EUikaErrorCode::Ok;
+}
+
+// ---------------------------------------------------------------------------
+// Bulk map/set population (framed buffers, one rehash)
+// ---------------------------------------------------------------------------
+// Input is the framed layout *_copy_all produces. New entries are built in
+// place without hashing and the container is rehashed once at the end.
+// Keys already present have their value overwritten in place (maps) or are
+// skipped (sets); keys repeated within one buffer collapse to one entry.
+
+// Read one [u32 size][data] frame at Offset.
+static bool ReadFrame(const uint8* InBuf, uint32 BufSize, uint32& Offset,
+                      const uint8*& OutData, uint32& OutSize)
+{
+    if (Offset + sizeof(uint32) > BufSize) return false;
+    FMemory::Memcpy(&OutSize, InBuf + Offset, sizeof(uint32));
+    if (Offset + sizeof(uint32) + OutSize > BufSize) return false;
+    OutData = InBuf + Offset + sizeof(uint32);
+    Offset += sizeof(uint32) + OutSize;
+    return true;
+}
+
+static EUikaErrorCode MapInsertFramed(FScriptMapHelper& Helper, FMapProperty* MapProp,
+                                      const uint8* InBuf, uint32 BufSize, int32 Count)
+{
+    FProperty* KeyProp = MapProp->KeyProp;
+    FProperty* ValueProp = MapProp->ValueProp;
+    // The hash only covers pre-existing pairs until the final Rehash.
+    const bool bHasExisting = Helper.Num() > 0;
+
+    uint8* TempKey = static_cast<uint8*>(FMemory::Malloc(KeyProp->GetSize(), KeyProp->GetMinAlignment()));
+    KeyProp->InitializeValue(TempKey);
+
+    TArray<int32> NewIndices;
+    NewIndices.Reserve(Count);
+    EUikaErrorCode Result = EUikaErrorCode::Ok;
+    uint32 Offset = 0;
+    for (int32 i = 0; i < Count; ++i)
+    {
+        const uint8* KeyData = nullptr;
+        const uint8* ValData = nullptr;
+        uint32 KeySize = 0, ValSize = 0;
+        if (!ReadFrame(InBuf, BufSize, Offset, KeyData, KeySize)
+            || !ReadFrame(InBuf, BufSize, Offset, ValData, ValSize))
+        {
+            Result = EUikaErrorCode::BufferTooSmall;
+            break;
+        }
+
+        if (bHasExisting)
+        {
+            WriteElement(KeyProp, TempKey, KeyData, KeySize);
+            const int32 Existing = Helper.FindMapPairIndexFromHash(TempKey);
+            if (Existing != INDEX_NONE)
+            {
+                WriteElement(ValueProp, Helper.GetValuePtr(Existing), ValData, ValSize);
+                continue;
+            }
+        }
+
+        const int32 Index = Helper.AddUninitializedValue();
+        KeyProp->InitializeValue(Helper.GetKeyPtr(Index));
+        ValueProp->InitializeValue(Helper.GetValuePtr(Index));
+        WriteElement(KeyProp, Helper.GetKeyPtr(Index), KeyData, KeySize);
+        WriteElement(ValueProp, Helper.GetValuePtr(Index), ValData, ValSize);
+        NewIndices.Add(Index);
+    }
+
+    KeyProp->DestroyValue(TempKey);
+    FMemory::Free(TempKey);
+
+    Helper.Rehash();
+
+    // Drop batch-internal duplicates: every copy but the one the hash
+    // resolves to is removed.
+    for (int32 Index : NewIndices)
+    {
+        if (Helper.FindMapPairIndexFromHash(Helper.GetKeyPtr(Index)) != Index)
+        {
+            Helper.RemoveAt(Index);
+        }
+    }
+    return Result;
+}
+
+static EUikaErrorCode SetInsertFramed(FScriptSetHelper& Helper, FSetProperty* SetProp,
+                                      const uint8* InBuf, uint32 BufSize, int32 Count)
+{
+    FProperty* ElementProp = SetProp->ElementProp;
+    const bool bHasExisting = Helper.Num() > 0;
+
+    uint8* TempElem = static_cast<uint8*>(FMemory::Malloc(ElementProp->GetSize(), ElementProp->GetMinAlignment()));
+    ElementProp->InitializeValue(TempElem);
+
+    TArray<int32> NewIndices;
+    NewIndices.Reserve(Count);
+    EUikaErrorCode Result = EUikaErrorCode::Ok;
+    uint32 Offset = 0;
+    for (int32 i = 0; i < Count; ++i)
+    {
+        const uint8* ElemData = nullptr;
+        uint32 ElemSize = 0;
+        if (!ReadFrame(InBuf, BufSize, Offset, ElemData, ElemSize))
+        {
+            Result = EUikaErrorCode::BufferTooSmall;
+            break;
+        }
+
+        if (bHasExisting)
+        {
+            WriteElement(ElementProp, TempElem, ElemData, ElemSize);
+            if (Helper.FindElementIndexFromHash(TempElem) != INDEX_NONE)
+            {
+                continue;
+            }
+        }
+
+        const int32 Index = Helper.AddUninitializedValue();
+        ElementProp->InitializeValue(Helper.GetElementPtr(Index));
+        WriteElement(ElementProp, Helper.GetElementPtr(Index), ElemData, ElemSize);
+        NewIndices.Add(Index);
+    }
+
+    ElementProp->DestroyValue(TempElem);
+    FMemory::Free(TempElem);
+
+    Helper.Rehash();
+
+    for (int32 Index : NewIndices)
+    {
+        if (Helper.FindElementIndexFromHash(Helper.GetElementPtr(Index)) != Index)
+        {
+            Helper.RemoveAt(Index);
+        }
+    }
+    return Result;
+}
+
+static EUikaErrorCode MapSetAllImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop,
+                                    const uint8* InBuf, uint32 BufSize, int32 Count)
+{
+    UIKA_CHECK_VALID(Obj);
+    if (Count < 0) return EUikaErrorCode::IndexOutOfRange;
+    if (!InBuf && Count > 0) return EUikaErrorCode::NullArgument;
+    FMapProperty* MapProp = CastField<FMapProperty>(static_cast<FProperty*>(Prop.ptr));
+    if (!MapProp) return EUikaErrorCode::TypeMismatch;
+
+    FScriptMapHelper Helper(MapProp, MapProp->ContainerPtrToValuePtr<void>(Object));
+    // Sizes both the pair storage and the hash buckets for Count entries.
+    Helper.EmptyValues(Count);
+    return MapInsertFramed(Helper, MapProp, InBuf, BufSize, Count);
+}
+
+static EUikaErrorCode MapAddManyImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop,
+                                     const uint8* InBuf, uint32 BufSize, int32 Count)
+{
+    UIKA_CHECK_VALID(Obj);
+    if (Count < 0) return EUikaErrorCode::IndexOutOfRange;
+    if (!InBuf && Count > 0) return EUikaErrorCode::NullArgument;
+    FMapProperty* MapProp = CastField<FMapProperty>(static_cast<FProperty*>(Prop.ptr));
+    if (!MapProp) return EUikaErrorCode::TypeMismatch;
+
+    FScriptMapHelper Helper(MapProp, MapProp->ContainerPtrToValuePtr<void>(Object));
+    return MapInsertFramed(Helper, MapProp, InBuf, BufSize, Count);
+}
+
+static EUikaErrorCode SetSetAllImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop,
+                                    const uint8* InBuf, uint32 BufSize, int32 Count)
+{
+    UIKA_CHECK_VALID(Obj);
+    if (Count < 0) return EUikaErrorCode::IndexOutOfRange;
+    if (!InBuf && Count > 0) return EUikaErrorCode::NullArgument;
+    FSetProperty* SetProp = CastField<FSetProperty>(static_cast<FProperty*>(Prop.ptr));
+    if (!SetProp) return EUikaErrorCode::TypeMismatch;
+
+    FScriptSetHelper Helper(SetProp, SetProp->ContainerPtrToValuePtr<void>(Object));
+    Helper.EmptyElements(Count);
+    return SetInsertFramed(Helper, SetProp, InBuf, BufSize, Count);
+}
+
+static EUikaErrorCode SetAddManyImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop,
+                                     const uint8* InBuf, uint32 BufSize, int32 Count)
+{
+    UIKA_CHECK_VALID(Obj);
+    if (Count < 0) return EUikaErrorCode::IndexOutOfRange;
+    if (!InBuf && Count > 0) return EUikaErrorCode::NullArgument;
+    FSetProperty* SetProp = CastField<FSetProperty>(static_cast<FProperty*>(Prop.ptr));
+    if (!SetProp) return EUikaErrorCode::TypeMismatch;
+
+    FScriptSetHelper Helper(SetProp, SetProp->ContainerPtrToValuePtr<void>(Object));
+    return SetInsertFramed(Helper, SetProp, InBuf, BufSize, Count);
+}
+
+// ---------------------------------------------------------------------------
+// Container algorithms (no element data crosses the FFI)
+// ---------------------------------------------------------------------------
+
+// Initialized scratch value of an inner property, filled from an FFI buffer.
+struct FUikaTempElement
+{
+    FProperty* Prop;
+    uint8* Data;
+
+    FUikaTempElement(FProperty* InProp, const uint8* InBuf, uint32 BufSize)
+        : Prop(InProp)
+        , Data(static_cast<uint8*>(FMemory::Malloc(InProp->GetSize(), InProp->GetMinAlignment())))
+    {
+        Prop->InitializeValue(Data);
+        WriteElement(Prop, Data, InBuf, BufSize);
+    }
+
+    ~FUikaTempElement()
+    {
+        Prop->DestroyValue(Data);
+        FMemory::Free(Data);
+    }
+
+    FUikaTempElement(const FUikaTempElement&) = delete;
+    FUikaTempElement& operator=(const FUikaTempElement&) = delete;
+};
+
+static bool ElementsIdentical(FProperty* Inner, const void* A, const void* B)
+{
+    return Inner->Identical(A, B, PPF_None);
+}
+
+// Natural ordering of an inner property's values. Returns false if the type
+// has no ordering (objects, structs, containers).
+static bool CompareElements(FProperty* Inner, const void* A, const void* B, int32& OutOrder)
+{
+    auto Order = [](auto X, auto Y) { return X < Y ? -1 : (Y < X ? 1 : 0); };
+
+    if (FBoolProperty* BoolProp = CastField<FBoolProperty>(Inner))
+    {
+        OutOrder = Order(BoolProp->GetPropertyValue(A), BoolProp->GetPropertyValue(B));
+        return true;
+    }
+    if (FEnumProperty* EnumProp = CastField<FEnumProperty>(Inner))
+    {
+        FNumericProperty* Under = EnumProp->GetUnderlyingProperty();
+        OutOrder = Order(Under->GetSignedIntPropertyValue(A), Under->GetSignedIntPropertyValue(B));
+        return true;
+    }
+    if (FNumericProperty* NumProp = CastField<FNumericProperty>(Inner))
+    {
+        if (NumProp->IsFloatingPoint())
+        {
+            OutOrder = Order(NumProp->GetFloatingPointPropertyValue(A), NumProp->GetFloatingPointPropertyValue(B));
+        }
+        else if (CastField<FUInt64Property>(Inner))
+        {
+            OutOrder = Order(NumProp->GetUnsignedIntPropertyValue(A), NumProp->GetUnsignedIntPropertyValue(B));
+        }
+        else
+        {
+            OutOrder = Order(NumProp->GetSignedIntPropertyValue(A), NumProp->GetSignedIntPropertyValue(B));
+        }
+        return true;
+    }
+    if (FStrProperty* StrProp = CastField<FStrProperty>(Inner))
+    {
+        OutOrder = StrProp->GetPropertyValue(A).Compare(StrProp->GetPropertyValue(B), ESearchCase::CaseSensitive);
+        return true;
+    }
+    if (FNameProperty* NameProp = CastField<FNameProperty>(Inner))
+    {
+        OutOrder = NameProp->GetPropertyValue(A).Compare(NameProp->GetPropertyValue(B));
+        return true;
+    }
+    if (FTextProperty* TextProp = CastField<FTextProperty>(Inner))
+    {
+        OutOrder = TextProp->GetPropertyValue(A).CompareTo(TextProp->GetPropertyValue(B));
+        return true;
+    }
+    return false;
+}
+
+// World location of an actor or scene component element; false otherwise.
+static bool GetObjectLocation(UObject* Obj, FVector& OutLocation)
+{
+    if (const AActor* Actor = Cast<AActor>(Obj))
+    {
+        OutLocation = Actor->GetActorLocation();
+        return true;
+    }
+    if (const USceneComponent* Comp = Cast<USceneComponent>(Obj))
+    {
+        OutLocation = Comp->GetComponentLocation();
+        return true;
+    }
+    return false;
+}
+
+// Reorder elements so that slot i holds the old element Perm[i]. UE types are
+// bitwise relocatable (TArray itself relies on it), so a staged memcpy moves
+// every element exactly once without constructing or destroying any.
+static void ApplyArrayPermutation(FScriptArrayHelper& Helper, uint32 ElemSize, const TArray<int32>& Perm)
+{
+    const int32 Num = Perm.Num();
+    TArray<uint8> Staging;
+    Staging.SetNumUninitialized(Num * ElemSize);
+    for (int32 i = 0; i < Num; ++i)
+    {
+        FMemory::Memcpy(Staging.GetData() + i * ElemSize, Helper.GetRawPtr(Perm[i]), ElemSize);
+    }
+    FMemory::Memcpy(Helper.GetRawPtr(0), Staging.GetData(), Num * ElemSize);
+}
+
+static EUikaErrorCode ArrayFindImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop,
+                                    const uint8* InBuf, uint32 BufSize, int32 Start, int32* OutIndex)
+{
+    UIKA_CHECK_VALID(Obj);
+    if (!InBuf || !OutIndex) return EUikaErrorCode::NullArgument;
+    FArrayProperty* ArrayProp = CastField<FArrayProperty>(static_cast<FProperty*>(Prop.ptr));
+    if (!ArrayProp) return EUikaErrorCode::TypeMismatch;
+
+    FScriptArrayHelper Helper(ArrayProp, ArrayProp->ContainerPtrToValuePtr<void>(Object));
+    FUikaTempElement Needle(ArrayProp->Inner, InBuf, BufSize);
+    *OutIndex = -1;
+    for (int32 i = FMath::Max(Start, 0); i < Helper.Num(); ++i)
+    {
+        if (ElementsIdentical(ArrayProp->Inner, Helper.GetRawPtr(i), Needle.Data))
+        {
+            *OutIndex = i;
+            break;
+        }
+    }
+    return EUikaErrorCode::Ok;
+}
+
+static EUikaErrorCode ArrayRemoveAllByValueImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop,
+                                                const uint8* InBuf, uint32 BufSize, int32* OutRemoved)
+{
+    UIKA_CHECK_VALID(Obj);
+    if (!InBuf) return EUikaErrorCode::NullArgument;
+    FArrayProperty* ArrayProp = CastField<FArrayProperty>(static_cast<FProperty*>(Prop.ptr));
+    if (!ArrayProp) return EUikaErrorCode::TypeMismatch;
+
+    FScriptArrayHelper Helper(ArrayProp, ArrayProp->ContainerPtrToValuePtr<void>(Object));
+    FUikaTempElement Needle(ArrayProp->Inner, InBuf, BufSize);
+    int32 Removed = 0;
+    // Walk backwards so each removal only shifts elements already checked.
+    for (int32 i = Helper.Num() - 1; i >= 0; --i)
+    {
+        if (ElementsIdentical(ArrayProp->Inner, Helper.GetRawPtr(i), Needle.Data))
+        {
+            Helper.RemoveValues(i, 1);
+            ++Removed;
+        }
+    }
+    if (OutRemoved) *OutRemoved = Removed;
+    return EUikaErrorCode::Ok;
+}
+
+static EUikaErrorCode ArrayDedupeImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop, int32* OutRemoved)
+{
+    UIKA_CHECK_VALID(Obj);
+    FArrayProperty* ArrayProp = CastField<FArrayProperty>(static_cast<FProperty*>(Prop.ptr));
+    if (!ArrayProp) return EUikaErrorCode::TypeMismatch;
+
+    FScriptArrayHelper Helper(ArrayProp, ArrayProp->ContainerPtrToValuePtr<void>(Object));
+    FProperty* Inner = ArrayProp->Inner;
+    const int32 Num = Helper.Num();
+    const bool bHashable = Inner->HasAllPropertyFlags(CPF_HasGetValueTypeHash);
+
+    // Keep the first occurrence of each value, preserving order. Hashable
+    // types bucket by GetValueTypeHash; others fall back to pairwise compares.
+    TArray<int32> Keep;
+    Keep.Reserve(Num);
+    TMultiMap<uint32, int32> Seen;
+    for (int32 i = 0; i < Num; ++i)
+    {
+        const void* Elem = Helper.GetRawPtr(i);
+        bool bDuplicate = false;
+        if (bHashable)
+        {
+            const uint32 Hash = Inner->GetValueTypeHash(Elem);
+            for (auto It = Seen.CreateConstKeyIterator(Hash); It && !bDuplicate; ++It)
+            {
+                bDuplicate = ElementsIdentical(Inner, Helper.GetRawPtr(It.Value()), Elem);
+            }
+            if (!bDuplicate) Seen.Add(Hash, i);
+        }
+        else
+        {
+            for (int32 k = 0; k < Keep.Num() && !bDuplicate; ++k)
+            {
+                bDuplicate = ElementsIdentical(Inner, Helper.GetRawPtr(Keep[k]), Elem);
+            }
+        }
+        if (!bDuplicate) Keep.Add(i);
+    }
+
+    const int32 Removed = Num - Keep.Num();
+    if (Removed > 0)
+    {
+        // Destroy the duplicates, pack the survivors to the front, then drop
+        // the tail without running destructors a second time.
+        TBitArray<> bKept(false, Num);
+        for (int32 Index : Keep) bKept[Index] = true;
+        for (int32 i = 0; i < Num; ++i)
+        {
+            if (!bKept[i]) Inner->DestroyValue(Helper.GetRawPtr(i));
+        }
+        ApplyArrayPermutation(Helper, Inner->GetSize(), Keep);
+        for (int32 i = Keep.Num(); i < Num; ++i)
+        {
+            Inner->InitializeValue(Helper.GetRawPtr(i));
+        }
+        Helper.RemoveValues(Keep.Num(), Removed);
+    }
+    if (OutRemoved) *OutRemoved = Removed;
+    return EUikaErrorCode::Ok;
+}
+
+static EUikaErrorCode ArraySortImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop,
+                                    uint32 Key, bool bDescending, const double* Origin)
+{
+    UIKA_CHECK_VALID(Obj);
+    FArrayProperty* ArrayProp = CastField<FArrayProperty>(static_cast<FProperty*>(Prop.ptr));
+    if (!ArrayProp) return EUikaErrorCode::TypeMismatch;
+
+    FScriptArrayHelper Helper(ArrayProp, ArrayProp->ContainerPtrToValuePtr<void>(Object));
+    FProperty* Inner = ArrayProp->Inner;
+    const int32 Num = Helper.Num();
+
+    TArray<int32> Perm;
+    Perm.SetNumUninitialized(Num);
+    for (int32 i = 0; i < Num; ++i) Perm[i] = i;
+
+    if (Key == UIKA_SORT_BY_DISTANCE)
+    {
+        FObjectPropertyBase* ObjProp = CastField<FObjectPropertyBase>(Inner);
+        if (!ObjProp) return EUikaErrorCode::TypeMismatch;
+        if (!Origin) return EUikaErrorCode::NullArgument;
+        const FVector From(Origin[0], Origin[1], Origin[2]);
+
+        // One location query per element; elements without a location
+        // (null, not an actor/component) sort last in either direction.
+        TArray<double> DistSq;
+        DistSq.SetNumUninitialized(Num);
+        for (int32 i = 0; i < Num; ++i)
+        {
+            FVector Location;
+            const bool bHasLocation = GetObjectLocation(ObjProp->GetObjectPropertyValue(Helper.GetRawPtr(i)), Location);
+            DistSq[i] = bHasLocation ? FVector::DistSquared(From, Location) : TNumericLimits<double>::Max();
+        }
+        Algo::StableSort(Perm, [&](int32 A, int32 B)
+        {
+            const bool bAMissing = DistSq[A] == TNumericLimits<double>::Max();
+            const bool bBMissing = DistSq[B] == TNumericLimits<double>::Max();
+            if (bAMissing || bBMissing) return !bAMissing && bBMissing;
+            return bDescending ? DistSq[B] < DistSq[A] : DistSq[A] < DistSq[B];
+        });
+    }
+    else if (Key == UIKA_SORT_BY_VALUE)
+    {
+        int32 Probe = 0;
+        if (Num > 1 && !CompareElements(Inner, Helper.GetRawPtr(0), Helper.GetRawPtr(1), Probe))
+        {
+            return EUikaErrorCode::TypeMismatch;
+        }
+        Algo::StableSort(Perm, [&](int32 A, int32 B)
+        {
+            int32 Order = 0;
+            CompareElements(Inner, Helper.GetRawPtr(A), Helper.GetRawPtr(B), Order);
+            return bDescending ? Order > 0 : Order < 0;
+        });
+    }
+    else
+    {
+        return EUikaErrorCode::InvalidOperation;
+    }
+
+    if (Num > 1)
+    {
+        ApplyArrayPermutation(Helper, Inner->GetSize(), Perm);
+    }
+    return EUikaErrorCode::Ok;
+}
+
+static EUikaErrorCode ArraySwapImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop, int32 A, int32 B)
+{
+    UIKA_CHECK_VALID(Obj);
+    FArrayProperty* ArrayProp = CastField<FArrayProperty>(static_cast<FProperty*>(Prop.ptr));
+    if (!ArrayProp) return EUikaErrorCode::TypeMismatch;
+
+    FScriptArrayHelper Helper(ArrayProp, ArrayProp->ContainerPtrToValuePtr<void>(Object));
+    if (!Helper.IsValidIndex(A) || !Helper.IsValidIndex(B)) return EUikaErrorCode::IndexOutOfRange;
+    if (A != B)
+    {
+        Helper.SwapValues(A, B);
+    }
+    return EUikaErrorCode::Ok;
+}
+
+static EUikaErrorCode ArrayInsertAtImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop,
+                                        int32 Index, const uint8* InBuf, uint32 BufSize)
+{
+    UIKA_CHECK_VALID(Obj);
+    if (!InBuf) return EUikaErrorCode::NullArgument;
+    FArrayProperty* ArrayProp = CastField<FArrayProperty>(static_cast<FProperty*>(Prop.ptr));
+    if (!ArrayProp) return EUikaErrorCode::TypeMismatch;
+
+    FScriptArrayHelper Helper(ArrayProp, ArrayProp->ContainerPtrToValuePtr<void>(Object));
+    if (Index < 0 || Index > Helper.Num()) return EUikaErrorCode::IndexOutOfRange;
+    Helper.InsertValues(Index, 1);
+    WriteElement(ArrayProp->Inner, Helper.GetRawPtr(Index), InBuf, BufSize);
+    return EUikaErrorCode::Ok;
+}
+
+static EUikaErrorCode ArrayRemoveRangeImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop,
+                                           int32 Index, int32 Count)
+{
+    UIKA_CHECK_VALID(Obj);
+    FArrayProperty* ArrayProp = CastField<FArrayProperty>(static_cast<FProperty*>(Prop.ptr));
+    if (!ArrayProp) return EUikaErrorCode::TypeMismatch;
+
+    FScriptArrayHelper Helper(ArrayProp, ArrayProp->ContainerPtrToValuePtr<void>(Object));
+    if (Index < 0 || Count < 0 || Index + Count > Helper.Num()) return EUikaErrorCode::IndexOutOfRange;
+    if (Count > 0)
+    {
+        Helper.RemoveValues(Index, Count);
+    }
+    return EUikaErrorCode::Ok;
+}
+
+// Resolve a second TSet property with the same element type.
+static FSetProperty* GetCompatibleSet(FSetProperty* SetProp, UikaFPropertyHandle OtherProp)
+{
+    FSetProperty* Other = CastField<FSetProperty>(static_cast<FProperty*>(OtherProp.ptr));
+    if (!Other || !Other->ElementProp->SameType(SetProp->ElementProp)) return nullptr;
+    return Other;
+}
+
+static EUikaErrorCode SetUnionImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop,
+                                   UikaUObjectHandle OtherObj, UikaFPropertyHandle OtherProp)
+{
+    UIKA_CHECK_VALID(Obj);
+    if (!OtherObj.ptr) return EUikaErrorCode::ObjectDestroyed;
+    FSetProperty* SetProp = CastField<FSetProperty>(static_cast<FProperty*>(Prop.ptr));
+    if (!SetProp) return EUikaErrorCode::TypeMismatch;
+    FSetProperty* OtherSetProp = GetCompatibleSet(SetProp, OtherProp);
+    if (!OtherSetProp) return EUikaErrorCode::TypeMismatch;
+
+    void* SetPtr = SetProp->ContainerPtrToValuePtr<void>(Object);
+    void* OtherPtr = OtherSetProp->ContainerPtrToValuePtr<void>(OtherObj.ptr);
+    FScriptSetHelper Helper(SetProp, SetPtr);
+    FScriptSetHelper OtherHelper(OtherSetProp, OtherPtr);
+    if (SetPtr == OtherPtr) return EUikaErrorCode::Ok;
+
+    // AddElement hashes against the live set, so existing elements are kept.
+    for (int32 i = NextValidIndex(OtherHelper, 0); i != INDEX_NONE; i = NextValidIndex(OtherHelper, i + 1))
+    {
+        Helper.AddElement(OtherHelper.GetElementPtr(i));
+    }
+    return EUikaErrorCode::Ok;
+}
+
+static EUikaErrorCode SetDifferenceImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop,
+                                        UikaUObjectHandle OtherObj, UikaFPropertyHandle OtherProp)
+{
+    UIKA_CHECK_VALID(Obj);
+    if (!OtherObj.ptr) return EUikaErrorCode::ObjectDestroyed;
+    FSetProperty* SetProp = CastField<FSetProperty>(static_cast<FProperty*>(Prop.ptr));
+    if (!SetProp) return EUikaErrorCode::TypeMismatch;
+    FSetProperty* OtherSetProp = GetCompatibleSet(SetProp, OtherProp);
+    if (!OtherSetProp) return EUikaErrorCode::TypeMismatch;
+
+    void* SetPtr = SetProp->ContainerPtrToValuePtr<void>(Object);
+    void* OtherPtr = OtherSetProp->ContainerPtrToValuePtr<void>(OtherObj.ptr);
+    FScriptSetHelper Helper(SetProp, SetPtr);
+    FScriptSetHelper OtherHelper(OtherSetProp, OtherPtr);
+    if (SetPtr == OtherPtr)
+    {
+        Helper.EmptyElements();
+        return EUikaErrorCode::Ok;
+    }
+
+    for (int32 i = NextValidIndex(Helper, 0); i != INDEX_NONE; i = NextValidIndex(Helper, i + 1))
+    {
+        if (OtherHelper.FindElementIndexFromHash(Helper.GetElementPtr(i)) != INDEX_NONE)
+        {
+            Helper.RemoveAt(i);
+        }
+    }
     return EUikaErrorCode::Ok;
 }
 
@@ -836,4 +1819,35 @@ FUikaContainerApi GContainerApi = {
     &ArraySetAllImpl,
     &MapCopyAllImpl,
     &SetCopyAllImpl,
+    // Cursor iteration
+    &MapIterBeginImpl,
+    &MapIterNextImpl,
+    &SetIterBeginImpl,
+    &SetIterNextImpl,
+    // Exact-size queries and chunked copies
+    &ArrayCopySizeImpl,
+    &MapCopySizeImpl,
+    &SetCopySizeImpl,
+    &ArrayCopyChunkImpl,
+    &MapCopyChunkImpl,
+    &SetCopyChunkImpl,
+    // In-place TArray data
+    &ArrayDataImpl,
+    &ArrayReserveImpl,
+    &ArrayAppendRawImpl,
+    // Bulk map/set population
+    &MapSetAllImpl,
+    &MapAddManyImpl,
+    &SetSetAllImpl,
+    &SetAddManyImpl,
+    // Container algorithms
+    &ArrayFindImpl,
+    &ArrayRemoveAllByValueImpl,
+    &ArrayDedupeImpl,
+    &ArraySortImpl,
+    &ArraySwapImpl,
+    &ArrayInsertAtImpl,
+    &ArrayRemoveRangeImpl,
+    &SetUnionImpl,
+    &SetDifferenceImpl,
 };
@@ -3,6 +3,7 @@
 // are layout-compatible with their Rust #[repr(C)] counterparts.
 
 #include "UikaApiTable.h"
+#include "UObject/WeakObjectPtr.h"
 
 // ---------------------------------------------------------------------------
 // Handle sizes (must match Rust side exactly)
@@ -15,6 +16,39 @@ static_assert(sizeof(UikaUFunctionHandle)    == 8,  "UikaUFunctionHandle must be
 static_assert(sizeof(UikaUStructHandle)      == 8,  "UikaUStructHandle must be 8 bytes");
 static_assert(sizeof(UikaFNameHandle)        == 8,  "UikaFNameHandle must be 8 bytes");
 static_assert(sizeof(UikaFWeakObjectHandle)  == 8,  "UikaFWeakObjectHandle must be 8 bytes");
+static_assert(sizeof(UikaStrView)            == 16, "UikaStrView must be 16 bytes");
+static_assert(sizeof(UikaUtf16View)          == 16, "UikaUtf16View must be 16 bytes");
+static_assert(sizeof(FUikaLogField)          == 32, "FUikaLogField must be 32 bytes");
+static_assert(offsetof(FUikaLogField, value) == 16, "FUikaLogField::value at offset 16");
+
+// ---------------------------------------------------------------------------
+// Command buffer record header layout
+// ---------------------------------------------------------------------------
+
+static_assert(sizeof(FUikaCommandHeader) == UIKA_CMD_ALIGN, "FUikaCommandHeader must be one alignment unit");
+static_assert(offsetof(FUikaCommandHeader, size) == 4, "FUikaCommandHeader::size at offset 4");
+static_assert(offsetof(FUikaCommandHeader, obj)  == 8, "FUikaCommandHeader::obj at offset 8");
+
+// ---------------------------------------------------------------------------
+// Math ABI (four double lanes, VectorRegister4Double alignment)
+// ---------------------------------------------------------------------------
+
+static_assert(sizeof(FUikaVector)    == 32, "FUikaVector must be 32 bytes");
+static_assert(sizeof(FUikaQuat)      == 32, "FUikaQuat must be 32 bytes");
+static_assert(sizeof(FUikaRotator)   == 32, "FUikaRotator must be 32 bytes");
+static_assert(sizeof(FUikaTransform) == 96, "FUikaTransform must be 96 bytes");
+static_assert(alignof(FUikaVector)    == 16, "FUikaVector alignment");
+static_assert(alignof(FUikaQuat)      == 16, "FUikaQuat alignment");
+static_assert(alignof(FUikaRotator)   == 16, "FUikaRotator alignment");
+static_assert(alignof(FUikaTransform) == 16, "FUikaTransform alignment");
+static_assert(offsetof(FUikaTransform, translation) == 32, "FUikaTransform::translation at offset 32");
+static_assert(offsetof(FUikaTransform, scale)       == 64, "FUikaTransform::scale at offset 64");
+
+// The math ABI mirrors the engine types it stands in for.
+static_assert(sizeof(FQuat)      == sizeof(FUikaQuat),      "FQuat and FUikaQuat must match");
+static_assert(sizeof(FTransform) == sizeof(FUikaTransform), "FTransform and FUikaTransform must match");
+static_assert(sizeof(FVector)    == 3 * sizeof(double),     "FUikaVector assumes double-precision FVector");
+static_assert(sizeof(FRotator)   == 3 * sizeof(double),     "FUikaRotator assumes double-precision FRotator");
 
 // ---------------------------------------------------------------------------
 // Error code size
@@ -39,3 +73,96 @@ static_assert(alignof(UikaFNameHandle)       == alignof(uint64), "UikaFNameHandl
 
 static_assert(offsetof(UikaFWeakObjectHandle, object_index)         == 0, "FWeakObjectHandle::object_index at offset 0");
 static_assert(offsetof(UikaFWeakObjectHandle, object_serial_number) == 4, "FWeakObjectHandle::object_serial_number at offset 4");
+static_assert(sizeof(FWeakObjectPtr) == sizeof(UikaFWeakObjectHandle), "FWeakObjectPtr is copied bitwise into UikaFWeakObjectHandle");
+
+static_assert(sizeof(FUikaObjectArrayView) == 40, "FUikaObjectArrayView must be 40 bytes");
+static_assert(offsetof(FUikaObjectArrayView, elements_per_chunk) == 16, "FUikaObjectArrayView::elements_per_chunk at offset 16");
+static_assert(offsetof(FUikaObjectArrayView, dead_flags)         == 36, "FUikaObjectArrayView::dead_flags at offset 36");
+
+// ---------------------------------------------------------------------------
+// Property batch op layout
+// ---------------------------------------------------------------------------
+
+static_assert(sizeof(FUikaPropOp) == 24, "FUikaPropOp must be 24 bytes");
+static_assert(offsetof(FUikaPropOp, kind)       == 8,  "FUikaPropOp::kind at offset 8");
+static_assert(offsetof(FUikaPropOp, op)         == 12, "FUikaPropOp::op at offset 12");
+static_assert(offsetof(FUikaPropOp, buf_offset) == 16, "FUikaPropOp::buf_offset at offset 16");
+static_assert(offsetof(FUikaPropOp, buf_size)   == 20, "FUikaPropOp::buf_size at offset 20");
+
+// ---------------------------------------------------------------------------
+// Field descriptor layout
+// ---------------------------------------------------------------------------
+
+static_assert(sizeof(FUikaFieldDesc) == 20, "FUikaFieldDesc must be 20 bytes");
+static_assert(offsetof(FUikaFieldDesc, flags)            == 12, "FUikaFieldDesc::flags at offset 12");
+static_assert(offsetof(FUikaFieldDesc, bool_byte_offset) == 16, "FUikaFieldDesc::bool_byte_offset at offset 16");
+
+// ---------------------------------------------------------------------------
+// Resolve request layout
+// ---------------------------------------------------------------------------
+
+static_assert(sizeof(FUikaResolveReq) == 40, "FUikaResolveReq must be 40 bytes");
+static_assert(offsetof(FUikaResolveReq, owner)  == 8,  "FUikaResolveReq::owner at offset 8");
+static_assert(offsetof(FUikaResolveReq, name)   == 16, "FUikaResolveReq::name at offset 16");
+static_assert(offsetof(FUikaResolveReq, result) == 32, "FUikaResolveReq::result at offset 32");
+
+static_assert(sizeof(FUikaFrameLayout) == 16, "FUikaFrameLayout must be 16 bytes");
+
+// ---------------------------------------------------------------------------
+// Queued delegate event batch layout
+// ---------------------------------------------------------------------------
+
+static_assert(sizeof(FUikaDelegateEventBatch) == 16, "FUikaDelegateEventBatch must be 16 bytes");
+static_assert(offsetof(FUikaDelegateEventBatch, len)   == 8,  "FUikaDelegateEventBatch::len at offset 8");
+static_assert(offsetof(FUikaDelegateEventBatch, count) == 12, "FUikaDelegateEventBatch::count at offset 12");
+
+// ---------------------------------------------------------------------------
+// Dead instance record layout
+// ---------------------------------------------------------------------------
+
+static_assert(sizeof(FUikaDeadInstance) == 16, "FUikaDeadInstance must be 16 bytes");
+static_assert(offsetof(FUikaDeadInstance, type_id) == 8, "FUikaDeadInstance::type_id at offset 8");
+
+static_assert(sizeof(FUikaTickInstance) == 16, "FUikaTickInstance must be 16 bytes");
+static_assert(offsetof(FUikaTickInstance, data) == 8, "FUikaTickInstance::data at offset 8");
+
+// ---------------------------------------------------------------------------
+// Actor index change record layout
+// ---------------------------------------------------------------------------
+
+static_assert(sizeof(FUikaActorChange) == 16, "FUikaActorChange must be 16 bytes");
+static_assert(offsetof(FUikaActorChange, added) == 8, "FUikaActorChange::added at offset 8");
+
+// ---------------------------------------------------------------------------
+// Async asset load result layout
+// ---------------------------------------------------------------------------
+
+static_assert(sizeof(FUikaAssetLoadResult) == 24, "FUikaAssetLoadResult must be 24 bytes");
+static_assert(offsetof(FUikaAssetLoadResult, objects) == 8,  "FUikaAssetLoadResult::objects at offset 8");
+static_assert(offsetof(FUikaAssetLoadResult, count)   == 16, "FUikaAssetLoadResult::count at offset 16");
+static_assert(offsetof(FUikaAssetLoadResult, status)  == 20, "FUikaAssetLoadResult::status at offset 20");
+
+// ---------------------------------------------------------------------------
+// State mirror layouts
+// ---------------------------------------------------------------------------
+
+static_assert(sizeof(FUikaMirrorColumn) == 16, "FUikaMirrorColumn must be 16 bytes");
+static_assert(offsetof(FUikaMirrorColumn, kind) == 8, "FUikaMirrorColumn::kind at offset 8");
+static_assert(sizeof(FUikaMirrorView) == 56, "FUikaMirrorView must be 56 bytes");
+static_assert(offsetof(FUikaMirrorView, row_count)    == 40, "FUikaMirrorView::row_count at offset 40");
+static_assert(offsetof(FUikaMirrorView, alive_offset) == 52, "FUikaMirrorView::alive_offset at offset 52");
+
+// ---------------------------------------------------------------------------
+// Batched trace queries
+// ---------------------------------------------------------------------------
+
+static_assert(sizeof(FUikaTraceRequest) == 96, "FUikaTraceRequest must be 96 bytes");
+static_assert(offsetof(FUikaTraceRequest, ignore) == 64, "FUikaTraceRequest::ignore at offset 64");
+static_assert(offsetof(FUikaTraceRequest, kind)   == 72, "FUikaTraceRequest::kind at offset 72");
+static_assert(offsetof(FUikaTraceRequest, flags)  == 84, "FUikaTraceRequest::flags at offset 84");
+static_assert(sizeof(FUikaTraceHit) == 96, "FUikaTraceHit must be 96 bytes");
+static_assert(offsetof(FUikaTraceHit, actor)    == 64, "FUikaTraceHit::actor at offset 64");
+static_assert(offsetof(FUikaTraceHit, distance) == 80, "FUikaTraceHit::distance at offset 80");
+static_assert(offsetof(FUikaTraceHit, flags)    == 92, "FUikaTraceHit::flags at offset 92");
+static_assert(sizeof(FUikaTraceBatchResult) == 24, "FUikaTraceBatchResult must be 24 bytes");
+static_assert(offsetof(FUikaTraceBatchResult, status) == 20, "FUikaTraceBatchResult::status at offset 20");
@@ -1,7 +1,9 @@
 // UikaCoreApiImpl.cpp — FUikaCoreApi implementation.
 
 #include "UikaApiTable.h"
+#include "UikaFNameHelper.h"
 #include "UObject/UObjectGlobals.h"
+#include "UObject/UObjectArray.h"
 
 static bool IsValidImpl(UikaUObjectHandle Obj)
 {
@@ -16,19 +18,11 @@ static EUikaErrorCode GetNameImpl(UikaUObjectHandle Obj, uint8* Buf, uint32 BufL
         return EUikaErrorCode::ObjectDestroyed;
     }
 
-    const FString Name = Object->GetFName().ToString();
-    const FTCHARToUTF8 Utf8(*Name);
-    const uint32 Len = static_cast<uint32>(Utf8.Length());
-
+    const uint32 Len = UikaFNameToUtf8(Object->GetFName(), Buf, BufLen);
     if (OutLen)
     {
         *OutLen = Len;
     }
-    if (Buf && BufLen > 0)
-    {
-        const uint32 CopyLen = FMath::Min(Len, BufLen);
-        FMemory::Memcpy(Buf, Utf8.Get(), CopyLen);
-    }
     return EUikaErrorCode::Ok;
 }
 
@@ -68,34 +62,33 @@ static UikaUObjectHandle GetOuterImpl(UikaUObjectHandle Obj)
 
 static UikaFNameHandle MakeFNameImpl(const uint8* NameUtf8, uint32 NameLen)
 {
-    const FString Str(NameLen, UTF8_TO_TCHAR(reinterpret_cast<const char*>(NameUtf8)));
-    const FName Name(*Str);
     // Pack FName into a uint64: ComparisonIndex in low 32, Number in high 32.
-    UikaFNameHandle Result;
-    Result.value = static_cast<uint64>(Name.GetComparisonIndex().ToUnstableInt())
-                 | (static_cast<uint64>(Name.GetNumber()) << 32);
-    return Result;
+    return UikaFNameHandle{ UikaPackFName(UikaUtf8ToFName(NameUtf8, NameLen)) };
 }
 
 static EUikaErrorCode FNameToStringImpl(UikaFNameHandle Handle, uint8* Buf, uint32 BufLen, uint32* OutLen)
 {
-    // Reconstruct FName from packed uint64.
-    const FNameEntryId CompIdx = FNameEntryId::FromUnstableInt(static_cast<uint32>(Handle.value & 0xFFFFFFFF));
-    const int32 Number = static_cast<int32>(Handle.value >> 32);
-    const FName Name(CompIdx, CompIdx, Number);
-
-    const FString Str = Name.ToString();
-    const FTCHARToUTF8 Utf8(*Str);
-    const uint32 Len = static_cast<uint32>(Utf8.Length());
-
+    const uint32 Len = UikaFNameToUtf8(UikaUnpackFName(Handle.value), Buf, BufLen);
     if (OutLen)
     {
         *OutLen = Len;
     }
-    if (Buf && BufLen > 0)
+    return EUikaErrorCode::Ok;
+}
+
+static EUikaErrorCode MakeFNamesBulkImpl(const UikaStrView* Names, uint32 Count, UikaFNameHandle* Out)
+{
+    if (Count == 0)
+    {
+        return EUikaErrorCode::Ok;
+    }
+    if (!Names || !Out)
     {
-        const uint32 CopyLen = FMath::Min(Len, BufLen);
-        FMemory::Memcpy(Buf, Utf8.Get(), CopyLen);
+        return EUikaErrorCode::NullArgument;
+    }
+    for (uint32 i = 0; i < Count; ++i)
+    {
+        Out[i].value = UikaPackFName(UikaUtf8ToFName(Names[i].ptr, Names[i].len));
     }
     return EUikaErrorCode::Ok;
 }
@@ -104,6 +97,31 @@ static EUikaErrorCode FNameToStringImpl(UikaFNameHandle Handle, uint8* Buf, uint
 // Weak object pointers
 // ---------------------------------------------------------------------------
 
+// Chunk bases of GUObjectArray published to Rust through
+// FUikaObjectArrayView. Sized once to the array's fixed chunk capacity, so
+// the table never moves; chunks are appended as objects are allocated into
+// them and never move either.
+static TArray<const uint8*> GObjectChunks;
+static uint32 GObjectChunkCount = 0;
+
+static void PublishObjectChunks()
+{
+    FChunkedFixedUObjectArray& Objects = GUObjectArray.GetObjectItemArrayUnsafe();
+    constexpr int32 PerChunk = FChunkedFixedUObjectArray::NumElementsPerChunk;
+    if (GObjectChunks.Num() == 0)
+    {
+        GObjectChunks.SetNumZeroed((Objects.Capacity() + PerChunk - 1) / PerChunk);
+    }
+    const int32 Num = Objects.Num();
+    while (GObjectChunkCount < static_cast<uint32>(GObjectChunks.Num())
+        && static_cast<int64>(GObjectChunkCount) * PerChunk < Num)
+    {
+        GObjectChunks[GObjectChunkCount] = reinterpret_cast<const uint8*>(
+            Objects.GetObjectPtr(static_cast<int32>(GObjectChunkCount) * PerChunk));
+        ++GObjectChunkCount;
+    }
+}
+
 static UikaFWeakObjectHandle MakeWeakImpl(UikaUObjectHandle Obj)
 {
     UObject* Object = static_cast<UObject*>(Obj.ptr);
@@ -111,6 +129,8 @@ static UikaFWeakObjectHandle MakeWeakImpl(UikaUObjectHandle Obj)
     {
         return UikaFWeakObjectHandle{ -1, 0 };
     }
+    // Publish the object's chunk so Rust can resolve the handle inline.
+    PublishObjectChunks();
     FWeakObjectPtr Weak(Object);
     // FWeakObjectPtr stores ObjectIndex and ObjectSerialNumber internally.
     // Access via the Get() approach — we store the index/serial from the internal state.
@@ -121,6 +141,8 @@ static UikaFWeakObjectHandle MakeWeakImpl(UikaUObjectHandle Obj)
 
 static UikaUObjectHandle ResolveWeakImpl(UikaFWeakObjectHandle WeakHandle)
 {
+    // Rust falls back here for handles in unpublished chunks.
+    PublishObjectChunks();
     FWeakObjectPtr Weak;
     FMemory::Memcpy(&Weak, &WeakHandle, sizeof(WeakHandle));
     UObject* Resolved = Weak.Get();
@@ -134,6 +156,50 @@ static bool IsWeakValidImpl(UikaFWeakObjectHandle WeakHandle)
     return Weak.IsValid();
 }
 
+static EUikaErrorCode ResolveWeakManyImpl(const UikaFWeakObjectHandle* WeakHandles, uint32 Count, UikaUObjectHandle* Out)
+{
+    if (Count == 0)
+    {
+        return EUikaErrorCode::Ok;
+    }
+    if (!WeakHandles || !Out)
+    {
+        return EUikaErrorCode::NullArgument;
+    }
+    PublishObjectChunks();
+    FWeakObjectPtr Weak;
+    for (uint32 i = 0; i < Count; ++i)
+    {
+        FMemory::Memcpy(&Weak, &WeakHandles[i], sizeof(UikaFWeakObjectHandle));
+        Out[i] = UikaUObjectHandle{ Weak.Get() };
+    }
+    return EUikaErrorCode::Ok;
+}
+
+static EUikaErrorCode GetObjectArrayViewImpl(FUikaObjectArrayView* Out)
+{
+    if (!Out)
+    {
+        return EUikaErrorCode::NullArgument;
+    }
+#if defined(UE_PACK_FUOBJECT_ITEM) && UE_PACK_FUOBJECT_ITEM
+    // Flags and serial number are packed into a shared word: no plain field
+    // offsets to publish. Rust stays on resolve_weak.
+    return EUikaErrorCode::InvalidOperation;
+#else
+    PublishObjectChunks();
+    Out->chunks = GObjectChunks.GetData();
+    Out->num_chunks = &GObjectChunkCount;
+    Out->elements_per_chunk = FChunkedFixedUObjectArray::NumElementsPerChunk;
+    Out->item_size = sizeof(FUObjectItem);
+    Out->object_offset = offsetof(FUObjectItem, Object);
+    Out->flags_offset = offsetof(FUObjectItem, Flags);
+    Out->serial_offset = offsetof(FUObjectItem, SerialNumber);
+    Out->dead_flags = static_cast<int32>(EInternalObjectFlags::Unreachable | EInternalObjectFlags::Garbage);
+    return EUikaErrorCode::Ok;
+#endif
+}
+
 FUikaCoreApi GCoreApi = {
     &IsValidImpl,
     &GetNameImpl,
@@ -145,4 +211,7 @@ FUikaCoreApi GCoreApi = {
     &MakeWeakImpl,
     &ResolveWeakImpl,
     &IsWeakValidImpl,
+    &MakeFNamesBulkImpl,
+    &ResolveWeakManyImpl,
+    &GetObjectArrayViewImpl,
 };
@@ -6,6 +6,8 @@
 #include "UikaFNameHelper.h"
 #include "UObject/UnrealType.h"
 #include "UObject/TextProperty.h"
+#include "UObject/GCObject.h"
+#include "UObject/Package.h"
 
 #include "UikaModule.h"
 
@@ -25,14 +27,324 @@
         return EUikaErrorCode::PropertyNotFound;                            \
     }
 
+// ---------------------------------------------------------------------------
+// Proxy pool + owner index
+// ---------------------------------------------------------------------------
+
+// Free proxies kept beyond this count are dropped and left for GC.
+static constexpr int32 UikaMaxPooledProxies = 256;
+
+// Bound proxies of one owner, keyed by (delegate property, CallbackId): the
+// same callback may be bound to several delegates of one object.
+using FUikaBoundProxyKey = TPair<const FProperty*, uint64>;
+using FUikaOwnerProxies = TMap<FUikaBoundProxyKey, TObjectPtr<UUikaDelegateProxy>>;
+
+// Owns every proxy the delegate API hands out. Bound proxies are indexed by
+// owner, property and CallbackId so removal is two hash lookups instead of a
+// subobject scan; unbound proxies are reset and kept on a free list for
+// reuse. Owners are registered with the object tracker while they have bound
+// proxies; it releases those proxies when the owner is destroyed.
+// Proxies are outered to the transient package and kept alive by this
+// referencer, so binding no longer allocates a subobject per callback.
+//
+// A delegate invocation list copied before an unbind (a broadcast in
+// progress, a stored FScriptDelegate) can still fire a released proxy. Such
+// proxies sit on the cooling list, ignoring fires, until the frame they were
+// released in has ended; only then can they be rebound to a new callback.
+class FUikaDelegateProxyPool : public FGCObject
+{
+public:
+    TMap<const UObjectBase*, FUikaOwnerProxies> Bound;
+    TArray<TObjectPtr<UUikaDelegateProxy>> Free;
+    TArray<TObjectPtr<UUikaDelegateProxy>> Cooling;
+    uint64 CoolingFrame = 0;
+
+    virtual void AddReferencedObjects(FReferenceCollector& Collector) override
+    {
+        for (auto& OwnerPair : Bound)
+        {
+            for (auto& ProxyPair : OwnerPair.Value)
+            {
+                Collector.AddReferencedObject(ProxyPair.Value);
+            }
+        }
+        Collector.AddReferencedObjects(Free);
+        Collector.AddReferencedObjects(Cooling);
+    }
+
+    virtual FString GetReferencerName() const override
+    {
+        return TEXT("FUikaDelegateProxyPool");
+    }
+};
+
+// Created lazily: FGCObject registration needs the UObject system.
+static FUikaDelegateProxyPool* GProxyPool = nullptr;
+
+// Owner deletion and API calls may run on different threads during purge.
+static FCriticalSection GProxyPoolLock;
+
+// Move proxies released in an earlier frame from the cooling list to the
+// free list.
+static void PromoteCoolingProxies()
+{
+    if (GProxyPool->CoolingFrame == GFrameCounter)
+    {
+        return;
+    }
+    for (UUikaDelegateProxy* Proxy : GProxyPool->Cooling)
+    {
+        if (GProxyPool->Free.Num() < UikaMaxPooledProxies)
+        {
+            GProxyPool->Free.Add(Proxy);
+        }
+    }
+    GProxyPool->Cooling.Reset();
+    GProxyPool->CoolingFrame = GFrameCounter;
+}
+
+static void ReturnToPool(UUikaDelegateProxy* Proxy)
+{
+    Proxy->ResetForPool();
+    PromoteCoolingProxies();
+    if (GProxyPool->Free.Num() + GProxyPool->Cooling.Num() < UikaMaxPooledProxies)
+    {
+        GProxyPool->Cooling.Add(Proxy);
+    }
+}
+
+// Object tracker registration and epoch (defined in UikaLifecycleApiImpl.cpp).
+extern void UikaTrackDelegateOwner(const UObjectBase* Object);
+extern void UikaUntrackDelegateOwner(const UObjectBase* Object);
+extern void UikaBumpObjectEpoch();
+
+// Called by the object tracker when a tracked owner is destroyed. Its
+// delegates die with it, so nothing can still target its proxies.
+void UikaDelegateOnOwnerDeleted(const UObjectBase* Object)
+{
+    FScopeLock Lock(&GProxyPoolLock);
+    if (!GProxyPool)
+    {
+        return;
+    }
+    FUikaOwnerProxies Proxies;
+    if (GProxyPool->Bound.RemoveAndCopyValue(Object, Proxies))
+    {
+        for (auto& Pair : Proxies)
+        {
+            ReturnToPool(Pair.Value);
+        }
+    }
+}
+
+// Take a proxy from the pool (or create one) and index it under
+// (Owner, Property, CallbackId).
+static UUikaDelegateProxy* AcquireProxy(UObject* Owner, const FProperty* Property, uint64 CallbackId,
+                                        UFunction* Signature)
+{
+    FScopeLock Lock(&GProxyPoolLock);
+    if (!GProxyPool)
+    {
+        GProxyPool = new FUikaDelegateProxyPool();
+    }
+    PromoteCoolingProxies();
+
+    UUikaDelegateProxy* Proxy = nullptr;
+    while (!Proxy && GProxyPool->Free.Num() > 0)
+    {
+        Proxy = GProxyPool->Free.Pop(EAllowShrinking::No);
+        if (!IsValid(Proxy))
+        {
+            Proxy = nullptr;
+        }
+    }
+    if (!Proxy)
+    {
+        Proxy = NewObject<UUikaDelegateProxy>(GetTransientPackage());
+    }
+
+    Proxy->CallbackId = CallbackId;
+    Proxy->Signature = Signature;
+    Proxy->BoundProperty = Property;
+    Proxy->OwnerObject = Owner;
+    FUikaOwnerProxies* Proxies = GProxyPool->Bound.Find(Owner);
+    if (!Proxies)
+    {
+        Proxies = &GProxyPool->Bound.Add(Owner);
+        UikaTrackDelegateOwner(Owner);
+    }
+    Proxies->Add(FUikaBoundProxyKey(Property, CallbackId), Proxy);
+    return Proxy;
+}
+
+// Look up the bound proxy for (Owner, Property, CallbackId). The caller
+// unbinds it from the delegate and then calls ReleaseProxy.
+static UUikaDelegateProxy* FindBoundProxy(const UObject* Owner, const FProperty* Property, uint64 CallbackId)
+{
+    FScopeLock Lock(&GProxyPoolLock);
+    if (!GProxyPool)
+    {
+        return nullptr;
+    }
+    FUikaOwnerProxies* Proxies = GProxyPool->Bound.Find(Owner);
+    if (!Proxies)
+    {
+        return nullptr;
+    }
+    const TObjectPtr<UUikaDelegateProxy>* Found = Proxies->Find(FUikaBoundProxyKey(Property, CallbackId));
+    return Found ? Found->Get() : nullptr;
+}
+
+// Drop the index entry for a proxy that has already been unbound and recycle it.
+static void ReleaseProxy(const UObject* Owner, UUikaDelegateProxy* Proxy)
+{
+    FScopeLock Lock(&GProxyPoolLock);
+    if (!GProxyPool)
+    {
+        return;
+    }
+    if (FUikaOwnerProxies* Proxies = GProxyPool->Bound.Find(Owner))
+    {
+        Proxies->Remove(FUikaBoundProxyKey(Proxy->BoundProperty, Proxy->CallbackId));
+        if (Proxies->Num() == 0)
+        {
+            GProxyPool->Bound.Remove(Owner);
+            UikaUntrackDelegateOwner(Owner);
+        }
+    }
+    ReturnToPool(Proxy);
+}
+
+// Release whatever proxy (if any) a unicast delegate is currently bound to.
+static void ReleaseUnicastProxy(UObject* Owner, const FProperty* Property, const FScriptDelegate& Delegate)
+{
+    UUikaDelegateProxy* Previous = Cast<UUikaDelegateProxy>(Delegate.GetUObject());
+    if (Previous && Previous->CallbackId != 0
+        && FindBoundProxy(Owner, Property, Previous->CallbackId) == Previous)
+    {
+        ReleaseProxy(Owner, Previous);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Queued event state
+// ---------------------------------------------------------------------------
+
+// Queued bindings copy each fire into the write queue; take_queued_events
+// hands that queue to Rust and swaps in the other one, so events raised
+// while Rust drains land in the fresh queue. Allocations are kept across
+// swaps, so a steady event rate does no allocation at all.
+struct FUikaEventQueue
+{
+    TArray<uint8> Bytes;
+    uint32 Count = 0;
+};
+
+static constexpr int32 UikaQueuedEventHeaderSize = 16;
+
+// Fires beyond this many undrained bytes are dropped (and logged once).
+static constexpr int32 UikaMaxQueuedEventBytes = 8 * 1024 * 1024;
+
+static FUikaEventQueue GEventQueues[2];
+static int32 GEventWriteIndex = 0;
+static bool GEventOverflowLogged = false;
+static FCriticalSection GEventQueueLock;
+
+static void ResetEventQueues()
+{
+    FScopeLock Lock(&GEventQueueLock);
+    for (FUikaEventQueue& Queue : GEventQueues)
+    {
+        Queue.Bytes.Reset();
+        Queue.Count = 0;
+    }
+    GEventOverflowLogged = false;
+}
+
+// A signature can be queued if every parameter is an input whose
+// read_param encoding is a self-contained copy: numerics, bools, enums,
+// names, strings, text, object pointers and POD structs.
+static bool IsQueueableSignature(const UFunction* Signature)
+{
+    if (!Signature)
+    {
+        return false;
+    }
+    for (TFieldIterator<FProperty> It(Signature); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
+    {
+        const FProperty* Param = *It;
+        if (Param->HasAnyPropertyFlags(CPF_ReturnParm)
+            || (Param->HasAnyPropertyFlags(CPF_OutParm) && !Param->HasAnyPropertyFlags(CPF_ConstParm)))
+        {
+            return false;
+        }
+        if (const FStructProperty* StructProp = CastField<FStructProperty>(Param))
+        {
+            if (!(StructProp->Struct->StructFlags & STRUCT_IsPlainOldData))
+            {
+                return false;
+            }
+            continue;
+        }
+        if (!CastField<FNumericProperty>(Param)
+            && !CastField<FBoolProperty>(Param)
+            && !CastField<FEnumProperty>(Param)
+            && !CastField<FNameProperty>(Param)
+            && !CastField<FStrProperty>(Param)
+            && !CastField<FTextProperty>(Param)
+            && !CastField<FObjectPropertyBase>(Param))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Called from UikaModule.cpp during DLL unload. Bound proxies carry callback
+// IDs of the Rust instance being unloaded (IDs restart after reload), so they
+// are made inert and handed to GC; the delegates only hold them weakly.
+// Undrained queued events are dropped for the same reason. The free list
+// survives since it holds no Rust state.
+void UikaDelegateReleaseBoundProxies()
+{
+    ResetEventQueues();
+
+    FScopeLock Lock(&GProxyPoolLock);
+    if (!GProxyPool)
+    {
+        return;
+    }
+    for (auto& OwnerPair : GProxyPool->Bound)
+    {
+        for (auto& ProxyPair : OwnerPair.Value)
+        {
+            ProxyPair.Value->ResetForPool();
+        }
+        UikaUntrackDelegateOwner(OwnerPair.Key);
+    }
+    GProxyPool->Bound.Empty();
+}
+
+// Called from UikaModule.cpp at module shutdown.
+void UikaDelegateProxyPoolShutdown()
+{
+    FScopeLock Lock(&GProxyPoolLock);
+    if (GProxyPool)
+    {
+        delete GProxyPool;
+        GProxyPool = nullptr;
+    }
+}
+
 // ---------------------------------------------------------------------------
 // bind_delegate — bind a Rust callback to a unicast delegate
 // ---------------------------------------------------------------------------
 
-static EUikaErrorCode UikaDelegateApi_BindDelegate(
+static EUikaErrorCode BindDelegateImpl(
     UikaUObjectHandle ObjHandle,
     UikaFPropertyHandle PropHandle,
-    uint64 CallbackId)
+    uint64 CallbackId,
+    bool bQueued)
 {
     UIKA_CHECK_ARGS(ObjHandle, PropHandle);
 
@@ -41,6 +353,10 @@ static EUikaErrorCode UikaDelegateApi_BindDelegate(
     {
         return EUikaErrorCode::TypeMismatch;
     }
+    if (bQueued && !IsQueueableSignature(DelegateProp->SignatureFunction))
+    {
+        return EUikaErrorCode::TypeMismatch;
+    }
 
     FScriptDelegate* Delegate = DelegateProp->GetPropertyValuePtr_InContainer(Object);
     if (!Delegate)
@@ -48,17 +364,24 @@ static EUikaErrorCode UikaDelegateApi_BindDelegate(
         return EUikaErrorCode::InternalError;
     }
 
-    // Create the proxy with Object as outer (lifecycle tied to owner).
-    UUikaDelegateProxy* Proxy = NewObject<UUikaDelegateProxy>(Object);
-    Proxy->CallbackId = CallbackId;
-    Proxy->Signature = DelegateProp->SignatureFunction;
-    Proxy->OwnerObject = Object;
+    // Rebinding replaces the previous target; recycle its proxy.
+    ReleaseUnicastProxy(Object, DelegateProp, *Delegate);
 
+    UUikaDelegateProxy* Proxy = AcquireProxy(Object, DelegateProp, CallbackId, DelegateProp->SignatureFunction);
+    Proxy->bQueued = bQueued;
     Delegate->BindUFunction(Proxy, UUikaDelegateProxy::FakeFuncName);
 
     return EUikaErrorCode::Ok;
 }
 
+static EUikaErrorCode UikaDelegateApi_BindDelegate(
+    UikaUObjectHandle ObjHandle,
+    UikaFPropertyHandle PropHandle,
+    uint64 CallbackId)
+{
+    return BindDelegateImpl(ObjHandle, PropHandle, CallbackId, false);
+}
+
 // ---------------------------------------------------------------------------
 // unbind_delegate — unbind a unicast delegate
 // ---------------------------------------------------------------------------
@@ -81,6 +404,7 @@ static EUikaErrorCode UikaDelegateApi_UnbindDelegate(
         return EUikaErrorCode::InternalError;
     }
 
+    ReleaseUnicastProxy(Object, DelegateProp, *Delegate);
     Delegate->Unbind();
     return EUikaErrorCode::Ok;
 }
@@ -89,10 +413,11 @@ static EUikaErrorCode UikaDelegateApi_UnbindDelegate(
 // add_multicast — add a Rust callback to a multicast delegate
 // ---------------------------------------------------------------------------
 
-static EUikaErrorCode UikaDelegateApi_AddMulticast(
+static EUikaErrorCode AddMulticastImpl(
     UikaUObjectHandle ObjHandle,
     UikaFPropertyHandle PropHandle,
-    uint64 CallbackId)
+    uint64 CallbackId,
+    bool bQueued)
 {
     UIKA_CHECK_ARGS(ObjHandle, PropHandle);
 
@@ -101,12 +426,13 @@ static EUikaErrorCode UikaDelegateApi_AddMulticast(
     {
         return EUikaErrorCode::TypeMismatch;
     }
+    if (bQueued && !IsQueueableSignature(MultiProp->SignatureFunction))
+    {
+        return EUikaErrorCode::TypeMismatch;
+    }
 
-    // Create the proxy with Object as outer.
-    UUikaDelegateProxy* Proxy = NewObject<UUikaDelegateProxy>(Object);
-    Proxy->CallbackId = CallbackId;
-    Proxy->Signature = MultiProp->SignatureFunction;
-    Proxy->OwnerObject = Object;
+    UUikaDelegateProxy* Proxy = AcquireProxy(Object, MultiProp, CallbackId, MultiProp->SignatureFunction);
+    Proxy->bQueued = bQueued;
 
     // Build a script delegate targeting the proxy.
     FScriptDelegate ScriptDelegate;
@@ -118,6 +444,14 @@ static EUikaErrorCode UikaDelegateApi_AddMulticast(
     return EUikaErrorCode::Ok;
 }
 
+static EUikaErrorCode UikaDelegateApi_AddMulticast(
+    UikaUObjectHandle ObjHandle,
+    UikaFPropertyHandle PropHandle,
+    uint64 CallbackId)
+{
+    return AddMulticastImpl(ObjHandle, PropHandle, CallbackId, false);
+}
+
 // ---------------------------------------------------------------------------
 // remove_multicast — remove a Rust callback from a multicast delegate
 // ---------------------------------------------------------------------------
@@ -135,22 +469,14 @@ static EUikaErrorCode UikaDelegateApi_RemoveMulticast(
         return EUikaErrorCode::TypeMismatch;
     }
 
-    // Get the invocation list to find our proxy by CallbackId.
-    // For inline delegates we can access the invocation list directly.
-    // For both types, we iterate to find the matching proxy.
-    // Iterate all UUikaDelegateProxy objects owned by this Object to find the matching one.
-    TArray<UObject*> Children;
-    GetObjectsWithOuter(Object, Children, false);
-    for (UObject* Child : Children)
+    UUikaDelegateProxy* Proxy = FindBoundProxy(Object, MultiProp, CallbackId);
+    if (Proxy)
     {
-        UUikaDelegateProxy* Proxy = Cast<UUikaDelegateProxy>(Child);
-        if (Proxy && Proxy->CallbackId == CallbackId)
-        {
-            FScriptDelegate ScriptDelegate;
-            ScriptDelegate.BindUFunction(Proxy, UUikaDelegateProxy::FakeFuncName);
-            MultiProp->RemoveDelegate(ScriptDelegate, Object);
-            return EUikaErrorCode::Ok;
-        }
+        FScriptDelegate ScriptDelegate;
+        ScriptDelegate.BindUFunction(Proxy, UUikaDelegateProxy::FakeFuncName);
+        MultiProp->RemoveDelegate(ScriptDelegate, Object);
+        ReleaseProxy(Object, Proxy);
+        return EUikaErrorCode::Ok;
     }
 
     // CallbackId not found — not an error, just means it wasn't bound.
@@ -178,6 +504,7 @@ static EUikaErrorCode UikaDelegateApi_BroadcastMulticast(
     // This calls ProcessMulticastDelegate which fires all bound delegates.
     // ProcessMulticastDelegate is the ProcessEvent-based broadcast path.
     Object->ProcessEvent(MultiProp->SignatureFunction, Params);
+    UikaBumpObjectEpoch();
 
     return EUikaErrorCode::Ok;
 }
@@ -250,7 +577,7 @@ static EUikaErrorCode UikaDelegateApi_ReadParam(
         return EUikaErrorCode::Ok;
     }
 
-    // Struct -> CopyScriptStruct
+    // Struct -> memcpy for POD structs, CopyScriptStruct otherwise
     if (const FStructProperty* StructProp = CastField<FStructProperty>(Prop))
     {
         uint32 Size = StructProp->GetSize();
@@ -259,7 +586,14 @@ static EUikaErrorCode UikaDelegateApi_ReadParam(
         {
             return EUikaErrorCode::BufferTooSmall;
         }
-        StructProp->Struct->CopyScriptStruct(OutBuf, ValuePtr);
+        if (StructProp->Struct->StructFlags & STRUCT_IsPlainOldData)
+        {
+            FMemory::Memcpy(OutBuf, ValuePtr, Size);
+        }
+        else
+        {
+            StructProp->Struct->CopyScriptStruct(OutBuf, ValuePtr);
+        }
         return EUikaErrorCode::Ok;
     }
 
@@ -287,6 +621,110 @@ static EUikaErrorCode UikaDelegateApi_ReadParam(
     return EUikaErrorCode::Ok;
 }
 
+// ---------------------------------------------------------------------------
+// Queued events — opt-in deferred delivery drained by Rust once per tick
+// ---------------------------------------------------------------------------
+
+static EUikaErrorCode UikaDelegateApi_BindDelegateQueued(
+    UikaUObjectHandle ObjHandle,
+    UikaFPropertyHandle PropHandle,
+    uint64 CallbackId)
+{
+    return BindDelegateImpl(ObjHandle, PropHandle, CallbackId, true);
+}
+
+static EUikaErrorCode UikaDelegateApi_AddMulticastQueued(
+    UikaUObjectHandle ObjHandle,
+    UikaFPropertyHandle PropHandle,
+    uint64 CallbackId)
+{
+    return AddMulticastImpl(ObjHandle, PropHandle, CallbackId, true);
+}
+
+// Called by UUikaDelegateProxy::ProcessEvent for queued proxies. Appends one
+// record: header, then each input param as [u32 size][read_param bytes].
+void UikaDelegateEnqueueEvent(uint64 CallbackId, UFunction* Signature, void* Parms)
+{
+    FScopeLock Lock(&GEventQueueLock);
+    FUikaEventQueue& Queue = GEventQueues[GEventWriteIndex];
+    if (Queue.Bytes.Num() >= UikaMaxQueuedEventBytes)
+    {
+        if (!GEventOverflowLogged)
+        {
+            UE_LOG(LogUika, Warning,
+                TEXT("[Uika] Queued delegate events exceed %d bytes; dropping events until drained"),
+                UikaMaxQueuedEventBytes);
+            GEventOverflowLogged = true;
+        }
+        return;
+    }
+
+    const int32 HeaderPos = Queue.Bytes.Num();
+    Queue.Bytes.AddUninitialized(UikaQueuedEventHeaderSize);
+
+    uint32 ParamCount = 0;
+    for (TFieldIterator<FProperty> It(Signature); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
+    {
+        FProperty* Param = *It;
+        const int32 SizePos = Queue.Bytes.Num();
+        const int32 ValuePos = SizePos + sizeof(uint32);
+
+        // Most values fit the guess; strings may need one retry at the exact size.
+        uint32 Capacity = FMath::Max<uint32>(Param->GetSize(), 64);
+        Queue.Bytes.SetNumUninitialized(ValuePos + Capacity, EAllowShrinking::No);
+        uint32 Written = 0;
+        EUikaErrorCode Code = UikaDelegateApi_ReadParam(
+            UikaFPropertyHandle{ Param }, Parms, Param->GetOffset_ForUFunction(),
+            Queue.Bytes.GetData() + ValuePos, Capacity, &Written);
+        if (Code == EUikaErrorCode::BufferTooSmall)
+        {
+            Capacity = Written;
+            Queue.Bytes.SetNumUninitialized(ValuePos + Capacity, EAllowShrinking::No);
+            Code = UikaDelegateApi_ReadParam(
+                UikaFPropertyHandle{ Param }, Parms, Param->GetOffset_ForUFunction(),
+                Queue.Bytes.GetData() + ValuePos, Capacity, &Written);
+        }
+        if (Code != EUikaErrorCode::Ok)
+        {
+            Queue.Bytes.SetNumUninitialized(HeaderPos, EAllowShrinking::No);
+            return;
+        }
+
+        Queue.Bytes.SetNumUninitialized(ValuePos + Written, EAllowShrinking::No);
+        FMemory::Memcpy(Queue.Bytes.GetData() + SizePos, &Written, sizeof(uint32));
+        ++ParamCount;
+    }
+
+    const uint32 PayloadLen = static_cast<uint32>(Queue.Bytes.Num() - HeaderPos - UikaQueuedEventHeaderSize);
+    uint8* Header = Queue.Bytes.GetData() + HeaderPos;
+    FMemory::Memcpy(Header, &CallbackId, sizeof(uint64));
+    FMemory::Memcpy(Header + 8, &PayloadLen, sizeof(uint32));
+    FMemory::Memcpy(Header + 12, &ParamCount, sizeof(uint32));
+    ++Queue.Count;
+}
+
+static EUikaErrorCode UikaDelegateApi_TakeQueuedEvents(FUikaDelegateEventBatch* Out)
+{
+    if (!Out)
+    {
+        return EUikaErrorCode::NullArgument;
+    }
+
+    FScopeLock Lock(&GEventQueueLock);
+    const FUikaEventQueue& Filled = GEventQueues[GEventWriteIndex];
+    Out->data = Filled.Bytes.GetData();
+    Out->len = static_cast<uint32>(Filled.Bytes.Num());
+    Out->count = Filled.Count;
+
+    // The handed-out queue stays untouched until the next take.
+    GEventWriteIndex ^= 1;
+    FUikaEventQueue& Next = GEventQueues[GEventWriteIndex];
+    Next.Bytes.Reset();
+    Next.Count = 0;
+    GEventOverflowLogged = false;
+    return EUikaErrorCode::Ok;
+}
+
 // ---------------------------------------------------------------------------
 // Global API struct
 // ---------------------------------------------------------------------------
@@ -298,4 +736,7 @@ FUikaDelegateApi GDelegateApi = {
     &UikaDelegateApi_RemoveMulticast,
     &UikaDelegateApi_BroadcastMulticast,
     &UikaDelegateApi_ReadParam,
+    &UikaDelegateApi_BindDelegateQueued,
+    &UikaDelegateApi_AddMulticastQueued,
+    &UikaDelegateApi_TakeQueuedEvents,
 };
@@ -1,8 +1,12 @@
 #include "UikaDelegateProxy.h"
 #include "UikaApiTable.h"
+#include "UikaTrace.h"
 
 #include "UikaModule.h"
 
+// Queued-event sink (defined in UikaDelegateApiImpl.cpp).
+extern void UikaDelegateEnqueueEvent(uint64 CallbackId, UFunction* Signature, void* Parms);
+
 // Static member initialization.
 FName UUikaDelegateProxy::FakeFuncName(TEXT("RustFakeCallable"));
 
@@ -13,6 +17,15 @@ void UUikaDelegateProxy::RustFakeCallable()
     // BindUFunction(Proxy, FakeFuncName) resolves correctly.
 }
 
+void UUikaDelegateProxy::ResetForPool()
+{
+    CallbackId = 0;
+    bQueued = false;
+    Signature = nullptr;
+    BoundProperty = nullptr;
+    OwnerObject.Reset();
+}
+
 void UUikaDelegateProxy::ProcessEvent(UFunction* Function, void* Parms)
 {
     // Normal path: if the function isn't our fake callable, delegate to Super.
@@ -22,7 +35,20 @@ void UUikaDelegateProxy::ProcessEvent(UFunction* Function, void* Parms)
         return;
     }
 
+    // Pooled or released proxy: a stale delegate copy may still target it.
+    if (CallbackId == 0)
+    {
+        return;
+    }
+
+    if (bQueued)
+    {
+        UikaDelegateEnqueueEvent(CallbackId, Signature, Parms);
+        return;
+    }
+
     // Delegate invocation path: forward to Rust.
+    UIKA_TRACE_SCOPE(Uika_InvokeDelegateCallback);
     const FUikaRustCallbacks* Callbacks = GetUikaRustCallbacks();
     if (Callbacks && Callbacks->invoke_delegate_callback)
     {
@@ -1,95 +1,507 @@
 // UikaLifecycleApiImpl.cpp — FUikaLifecycleApi implementation.
 //
 // Provides GC root management and Pinned object destroy notification.
-// - add_gc_root / remove_gc_root: prevent/allow UE garbage collection
-// - register_pinned / unregister_pinned: track Pinned objects for destroy notification
+// - add_gc_root / remove_gc_root (+ _many): hold objects in the Rust root set
+// - register_pinned / unregister_pinned (+ _many): track Pinned objects for destroy notification
+//
+// Also hosts the plugin's single UObject delete listener (see "Unified object
+// delete tracking"), shared by reified instances, Pinned objects and
+// delegate owners, and the object destruction epoch (see "Object epoch").
 
 #include "UikaApiTable.h"
+#include "UikaTrace.h"
+#include "UUikaReifiedClass.h"
+#include "Misc/CoreDelegates.h"
 #include "UObject/UObjectGlobals.h"
 #include "UObject/UObjectArray.h"
+#include "UObject/GCObject.h"
+
+#include <atomic>
 
 // Access to Rust callbacks (defined in UikaModule.cpp).
 extern const FUikaRustCallbacks* GetUikaRustCallbacks();
 
 // ---------------------------------------------------------------------------
-// GC root management
+// Unified object delete tracking
 // ---------------------------------------------------------------------------
+//
+// One delete listener serves every subsystem that needs to hear about a
+// specific object's destruction: reified-class instances, Pinned objects and
+// delegate owners. A dense bitmap indexed by GUObjectArray index rejects
+// untracked objects with a single bit test, so the listener costs almost
+// nothing for the bulk of a GC purge. Tracked deaths that need Rust are
+// buffered and delivered in one batched call per purge (or per frame for
+// incremental purges) instead of one FFI call per object.
 
-static void AddGcRootImpl(UikaUObjectHandle Obj)
+enum EUikaTrackKind : uint8
+{
+    UikaTrack_Reified       = 1 << 0,
+    UikaTrack_Pinned        = 1 << 1,
+    UikaTrack_DelegateOwner = 1 << 2,
+    UikaTrack_Rooted        = 1 << 3,
+};
+
+// Delegate proxy release hook (defined in UikaDelegateApiImpl.cpp).
+extern void UikaDelegateOnOwnerDeleted(const UObjectBase* Object);
+
+// Root set release hook (see "GC root set" below).
+static void RootSetOnDeleted(const UObjectBase* Object);
+
+// Per tracked index: which subsystems care, and the reified class an
+// instance was constructed as (its ancestor, for Blueprint children).
+struct FUikaTrackedEntry
+{
+    uint8 Kinds = 0;
+    UUikaReifiedClass* ReifiedClass = nullptr;
+};
+
+struct FUikaObjectTracker
+{
+    // One bit per GUObjectArray slot, sized to the array capacity so it never
+    // reallocates under a concurrent (async purge) reader. Updated atomically.
+    TArray<uint32> TrackedBits;
+
+    // Entries per tracked index, and the buffered deaths still to deliver.
+    TMap<int32, FUikaTrackedEntry> Entries;
+    TArray<FUikaDeadInstance> DeadInstances;
+    TArray<UikaUObjectHandle> DeadPinned;
+    // Addresses with a buffered death; a new registration at one of them
+    // must wait for that death to reach Rust.
+    TSet<const UObjectBase*> DeadAddresses;
+    FCriticalSection Lock;
+
+    // Set when the dead buffers become non-empty; lets flushes skip the lock.
+    std::atomic<bool> bHasDead{ false };
+};
+
+static FUikaObjectTracker GTracker;
+
+// Set of UObject pointers that have active Pinned<T> handles in Rust.
+// Kept for unload cleanup (see UikaPinnedReleaseAll). Guarded by GTracker.Lock.
+static TSet<const UObjectBase*> GPinnedObjects;
+
+static bool GTrackerRegistered = false;
+static FDelegateHandle GPostPurgeHandle;
+static FDelegateHandle GEndFrameHandle;
+static FDelegateHandle GPreGcHandle;
+
+// ---------------------------------------------------------------------------
+// Object epoch
+// ---------------------------------------------------------------------------
+//
+// Bumped whenever some object may have stopped being IsValid: every delete,
+// the start of each GC (reachability marks objects Unreachable), and after
+// API calls that run arbitrary game code (ProcessEvent, spawning, command
+// buffers), which is where Destroy/MarkAsGarbage happen from Rust's point of
+// view. Rust reads it through object_epoch and trusts an is_valid result for
+// as long as the value is unchanged.
+
+static std::atomic<uint64> GObjectEpoch{ 1 };
+static_assert(sizeof(GObjectEpoch) == sizeof(uint64) && std::atomic<uint64>::is_always_lock_free,
+    "Rust reads the epoch as an AtomicU64");
+
+void UikaBumpObjectEpoch()
 {
-    UObject* Object = static_cast<UObject*>(Obj.ptr);
-    if (::IsValid(Object))
+    GObjectEpoch.fetch_add(1, std::memory_order_release);
+}
+
+static bool IsTrackedIndex(int32 Index)
+{
+    const int32 Word = Index >> 5;
+    if (Index < 0 || Word >= GTracker.TrackedBits.Num())
     {
-        Object->AddToRoot();
+        return false;
     }
+    const uint32 Bits = FPlatformAtomics::AtomicRead(
+        reinterpret_cast<volatile int32*>(&GTracker.TrackedBits[Word]));
+    return (Bits & (1u << (Index & 31))) != 0;
 }
 
-static void RemoveGcRootImpl(UikaUObjectHandle Obj)
+static void SetTrackedBit(int32 Index, bool bSet)
 {
-    UObject* Object = static_cast<UObject*>(Obj.ptr);
-    if (::IsValid(Object))
+    volatile int32* Word = reinterpret_cast<volatile int32*>(&GTracker.TrackedBits[Index >> 5]);
+    const int32 Mask = static_cast<int32>(1u << (Index & 31));
+    if (bSet)
     {
-        Object->RemoveFromRoot();
+        FPlatformAtomics::InterlockedOr(Word, Mask);
+    }
+    else
+    {
+        FPlatformAtomics::InterlockedAnd(Word, ~Mask);
     }
 }
 
-// ---------------------------------------------------------------------------
-// Pinned object tracking + destroy notification
-// ---------------------------------------------------------------------------
+// Deliver buffered deaths to Rust. Runs on the game thread post-purge and at
+// the end of each frame; TrackObject only forces it when a new registration
+// lands on an address whose death is still buffered, so the death is always
+// delivered before another object is tracked at that address.
+static void FlushDeadObjects()
+{
+    if (!GTracker.bHasDead.load(std::memory_order_acquire))
+    {
+        return;
+    }
 
-// Set of UObject pointers that have active Pinned<T> handles in Rust.
-// Checked by the delete listener to fire notify_pinned_destroyed.
-static TSet<const UObjectBase*> GPinnedObjects;
+    TArray<FUikaDeadInstance> Instances;
+    TArray<UikaUObjectHandle> Pinned;
+    {
+        FScopeLock Lock(&GTracker.Lock);
+        Swap(Instances, GTracker.DeadInstances);
+        Swap(Pinned, GTracker.DeadPinned);
+        GTracker.DeadAddresses.Reset();
+        GTracker.bHasDead.store(false, std::memory_order_release);
+    }
 
-// Delete listener that watches GUObjectArray for pinned object destruction.
-// Extends the existing FUikaDeleteListener pattern from UikaReifyApiImpl.cpp.
-class FUikaPinnedDeleteListener : public FUObjectArray::FUObjectDeleteListener
+    UIKA_TRACE_SCOPE(Uika_NotifyDestroyed);
+    const FUikaRustCallbacks* Callbacks = GetUikaRustCallbacks();
+    if (Callbacks && Instances.Num() > 0 && Callbacks->drop_rust_instances)
+    {
+        Callbacks->drop_rust_instances(Instances.GetData(), static_cast<uint32>(Instances.Num()));
+    }
+    if (Callbacks && Pinned.Num() > 0 && Callbacks->notify_pinned_destroyed_many)
+    {
+        Callbacks->notify_pinned_destroyed_many(Pinned.GetData(), static_cast<uint32>(Pinned.Num()));
+    }
+
+    // Hand the allocations back for the next purge.
+    FScopeLock Lock(&GTracker.Lock);
+    if (GTracker.DeadInstances.Num() == 0)
+    {
+        Instances.Reset();
+        Swap(Instances, GTracker.DeadInstances);
+    }
+    if (GTracker.DeadPinned.Num() == 0)
+    {
+        Pinned.Reset();
+        Swap(Pinned, GTracker.DeadPinned);
+    }
+}
+
+class FUikaObjectDeleteListener : public FUObjectArray::FUObjectDeleteListener
 {
 public:
     virtual void NotifyUObjectDeleted(const UObjectBase* Object, int32 Index) override
     {
-        if (!GPinnedObjects.Contains(Object))
+        UikaBumpObjectEpoch();
+        if (!IsTrackedIndex(Index))
         {
             return;
         }
+        SetTrackedBit(Index, false);
 
-        // Notify Rust that this pinned object has been destroyed.
-        const FUikaRustCallbacks* Callbacks = GetUikaRustCallbacks();
-        if (Callbacks && Callbacks->notify_pinned_destroyed)
+        FUikaTrackedEntry Entry;
+        uint8 Kinds = 0;
         {
-            Callbacks->notify_pinned_destroyed(
-                UikaUObjectHandle{ const_cast<UObjectBase*>(Object) });
+            FScopeLock Lock(&GTracker.Lock);
+            GTracker.Entries.RemoveAndCopyValue(Index, Entry);
+            Kinds = Entry.Kinds;
+
+            // Reified classes are rooted, so the class outlives its instances.
+            if ((Kinds & UikaTrack_Reified) && Entry.ReifiedClass)
+            {
+                Entry.ReifiedClass->RemoveLiveInstance(Object);
+                GTracker.DeadInstances.Add(FUikaDeadInstance{
+                    UikaUObjectHandle{ const_cast<UObjectBase*>(Object) },
+                    Entry.ReifiedClass->RustTypeId });
+            }
+            if (Kinds & UikaTrack_Pinned)
+            {
+                // The Pinned<T> drop will call unregister_pinned, but the
+                // object is already gone, so clean up proactively.
+                GPinnedObjects.Remove(Object);
+                GTracker.DeadPinned.Add(UikaUObjectHandle{ const_cast<UObjectBase*>(Object) });
+            }
+            if (Kinds & (UikaTrack_Reified | UikaTrack_Pinned))
+            {
+                GTracker.DeadAddresses.Add(Object);
+                GTracker.bHasDead.store(true, std::memory_order_release);
+            }
         }
 
-        // Remove from tracking — the Pinned<T> drop will call unregister_pinned
-        // but the object is already gone, so we clean up proactively.
-        GPinnedObjects.Remove(Object);
+        if (Kinds & UikaTrack_DelegateOwner)
+        {
+            UikaDelegateOnOwnerDeleted(Object);
+        }
+        if (Kinds & UikaTrack_Rooted)
+        {
+            RootSetOnDeleted(Object);
+        }
     }
 
     virtual void OnUObjectArrayShutdown() override
     {
         GUObjectArray.RemoveUObjectDeleteListener(this);
+        GTrackerRegistered = false;
     }
 };
 
-static FUikaPinnedDeleteListener GPinnedDeleteListener;
-static bool GPinnedListenerRegistered = false;
+static FUikaObjectDeleteListener GObjectDeleteListener;
+
+static void EnsureTrackerRegistered()
+{
+    if (GTrackerRegistered)
+    {
+        return;
+    }
+    GTracker.TrackedBits.SetNumZeroed((GUObjectArray.GetObjectArrayCapacity() + 31) / 32);
+    GUObjectArray.AddUObjectDeleteListener(&GObjectDeleteListener);
+    GPostPurgeHandle = FCoreUObjectDelegates::GetPostPurgeGarbageDelegate().AddStatic(&FlushDeadObjects);
+    GEndFrameHandle = FCoreDelegates::OnEndFrame.AddStatic(&FlushDeadObjects);
+    GPreGcHandle = FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddStatic(&UikaBumpObjectEpoch);
+    GTrackerRegistered = true;
+}
 
-static void EnsurePinnedListenerRegistered()
+static void TrackObject(const UObjectBase* Object, uint8 Kind, UUikaReifiedClass* ReifiedClass = nullptr)
 {
-    if (!GPinnedListenerRegistered)
+    EnsureTrackerRegistered();
+    if ((Kind & (UikaTrack_Reified | UikaTrack_Pinned)) && GTracker.bHasDead.load(std::memory_order_acquire))
     {
-        GUObjectArray.AddUObjectDeleteListener(&GPinnedDeleteListener);
-        GPinnedListenerRegistered = true;
+        bool bAddressReused = false;
+        {
+            FScopeLock Lock(&GTracker.Lock);
+            bAddressReused = GTracker.DeadAddresses.Contains(Object);
+        }
+        if (bAddressReused)
+        {
+            FlushDeadObjects();
+        }
     }
+
+    const int32 Index = GUObjectArray.ObjectToIndex(Object);
+    if (Index < 0 || (Index >> 5) >= GTracker.TrackedBits.Num())
+    {
+        return;
+    }
+    FScopeLock Lock(&GTracker.Lock);
+    FUikaTrackedEntry& Entry = GTracker.Entries.FindOrAdd(Index);
+    Entry.Kinds |= Kind;
+    if (ReifiedClass)
+    {
+        Entry.ReifiedClass = ReifiedClass;
+    }
+    SetTrackedBit(Index, true);
+}
+
+static void UntrackObject(const UObjectBase* Object, uint8 Kind)
+{
+    if (!GTrackerRegistered)
+    {
+        return;
+    }
+    const int32 Index = GUObjectArray.ObjectToIndex(Object);
+    FScopeLock Lock(&GTracker.Lock);
+    FUikaTrackedEntry* Entry = GTracker.Entries.Find(Index);
+    if (!Entry)
+    {
+        return;
+    }
+    Entry->Kinds &= ~Kind;
+    if (Entry->Kinds == 0)
+    {
+        GTracker.Entries.Remove(Index);
+        SetTrackedBit(Index, false);
+    }
+}
+
+// Called from UikaClassConstructor for every reified-class instance.
+void UikaTrackReifiedInstance(const UObjectBase* Object, UUikaReifiedClass* ReifiedClass)
+{
+    TrackObject(Object, UikaTrack_Reified, ReifiedClass);
+}
+
+// Called by the delegate API when an object first gets a proxy bound.
+void UikaTrackDelegateOwner(const UObjectBase* Object)
+{
+    TrackObject(Object, UikaTrack_DelegateOwner);
+}
+
+// Called by the delegate API when an owner's last proxy is released.
+void UikaUntrackDelegateOwner(const UObjectBase* Object)
+{
+    UntrackObject(Object, UikaTrack_DelegateOwner);
 }
 
+// ---------------------------------------------------------------------------
+// GC root set
+// ---------------------------------------------------------------------------
+//
+// Objects rooted from Rust are held by one FGCObject instead of AddToRoot:
+// a dense array reported in a single AddReferencedObjects call, which keeps
+// Uika off the root flags GC itself uses. Each object is counted, so two
+// Pinned<T> of one object need two removals. Removal swaps the last slot in.
+// Rooted objects are tracked, so a destroyed one (its reference nulled by
+// garbage elimination) drops out when it is deleted.
+
+class FUikaRootSet : public FGCObject
+{
+public:
+    TArray<TObjectPtr<UObject>> Objects;
+    // Parallel to Objects: the original pointer (Objects entries may be nulled
+    // by GC) and its root count.
+    TArray<const UObjectBase*> Keys;
+    TArray<int32> Counts;
+    TMap<const UObjectBase*, int32> Slots;
+
+    // Returns true if Object was not rooted before.
+    bool Add(UObject* Object)
+    {
+        if (const int32* Slot = Slots.Find(Object))
+        {
+            ++Counts[*Slot];
+            return false;
+        }
+        Slots.Add(Object, Objects.Add(Object));
+        Keys.Add(Object);
+        Counts.Add(1);
+        return true;
+    }
+
+    // Returns true if this released the object's last root.
+    bool Remove(const UObjectBase* Object, bool bAllRoots)
+    {
+        const int32* Slot = Slots.Find(Object);
+        if (!Slot)
+        {
+            return false;
+        }
+        const int32 Index = *Slot;
+        if (!bAllRoots && --Counts[Index] > 0)
+        {
+            return false;
+        }
+        Slots.Remove(Object);
+        const int32 Last = Objects.Num() - 1;
+        if (Index != Last)
+        {
+            Objects[Index] = Objects[Last];
+            Keys[Index] = Keys[Last];
+            Counts[Index] = Counts[Last];
+            Slots[Keys[Index]] = Index;
+        }
+        Objects.Pop(EAllowShrinking::No);
+        Keys.Pop(EAllowShrinking::No);
+        Counts.Pop(EAllowShrinking::No);
+        return true;
+    }
+
+    void Reset()
+    {
+        Objects.Reset();
+        Keys.Reset();
+        Counts.Reset();
+        Slots.Reset();
+    }
+
+    virtual void AddReferencedObjects(FReferenceCollector& Collector) override
+    {
+        Collector.AddReferencedObjects(Objects);
+    }
+
+    virtual FString GetReferencerName() const override
+    {
+        return TEXT("FUikaRootSet");
+    }
+};
+
+// Created lazily: FGCObject registration needs the UObject system.
+static FUikaRootSet* GRootSet = nullptr;
+static FCriticalSection GRootSetLock;
+
+static void AddGcRoots(const UikaUObjectHandle* Objs, uint32 Count)
+{
+    TArray<UObject*, TInlineAllocator<16>> FirstRooted;
+    {
+        FScopeLock Lock(&GRootSetLock);
+        if (!GRootSet)
+        {
+            GRootSet = new FUikaRootSet();
+        }
+        for (uint32 i = 0; i < Count; ++i)
+        {
+            UObject* Object = static_cast<UObject*>(Objs[i].ptr);
+            if (::IsValid(Object) && GRootSet->Add(Object))
+            {
+                FirstRooted.Add(Object);
+            }
+        }
+    }
+    // The objects are rooted now, so they cannot be deleted before tracking.
+    for (UObject* Object : FirstRooted)
+    {
+        TrackObject(Object, UikaTrack_Rooted);
+    }
+}
+
+static void RemoveGcRoots(const UikaUObjectHandle* Objs, uint32 Count)
+{
+    TArray<const UObjectBase*, TInlineAllocator<16>> Released;
+    {
+        FScopeLock Lock(&GRootSetLock);
+        if (!GRootSet)
+        {
+            return;
+        }
+        for (uint32 i = 0; i < Count; ++i)
+        {
+            const UObjectBase* Object = static_cast<const UObjectBase*>(Objs[i].ptr);
+            if (Object && GRootSet->Remove(Object, false))
+            {
+                Released.Add(Object);
+            }
+        }
+    }
+    for (const UObjectBase* Object : Released)
+    {
+        UntrackObject(Object, UikaTrack_Rooted);
+    }
+}
+
+static void RootSetOnDeleted(const UObjectBase* Object)
+{
+    FScopeLock Lock(&GRootSetLock);
+    if (GRootSet)
+    {
+        GRootSet->Remove(Object, true);
+    }
+}
+
+static void AddGcRootImpl(UikaUObjectHandle Obj)
+{
+    AddGcRoots(&Obj, 1);
+}
+
+static void RemoveGcRootImpl(UikaUObjectHandle Obj)
+{
+    RemoveGcRoots(&Obj, 1);
+}
+
+static void AddGcRootManyImpl(const UikaUObjectHandle* Objs, uint32 Count)
+{
+    if (Objs)
+    {
+        AddGcRoots(Objs, Count);
+    }
+}
+
+static void RemoveGcRootManyImpl(const UikaUObjectHandle* Objs, uint32 Count)
+{
+    if (Objs)
+    {
+        RemoveGcRoots(Objs, Count);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Pinned registration
+// ---------------------------------------------------------------------------
+
 static void RegisterPinnedImpl(UikaUObjectHandle Obj)
 {
     const UObjectBase* Object = static_cast<const UObjectBase*>(Obj.ptr);
     if (Object)
     {
-        EnsurePinnedListenerRegistered();
+        TrackObject(Object, UikaTrack_Pinned);
+        FScopeLock Lock(&GTracker.Lock);
         GPinnedObjects.Add(Object);
     }
 }
@@ -97,36 +509,130 @@ static void RegisterPinnedImpl(UikaUObjectHandle Obj)
 static void UnregisterPinnedImpl(UikaUObjectHandle Obj)
 {
     const UObjectBase* Object = static_cast<const UObjectBase*>(Obj.ptr);
-    if (Object)
+    if (!Object)
+    {
+        return;
+    }
+    // Only untrack objects still in the set: if the listener already removed
+    // it, the object is gone and its memory must not be touched.
+    bool bWasPinned = false;
+    {
+        FScopeLock Lock(&GTracker.Lock);
+        bWasPinned = GPinnedObjects.Remove(Object) > 0;
+    }
+    if (bWasPinned)
+    {
+        UntrackObject(Object, UikaTrack_Pinned);
+    }
+}
+
+static void RegisterPinnedManyImpl(const UikaUObjectHandle* Objs, uint32 Count)
+{
+    if (!Objs || Count == 0)
+    {
+        return;
+    }
+    for (uint32 i = 0; i < Count; ++i)
+    {
+        if (const UObjectBase* Object = static_cast<const UObjectBase*>(Objs[i].ptr))
+        {
+            TrackObject(Object, UikaTrack_Pinned);
+        }
+    }
+    FScopeLock Lock(&GTracker.Lock);
+    for (uint32 i = 0; i < Count; ++i)
+    {
+        if (const UObjectBase* Object = static_cast<const UObjectBase*>(Objs[i].ptr))
+        {
+            GPinnedObjects.Add(Object);
+        }
+    }
+}
+
+static void UnregisterPinnedManyImpl(const UikaUObjectHandle* Objs, uint32 Count)
+{
+    if (!Objs || Count == 0)
+    {
+        return;
+    }
+    TArray<const UObjectBase*, TInlineAllocator<16>> WasPinned;
+    {
+        FScopeLock Lock(&GTracker.Lock);
+        for (uint32 i = 0; i < Count; ++i)
+        {
+            const UObjectBase* Object = static_cast<const UObjectBase*>(Objs[i].ptr);
+            if (Object && GPinnedObjects.Remove(Object) > 0)
+            {
+                WasPinned.Add(Object);
+            }
+        }
+    }
+    for (const UObjectBase* Object : WasPinned)
     {
-        GPinnedObjects.Remove(Object);
+        UntrackObject(Object, UikaTrack_Pinned);
     }
 }
 
+// Called from UikaModule.cpp before the Rust side shuts down, so buffered
+// deaths reach the DLL that owns the instances.
+void UikaObjectTrackerFlush()
+{
+    FlushDeadObjects();
+}
+
 // Called from UikaModule.cpp during DLL unload to clean up.
 //
 // Hot reload note: when the Rust DLL is unloaded, user statics holding
 // Pinned<T> values are forgotten without their Drop running, so Rust never
-// calls remove_gc_root for them. Without this loop those objects stay in
-// UE's root set forever and trip the !IsRooted() assertion when PIE later
-// tries to clean up the world. We mirror what Pinned<T>::drop would have
-// done on the C++ side.
-void UikaPinnedUnregisterDeleteListener()
+// calls remove_gc_root for them. Without this those objects would stay
+// referenced forever and leak the world when PIE later tries to clean it up.
+// The root set is simply emptied; Rooted tracking bits left behind are
+// dropped when their objects are deleted (RootSetOnDeleted then finds no
+// entry).
+void UikaPinnedReleaseAll()
 {
-    if (GPinnedListenerRegistered)
+    TArray<const UObjectBase*> Tracked;
     {
-        GUObjectArray.RemoveUObjectDeleteListener(&GPinnedDeleteListener);
-        GPinnedListenerRegistered = false;
+        FScopeLock Lock(&GTracker.Lock);
+        Tracked = GPinnedObjects.Array();
+        GPinnedObjects.Empty();
     }
-    for (const UObjectBase* TrackedBase : GPinnedObjects)
+    for (const UObjectBase* TrackedBase : Tracked)
     {
-        UObject* Object = static_cast<UObject*>(const_cast<UObjectBase*>(TrackedBase));
-        if (::IsValid(Object) && Object->IsRooted())
-        {
-            Object->RemoveFromRoot();
-        }
+        UntrackObject(TrackedBase, UikaTrack_Pinned);
+    }
+
+    FScopeLock Lock(&GRootSetLock);
+    if (GRootSet)
+    {
+        GRootSet->Reset();
     }
-    GPinnedObjects.Empty();
+}
+
+// Called from UikaModule.cpp at module shutdown.
+void UikaObjectTrackerShutdown()
+{
+    if (!GTrackerRegistered)
+    {
+        return;
+    }
+    FlushDeadObjects();
+    GUObjectArray.RemoveUObjectDeleteListener(&GObjectDeleteListener);
+    FCoreUObjectDelegates::GetPostPurgeGarbageDelegate().Remove(GPostPurgeHandle);
+    FCoreDelegates::OnEndFrame.Remove(GEndFrameHandle);
+    FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Remove(GPreGcHandle);
+    GTrackerRegistered = false;
+
+    FScopeLock Lock(&GRootSetLock);
+    delete GRootSet;
+    GRootSet = nullptr;
+}
+
+static const uint64* ObjectEpochImpl()
+{
+    // The epoch is only complete once the delete listener is installed.
+    EnsureTrackerRegistered();
+    return reinterpret_cast<const uint64*>(&GObjectEpoch);
 }
 
 // ---------------------------------------------------------------------------
@@ -138,4 +644,9 @@ FUikaLifecycleApi GLifecycleApi = {
     &RemoveGcRootImpl,
     &RegisterPinnedImpl,
     &UnregisterPinnedImpl,
+    &ObjectEpochImpl,
+    &AddGcRootManyImpl,
+    &RemoveGcRootManyImpl,
+    &RegisterPinnedManyImpl,
+    &UnregisterPinnedManyImpl,
 };
@@ -0,0 +1,476 @@
+// UikaLoggingApiImpl.cpp — FUikaLoggingApi implementation.
+// Rust log records go into a lock-free multi-producer ring and are written
+// to GLog by a background drain thread; errors are written synchronously.
+// The per-category verbosity table the Rust side filters against before
+// formatting is refreshed on the game thread every frame.
+
+#include "UikaApiTable.h"
+#include "UikaModule.h"
+#include "HAL/Event.h"
+#include "Misc/CoreDelegates.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Logging/LogCategory.h"
+#include "Misc/OutputDeviceRedirector.h"
+
+#include <atomic>
+
+// ---------------------------------------------------------------------------
+// Categories
+// ---------------------------------------------------------------------------
+
+static constexpr uint32 UikaMaxLogCategories = 256;
+
+namespace
+{
+    // [0] is LogUika; the rest are created on first registration and live
+    // until module shutdown, so ids stay stable across hot reloads.
+    FLogCategoryBase* GCategories[UikaMaxLogCategories] = {};
+    std::atomic<uint32> GCategoryCount{ 0 };
+    TArray<FLogCategoryBase*> GOwnedCategories;
+    FCriticalSection GCategoryLock;
+
+    // Published to Rust as a plain byte table.
+    std::atomic<uint8> GVerbosity[UikaMaxLogCategories] = {};
+}
+
+static_assert(sizeof(std::atomic<uint8>) == 1 && std::atomic<uint8>::is_always_lock_free,
+    "verbosity_table is read by Rust as plain bytes");
+
+static uint8 EffectiveVerbosity(const FLogCategoryBase* Category)
+{
+    return static_cast<uint8>(Category->GetVerbosity() & ELogVerbosity::VerbosityMask);
+}
+
+// Pick up `Log <Category> <Verbosity>` and friends. Runs on the game thread
+// at the start of every frame, and when a category is registered.
+static void RefreshVerbosity()
+{
+    const uint32 Count = GCategoryCount.load(std::memory_order_acquire);
+    for (uint32 i = 0; i < Count; ++i)
+    {
+        const uint8 Verbosity = EffectiveVerbosity(GCategories[i]);
+        if (GVerbosity[i].load(std::memory_order_relaxed) != Verbosity)
+        {
+            GVerbosity[i].store(Verbosity, std::memory_order_relaxed);
+        }
+    }
+}
+
+static FLogCategoryBase* CategoryFor(uint16 Id)
+{
+    return Id < GCategoryCount.load(std::memory_order_acquire) ? GCategories[Id] : &LogUika;
+}
+
+// Rust level (0=Display, 1=Warning, 2=Error, 3=Verbose, 4=VeryVerbose).
+static ELogVerbosity::Type ToVerbosity(uint8 Level)
+{
+    switch (Level)
+    {
+    case 0:  return ELogVerbosity::Display;
+    case 1:  return ELogVerbosity::Warning;
+    case 3:  return ELogVerbosity::Verbose;
+    case 4:  return ELogVerbosity::VeryVerbose;
+    default: return ELogVerbosity::Error;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Rendering: "message {key=value, key=value}"
+// ---------------------------------------------------------------------------
+
+static void AppendUtf8(FString& Out, const uint8* Str, uint32 Len)
+{
+    if (Len)
+    {
+        const FUTF8ToTCHAR Conv(reinterpret_cast<const ANSICHAR*>(Str), Len);
+        Out.AppendChars(Conv.Get(), Conv.Length());
+    }
+}
+
+static void AppendField(FString& Out, uint32 Index, const uint8* Key, uint32 KeyLen, const uint8* Value, uint32 ValueLen)
+{
+    Out += Index == 0 ? TEXT(" {") : TEXT(", ");
+    AppendUtf8(Out, Key, KeyLen);
+    Out += TEXT('=');
+    AppendUtf8(Out, Value, ValueLen);
+}
+
+static void Emit(const FString& Line, ELogVerbosity::Type Verbosity, const FLogCategoryBase* Category, double Time)
+{
+    // Time is the enqueue time, so drained lines keep their own timestamps.
+    GLog->Serialize(*Line, Verbosity, Category->GetCategoryName(), Time);
+}
+
+// Synchronous path: errors, oversized records, and logging before startup /
+// after shutdown.
+static void EmitDirect(uint8 Level, uint16 Category, const uint8* Msg, uint32 MsgLen,
+                       const FUikaLogField* Fields, uint32 FieldCount)
+{
+    FString Line;
+    AppendUtf8(Line, Msg, MsgLen);
+    for (uint32 i = 0; i < FieldCount; ++i)
+    {
+        AppendField(Line, i, Fields[i].key.ptr, Fields[i].key.len, Fields[i].value.ptr, Fields[i].value.len);
+    }
+    if (FieldCount)
+    {
+        Line += TEXT('}');
+    }
+    Emit(Line, ToVerbosity(Level), CategoryFor(Category), FPlatformTime::Seconds() - GStartTime);
+}
+
+// ---------------------------------------------------------------------------
+// Record ring (bounded MPSC, per-slot sequence numbers)
+// ---------------------------------------------------------------------------
+// Slot payload: message bytes, then per field [u16 key_len][key][u16 value_len][value].
+
+static constexpr uint32 UikaLogRingSize = 2048;   // power of two
+static constexpr uint32 UikaLogSlotBytes = 512;
+static constexpr uint32 UikaLogWakeBatch = 256;   // wake the drain every N records
+static constexpr uint32 UikaLogDrainIntervalMs = 10;
+
+struct alignas(64) FUikaLogSlot
+{
+    // Pos: free for the producer claiming Pos; Pos + 1: filled.
+    std::atomic<uint64> Sequence;
+    double Time;
+    uint16 MsgLen;
+    uint16 Length;
+    uint16 Category;
+    uint8  Level;
+    uint8  FieldCount;
+    uint8  Payload[UikaLogSlotBytes - 24];
+};
+static_assert(sizeof(FUikaLogSlot) == UikaLogSlotBytes, "FUikaLogSlot layout");
+
+namespace
+{
+    FUikaLogSlot GSlots[UikaLogRingSize];
+    std::atomic<uint64> GEnqueuePos{ 0 };
+    uint64 GDequeuePos = 0;                 // GDrainLock
+    FCriticalSection GDrainLock;            // one consumer at a time
+    std::atomic<uint64> GDropped{ 0 };
+    std::atomic<bool> GRingReady{ false };
+    FEvent* GWakeEvent = nullptr;
+    FDelegateHandle GBeginFrameHandle;
+}
+
+static void WakeDrain()
+{
+    if (GWakeEvent)
+    {
+        GWakeEvent->Trigger();
+    }
+}
+
+// Returns false when the record does not fit a slot or the ring is full.
+static bool TryEnqueue(uint8 Level, uint16 Category, const uint8* Msg, uint32 MsgLen,
+                       const FUikaLogField* Fields, uint32 FieldCount, bool& bOutFull)
+{
+    bOutFull = false;
+    uint64 Length = MsgLen;
+    for (uint32 i = 0; i < FieldCount; ++i)
+    {
+        Length += 4 + uint64(Fields[i].key.len) + Fields[i].value.len;
+    }
+    if (Length > sizeof(FUikaLogSlot::Payload) || FieldCount > MAX_uint8)
+    {
+        return false;
+    }
+
+    uint64 Pos = GEnqueuePos.load(std::memory_order_relaxed);
+    FUikaLogSlot* Slot;
+    for (;;)
+    {
+        Slot = &GSlots[Pos & (UikaLogRingSize - 1)];
+        const int64 Diff = int64(Slot->Sequence.load(std::memory_order_acquire) - Pos);
+        if (Diff == 0)
+        {
+            if (GEnqueuePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (Diff < 0)
+        {
+            bOutFull = true;
+            return false;
+        }
+        else
+        {
+            Pos = GEnqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    Slot->Time = FPlatformTime::Seconds() - GStartTime;
+    Slot->MsgLen = static_cast<uint16>(MsgLen);
+    Slot->Length = static_cast<uint16>(Length);
+    Slot->Category = Category;
+    Slot->Level = Level;
+    Slot->FieldCount = static_cast<uint8>(FieldCount);
+    uint8* Out = Slot->Payload;
+    if (MsgLen)
+    {
+        FMemory::Memcpy(Out, Msg, MsgLen);
+        Out += MsgLen;
+    }
+    for (uint32 i = 0; i < FieldCount; ++i)
+    {
+        for (const UikaStrView& Str : { Fields[i].key, Fields[i].value })
+        {
+            const uint16 Len = static_cast<uint16>(Str.len);
+            FMemory::Memcpy(Out, &Len, sizeof(Len));
+            if (Len)
+            {
+                FMemory::Memcpy(Out + sizeof(Len), Str.ptr, Len);
+            }
+            Out += sizeof(Len) + Len;
+        }
+    }
+    Slot->Sequence.store(Pos + 1, std::memory_order_release);
+
+    if ((Pos & (UikaLogWakeBatch - 1)) == 0 || ToVerbosity(Level) <= ELogVerbosity::Warning)
+    {
+        WakeDrain();
+    }
+    return true;
+}
+
+static void RenderSlot(FString& Out, const FUikaLogSlot& Slot)
+{
+    Out.Reset();
+    AppendUtf8(Out, Slot.Payload, Slot.MsgLen);
+    const uint8* Cursor = Slot.Payload + Slot.MsgLen;
+    for (uint32 i = 0; i < Slot.FieldCount; ++i)
+    {
+        uint16 KeyLen, ValueLen;
+        FMemory::Memcpy(&KeyLen, Cursor, sizeof(KeyLen));
+        const uint8* Key = Cursor + sizeof(KeyLen);
+        Cursor = Key + KeyLen;
+        FMemory::Memcpy(&ValueLen, Cursor, sizeof(ValueLen));
+        const uint8* Value = Cursor + sizeof(ValueLen);
+        Cursor = Value + ValueLen;
+        AppendField(Out, i, Key, KeyLen, Value, ValueLen);
+    }
+    if (Slot.FieldCount)
+    {
+        Out += TEXT('}');
+    }
+}
+
+// Write every filled slot to GLog, in order. Caller holds GDrainLock.
+static void DrainRingLocked()
+{
+    FString Line;
+    for (;;)
+    {
+        FUikaLogSlot& Slot = GSlots[GDequeuePos & (UikaLogRingSize - 1)];
+        if (Slot.Sequence.load(std::memory_order_acquire) != GDequeuePos + 1)
+        {
+            break;
+        }
+        RenderSlot(Line, Slot);
+        Emit(Line, ToVerbosity(Slot.Level), CategoryFor(Slot.Category), Slot.Time);
+        Slot.Sequence.store(GDequeuePos + UikaLogRingSize, std::memory_order_release);
+        ++GDequeuePos;
+    }
+
+    if (const uint64 Dropped = GDropped.exchange(0, std::memory_order_relaxed))
+    {
+        UE_LOG(LogUika, Warning, TEXT("[Uika] %llu log records dropped (log ring full)"), Dropped);
+    }
+}
+
+static void DrainRing()
+{
+    FScopeLock Lock(&GDrainLock);
+    DrainRingLocked();
+}
+
+// ---------------------------------------------------------------------------
+// Drain thread
+// ---------------------------------------------------------------------------
+
+class FUikaLogDrain final : public FRunnable
+{
+public:
+    virtual uint32 Run() override
+    {
+        while (!bStop.load(std::memory_order_relaxed))
+        {
+            GWakeEvent->Wait(UikaLogDrainIntervalMs);
+            DrainRing();
+        }
+        return 0;
+    }
+
+    virtual void Stop() override
+    {
+        bStop.store(true, std::memory_order_relaxed);
+        WakeDrain();
+    }
+
+private:
+    std::atomic<bool> bStop{ false };
+};
+
+namespace
+{
+    FUikaLogDrain* GDrain = nullptr;
+    FRunnableThread* GDrainThread = nullptr;
+}
+
+// ---------------------------------------------------------------------------
+// Implementations
+// ---------------------------------------------------------------------------
+
+static void LogRecordImpl(uint8 Level, uint16 Category, const uint8* Msg, uint32 MsgLen,
+                          const FUikaLogField* Fields, uint32 FieldCount)
+{
+    if (CategoryFor(Category)->IsSuppressed(ToVerbosity(Level)))
+    {
+        return;
+    }
+    if (!Fields)
+    {
+        FieldCount = 0;
+    }
+
+    // Errors bypass the ring: they must reach the log even if the process
+    // goes down right after.
+    const bool bSync = ToVerbosity(Level) <= ELogVerbosity::Error;
+    bool bFull = false;
+    if (!bSync && GRingReady.load(std::memory_order_acquire)
+        && TryEnqueue(Level, Category, Msg, MsgLen, Fields, FieldCount, bFull))
+    {
+        return;
+    }
+    if (bFull)
+    {
+        GDropped.fetch_add(1, std::memory_order_relaxed);
+        WakeDrain();
+        return;
+    }
+
+    // Flush what is queued first so the line keeps its place.
+    FScopeLock Lock(&GDrainLock);
+    DrainRingLocked();
+    EmitDirect(Level, Category, Msg, MsgLen, Fields, FieldCount);
+    if (bSync)
+    {
+        GLog->Flush();
+    }
+}
+
+static void LogImpl(uint8 Level, const uint8* Msg, uint32 MsgLen)
+{
+    LogRecordImpl(Level, 0, Msg, MsgLen, nullptr, 0);
+}
+
+static uint16 RegisterCategoryImpl(const uint8* Name, uint32 NameLen)
+{
+    FString NameStr;
+    AppendUtf8(NameStr, Name, NameLen);
+    const FName CategoryName(*NameStr);
+
+    FScopeLock Lock(&GCategoryLock);
+    const uint32 Count = GCategoryCount.load(std::memory_order_relaxed);
+    for (uint32 i = 0; i < Count; ++i)
+    {
+        if (GCategories[i]->GetCategoryName() == CategoryName)
+        {
+            return static_cast<uint16>(i);
+        }
+    }
+    if (Count >= UikaMaxLogCategories)
+    {
+        UE_LOG(LogUika, Warning, TEXT("[Uika] Log category table full; %s logs to LogUika"), *NameStr);
+        return 0;
+    }
+
+    FLogCategoryBase* Category = new FLogCategoryBase(CategoryName, ELogVerbosity::Log, ELogVerbosity::All);
+    GOwnedCategories.Add(Category);
+    GCategories[Count] = Category;
+    GCategoryCount.store(Count + 1, std::memory_order_release);
+    // Also catches verbosity changes made since the last frame.
+    RefreshVerbosity();
+    return static_cast<uint16>(Count);
+}
+
+static const uint8* VerbosityTableImpl()
+{
+    return reinterpret_cast<const uint8*>(GVerbosity);
+}
+
+// ---------------------------------------------------------------------------
+// Module hooks (called from UikaModule.cpp)
+// ---------------------------------------------------------------------------
+
+void UikaLogStartup()
+{
+    for (uint32 i = 0; i < UikaLogRingSize; ++i)
+    {
+        GSlots[i].Sequence.store(i, std::memory_order_relaxed);
+    }
+    GEnqueuePos.store(0, std::memory_order_relaxed);
+    GDequeuePos = 0;
+
+    {
+        FScopeLock Lock(&GCategoryLock);
+        GCategories[0] = &LogUika;
+        GVerbosity[0].store(EffectiveVerbosity(&LogUika), std::memory_order_relaxed);
+        GCategoryCount.store(1, std::memory_order_release);
+    }
+    GBeginFrameHandle = FCoreDelegates::OnBeginFrame.AddStatic(&RefreshVerbosity);
+
+    // Without threads every record takes the synchronous path.
+    if (FPlatformProcess::SupportsMultithreading())
+    {
+        GWakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+        GDrain = new FUikaLogDrain();
+        GDrainThread = FRunnableThread::Create(GDrain, TEXT("UikaLogDrain"), 0, TPri_BelowNormal);
+        GRingReady.store(GDrainThread != nullptr, std::memory_order_release);
+    }
+}
+
+void UikaLogShutdown()
+{
+    FCoreDelegates::OnBeginFrame.Remove(GBeginFrameHandle);
+    GBeginFrameHandle.Reset();
+    GRingReady.store(false, std::memory_order_release);
+    if (GDrainThread)
+    {
+        GDrainThread->Kill(true);
+        delete GDrainThread;
+        GDrainThread = nullptr;
+    }
+    delete GDrain;
+    GDrain = nullptr;
+    DrainRing();
+    if (GWakeEvent)
+    {
+        FPlatformProcess::ReturnSynchEventToPool(GWakeEvent);
+        GWakeEvent = nullptr;
+    }
+
+    FScopeLock Lock(&GCategoryLock);
+    GCategoryCount.store(1, std::memory_order_release);
+    for (FLogCategoryBase* Category : GOwnedCategories)
+    {
+        delete Category;
+    }
+    GOwnedCategories.Reset();
+}
+
+// ---------------------------------------------------------------------------
+// Export
+// ---------------------------------------------------------------------------
+
+FUikaLoggingApi GLoggingApi = {
+    &LogImpl,
+    &RegisterCategoryImpl,
+    &VerbosityTableImpl,
+    &LogRecordImpl,
+};
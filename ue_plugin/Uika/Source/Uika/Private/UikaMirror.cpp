@@ -0,0 +1,433 @@
+// UikaMirror.cpp — per-frame state mirrors for Rust.
+//
+// Rust subscribes a set of objects and a list of columns (POD properties,
+// component-to-world transforms, velocities). One FTickFunction per world and
+// tick group fills every mirror subscribed there into the back half of a
+// double-buffered SoA block, marks rows whose bytes or liveness changed since
+// the previous snapshot, then publishes it by bumping the mirror's sequence.
+// Rust reads the published snapshot in place, with no crossing and only for
+// the dirty rows.
+
+#include "UikaApiTable.h"
+#include "UikaModule.h"
+#include "UikaTrace.h"
+#include "Algo/AnyOf.h"
+#include "Components/SceneComponent.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+#include <atomic>
+
+static constexpr uint32 UikaMirrorAlign = 16;
+
+namespace
+{
+    struct FUikaMirror
+    {
+        UWorld* World = nullptr;
+        ETickingGroup TickGroup = TG_PrePhysics;
+        TArray<FUikaMirrorColumn> Columns;
+        TArray<uint32> ColumnOffsets;
+        TArray<uint32> ColumnSizes;
+        TArray<TWeakObjectPtr<UObject>> Objects;
+
+        uint8* Buffers[2] = { nullptr, nullptr };
+        uint32 DirtyOffset = 0;
+        uint32 AliveOffset = 0;
+        // Snapshot s is in Buffers[s & 1]; 0 = nothing published yet.
+        std::atomic<uint64> Sequence{ 0 };
+
+        ~FUikaMirror()
+        {
+            FMemory::Free(Buffers[0]);
+            FMemory::Free(Buffers[1]);
+        }
+
+        void Layout();
+        void Fill();
+        void GetView(FUikaMirrorView& Out) const;
+    };
+
+    struct FUikaMirrorTickFunction : public FTickFunction
+    {
+        UWorld* World = nullptr;
+
+        virtual void ExecuteTick(float DeltaTime, ELevelTick TickType,
+            ENamedThreads::Type CurrentThread,
+            const FGraphEventRef& MyCompletionGraphEvent) override;
+
+        virtual FString DiagnosticMessage() override
+        {
+            return FString::Printf(TEXT("UikaMirror[%d]"), static_cast<int32>(TickGroup));
+        }
+    };
+
+    TMap<uint64, TUniquePtr<FUikaMirror>> GMirrors;
+    uint64 GNextMirrorId = 1;
+    // One tick function per (world, tick group) with at least one mirror.
+    TMap<TPair<UWorld*, uint32>, TUniquePtr<FUikaMirrorTickFunction>> GMirrorTicks;
+
+    FDelegateHandle GMirrorWorldCleanupHandle;
+}
+
+static_assert(sizeof(std::atomic<uint64>) == sizeof(uint64) && std::atomic<uint64>::is_always_lock_free,
+    "FUikaMirrorView::sequence is read by Rust as a plain u64");
+
+// ---------------------------------------------------------------------------
+// Columns
+// ---------------------------------------------------------------------------
+
+static uint32 ColumnSize(const FUikaMirrorColumn& Column)
+{
+    switch (Column.kind)
+    {
+    case UIKA_MIRROR_PROPERTY:
+    {
+        const FProperty* Property = static_cast<FProperty*>(Column.prop.ptr);
+        return Property ? static_cast<uint32>(Property->GetElementSize()) : 0;
+    }
+    case UIKA_MIRROR_TRANSFORM: return sizeof(FUikaTransform);
+    case UIKA_MIRROR_VELOCITY:  return sizeof(FUikaVector);
+    default:                    return 0;
+    }
+}
+
+static EUikaErrorCode ValidateColumn(const FUikaMirrorColumn& Column)
+{
+    if (Column.kind > UIKA_MIRROR_VELOCITY) return EUikaErrorCode::InvalidOperation;
+    if (Column.kind != UIKA_MIRROR_PROPERTY) return EUikaErrorCode::Ok;
+
+    const FProperty* Property = static_cast<FProperty*>(Column.prop.ptr);
+    if (!Property) return EUikaErrorCode::PropertyNotFound;
+    // Raw copies only: no bit-fields, no TObjectPtr, nothing with a destructor.
+    if (!Property->HasAnyPropertyFlags(CPF_IsPlainOldData)
+        || CastField<FBoolProperty>(Property) || CastField<FObjectPropertyBase>(Property))
+    {
+        return EUikaErrorCode::TypeMismatch;
+    }
+    return EUikaErrorCode::Ok;
+}
+
+static const USceneComponent* SceneOf(const UObject* Obj)
+{
+    if (const AActor* Actor = Cast<AActor>(Obj))
+    {
+        return Actor->GetRootComponent();
+    }
+    return Cast<USceneComponent>(Obj);
+}
+
+static FUikaVector ToMirrorVector(const FVector& V)
+{
+    return FUikaVector{ V.X, V.Y, V.Z, 0.0 };
+}
+
+// Write one cell. Returns false if the object has no value for this column
+// (e.g. an actor without a root component), leaving Dest zeroed.
+static bool ReadColumn(const FUikaMirrorColumn& Column, uint32 Size, const UObject* Obj, uint8* Dest)
+{
+    switch (Column.kind)
+    {
+    case UIKA_MIRROR_PROPERTY:
+    {
+        // Bound the raw read by the object's own layout.
+        if (uint64(Column.offset) + Size > uint64(Obj->GetClass()->GetPropertiesSize())) break;
+        FMemory::Memcpy(Dest, reinterpret_cast<const uint8*>(Obj) + Column.offset, Size);
+        return true;
+    }
+    case UIKA_MIRROR_TRANSFORM:
+    {
+        const USceneComponent* Scene = SceneOf(Obj);
+        if (!Scene) break;
+        const FTransform& Transform = Scene->GetComponentTransform();
+        const FQuat Rotation = Transform.GetRotation();
+        FUikaTransform Out;
+        Out.rotation = FUikaQuat{ Rotation.X, Rotation.Y, Rotation.Z, Rotation.W };
+        Out.translation = ToMirrorVector(Transform.GetTranslation());
+        Out.scale = ToMirrorVector(Transform.GetScale3D());
+        FMemory::Memcpy(Dest, &Out, sizeof(Out));
+        return true;
+    }
+    case UIKA_MIRROR_VELOCITY:
+    {
+        FVector Velocity;
+        if (const AActor* Actor = Cast<AActor>(Obj))
+        {
+            Velocity = Actor->GetVelocity();
+        }
+        else if (const USceneComponent* Scene = Cast<USceneComponent>(Obj))
+        {
+            Velocity = Scene->GetComponentVelocity();
+        }
+        else
+        {
+            break;
+        }
+        const FUikaVector Out = ToMirrorVector(Velocity);
+        FMemory::Memcpy(Dest, &Out, sizeof(Out));
+        return true;
+    }
+    default:
+        break;
+    }
+    FMemory::Memzero(Dest, Size);
+    return false;
+}
+
+// ---------------------------------------------------------------------------
+// Mirror
+// ---------------------------------------------------------------------------
+
+static FORCEINLINE bool TestBit(const uint8* Words, uint32 Row)
+{
+    return (reinterpret_cast<const uint64*>(Words)[Row / 64] >> (Row % 64)) & 1;
+}
+
+static FORCEINLINE void SetBit(uint8* Words, uint32 Row)
+{
+    reinterpret_cast<uint64*>(Words)[Row / 64] |= uint64(1) << (Row % 64);
+}
+
+void FUikaMirror::Layout()
+{
+    const uint32 Rows = static_cast<uint32>(Objects.Num());
+    const uint32 BitsetBytes = FMath::DivideAndRoundUp(FMath::Max(Rows, 1u), 64u) * sizeof(uint64);
+
+    uint32 Size = 0;
+    ColumnOffsets.Reset(Columns.Num());
+    ColumnSizes.Reset(Columns.Num());
+    for (const FUikaMirrorColumn& Column : Columns)
+    {
+        const uint32 ValueSize = ColumnSize(Column);
+        ColumnOffsets.Add(Size);
+        ColumnSizes.Add(ValueSize);
+        Size = Align(Size + ValueSize * Rows, UikaMirrorAlign);
+    }
+    DirtyOffset = Size;
+    AliveOffset = Size + BitsetBytes;
+    Size = Align(AliveOffset + BitsetBytes, UikaMirrorAlign);
+
+    for (uint8*& Buffer : Buffers)
+    {
+        FMemory::Free(Buffer);
+        Buffer = static_cast<uint8*>(FMemory::MallocZeroed(Size, UikaMirrorAlign));
+    }
+    Sequence.store(0, std::memory_order_release);
+}
+
+void FUikaMirror::Fill()
+{
+    const uint64 Published = Sequence.load(std::memory_order_relaxed);
+    const uint64 Next = Published + 1;
+    // Before the first snapshot there is nothing to diff against.
+    const uint8* Prev = Published ? Buffers[Published & 1] : nullptr;
+    uint8* Out = Buffers[Next & 1];
+    // Seqlock writer side: a worker still reading snapshot Next - 2 must not
+    // see these writes before it sees Published (see MirrorSnapshot::is_current).
+    std::atomic_thread_fence(std::memory_order_release);
+
+    const uint32 Rows = static_cast<uint32>(Objects.Num());
+    const uint32 BitsetBytes = AliveOffset - DirtyOffset;
+    FMemory::Memzero(Out + DirtyOffset, BitsetBytes * 2);
+
+    for (uint32 Row = 0; Row < Rows; ++Row)
+    {
+        const UObject* Obj = Objects[Row].Get();
+        const bool bAlive = IsValid(Obj);
+        bool bChanged = !Prev || bAlive != TestBit(Prev + AliveOffset, Row);
+        for (int32 Col = 0; Col < Columns.Num(); ++Col)
+        {
+            const uint32 Size = ColumnSizes[Col];
+            uint8* Cell = Out + ColumnOffsets[Col] + Row * Size;
+            if (bAlive)
+            {
+                ReadColumn(Columns[Col], Size, Obj, Cell);
+            }
+            else
+            {
+                FMemory::Memzero(Cell, Size);
+            }
+            bChanged = bChanged || FMemory::Memcmp(Cell, Prev + ColumnOffsets[Col] + Row * Size, Size) != 0;
+        }
+        if (bAlive) SetBit(Out + AliveOffset, Row);
+        if (bChanged) SetBit(Out + DirtyOffset, Row);
+    }
+
+    Sequence.store(Next, std::memory_order_release);
+}
+
+void FUikaMirror::GetView(FUikaMirrorView& Out) const
+{
+    Out.buffers[0] = Buffers[0];
+    Out.buffers[1] = Buffers[1];
+    Out.sequence = reinterpret_cast<const uint64*>(&Sequence);
+    Out.column_offsets = ColumnOffsets.GetData();
+    Out.column_sizes = ColumnSizes.GetData();
+    Out.row_count = static_cast<uint32>(Objects.Num());
+    Out.column_count = static_cast<uint32>(Columns.Num());
+    Out.dirty_offset = DirtyOffset;
+    Out.alive_offset = AliveOffset;
+}
+
+// ---------------------------------------------------------------------------
+// Tick functions
+// ---------------------------------------------------------------------------
+
+void FUikaMirrorTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType,
+    ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+    if (TickType == LEVELTICK_ViewportsOnly)
+    {
+        return;
+    }
+    UIKA_TRACE_SCOPE(Uika_MirrorFill);
+    for (TPair<uint64, TUniquePtr<FUikaMirror>>& Pair : GMirrors)
+    {
+        FUikaMirror& Mirror = *Pair.Value;
+        if (Mirror.World == World && Mirror.TickGroup == TickGroup)
+        {
+            Mirror.Fill();
+        }
+    }
+}
+
+static void EnsureMirrorTick(UWorld* World, ETickingGroup TickGroup)
+{
+    TUniquePtr<FUikaMirrorTickFunction>& Tick = GMirrorTicks.FindOrAdd(
+        TPair<UWorld*, uint32>(World, static_cast<uint32>(TickGroup)));
+    if (Tick)
+    {
+        return;
+    }
+    Tick = MakeUnique<FUikaMirrorTickFunction>();
+    Tick->World = World;
+    Tick->TickGroup = TickGroup;
+    Tick->bCanEverTick = true;
+    Tick->bStartWithTickEnabled = true;
+    Tick->bTickEvenWhenPaused = false;
+    Tick->RegisterTickFunction(World->PersistentLevel);
+}
+
+// Drop tick functions that no mirror uses any more.
+static void PruneMirrorTicks()
+{
+    for (auto It = GMirrorTicks.CreateIterator(); It; ++It)
+    {
+        const bool bUsed = Algo::AnyOf(GMirrors, [&It](const TPair<uint64, TUniquePtr<FUikaMirror>>& Pair)
+        {
+            return Pair.Value->World == It->Key.Key
+                && static_cast<uint32>(Pair.Value->TickGroup) == It->Key.Value;
+        });
+        if (!bUsed)
+        {
+            It->Value->UnRegisterTickFunction();
+            It.RemoveCurrent();
+        }
+    }
+}
+
+static void OnMirrorWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+    for (auto It = GMirrorTicks.CreateIterator(); It; ++It)
+    {
+        if (It->Key.Key == World)
+        {
+            It->Value->UnRegisterTickFunction();
+            It.RemoveCurrent();
+        }
+    }
+    // Mirrors of the world stay readable (frozen) until Rust destroys them.
+    for (TPair<uint64, TUniquePtr<FUikaMirror>>& Pair : GMirrors)
+    {
+        if (Pair.Value->World == World)
+        {
+            Pair.Value->World = nullptr;
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// API (called from UikaWorldApiImpl.cpp)
+// ---------------------------------------------------------------------------
+
+static void SetMirrorObjects(FUikaMirror& Mirror, const UikaUObjectHandle* Objs, uint32 Count)
+{
+    Mirror.Objects.Reset(Count);
+    for (uint32 i = 0; i < Count; ++i)
+    {
+        Mirror.Objects.Emplace(static_cast<UObject*>(Objs[i].ptr));
+    }
+    Mirror.Layout();
+    Mirror.Fill();
+}
+
+EUikaErrorCode UikaMirrorCreate(UikaUObjectHandle WorldHandle, const FUikaMirrorColumn* Columns, uint32 ColumnCount,
+    const UikaUObjectHandle* Objs, uint32 ObjCount, uint32 TickGroup, uint64* OutId, FUikaMirrorView* OutView)
+{
+    UWorld* World = Cast<UWorld>(static_cast<UObject*>(WorldHandle.ptr));
+    if (!World || !World->PersistentLevel || !OutId || !OutView
+        || (ColumnCount && !Columns) || (ObjCount && !Objs))
+    {
+        return EUikaErrorCode::NullArgument;
+    }
+    if (TickGroup >= TG_MAX)
+    {
+        return EUikaErrorCode::InvalidOperation;
+    }
+    for (uint32 i = 0; i < ColumnCount; ++i)
+    {
+        const EUikaErrorCode Code = ValidateColumn(Columns[i]);
+        if (Code != EUikaErrorCode::Ok) return Code;
+    }
+
+    TUniquePtr<FUikaMirror> Mirror = MakeUnique<FUikaMirror>();
+    Mirror->World = World;
+    Mirror->TickGroup = static_cast<ETickingGroup>(TickGroup);
+    Mirror->Columns.Append(Columns, ColumnCount);
+    SetMirrorObjects(*Mirror, Objs, ObjCount);
+    Mirror->GetView(*OutView);
+
+    EnsureMirrorTick(World, Mirror->TickGroup);
+    *OutId = GNextMirrorId++;
+    GMirrors.Add(*OutId, MoveTemp(Mirror));
+    return EUikaErrorCode::Ok;
+}
+
+EUikaErrorCode UikaMirrorSetObjects(uint64 Id, const UikaUObjectHandle* Objs, uint32 ObjCount, FUikaMirrorView* OutView)
+{
+    TUniquePtr<FUikaMirror>* Mirror = GMirrors.Find(Id);
+    if (!Mirror) return EUikaErrorCode::InvalidOperation;
+    if (!OutView || (ObjCount && !Objs)) return EUikaErrorCode::NullArgument;
+
+    SetMirrorObjects(**Mirror, Objs, ObjCount);
+    (*Mirror)->GetView(*OutView);
+    return EUikaErrorCode::Ok;
+}
+
+EUikaErrorCode UikaMirrorDestroy(uint64 Id)
+{
+    if (GMirrors.Remove(Id) == 0) return EUikaErrorCode::InvalidOperation;
+    PruneMirrorTicks();
+    return EUikaErrorCode::Ok;
+}
+
+// Rust views die with the DLL (hot reload / unload).
+void UikaMirrorDestroyAll()
+{
+    GMirrors.Reset();
+    PruneMirrorTicks();
+}
+
+void UikaMirrorRegisterHooks()
+{
+    GMirrorWorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddStatic(&OnMirrorWorldCleanup);
+}
+
+void UikaMirrorUnregisterHooks()
+{
+    FWorldDelegates::OnWorldCleanup.Remove(GMirrorWorldCleanupHandle);
+    GMirrorWorldCleanupHandle.Reset();
+    UikaMirrorDestroyAll();
+}
@@ -1,13 +1,20 @@
 #include "UikaModule.h"
 #include "UikaApiTable.h"
+#include "UikaTrace.h"
 #include "UUikaReifiedClass.h"
 #include "HAL/PlatformProcess.h"
 #include "HAL/PlatformFileManager.h"
 #include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
 #include "Misc/Paths.h"
+#include "Async/Async.h"
 
 DEFINE_LOG_CATEGORY(LogUika);
 
+#if CPUPROFILERTRACE_ENABLED
+UE_TRACE_CHANNEL_DEFINE(UikaChannel)
+#endif
+
 // External API sub-table instances (defined in their respective *Impl.cpp files)
 extern FUikaCoreApi       GCoreApi;
 extern FUikaReflectionApi GReflectionApi;
@@ -18,15 +25,56 @@ extern FUikaLifecycleApi  GLifecycleApi;
 extern FUikaReifyApi      GReifyApi;
 extern FUikaWorldApi      GWorldApi;
 extern FUikaWidgetApi     GWidgetApi;
+extern FUikaTaskApi       GTaskApi;
+extern FUikaLoggingApi    GLoggingApi;
 
-// Reify helpers (defined in UikaReifyApiImpl.cpp)
-extern void UikaReifyRegisterDeleteListener();
-extern void UikaReifyUnregisterDeleteListener();
+// Log ring / drain thread hooks (defined in UikaLoggingApiImpl.cpp)
+extern void UikaLogStartup();
+extern void UikaLogShutdown();
+
+// Reflection lookup cache hooks (defined in UikaReflectionApiImpl.cpp)
+extern void UikaReflectionCacheRegisterListeners();
+extern void UikaReflectionCacheUnregisterListeners();
+
+// Delegate proxy pool hooks (defined in UikaDelegateApiImpl.cpp)
+extern void UikaDelegateReleaseBoundProxies();
+extern void UikaDelegateProxyPoolShutdown();
+
+// Async asset load hook (defined in UikaWorldApiImpl.cpp)
+extern void UikaAssetLoadCancelAll();
+
+// Task hooks (defined in UikaTaskApiImpl.cpp)
+extern void UikaTaskRegisterHooks();
+extern void UikaTaskUnregisterHooks();
+extern void UikaTaskWaitForAll();
+
+// Class tick hooks (defined in UikaClassTick.cpp)
+extern void UikaClassTickRegisterHooks();
+extern void UikaClassTickUnregisterHooks();
+
+// State mirror hooks (defined in UikaMirror.cpp)
+extern void UikaMirrorRegisterHooks();
+extern void UikaMirrorUnregisterHooks();
+extern void UikaMirrorDestroyAll();
+
+// Reified ancestor cache hooks (defined in UUikaReifiedClass.cpp)
+extern void UikaReifiedClassRegisterHooks();
+extern void UikaReifiedClassUnregisterHooks();
+
+// Trace batch hooks (defined in UikaCollisionQueries.cpp)
+extern void UikaTraceBatchRegisterHooks();
+extern void UikaTraceBatchUnregisterHooks();
+extern void UikaTraceBatchCancelAll();
 
-// Pinned lifecycle helpers (defined in UikaLifecycleApiImpl.cpp)
-extern void UikaPinnedUnregisterDeleteListener();
+// Object tracker / Pinned lifecycle helpers (defined in UikaLifecycleApiImpl.cpp)
+extern void UikaObjectTrackerFlush();
+extern void UikaObjectTrackerShutdown();
+extern void UikaPinnedReleaseAll();
+
+// Reify helpers (defined in UikaReifyApiImpl.cpp)
 extern void UikaReifyForEachReifiedInstance(
     TFunctionRef<void(UObject*, UUikaReifiedClass*)> Callback);
+extern void UikaReifySnapshotRelease();
 
 // Module-level storage for Rust callbacks (set during StartupModule, read by UUikaDelegateProxy).
 static const FUikaRustCallbacks* GRustCallbacks = nullptr;
@@ -43,23 +91,6 @@ extern uint32_t UikaGetFuncCount();
 
 #define LOCTEXT_NAMESPACE "FUikaModule"
 
-// ---------------------------------------------------------------------------
-// Logging bridge (the one API implemented in Phase 1 for end-to-end testing)
-// ---------------------------------------------------------------------------
-
-static void UikaLogImpl(uint8 Level, const uint8* Msg, uint32 MsgLen)
-{
-    const FString MsgStr(MsgLen, UTF8_TO_TCHAR(reinterpret_cast<const char*>(Msg)));
-    switch (Level)
-    {
-    case 0:  UE_LOG(LogUika, Display, TEXT("%s"), *MsgStr); break;
-    case 1:  UE_LOG(LogUika, Warning, TEXT("%s"), *MsgStr); break;
-    default: UE_LOG(LogUika, Error,   TEXT("%s"), *MsgStr); break;
-    }
-}
-
-static FUikaLoggingApi GLoggingApi = { &UikaLogImpl };
-
 // ---------------------------------------------------------------------------
 // API table instance
 // ---------------------------------------------------------------------------
@@ -82,6 +113,7 @@ static void FillApiTable()
     GApiTable.reify        = &GReifyApi;
     GApiTable.world        = &GWorldApi;
     GApiTable.widget       = &GWidgetApi;
+    GApiTable.task         = &GTaskApi;
 
     // Fill generated func_table (Phase 6)
     UikaFillFuncTable();
@@ -104,6 +136,110 @@ void FUikaModule::StaticReload()
     Module.ReloadRustDll();
 }
 
+// Uika.Stats [TopN] [reset]
+static void UikaStatsCommand(const TArray<FString>& Args)
+{
+    if (!GRustCallbacks || !GRustCallbacks->dump_ffi_stats)
+    {
+        UE_LOG(LogUika, Warning, TEXT("[Uika] Uika.Stats: Rust DLL not loaded."));
+        return;
+    }
+
+    uint32 TopN = 20;
+    bool bReset = false;
+    for (const FString& Arg : Args)
+    {
+        if (Arg.Equals(TEXT("reset"), ESearchCase::IgnoreCase))
+        {
+            bReset = true;
+        }
+        else if (Arg.IsNumeric())
+        {
+            TopN = static_cast<uint32>(FMath::Max(1, FCString::Atoi(*Arg)));
+        }
+    }
+    GRustCallbacks->dump_ffi_stats(TopN, bReset);
+}
+
+static FAutoConsoleCommand CmdStats(
+    TEXT("Uika.Stats"),
+    TEXT("Dump the top FFI entries by time and call count: Uika.Stats [TopN=20] [reset].\n")
+    TEXT("Counters are only collected when the Rust DLL is built with the ffi-stats feature."),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&UikaStatsCommand));
+
+static TAutoConsoleVariable<int32> CVarUikaHotReloadWatch(
+    TEXT("Uika.HotReload.Watch"),
+    0,
+    TEXT("Watch the Rust DLL and hot-reload automatically when a new build lands.\n")
+    TEXT("The copy runs on a worker thread; the swap happens at the next frame boundary."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarUikaHotReloadPreload(
+    TEXT("Uika.HotReload.Preload"),
+    1,
+    TEXT("When watching, also map the staged DLL on the worker thread so the swap only runs uika_init."),
+    ECVF_Default);
+
+// Seconds between polls of the DLL source timestamp.
+static constexpr float UikaDllWatchInterval = 0.5f;
+
+// Copy the build to HotPath and optionally map it. Runs on a worker thread
+// (watcher) or the game thread (Uika.Reload); touches no module state.
+static FUikaStagedDll StageDllCopy(const FString& SourcePath, const FString& HotPath, bool bPreload)
+{
+    IFileManager& FileManager = IFileManager::Get();
+
+    FUikaStagedDll Staged;
+    Staged.Path = HotPath;
+    Staged.SourceTimestamp = FileManager.GetTimeStamp(*SourcePath);
+
+    const uint32 CopyResult = FileManager.Copy(*HotPath, *SourcePath);
+    if (CopyResult != COPY_OK)
+    {
+        UE_LOG(LogUika, Error,
+            TEXT("[Uika] Could not copy %s → %s (error %u)"), *SourcePath, *HotPath, CopyResult);
+        return Staged;
+    }
+
+    // The linker rewrote the file while we were copying: drop the torn copy,
+    // the watcher stages the finished build on a later poll.
+    if (FileManager.GetTimeStamp(*SourcePath) != Staged.SourceTimestamp)
+    {
+        FileManager.Delete(*HotPath, false, true, true);
+        Staged.SourceTimestamp = FDateTime::MinValue();
+        return Staged;
+    }
+
+    if (bPreload)
+    {
+        Staged.Handle = FPlatformProcess::GetDllHandle(*HotPath);
+        if (!Staged.Handle)
+        {
+            UE_LOG(LogUika, Error, TEXT("[Uika] Failed to pre-load DLL: %s"), *HotPath);
+            FileManager.Delete(*HotPath, false, true, true);
+            return Staged;
+        }
+    }
+
+    Staged.bOk = true;
+    return Staged;
+}
+
+// Free a staged DLL that will never be swapped in.
+static void DiscardStagedDll(FUikaStagedDll& Staged)
+{
+    if (Staged.Handle)
+    {
+        FPlatformProcess::FreeDllHandle(Staged.Handle);
+        Staged.Handle = nullptr;
+    }
+    if (Staged.bOk)
+    {
+        IFileManager::Get().Delete(*Staged.Path, false, true, true);
+    }
+    Staged.bOk = false;
+}
+
 // ---------------------------------------------------------------------------
 // Module lifecycle
 // ---------------------------------------------------------------------------
@@ -111,7 +247,14 @@ void FUikaModule::StaticReload()
 void FUikaModule::StartupModule()
 {
     // 1. Fill the API table
+    UikaLogStartup();
     FillApiTable();
+    UikaReflectionCacheRegisterListeners();
+    UikaTaskRegisterHooks();
+    UikaClassTickRegisterHooks();
+    UikaMirrorRegisterHooks();
+    UikaTraceBatchRegisterHooks();
+    UikaReifiedClassRegisterHooks();
 
     // 2. Locate the Rust DLL
     const FString PluginDir = FPaths::Combine(
@@ -121,6 +264,11 @@ void FUikaModule::StartupModule()
         FPlatformProcess::GetBinariesSubdirectory(),
         TEXT("uika.dll"));
 
+    // The watcher also picks up a first build that lands after startup.
+    WatcherTickHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateRaw(this, &FUikaModule::TickDllWatcher),
+        UikaDllWatchInterval);
+
     if (!FPaths::FileExists(DllSourcePath))
     {
         UE_LOG(LogUika, Warning,
@@ -131,10 +279,8 @@ void FUikaModule::StartupModule()
 
     // 3. Copy-on-load: never lock the source DLL so that build.py / cargo
     //    can always overwrite it, and hot reload always reads the latest.
-    ReloadCount++;
-    const FString InitialCopyPath = FPaths::Combine(
-        FPaths::GetPath(DllSourcePath),
-        FString::Printf(TEXT("uika_hot_%d.dll"), ReloadCount));
+    const FString InitialCopyPath = MakeHotDllPath();
+    LoadedSourceTimestamp = IFileManager::Get().GetTimeStamp(*DllSourcePath);
 
     uint32 CopyResult = IFileManager::Get().Copy(*InitialCopyPath, *DllSourcePath);
     if (CopyResult != 0)
@@ -159,7 +305,24 @@ void FUikaModule::StartupModule()
 
 void FUikaModule::ShutdownModule()
 {
+    if (WatcherTickHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(WatcherTickHandle);
+        WatcherTickHandle.Reset();
+    }
+    CancelStaging();
+
     UnloadRustDll();
+    UikaTaskUnregisterHooks();
+    UikaClassTickUnregisterHooks();
+    UikaMirrorUnregisterHooks();
+    UikaTraceBatchUnregisterHooks();
+    UikaReifiedClassUnregisterHooks();
+    UikaReflectionCacheUnregisterListeners();
+    UikaDelegateProxyPoolShutdown();
+    UikaObjectTrackerShutdown();
+    UikaReifySnapshotRelease();
+    UikaLogShutdown();
 
     // Clean up the hot-copy DLL (now unlocked).
     if (!CurrentLoadedDllPath.IsEmpty() && CurrentLoadedDllPath != DllSourcePath)
@@ -172,9 +335,17 @@ void FUikaModule::ShutdownModule()
 // DLL load / unload helpers
 // ---------------------------------------------------------------------------
 
-bool FUikaModule::LoadRustDll(const FString& LoadPath)
+FString FUikaModule::MakeHotDllPath()
 {
-    DllHandle = FPlatformProcess::GetDllHandle(*LoadPath);
+    ReloadCount++;
+    return FPaths::Combine(
+        FPaths::GetPath(DllSourcePath),
+        FString::Printf(TEXT("uika_hot_%d.dll"), ReloadCount));
+}
+
+bool FUikaModule::LoadRustDll(const FString& LoadPath, void* PreloadedHandle)
+{
+    DllHandle = PreloadedHandle ? PreloadedHandle : FPlatformProcess::GetDllHandle(*LoadPath);
     if (!DllHandle)
     {
         UE_LOG(LogUika, Error, TEXT("[Uika] Failed to load DLL: %s"), *LoadPath);
@@ -206,17 +377,23 @@ bool FUikaModule::LoadRustDll(const FString& LoadPath)
     // Store globally so UUikaDelegateProxy can access Rust callbacks.
     GRustCallbacks = RustCallbacks;
 
-    // Register the UObject delete listener for reified class instance cleanup.
-    UikaReifyRegisterDeleteListener();
-
     return true;
 }
 
 void FUikaModule::UnloadRustDll()
 {
-    // Unregister delete listeners before shutting down Rust.
-    UikaReifyUnregisterDeleteListener();
-    UikaPinnedUnregisterDeleteListener();
+    // Deliver buffered destroy notifications while the DLL that owns the
+    // instances is still loaded, then drop Pinned roots.
+    UikaObjectTrackerFlush();
+    UikaPinnedReleaseAll();
+    UikaDelegateReleaseBoundProxies();
+    UikaAssetLoadCancelAll();
+    // Worker jobs run Rust code: none may outlive the DLL.
+    UikaTaskWaitForAll();
+    // Only now that no worker can still be reading a snapshot or waiting on
+    // a trace batch.
+    UikaMirrorDestroyAll();
+    UikaTraceBatchCancelAll();
 
     if (DllHandle)
     {
@@ -249,6 +426,7 @@ void FUikaModule::UnloadRustDll()
 
 void FUikaModule::TeardownReifiedInstances()
 {
+    UIKA_TRACE_SCOPE(Uika_TeardownReifiedInstances);
     if (DllHandle && RustCallbacks && RustCallbacks->drop_rust_instance)
     {
         int32 InstanceCount = 0;
@@ -260,7 +438,8 @@ void FUikaModule::TeardownReifiedInstances()
                 RustCallbacks->drop_rust_instance(
                     UikaUObjectHandle{ Obj },
                     ReifiedClass->RustTypeId,
-                    nullptr);
+                    static_cast<uint8*>(ReifiedClass->GetRustData(Obj)));
+                ReifiedClass->SetRustData(Obj, nullptr);
                 InstanceCount++;
             });
         UE_LOG(LogUika, Display,
@@ -270,6 +449,7 @@ void FUikaModule::TeardownReifiedInstances()
 
 void FUikaModule::ReconstructReifiedInstances()
 {
+    UIKA_TRACE_SCOPE(Uika_ReconstructReifiedInstances);
     if (RustCallbacks && RustCallbacks->construct_rust_instance)
     {
         int32 ReconstructCount = 0;
@@ -277,10 +457,10 @@ void FUikaModule::ReconstructReifiedInstances()
             [this, &ReconstructCount](UObject* Obj, UUikaReifiedClass* ReifiedClass)
             {
                 bool bIsCDO = Obj->HasAnyFlags(RF_ClassDefaultObject);
-                RustCallbacks->construct_rust_instance(
+                ReifiedClass->SetRustData(Obj, RustCallbacks->construct_rust_instance(
                     UikaUObjectHandle{ Obj },
                     ReifiedClass->RustTypeId,
-                    bIsCDO);
+                    bIsCDO));
                 ReconstructCount++;
             });
         UE_LOG(LogUika, Display,
@@ -288,22 +468,48 @@ void FUikaModule::ReconstructReifiedInstances()
     }
 }
 
+void FUikaModule::SnapshotReifiedInstances()
+{
+    if (!DllHandle || !RustCallbacks || !RustCallbacks->snapshot_rust_instances)
+    {
+        // No outgoing DLL: keep any snapshot left by an earlier failed reload.
+        return;
+    }
+    UikaReifySnapshotRelease();
+    const uint32 SnapshotCount = RustCallbacks->snapshot_rust_instances();
+    if (SnapshotCount > 0)
+    {
+        UE_LOG(LogUika, Display,
+            TEXT("[Uika] Snapshotted %u Rust instances"), SnapshotCount);
+    }
+}
+
+void FUikaModule::RestoreReifiedInstances()
+{
+    if (RustCallbacks && RustCallbacks->restore_rust_instances)
+    {
+        const uint32 RestoreCount = RustCallbacks->restore_rust_instances();
+        if (RestoreCount > 0)
+        {
+            UE_LOG(LogUika, Display,
+                TEXT("[Uika] Restored %u Rust instances from snapshot"), RestoreCount);
+        }
+    }
+    UikaReifySnapshotRelease();
+}
+
 // ---------------------------------------------------------------------------
 // Hot reload (DLL swap)
 // ---------------------------------------------------------------------------
 
-void FUikaModule::ReloadRustDll()
+void FUikaModule::SwapToStagedDll(const FUikaStagedDll& Staged)
 {
     UE_LOG(LogUika, Display, TEXT("[Uika] === Hot Reload Begin ==="));
+    const double StartSeconds = FPlatformTime::Seconds();
 
-    if (DllSourcePath.IsEmpty())
-    {
-        UE_LOG(LogUika, Error,
-            TEXT("[Uika] Hot reload failed: DLL source path not set (was initial load skipped?)"));
-        return;
-    }
-
-    // Phase 1: Teardown — drop all Rust instances and unload old DLL
+    // Phase 1: Snapshot opted-in instance state, then teardown — drop all
+    // Rust instances and unload old DLL
+    SnapshotReifiedInstances();
     TeardownReifiedInstances();
 
     FString PreviousLoadedPath = CurrentLoadedDllPath;
@@ -314,40 +520,129 @@ void FUikaModule::ReloadRustDll()
         IFileManager::Get().Delete(*PreviousLoadedPath, false, true, true);
     }
 
-    // Phase 2: Copy-on-reload — copy the new DLL to avoid Windows lock
-    if (!FPaths::FileExists(DllSourcePath))
+    // Phase 2: Initialize the staged DLL (already copied, possibly mapped)
+    if (!LoadRustDll(Staged.Path, Staged.Handle))
     {
-        UE_LOG(LogUika, Error,
-            TEXT("[Uika] Hot reload failed: %s not found. Did cargo build succeed?"),
-            *DllSourcePath);
+        UE_LOG(LogUika, Error, TEXT("[Uika] Hot reload failed: could not load new DLL"));
+        FailedSourceTimestamp = Staged.SourceTimestamp;
         return;
     }
+    LoadedSourceTimestamp = Staged.SourceTimestamp;
 
-    ReloadCount++;
-    const FString HotDllPath = FPaths::Combine(
-        FPaths::GetPath(DllSourcePath),
-        FString::Printf(TEXT("uika_hot_%d.dll"), ReloadCount));
+    // Phase 3: Reconstruct — rebuild Rust instance data, then restore the
+    // snapshot into it
+    ReconstructReifiedInstances();
+    RestoreReifiedInstances();
 
-    uint32 CopyResult = IFileManager::Get().Copy(*HotDllPath, *DllSourcePath);
-    if (CopyResult != 0)
+    UE_LOG(LogUika, Display, TEXT("[Uika] === Hot Reload Complete (%.1f ms on game thread) ==="),
+        (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+}
+
+void FUikaModule::ReloadRustDll()
+{
+    if (DllSourcePath.IsEmpty())
     {
         UE_LOG(LogUika, Error,
-            TEXT("[Uika] Hot reload failed: could not copy %s → %s (error %u)"),
-            *DllSourcePath, *HotDllPath, CopyResult);
+            TEXT("[Uika] Hot reload failed: DLL source path not set (was initial load skipped?)"));
         return;
     }
 
-    // Phase 2b: Load the new DLL and re-initialize Rust
-    if (!LoadRustDll(HotDllPath))
+    // Reuse a build the watcher is already staging; otherwise copy now.
+    FUikaStagedDll Staged;
+    if (StagingFuture.IsValid())
     {
-        UE_LOG(LogUika, Error, TEXT("[Uika] Hot reload failed: could not load new DLL"));
-        return;
+        Staged = StagingFuture.Consume();
+    }
+    if (!Staged.bOk)
+    {
+        if (!FPaths::FileExists(DllSourcePath))
+        {
+            UE_LOG(LogUika, Error,
+                TEXT("[Uika] Hot reload failed: %s not found. Did cargo build succeed?"),
+                *DllSourcePath);
+            return;
+        }
+        Staged = StageDllCopy(DllSourcePath, MakeHotDllPath(), false);
+        if (!Staged.bOk)
+        {
+            UE_LOG(LogUika, Error, TEXT("[Uika] Hot reload failed: could not stage %s"), *DllSourcePath);
+            return;
+        }
     }
 
-    // Phase 3: Reconstruct — rebuild Rust instance data
-    ReconstructReifiedInstances();
+    SwapToStagedDll(Staged);
+}
+
+// ---------------------------------------------------------------------------
+// DLL watcher (background staging, frame-boundary swap)
+// ---------------------------------------------------------------------------
+
+bool FUikaModule::TickDllWatcher(float DeltaTime)
+{
+    // A staged build is ready: swap now. The core ticker runs between frames,
+    // so no world is mid-tick.
+    if (StagingFuture.IsValid())
+    {
+        if (StagingFuture.IsReady())
+        {
+            FUikaStagedDll Staged = StagingFuture.Consume();
+            if (Staged.bOk)
+            {
+                SwapToStagedDll(Staged);
+            }
+            else if (Staged.SourceTimestamp != FDateTime::MinValue())
+            {
+                FailedSourceTimestamp = Staged.SourceTimestamp;
+            }
+        }
+        return true;
+    }
+
+    if (CVarUikaHotReloadWatch.GetValueOnGameThread() == 0)
+    {
+        return true;
+    }
+
+    const FDateTime Stamp = IFileManager::Get().GetTimeStamp(*DllSourcePath);
+    if (Stamp == FDateTime::MinValue() || Stamp == LoadedSourceTimestamp || Stamp == FailedSourceTimestamp)
+    {
+        PendingSourceTimestamp = FDateTime::MinValue();
+        return true;
+    }
 
-    UE_LOG(LogUika, Display, TEXT("[Uika] === Hot Reload Complete ==="));
+    // Wait until the linker is done: the timestamp must hold still for one poll.
+    if (Stamp != PendingSourceTimestamp)
+    {
+        PendingSourceTimestamp = Stamp;
+        return true;
+    }
+    PendingSourceTimestamp = FDateTime::MinValue();
+
+    BeginStaging();
+    return true;
+}
+
+void FUikaModule::BeginStaging()
+{
+    const FString SourcePath = DllSourcePath;
+    const FString HotPath = MakeHotDllPath();
+    const bool bPreload = CVarUikaHotReloadPreload.GetValueOnGameThread() != 0;
+
+    UE_LOG(LogUika, Display, TEXT("[Uika] New build detected, staging %s"), *HotPath);
+    StagingFuture = Async(EAsyncExecution::ThreadPool,
+        [SourcePath, HotPath, bPreload]()
+        {
+            return StageDllCopy(SourcePath, HotPath, bPreload);
+        });
+}
+
+void FUikaModule::CancelStaging()
+{
+    if (StagingFuture.IsValid())
+    {
+        FUikaStagedDll Staged = StagingFuture.Consume();
+        DiscardStagedDll(Staged);
+    }
 }
 
 #undef LOCTEXT_NAMESPACE
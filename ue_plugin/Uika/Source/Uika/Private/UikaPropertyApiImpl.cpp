@@ -153,37 +153,70 @@ static EUikaErrorCode SetF64Impl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop
 // String (handles FStrProperty and FTextProperty)
 // ---------------------------------------------------------------------------
 
-static EUikaErrorCode GetStringImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop,
-                                     uint8* Buf, uint32 BufLen, uint32* OutLen)
+// In-place storage of an FStrProperty, or the display string of an
+// FTextProperty (FText::ToString returns a reference, no copy).
+static const FString* FindStringValue(const FProperty* Property, const void* Container)
 {
-    UIKA_CHECK_VALID(Obj);
-    FProperty* Property = static_cast<FProperty*>(Prop.ptr);
-
-    FString Value;
     if (const FStrProperty* StrProp = CastField<FStrProperty>(Property))
     {
-        Value = StrProp->GetPropertyValue_InContainer(Object);
+        return StrProp->GetPropertyValuePtr_InContainer(Container);
     }
-    else if (const FTextProperty* TextProp = CastField<FTextProperty>(Property))
+    if (const FTextProperty* TextProp = CastField<FTextProperty>(Property))
     {
-        Value = TextProp->GetPropertyValue_InContainer(Object).ToString();
+        return &TextProp->GetPropertyValuePtr_InContainer(Container)->ToString();
     }
-    else
+    return nullptr;
+}
+
+static uint32 Utf8LengthOf(const FString& Str)
+{
+    return Str.IsEmpty() ? 0 : static_cast<uint32>(FPlatformString::ConvertedLength<UTF8CHAR>(*Str, Str.Len()));
+}
+
+// Convert straight into Dest. Dest must hold Utf8LengthOf(Str) bytes.
+static void WriteUtf8(const FString& Str, uint8* Dest, uint32 DestLen)
+{
+    if (!Str.IsEmpty())
     {
-        return EUikaErrorCode::TypeMismatch;
+        FPlatformString::Convert(reinterpret_cast<UTF8CHAR*>(Dest), static_cast<int32>(DestLen), *Str, Str.Len());
+    }
+}
+
+// Length-bounded UTF-8 -> FString (the input is not null-terminated).
+static FString Utf8SliceToFString(const uint8* InBuf, uint32 Len)
+{
+    if (!InBuf || Len == 0)
+    {
+        return FString();
     }
+    const FUTF8ToTCHAR Wide(reinterpret_cast<const ANSICHAR*>(InBuf), static_cast<int32>(Len));
+    return FString(Wide.Length(), Wide.Get());
+}
 
-    const FTCHARToUTF8 Utf8(*Value);
-    const uint32 Len = static_cast<uint32>(Utf8.Length());
+static EUikaErrorCode GetStringImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop,
+                                     uint8* Buf, uint32 BufLen, uint32* OutLen)
+{
+    UIKA_CHECK_VALID(Obj);
+    const FString* Value = FindStringValue(static_cast<FProperty*>(Prop.ptr), Object);
+    if (!Value)
+    {
+        return EUikaErrorCode::TypeMismatch;
+    }
 
+    const uint32 Len = Utf8LengthOf(*Value);
     if (OutLen)
     {
         *OutLen = Len;
     }
-    if (Buf && BufLen > 0)
+    if (Buf && BufLen >= Len)
+    {
+        WriteUtf8(*Value, Buf, BufLen);
+    }
+    else if (Buf && BufLen > 0)
     {
-        const uint32 CopyLen = FMath::Min(Len, BufLen);
-        FMemory::Memcpy(Buf, Utf8.Get(), CopyLen);
+        // Legacy truncating behaviour; get_string_exact reports BufferTooSmall instead.
+        const FTCHARToUTF8 Utf8(**Value, Value->Len());
+        FMemory::Memcpy(Buf, Utf8.Get(), BufLen);
     }
     return EUikaErrorCode::Ok;
 }
@@ -194,15 +227,13 @@ static EUikaErrorCode SetStringImpl(UikaUObjectHandle Obj, UikaFPropertyHandle P
     UIKA_CHECK_VALID(Obj);
     FProperty* Property = static_cast<FProperty*>(Prop.ptr);
 
-    const FString Value(Len, UTF8_TO_TCHAR(reinterpret_cast<const char*>(InBuf)));
-
     if (FStrProperty* StrProp = CastField<FStrProperty>(Property))
     {
-        StrProp->SetPropertyValue_InContainer(Object, Value);
+        StrProp->SetPropertyValue_InContainer(Object, Utf8SliceToFString(InBuf, Len));
     }
     else if (FTextProperty* TextProp = CastField<FTextProperty>(Property))
     {
-        TextProp->SetPropertyValue_InContainer(Object, FText::FromString(Value));
+        TextProp->SetPropertyValue_InContainer(Object, FText::FromString(Utf8SliceToFString(InBuf, Len)));
     }
     else
     {
@@ -211,6 +242,52 @@ static EUikaErrorCode SetStringImpl(UikaUObjectHandle Obj, UikaFPropertyHandle P
     return EUikaErrorCode::Ok;
 }
 
+static EUikaErrorCode GetStringExactImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop,
+                                         uint8* Buf, uint32 BufLen, uint32* OutLen)
+{
+    UIKA_CHECK_VALID(Obj);
+    const FString* Value = FindStringValue(static_cast<FProperty*>(Prop.ptr), Object);
+    if (!Value)
+    {
+        return EUikaErrorCode::TypeMismatch;
+    }
+
+    const uint32 Len = Utf8LengthOf(*Value);
+    if (OutLen)
+    {
+        *OutLen = Len;
+    }
+    if (Len == 0)
+    {
+        return EUikaErrorCode::Ok;
+    }
+    if (!Buf || BufLen < Len)
+    {
+        return EUikaErrorCode::BufferTooSmall;
+    }
+    WriteUtf8(*Value, Buf, BufLen);
+    return EUikaErrorCode::Ok;
+}
+
+static EUikaErrorCode GetStringViewImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop, UikaUtf16View* Out)
+{
+    UIKA_CHECK_VALID(Obj);
+    if (!Out)
+    {
+        return EUikaErrorCode::NullArgument;
+    }
+    const FString* Value = FindStringValue(static_cast<FProperty*>(Prop.ptr), Object);
+    if (!Value)
+    {
+        return EUikaErrorCode::TypeMismatch;
+    }
+    static_assert(sizeof(TCHAR) == sizeof(uint16), "UTF-16 view requires a 2-byte TCHAR");
+    Out->ptr = reinterpret_cast<const uint16*>(**Value);
+    Out->len = static_cast<uint32>(Value->Len());
+    Out->_pad = 0;
+    return EUikaErrorCode::Ok;
+}
+
 // ---------------------------------------------------------------------------
 // FName (stored as opaque uint64)
 // ---------------------------------------------------------------------------
@@ -325,6 +402,11 @@ static EUikaErrorCode GetStructImpl(UikaUObjectHandle Obj, UikaFPropertyHandle P
         return EUikaErrorCode::TypeMismatch;
     }
     const void* SrcPtr = StructProp->ContainerPtrToValuePtr<void>(Object);
+    if (StructProp->HasAnyPropertyFlags(CPF_IsPlainOldData))
+    {
+        FMemory::Memcpy(OutBuf, SrcPtr, StructProp->GetElementSize());
+        return EUikaErrorCode::Ok;
+    }
     StructProp->Struct->CopyScriptStruct(OutBuf, SrcPtr);
     return EUikaErrorCode::Ok;
 }
@@ -339,6 +421,11 @@ static EUikaErrorCode SetStructImpl(UikaUObjectHandle Obj, UikaFPropertyHandle P
         return EUikaErrorCode::TypeMismatch;
     }
     void* DstPtr = StructProp->ContainerPtrToValuePtr<void>(Object);
+    if (StructProp->HasAnyPropertyFlags(CPF_IsPlainOldData))
+    {
+        FMemory::Memcpy(DstPtr, InBuf, StructProp->GetElementSize());
+        return EUikaErrorCode::Ok;
+    }
     StructProp->Struct->CopyScriptStruct(DstPtr, InBuf);
     return EUikaErrorCode::Ok;
 }
@@ -359,6 +446,12 @@ static EUikaErrorCode GetPropertyAtImpl(UikaUObjectHandle Obj, UikaFPropertyHand
     uint32 ElemSize = Property->GetElementSize();
     if (BufSize < ElemSize) return EUikaErrorCode::InternalError;
 
+    // POD elements (numerics, POD structs) skip the virtual copy.
+    if (Property->HasAnyPropertyFlags(CPF_IsPlainOldData))
+    {
+        FMemory::Memcpy(OutBuf, Src, ElemSize);
+        return EUikaErrorCode::Ok;
+    }
     Property->CopySingleValue(OutBuf, Src);
     return EUikaErrorCode::Ok;
 }
@@ -375,10 +468,515 @@ static EUikaErrorCode SetPropertyAtImpl(UikaUObjectHandle Obj, UikaFPropertyHand
     uint32 ElemSize = Property->GetElementSize();
     if (BufSize < ElemSize) return EUikaErrorCode::InternalError;
 
+    if (Property->HasAnyPropertyFlags(CPF_IsPlainOldData))
+    {
+        FMemory::Memcpy(Dest, InBuf, ElemSize);
+        return EUikaErrorCode::Ok;
+    }
     Property->CopySingleValue(Dest, InBuf);
     return EUikaErrorCode::Ok;
 }
 
+// ---------------------------------------------------------------------------
+// Batched access (many properties, one object, one crossing)
+// ---------------------------------------------------------------------------
+
+// Fixed-size scalar read/write via unaligned memcpy (io_buf offsets are packed).
+template <typename T>
+static EUikaErrorCode BatchScalar(void* ValuePtr, uint8* Slot, uint32 SlotSize, bool bWrite)
+{
+    if (SlotSize < sizeof(T))
+    {
+        return EUikaErrorCode::BufferTooSmall;
+    }
+    if (bWrite)
+    {
+        FMemory::Memcpy(ValuePtr, Slot, sizeof(T));
+    }
+    else
+    {
+        FMemory::Memcpy(Slot, ValuePtr, sizeof(T));
+    }
+    return EUikaErrorCode::Ok;
+}
+
+static EUikaErrorCode RunPropOp(void* Object, const FUikaPropOp& Op, uint8* IoBuf)
+{
+    FProperty* Property = static_cast<FProperty*>(Op.prop.ptr);
+    if (!Property)
+    {
+        return EUikaErrorCode::PropertyNotFound;
+    }
+
+    uint8* Slot = IoBuf + Op.buf_offset;
+    const uint32 SlotSize = Op.buf_size;
+    const bool bWrite = Op.op == UIKA_PROP_OP_WRITE;
+
+    switch (static_cast<EUikaPropKind>(Op.kind))
+    {
+    case EUikaPropKind::Bool:
+    {
+        FBoolProperty* BoolProp = CastField<FBoolProperty>(Property);
+        if (!BoolProp) return EUikaErrorCode::TypeMismatch;
+        if (SlotSize < 1) return EUikaErrorCode::BufferTooSmall;
+        if (bWrite)
+        {
+            BoolProp->SetPropertyValue_InContainer(Object, *Slot != 0);
+        }
+        else
+        {
+            *Slot = BoolProp->GetPropertyValue_InContainer(Object) ? 1 : 0;
+        }
+        return EUikaErrorCode::Ok;
+    }
+    case EUikaPropKind::I32:
+        return BatchScalar<int32>(Property->ContainerPtrToValuePtr<void>(Object), Slot, SlotSize, bWrite);
+    case EUikaPropKind::I64:
+        return BatchScalar<int64>(Property->ContainerPtrToValuePtr<void>(Object), Slot, SlotSize, bWrite);
+    case EUikaPropKind::U8:
+        return BatchScalar<uint8>(Property->ContainerPtrToValuePtr<void>(Object), Slot, SlotSize, bWrite);
+    case EUikaPropKind::F32:
+        return BatchScalar<float>(Property->ContainerPtrToValuePtr<void>(Object), Slot, SlotSize, bWrite);
+    case EUikaPropKind::F64:
+        return BatchScalar<double>(Property->ContainerPtrToValuePtr<void>(Object), Slot, SlotSize, bWrite);
+    case EUikaPropKind::Name:
+        // Same opaque uint64 copy as GetFNameImpl/SetFNameImpl.
+        return BatchScalar<uint64>(Property->ContainerPtrToValuePtr<void>(Object), Slot, SlotSize, bWrite);
+    case EUikaPropKind::Object:
+    {
+        FObjectPropertyBase* ObjProp = CastField<FObjectPropertyBase>(Property);
+        if (!ObjProp) return EUikaErrorCode::TypeMismatch;
+        if (SlotSize < sizeof(void*)) return EUikaErrorCode::BufferTooSmall;
+        if (bWrite)
+        {
+            UObject* Value = nullptr;
+            FMemory::Memcpy(&Value, Slot, sizeof(void*));
+            ObjProp->SetObjectPropertyValue_InContainer(Object, Value);
+        }
+        else
+        {
+            UObject* Value = ObjProp->GetObjectPropertyValue_InContainer(Object);
+            FMemory::Memcpy(Slot, &Value, sizeof(void*));
+        }
+        return EUikaErrorCode::Ok;
+    }
+    case EUikaPropKind::Enum:
+    {
+        if (SlotSize < sizeof(int64)) return EUikaErrorCode::BufferTooSmall;
+        int64 Value = 0;
+        if (bWrite)
+        {
+            FMemory::Memcpy(&Value, Slot, sizeof(int64));
+        }
+        if (const FEnumProperty* EnumProp = CastField<FEnumProperty>(Property))
+        {
+            FNumericProperty* UnderlyingProp = const_cast<FNumericProperty*>(EnumProp->GetUnderlyingProperty());
+            void* ValuePtr = EnumProp->ContainerPtrToValuePtr<void>(Object);
+            if (bWrite)
+            {
+                UnderlyingProp->SetIntPropertyValue(ValuePtr, Value);
+            }
+            else
+            {
+                Value = UnderlyingProp->GetSignedIntPropertyValue(ValuePtr);
+            }
+        }
+        else if (CastField<FByteProperty>(Property))
+        {
+            uint8* BytePtr = Property->ContainerPtrToValuePtr<uint8>(Object);
+            if (bWrite)
+            {
+                *BytePtr = static_cast<uint8>(Value);
+            }
+            else
+            {
+                Value = static_cast<int64>(*BytePtr);
+            }
+        }
+        else
+        {
+            return EUikaErrorCode::TypeMismatch;
+        }
+        if (!bWrite)
+        {
+            FMemory::Memcpy(Slot, &Value, sizeof(int64));
+        }
+        return EUikaErrorCode::Ok;
+    }
+    case EUikaPropKind::Struct:
+    {
+        const FStructProperty* StructProp = CastField<FStructProperty>(Property);
+        if (!StructProp) return EUikaErrorCode::TypeMismatch;
+        // Slots are raw Rust bytes: as for gather, only structs that are a
+        // plain byte copy may travel through them.
+        if (!(StructProp->Struct->StructFlags & STRUCT_IsPlainOldData)) return EUikaErrorCode::TypeMismatch;
+        if (SlotSize < static_cast<uint32>(StructProp->Struct->GetStructureSize()))
+        {
+            return EUikaErrorCode::BufferTooSmall;
+        }
+        void* ValuePtr = StructProp->ContainerPtrToValuePtr<void>(Object);
+        if (bWrite)
+        {
+            StructProp->Struct->CopyScriptStruct(ValuePtr, Slot);
+        }
+        else
+        {
+            StructProp->Struct->CopyScriptStruct(Slot, ValuePtr);
+        }
+        return EUikaErrorCode::Ok;
+    }
+    case EUikaPropKind::String:
+    {
+        // Slot format: [u32 utf8_len][utf8 bytes] (same as delegate read_param).
+        if (SlotSize < sizeof(uint32)) return EUikaErrorCode::BufferTooSmall;
+        if (bWrite)
+        {
+            uint32 Len = 0;
+            FMemory::Memcpy(&Len, Slot, sizeof(uint32));
+            if (Len > SlotSize - sizeof(uint32)) return EUikaErrorCode::BufferTooSmall;
+            const FString Value = Utf8SliceToFString(Slot + sizeof(uint32), Len);
+            if (FStrProperty* StrProp = CastField<FStrProperty>(Property))
+            {
+                StrProp->SetPropertyValue_InContainer(Object, Value);
+            }
+            else if (FTextProperty* TextProp = CastField<FTextProperty>(Property))
+            {
+                TextProp->SetPropertyValue_InContainer(Object, FText::FromString(Value));
+            }
+            else
+            {
+                return EUikaErrorCode::TypeMismatch;
+            }
+            return EUikaErrorCode::Ok;
+        }
+
+        const FString* Value = FindStringValue(Property, Object);
+        if (!Value) return EUikaErrorCode::TypeMismatch;
+        const uint32 Len = Utf8LengthOf(*Value);
+        if (Len > SlotSize - sizeof(uint32)) return EUikaErrorCode::BufferTooSmall;
+        FMemory::Memcpy(Slot, &Len, sizeof(uint32));
+        WriteUtf8(*Value, Slot + sizeof(uint32), Len);
+        return EUikaErrorCode::Ok;
+    }
+    default:
+        return EUikaErrorCode::TypeMismatch;
+    }
+}
+
+static EUikaErrorCode BatchImpl(UikaUObjectHandle Obj, const FUikaPropOp* Ops, uint32 Count, uint8* IoBuf)
+{
+    UIKA_CHECK_VALID(Obj);
+    if (Count == 0) return EUikaErrorCode::Ok;
+    if (!Ops || !IoBuf) return EUikaErrorCode::NullArgument;
+
+    for (uint32 i = 0; i < Count; ++i)
+    {
+        const EUikaErrorCode Result = RunPropOp(Object, Ops[i], IoBuf);
+        if (Result != EUikaErrorCode::Ok)
+        {
+            return Result;
+        }
+    }
+    return EUikaErrorCode::Ok;
+}
+
+// ---------------------------------------------------------------------------
+// Gather / scatter (one property, many objects, dense strided buffer)
+// ---------------------------------------------------------------------------
+
+enum class EUikaGatherMode : uint8 { Bool, Object, Struct, Pod };
+
+// Classify the property once so the per-object loop is a plain copy.
+static bool GetGatherMode(FProperty* Property, EUikaGatherMode& OutMode, uint32& OutElemSize)
+{
+    if (CastField<FBoolProperty>(Property))
+    {
+        OutMode = EUikaGatherMode::Bool;
+        OutElemSize = 1;
+    }
+    else if (CastField<FObjectPropertyBase>(Property))
+    {
+        OutMode = EUikaGatherMode::Object;
+        OutElemSize = sizeof(void*);
+    }
+    else if (const FStructProperty* StructProp = CastField<FStructProperty>(Property))
+    {
+        // Callers hand in raw, possibly uninitialized slots: only structs
+        // that are a plain byte copy can be gathered into them.
+        if (!(StructProp->Struct->StructFlags & STRUCT_IsPlainOldData)) return false;
+        OutMode = EUikaGatherMode::Struct;
+        OutElemSize = static_cast<uint32>(StructProp->Struct->GetStructureSize());
+    }
+    else if (Property->HasAnyPropertyFlags(CPF_IsPlainOldData))
+    {
+        OutMode = EUikaGatherMode::Pod;
+        OutElemSize = static_cast<uint32>(Property->GetElementSize());
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+// The caller's element (UIKA_GATHER_*, or a size) against the property's.
+static bool MatchesGatherElement(EUikaGatherMode Mode, uint32 ElemSize, uint32 Elem)
+{
+    if (Elem == UIKA_GATHER_ANY) return true;
+    if (Elem == UIKA_GATHER_BOOL) return Mode == EUikaGatherMode::Bool;
+    return Mode != EUikaGatherMode::Bool && ElemSize == Elem;
+}
+
+static EUikaErrorCode GatherImpl(const UikaUObjectHandle* Objs, uint32 Count, UikaFPropertyHandle Prop,
+                                 uint8* OutBuf, uint32 Stride, uint32 Elem)
+{
+    FProperty* Property = static_cast<FProperty*>(Prop.ptr);
+    if (!Property) return EUikaErrorCode::PropertyNotFound;
+
+    EUikaGatherMode Mode;
+    uint32 ElemSize = 0;
+    if (!GetGatherMode(Property, Mode, ElemSize)) return EUikaErrorCode::TypeMismatch;
+    if (!MatchesGatherElement(Mode, ElemSize, Elem)) return EUikaErrorCode::TypeMismatch;
+    if (Count == 0) return EUikaErrorCode::Ok;
+    if (!Objs || !OutBuf) return EUikaErrorCode::NullArgument;
+    if (Stride == 0) Stride = ElemSize;
+    if (Stride < ElemSize) return EUikaErrorCode::BufferTooSmall;
+
+    const FBoolProperty* BoolProp = Mode == EUikaGatherMode::Bool ? CastField<FBoolProperty>(Property) : nullptr;
+    const FObjectPropertyBase* ObjProp = Mode == EUikaGatherMode::Object ? CastField<FObjectPropertyBase>(Property) : nullptr;
+    const FStructProperty* StructProp = Mode == EUikaGatherMode::Struct ? CastField<FStructProperty>(Property) : nullptr;
+
+    for (uint32 i = 0; i < Count; ++i)
+    {
+        uint8* Dest = OutBuf + static_cast<SIZE_T>(i) * Stride;
+        void* Object = Objs[i].ptr;
+        if (!Object)
+        {
+            FMemory::Memzero(Dest, ElemSize);
+            continue;
+        }
+        switch (Mode)
+        {
+        case EUikaGatherMode::Bool:
+            *Dest = BoolProp->GetPropertyValue_InContainer(Object) ? 1 : 0;
+            break;
+        case EUikaGatherMode::Object:
+        {
+            UObject* Value = ObjProp->GetObjectPropertyValue_InContainer(Object);
+            FMemory::Memcpy(Dest, &Value, sizeof(void*));
+            break;
+        }
+        case EUikaGatherMode::Struct:
+            StructProp->Struct->CopyScriptStruct(Dest, StructProp->ContainerPtrToValuePtr<void>(Object));
+            break;
+        case EUikaGatherMode::Pod:
+            FMemory::Memcpy(Dest, Property->ContainerPtrToValuePtr<void>(Object), ElemSize);
+            break;
+        }
+    }
+    return EUikaErrorCode::Ok;
+}
+
+static EUikaErrorCode ScatterImpl(const UikaUObjectHandle* Objs, uint32 Count, UikaFPropertyHandle Prop,
+                                  const uint8* InBuf, uint32 Stride, uint32 Elem)
+{
+    FProperty* Property = static_cast<FProperty*>(Prop.ptr);
+    if (!Property) return EUikaErrorCode::PropertyNotFound;
+
+    EUikaGatherMode Mode;
+    uint32 ElemSize = 0;
+    if (!GetGatherMode(Property, Mode, ElemSize)) return EUikaErrorCode::TypeMismatch;
+    if (!MatchesGatherElement(Mode, ElemSize, Elem)) return EUikaErrorCode::TypeMismatch;
+    if (Count == 0) return EUikaErrorCode::Ok;
+    if (!Objs || !InBuf) return EUikaErrorCode::NullArgument;
+    if (Stride == 0) Stride = ElemSize;
+    if (Stride < ElemSize) return EUikaErrorCode::BufferTooSmall;
+
+    FBoolProperty* BoolProp = Mode == EUikaGatherMode::Bool ? CastField<FBoolProperty>(Property) : nullptr;
+    FObjectPropertyBase* ObjProp = Mode == EUikaGatherMode::Object ? CastField<FObjectPropertyBase>(Property) : nullptr;
+    const FStructProperty* StructProp = Mode == EUikaGatherMode::Struct ? CastField<FStructProperty>(Property) : nullptr;
+
+    for (uint32 i = 0; i < Count; ++i)
+    {
+        void* Object = Objs[i].ptr;
+        if (!Object)
+        {
+            continue;
+        }
+        const uint8* Src = InBuf + static_cast<SIZE_T>(i) * Stride;
+        switch (Mode)
+        {
+        case EUikaGatherMode::Bool:
+            BoolProp->SetPropertyValue_InContainer(Object, *Src != 0);
+            break;
+        case EUikaGatherMode::Object:
+        {
+            UObject* Value = nullptr;
+            FMemory::Memcpy(&Value, Src, sizeof(void*));
+            ObjProp->SetObjectPropertyValue_InContainer(Object, Value);
+            break;
+        }
+        case EUikaGatherMode::Struct:
+            StructProp->Struct->CopyScriptStruct(StructProp->ContainerPtrToValuePtr<void>(Object), Src);
+            break;
+        case EUikaGatherMode::Pod:
+            FMemory::Memcpy(Property->ContainerPtrToValuePtr<void>(Object), Src, ElemSize);
+            break;
+        }
+    }
+    return EUikaErrorCode::Ok;
+}
+
+// ---------------------------------------------------------------------------
+// Math fast paths (canonical FUikaVector / FUikaRotator / FUikaTransform ABI)
+// ---------------------------------------------------------------------------
+
+// Value pointer of a T-typed struct property, or null if the property holds
+// any other struct. Values are converted field by field, never memcpy'd, so
+// the engine's own register layout stays an implementation detail.
+template <typename T>
+static T* MathValuePtr(void* Object, UikaFPropertyHandle Prop)
+{
+    const FStructProperty* StructProp = CastField<FStructProperty>(static_cast<FProperty*>(Prop.ptr));
+    if (!StructProp || StructProp->Struct != TBaseStructure<T>::Get())
+    {
+        return nullptr;
+    }
+    return StructProp->ContainerPtrToValuePtr<T>(Object);
+}
+
+static FUikaVector ToUikaVector(const FVector& V)
+{
+    return FUikaVector{ V.X, V.Y, V.Z, 0.0 };
+}
+
+static FVector FromUikaVector(const FUikaVector& V)
+{
+    return FVector(V.x, V.y, V.z);
+}
+
+static EUikaErrorCode GetVectorImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop, FUikaVector* Out)
+{
+    UIKA_CHECK_VALID(Obj);
+    const FVector* Value = MathValuePtr<FVector>(Object, Prop);
+    if (!Value) return EUikaErrorCode::TypeMismatch;
+    *Out = ToUikaVector(*Value);
+    return EUikaErrorCode::Ok;
+}
+
+static EUikaErrorCode SetVectorImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop, const FUikaVector* Val)
+{
+    UIKA_CHECK_VALID(Obj);
+    FVector* Value = MathValuePtr<FVector>(Object, Prop);
+    if (!Value) return EUikaErrorCode::TypeMismatch;
+    *Value = FromUikaVector(*Val);
+    return EUikaErrorCode::Ok;
+}
+
+static EUikaErrorCode GetRotatorImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop, FUikaRotator* Out)
+{
+    UIKA_CHECK_VALID(Obj);
+    const FRotator* Value = MathValuePtr<FRotator>(Object, Prop);
+    if (!Value) return EUikaErrorCode::TypeMismatch;
+    *Out = FUikaRotator{ Value->Pitch, Value->Yaw, Value->Roll, 0.0 };
+    return EUikaErrorCode::Ok;
+}
+
+static EUikaErrorCode SetRotatorImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop, const FUikaRotator* Val)
+{
+    UIKA_CHECK_VALID(Obj);
+    FRotator* Value = MathValuePtr<FRotator>(Object, Prop);
+    if (!Value) return EUikaErrorCode::TypeMismatch;
+    *Value = FRotator(Val->pitch, Val->yaw, Val->roll);
+    return EUikaErrorCode::Ok;
+}
+
+static EUikaErrorCode GetTransformImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop, FUikaTransform* Out)
+{
+    UIKA_CHECK_VALID(Obj);
+    const FTransform* Value = MathValuePtr<FTransform>(Object, Prop);
+    if (!Value) return EUikaErrorCode::TypeMismatch;
+    const FQuat Rotation = Value->GetRotation();
+    Out->rotation = FUikaQuat{ Rotation.X, Rotation.Y, Rotation.Z, Rotation.W };
+    Out->translation = ToUikaVector(Value->GetTranslation());
+    Out->scale = ToUikaVector(Value->GetScale3D());
+    return EUikaErrorCode::Ok;
+}
+
+static EUikaErrorCode SetTransformImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Prop, const FUikaTransform* Val)
+{
+    UIKA_CHECK_VALID(Obj);
+    FTransform* Value = MathValuePtr<FTransform>(Object, Prop);
+    if (!Value) return EUikaErrorCode::TypeMismatch;
+    const FUikaQuat& R = Val->rotation;
+    *Value = FTransform(FQuat(R.x, R.y, R.z, R.w), FromUikaVector(Val->translation), FromUikaVector(Val->scale));
+    return EUikaErrorCode::Ok;
+}
+
+// ---------------------------------------------------------------------------
+// Property paths (leaf element at a resolved offset)
+// ---------------------------------------------------------------------------
+
+static EUikaErrorCode GetAtOffsetImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Leaf, uint32 Offset,
+    uint8* OutBuf, uint32 BufSize)
+{
+    UIKA_CHECK_VALID(Obj);
+    const FProperty* Property = static_cast<FProperty*>(Leaf.ptr);
+    if (!Property) return EUikaErrorCode::PropertyNotFound;
+    if (!OutBuf) return EUikaErrorCode::NullArgument;
+
+    const void* Src = static_cast<const uint8*>(Object) + Offset;
+    if (const FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
+    {
+        if (BufSize < 1) return EUikaErrorCode::BufferTooSmall;
+        *OutBuf = BoolProp->GetPropertyValue(Src) ? 1 : 0;
+        return EUikaErrorCode::Ok;
+    }
+    if (const FObjectPropertyBase* ObjProp = CastField<FObjectPropertyBase>(Property))
+    {
+        if (BufSize < sizeof(UikaUObjectHandle)) return EUikaErrorCode::BufferTooSmall;
+        const UikaUObjectHandle Value{ ObjProp->GetObjectPropertyValue(Src) };
+        FMemory::Memcpy(OutBuf, &Value, sizeof(Value));
+        return EUikaErrorCode::Ok;
+    }
+    // Anything else would be constructed into an uninitialized Rust buffer.
+    if (!Property->HasAnyPropertyFlags(CPF_IsPlainOldData)) return EUikaErrorCode::TypeMismatch;
+    const uint32 ElemSize = Property->GetElementSize();
+    if (BufSize < ElemSize) return EUikaErrorCode::BufferTooSmall;
+    FMemory::Memcpy(OutBuf, Src, ElemSize);
+    return EUikaErrorCode::Ok;
+}
+
+static EUikaErrorCode SetAtOffsetImpl(UikaUObjectHandle Obj, UikaFPropertyHandle Leaf, uint32 Offset,
+    const uint8* InBuf, uint32 BufSize)
+{
+    UIKA_CHECK_VALID(Obj);
+    const FProperty* Property = static_cast<FProperty*>(Leaf.ptr);
+    if (!Property) return EUikaErrorCode::PropertyNotFound;
+    if (!InBuf) return EUikaErrorCode::NullArgument;
+
+    void* Dest = static_cast<uint8*>(Object) + Offset;
+    if (const FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
+    {
+        if (BufSize < 1) return EUikaErrorCode::BufferTooSmall;
+        BoolProp->SetPropertyValue(Dest, *InBuf != 0);
+        return EUikaErrorCode::Ok;
+    }
+    if (FObjectPropertyBase* ObjProp = CastField<FObjectPropertyBase>(const_cast<FProperty*>(Property)))
+    {
+        if (BufSize < sizeof(UikaUObjectHandle)) return EUikaErrorCode::BufferTooSmall;
+        UikaUObjectHandle Value;
+        FMemory::Memcpy(&Value, InBuf, sizeof(Value));
+        ObjProp->SetObjectPropertyValue(Dest, static_cast<UObject*>(Value.ptr));
+        return EUikaErrorCode::Ok;
+    }
+    if (!Property->HasAnyPropertyFlags(CPF_IsPlainOldData)) return EUikaErrorCode::TypeMismatch;
+    const uint32 ElemSize = Property->GetElementSize();
+    if (BufSize < ElemSize) return EUikaErrorCode::BufferTooSmall;
+    FMemory::Memcpy(Dest, InBuf, ElemSize);
+    return EUikaErrorCode::Ok;
+}
+
 // ---------------------------------------------------------------------------
 // Static instance
 // ---------------------------------------------------------------------------
@@ -420,4 +1018,22 @@ FUikaPropertyApi GPropertyApi = {
     // Indexed access (fixed arrays)
     &GetPropertyAtImpl,
     &SetPropertyAtImpl,
+    // Batched access
+    &BatchImpl,
+    // Gather / scatter
+    &GatherImpl,
+    &ScatterImpl,
+    // Exact-size / borrowed string reads
+    &GetStringExactImpl,
+    &GetStringViewImpl,
+    // Math fast paths
+    &GetVectorImpl,
+    &SetVectorImpl,
+    &GetRotatorImpl,
+    &SetRotatorImpl,
+    &GetTransformImpl,
+    &SetTransformImpl,
+    // Property paths
+    &GetAtOffsetImpl,
+    &SetAtOffsetImpl,
 };
@@ -1,20 +1,128 @@
 // UikaReflectionApiImpl.cpp — FUikaReflectionApi implementation.
 
 #include "UikaApiTable.h"
+#include "UikaFNameHelper.h"
 #include "UObject/UObjectGlobals.h"
 #include "UObject/UnrealType.h"
+#include "UObject/ObjectKey.h"
+#include "Misc/ScopeRWLock.h"
 
-// Helper: convert UTF-8 byte slice to FName.
-static FName Utf8ToFName(const uint8* Name, uint32 NameLen)
+// Generated command-buffer thunks (UikaFillFuncTable.cpp), indexed by FuncId.
+// Null entries are functions that cannot be recorded.
+typedef uint32_t (*FUikaCommandThunk)(const uint8_t* Record, uint32_t Size);
+extern void** UikaGetCmdTable();
+extern uint32_t UikaGetFuncCount();
+
+// Object epoch bump (defined in UikaLifecycleApiImpl.cpp).
+extern void UikaBumpObjectEpoch();
+
+// ---------------------------------------------------------------------------
+// Lookup cache
+// ---------------------------------------------------------------------------
+//
+// Name lookups are cached by (kind, owner, interned name). Each entry holds a
+// weak pointer to the object that bounds the result's lifetime (the owner
+// for member lookups, the result for global finds). A hit whose guard died
+// (package unload, GC) is re-resolved. The whole cache is flushed when the
+// editor reinstances objects.
+
+struct FUikaLookupKey
 {
-    const FString Str(NameLen, UTF8_TO_TCHAR(reinterpret_cast<const char*>(Name)));
-    return FName(*Str);
+    const void* Owner;
+    uint64 Name;
+    uint32 Kind;
+
+    bool operator==(const FUikaLookupKey& Other) const
+    {
+        return Owner == Other.Owner && Name == Other.Name && Kind == Other.Kind;
+    }
+
+    friend uint32 GetTypeHash(const FUikaLookupKey& Key)
+    {
+        return HashCombineFast(HashCombineFast(::GetTypeHash(Key.Owner), ::GetTypeHash(Key.Name)), Key.Kind);
+    }
+};
+
+struct FUikaLookupEntry
+{
+    void* Result;
+    FWeakObjectPtr Guard;
+};
+
+static FRWLock GLookupLock;
+static TMap<FUikaLookupKey, FUikaLookupEntry> GLookupCache;
+#if WITH_EDITOR
+static FDelegateHandle GObjectsReplacedHandle;
+#endif
+static FDelegateHandle GPostGarbageCollectHandle;
+
+static void FlushLookupCache()
+{
+    FWriteScopeLock Lock(GLookupLock);
+    GLookupCache.Empty();
 }
 
-// Helper: convert UTF-8 byte slice to FString.
-static FString Utf8ToFString(const uint8* Name, uint32 NameLen)
+// Uncached lookup. Sets OutGuard to the object whose lifetime bounds the result.
+static void* ResolveUncached(EUikaResolveKind Kind, void* Owner, FName Name, UObject*& OutGuard)
 {
-    return FString(NameLen, UTF8_TO_TCHAR(reinterpret_cast<const char*>(Name)));
+    switch (Kind)
+    {
+    case EUikaResolveKind::Class:
+    {
+        UClass* Found = FindFirstObject<UClass>(*Name.ToString(), EFindFirstObjectOptions::NativeFirst);
+        OutGuard = Found;
+        return Found;
+    }
+    case EUikaResolveKind::Struct:
+    {
+        UScriptStruct* Found = FindFirstObject<UScriptStruct>(*Name.ToString(), EFindFirstObjectOptions::NativeFirst);
+        OutGuard = Found;
+        return Found;
+    }
+    case EUikaResolveKind::Property:
+    case EUikaResolveKind::StructProperty:
+    case EUikaResolveKind::FunctionParam:
+    {
+        UStruct* Struct = static_cast<UStruct*>(Owner);
+        if (!Struct) return nullptr;
+        OutGuard = Struct;
+        return Struct->FindPropertyByName(Name);
+    }
+    case EUikaResolveKind::Function:
+    {
+        UClass* Class = static_cast<UClass*>(Owner);
+        if (!Class) return nullptr;
+        OutGuard = Class;
+        return Class->FindFunctionByName(Name);
+    }
+    default:
+        return nullptr;
+    }
+}
+
+static void* CachedLookup(EUikaResolveKind Kind, void* Owner, const uint8* Name, uint32 NameLen)
+{
+    const FName InternedName = UikaUtf8ToFName(Name, NameLen);
+    if (InternedName.IsNone()) return nullptr;
+
+    const FUikaLookupKey Key{ Owner, UikaPackFName(InternedName), static_cast<uint32>(Kind) };
+    {
+        FReadScopeLock Lock(GLookupLock);
+        if (const FUikaLookupEntry* Hit = GLookupCache.Find(Key))
+        {
+            if (Hit->Guard.IsValid()) return Hit->Result;
+        }
+    }
+
+    UObject* Guard = nullptr;
+    void* Result = ResolveUncached(Kind, Owner, InternedName, Guard);
+    // Misses are not cached: the class or struct may load later.
+    if (Result && Guard)
+    {
+        FWriteScopeLock Lock(GLookupLock);
+        GLookupCache.Add(Key, FUikaLookupEntry{ Result, FWeakObjectPtr(Guard) });
+    }
+    return Result;
 }
 
 // ---------------------------------------------------------------------------
@@ -23,21 +131,16 @@ static FString Utf8ToFString(const uint8* Name, uint32 NameLen)
 
 static UikaUClassHandle FindClassImpl(const uint8* Name, uint32 NameLen)
 {
-    const FString ClassName = Utf8ToFString(Name, NameLen);
-    UClass* Found = FindFirstObject<UClass>(*ClassName, EFindFirstObjectOptions::NativeFirst);
-    return UikaUClassHandle{ Found };
+    return UikaUClassHandle{ CachedLookup(EUikaResolveKind::Class, nullptr, Name, NameLen) };
 }
 
 static UikaFPropertyHandle FindPropertyImpl(UikaUClassHandle Cls, const uint8* Name, uint32 NameLen)
 {
-    UClass* Class = static_cast<UClass*>(Cls.ptr);
-    if (!Class)
+    if (!Cls.ptr)
     {
         return UikaFPropertyHandle{ nullptr };
     }
-    const FName PropName = Utf8ToFName(Name, NameLen);
-    FProperty* Prop = Class->FindPropertyByName(PropName);
-    return UikaFPropertyHandle{ Prop };
+    return UikaFPropertyHandle{ CachedLookup(EUikaResolveKind::Property, Cls.ptr, Name, NameLen) };
 }
 
 static UikaUClassHandle GetStaticClassImpl(const uint8* Name, uint32 NameLen)
@@ -58,21 +161,16 @@ static uint32 GetPropertySizeImpl(UikaFPropertyHandle Prop)
 
 static UikaUStructHandle FindStructImpl(const uint8* Name, uint32 NameLen)
 {
-    const FString StructName = Utf8ToFString(Name, NameLen);
-    UScriptStruct* Found = FindFirstObject<UScriptStruct>(*StructName, EFindFirstObjectOptions::NativeFirst);
-    return UikaUStructHandle{ Found };
+    return UikaUStructHandle{ CachedLookup(EUikaResolveKind::Struct, nullptr, Name, NameLen) };
 }
 
 static UikaFPropertyHandle FindStructPropertyImpl(UikaUStructHandle UStruct, const uint8* Name, uint32 NameLen)
 {
-    UScriptStruct* Struct = static_cast<UScriptStruct*>(UStruct.ptr);
-    if (!Struct)
+    if (!UStruct.ptr)
     {
         return UikaFPropertyHandle{ nullptr };
     }
-    const FName PropName = Utf8ToFName(Name, NameLen);
-    FProperty* Prop = Struct->FindPropertyByName(PropName);
-    return UikaFPropertyHandle{ Prop };
+    return UikaFPropertyHandle{ CachedLookup(EUikaResolveKind::StructProperty, UStruct.ptr, Name, NameLen) };
 }
 
 // ---------------------------------------------------------------------------
@@ -83,22 +181,175 @@ static UikaUFunctionHandle FindFunctionImpl(UikaUObjectHandle Obj, const uint8*
 {
     UObject* Object = static_cast<UObject*>(Obj.ptr);
     if (!::IsValid(Object)) return UikaUFunctionHandle{ nullptr };
-    const FName FuncName = Utf8ToFName(Name, NameLen);
-    UFunction* Func = Object->FindFunction(FuncName);
-    return UikaUFunctionHandle{ Func };
+    return UikaUFunctionHandle{ CachedLookup(EUikaResolveKind::Function, Object->GetClass(), Name, NameLen) };
 }
 
-static uint8* AllocParamsImpl(UikaUFunctionHandle Func)
+// ---------------------------------------------------------------------------
+// Parameter frame plans and pool
+// ---------------------------------------------------------------------------
+//
+// A frame plan caches, per UFunction, the frame size/alignment and the
+// parameters that actually need construction (not CPF_ZeroConstructor) or
+// destruction (not POD / CPF_NoDestructor). Frames up to
+// UIKA_FRAME_POOL_MAX_SIZE bytes are recycled through per-size-class free
+// lists instead of hitting the allocator on each call.
+//
+// Plans are keyed by object index + serial number, so a UFunction allocated
+// at a dead one's address gets its own entry; a published plan is never
+// replaced while it may still be in use. Dead entries are pruned after GC.
+
+struct FUikaFramePlan
 {
-    UFunction* Function = static_cast<UFunction*>(Func.ptr);
-    if (!Function || Function->ParmsSize == 0) return nullptr;
-    uint8* Params = static_cast<uint8*>(FMemory::Malloc(Function->ParmsSize));
-    FMemory::Memzero(Params, Function->ParmsSize);
-    // Initialize properties to defaults
+    uint32 Size = 0;
+    uint32 Alignment = 0;
+    TArray<FProperty*, TInlineAllocator<4>> NeedsInit;
+    TArray<FProperty*, TInlineAllocator<4>> NeedsDestroy;
+};
+
+static constexpr uint32 UIKA_FRAME_POOL_GRANULE  = 64;
+static constexpr uint32 UIKA_FRAME_POOL_MAX_SIZE = 1024;
+static constexpr uint32 UIKA_FRAME_POOL_CLASSES  = UIKA_FRAME_POOL_MAX_SIZE / UIKA_FRAME_POOL_GRANULE;
+static constexpr uint32 UIKA_FRAME_POOL_DEPTH    = 8;
+static constexpr uint32 UIKA_FRAME_POOL_ALIGN    = 16;
+
+static FRWLock GFramePlanLock;
+static TMap<FObjectKey, TUniquePtr<FUikaFramePlan>> GFramePlans;
+
+static FCriticalSection GFramePoolLock;
+static TArray<uint8*, TInlineAllocator<UIKA_FRAME_POOL_DEPTH>> GFramePool[UIKA_FRAME_POOL_CLASSES];
+
+static const FUikaFramePlan* GetFramePlan(const UFunction* Function)
+{
+    const FObjectKey Key(Function);
+    {
+        FReadScopeLock Lock(GFramePlanLock);
+        if (const TUniquePtr<FUikaFramePlan>* Plan = GFramePlans.Find(Key)) return Plan->Get();
+    }
+
+    TUniquePtr<FUikaFramePlan> NewPlan = MakeUnique<FUikaFramePlan>();
+    FUikaFramePlan& Plan = *NewPlan;
+    Plan.Size = static_cast<uint32>(Function->ParmsSize);
+    Plan.Alignment = static_cast<uint32>(FMath::Max(Function->GetMinAlignment(), 1));
     for (TFieldIterator<FProperty> It(Function); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
     {
-        It->InitializeValue_InContainer(Params);
+        if (!It->HasAnyPropertyFlags(CPF_ZeroConstructor))
+        {
+            Plan.NeedsInit.Add(*It);
+        }
+        if (!It->HasAnyPropertyFlags(CPF_IsPlainOldData | CPF_NoDestructor))
+        {
+            Plan.NeedsDestroy.Add(*It);
+        }
+    }
+
+    // Plans are heap-allocated so pointers stay valid while the map grows.
+    // They are only freed by FlushFramePlans (reinstancing / shutdown on the
+    // game thread) or PruneFramePlans once their UFunction has been collected.
+    FWriteScopeLock Lock(GFramePlanLock);
+    if (const TUniquePtr<FUikaFramePlan>* Existing = GFramePlans.Find(Key))
+    {
+        return Existing->Get();
+    }
+    return GFramePlans.Add(Key, MoveTemp(NewPlan)).Get();
+}
+
+// Drop the plans of collected UFunctions (post-GC, game thread).
+static void PruneFramePlans()
+{
+    FWriteScopeLock Lock(GFramePlanLock);
+    for (auto It = GFramePlans.CreateIterator(); It; ++It)
+    {
+        if (!It.Key().ResolveObjectPtr())
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+static void FlushFramePlans()
+{
+    {
+        FWriteScopeLock Lock(GFramePlanLock);
+        GFramePlans.Empty();
+    }
+    FScopeLock Lock(&GFramePoolLock);
+    for (auto& Bucket : GFramePool)
+    {
+        for (uint8* Frame : Bucket)
+        {
+            FMemory::Free(Frame);
+        }
+        Bucket.Reset();
+    }
+}
+
+static bool IsPooledFrame(const FUikaFramePlan& Plan)
+{
+    return Plan.Size <= UIKA_FRAME_POOL_MAX_SIZE && Plan.Alignment <= UIKA_FRAME_POOL_ALIGN;
+}
+
+static uint32 FramePoolClass(uint32 Size)
+{
+    return (Size + UIKA_FRAME_POOL_GRANULE - 1) / UIKA_FRAME_POOL_GRANULE - 1;
+}
+
+static uint8* AcquireFrame(const FUikaFramePlan& Plan)
+{
+    if (!IsPooledFrame(Plan))
+    {
+        return static_cast<uint8*>(FMemory::Malloc(Plan.Size, Plan.Alignment));
+    }
+    const uint32 Class = FramePoolClass(Plan.Size);
+    {
+        FScopeLock Lock(&GFramePoolLock);
+        if (GFramePool[Class].Num() > 0)
+        {
+            return GFramePool[Class].Pop(EAllowShrinking::No);
+        }
+    }
+    return static_cast<uint8*>(FMemory::Malloc((Class + 1) * UIKA_FRAME_POOL_GRANULE, UIKA_FRAME_POOL_ALIGN));
+}
+
+static void ReleaseFrame(const FUikaFramePlan& Plan, uint8* Frame)
+{
+    if (IsPooledFrame(Plan))
+    {
+        const uint32 Class = FramePoolClass(Plan.Size);
+        FScopeLock Lock(&GFramePoolLock);
+        if (static_cast<uint32>(GFramePool[Class].Num()) < UIKA_FRAME_POOL_DEPTH)
+        {
+            GFramePool[Class].Add(Frame);
+            return;
+        }
+    }
+    FMemory::Free(Frame);
+}
+
+// Zero the frame and construct only the parameters that need it.
+static void InitFrame(const FUikaFramePlan& Plan, uint8* Frame)
+{
+    FMemory::Memzero(Frame, Plan.Size);
+    for (FProperty* Prop : Plan.NeedsInit)
+    {
+        Prop->InitializeValue_InContainer(Frame);
+    }
+}
+
+static void DestroyFrame(const FUikaFramePlan& Plan, uint8* Frame)
+{
+    for (FProperty* Prop : Plan.NeedsDestroy)
+    {
+        Prop->DestroyValue_InContainer(Frame);
     }
+}
+
+static uint8* AllocParamsImpl(UikaUFunctionHandle Func)
+{
+    UFunction* Function = static_cast<UFunction*>(Func.ptr);
+    if (!Function || Function->ParmsSize == 0) return nullptr;
+    const FUikaFramePlan& Plan = *GetFramePlan(Function);
+    uint8* Params = AcquireFrame(Plan);
+    InitFrame(Plan, Params);
     return Params;
 }
 
@@ -106,14 +357,49 @@ static void FreeParamsImpl(UikaUFunctionHandle Func, uint8* Params)
 {
     if (!Params) return;
     UFunction* Function = static_cast<UFunction*>(Func.ptr);
-    if (Function)
+    if (!Function)
     {
-        for (TFieldIterator<FProperty> It(Function); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
-        {
-            It->DestroyValue_InContainer(Params);
-        }
+        FMemory::Free(Params);
+        return;
     }
-    FMemory::Free(Params);
+    const FUikaFramePlan& Plan = *GetFramePlan(Function);
+    DestroyFrame(Plan, Params);
+    ReleaseFrame(Plan, Params);
+}
+
+static EUikaErrorCode GetFrameLayoutImpl(UikaUFunctionHandle Func, FUikaFrameLayout* Out)
+{
+    UFunction* Function = static_cast<UFunction*>(Func.ptr);
+    if (!Function) return EUikaErrorCode::FunctionNotFound;
+    if (!Out) return EUikaErrorCode::NullArgument;
+    const FUikaFramePlan& Plan = *GetFramePlan(Function);
+    Out->size = Plan.Size;
+    Out->align = Plan.Alignment;
+    Out->init_count = static_cast<uint32>(Plan.NeedsInit.Num());
+    Out->destroy_count = static_cast<uint32>(Plan.NeedsDestroy.Num());
+    return EUikaErrorCode::Ok;
+}
+
+static EUikaErrorCode InitParamsImpl(UikaUFunctionHandle Func, uint8* Buf, uint32 BufLen)
+{
+    UFunction* Function = static_cast<UFunction*>(Func.ptr);
+    if (!Function) return EUikaErrorCode::FunctionNotFound;
+    const FUikaFramePlan& Plan = *GetFramePlan(Function);
+    if (Plan.Size == 0) return EUikaErrorCode::Ok;
+    if (!Buf) return EUikaErrorCode::NullArgument;
+    if (BufLen < Plan.Size) return EUikaErrorCode::BufferTooSmall;
+    if (!IsAligned(Buf, Plan.Alignment)) return EUikaErrorCode::InvalidOperation;
+    InitFrame(Plan, Buf);
+    return EUikaErrorCode::Ok;
+}
+
+static EUikaErrorCode DestroyParamsImpl(UikaUFunctionHandle Func, uint8* Buf)
+{
+    UFunction* Function = static_cast<UFunction*>(Func.ptr);
+    if (!Function) return EUikaErrorCode::FunctionNotFound;
+    if (!Buf) return EUikaErrorCode::NullArgument;
+    DestroyFrame(*GetFramePlan(Function), Buf);
+    return EUikaErrorCode::Ok;
 }
 
 static EUikaErrorCode CallFunctionImpl(UikaUObjectHandle Obj, UikaUFunctionHandle Func, uint8* Params)
@@ -123,16 +409,14 @@ static EUikaErrorCode CallFunctionImpl(UikaUObjectHandle Obj, UikaUFunctionHandl
     UFunction* Function = static_cast<UFunction*>(Func.ptr);
     if (!Function) return EUikaErrorCode::FunctionNotFound;
     Object->ProcessEvent(Function, Params);
+    UikaBumpObjectEpoch();
     return EUikaErrorCode::Ok;
 }
 
 static UikaFPropertyHandle GetFunctionParamImpl(UikaUFunctionHandle Func, const uint8* Name, uint32 NameLen)
 {
-    UFunction* Function = static_cast<UFunction*>(Func.ptr);
-    if (!Function) return UikaFPropertyHandle{ nullptr };
-    const FName PropName = Utf8ToFName(Name, NameLen);
-    FProperty* Prop = Function->FindPropertyByName(PropName);
-    return UikaFPropertyHandle{ Prop };
+    if (!Func.ptr) return UikaFPropertyHandle{ nullptr };
+    return UikaFPropertyHandle{ CachedLookup(EUikaResolveKind::FunctionParam, Func.ptr, Name, NameLen) };
 }
 
 static uint32 GetPropertyOffsetImpl(UikaFPropertyHandle Prop)
@@ -144,11 +428,8 @@ static uint32 GetPropertyOffsetImpl(UikaFPropertyHandle Prop)
 
 static UikaUFunctionHandle FindFunctionByClassImpl(UikaUClassHandle Cls, const uint8* Name, uint32 NameLen)
 {
-    UClass* Class = static_cast<UClass*>(Cls.ptr);
-    if (!Class) return UikaUFunctionHandle{ nullptr };
-    const FName FuncName = Utf8ToFName(Name, NameLen);
-    UFunction* Func = Class->FindFunctionByName(FuncName);
-    return UikaUFunctionHandle{ Func };
+    if (!Cls.ptr) return UikaUFunctionHandle{ nullptr };
+    return UikaUFunctionHandle{ CachedLookup(EUikaResolveKind::Function, Cls.ptr, Name, NameLen) };
 }
 
 static uint32 GetElementSizeImpl(UikaFPropertyHandle Prop)
@@ -179,6 +460,253 @@ static EUikaErrorCode DestroyStructImpl(UikaUStructHandle UStructHandle, uint8*
     return EUikaErrorCode::Ok;
 }
 
+// ---------------------------------------------------------------------------
+// Layout descriptors (direct field access from Rust)
+// ---------------------------------------------------------------------------
+
+static EUikaErrorCode GetFieldDescImpl(UikaFPropertyHandle Prop, FUikaFieldDesc* Out)
+{
+    FProperty* Property = static_cast<FProperty*>(Prop.ptr);
+    if (!Property) return EUikaErrorCode::PropertyNotFound;
+    if (!Out) return EUikaErrorCode::NullArgument;
+
+    FMemory::Memzero(Out, sizeof(FUikaFieldDesc));
+    Out->offset = static_cast<uint32>(Property->GetOffset_ForInternal());
+    Out->elem_size = static_cast<uint32>(Property->GetElementSize());
+    Out->array_dim = static_cast<uint32>(Property->ArrayDim);
+
+    if (const FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
+    {
+        // Native bools and bit-fields are both a masked byte access.
+        Out->flags = UIKA_FIELD_BOOL;
+        Out->bool_byte_offset = BoolProp->GetByteOffset();
+        Out->bool_byte_mask = BoolProp->GetByteMask();
+        Out->bool_field_mask = BoolProp->GetFieldMask();
+    }
+    else if (CastField<FObjectPropertyBase>(Property))
+    {
+        // Never POD: TObjectPtr may need resolving.
+        Out->flags = UIKA_FIELD_OBJECT;
+    }
+    else if (Property->HasAnyPropertyFlags(CPF_IsPlainOldData))
+    {
+        Out->flags = UIKA_FIELD_POD;
+    }
+    return EUikaErrorCode::Ok;
+}
+
+// ---------------------------------------------------------------------------
+// Property paths ("Transform.Translation.X", "Slots[2].Count")
+// ---------------------------------------------------------------------------
+//
+// Struct properties and fixed-array elements are stored inline, so a whole
+// path collapses to one byte offset from the container plus the leaf.
+
+static EUikaErrorCode ResolvePropertyPathImpl(UikaUClassHandle Owner, const uint8* Path, uint32 PathLen,
+    UikaFPropertyHandle* OutLeaf, FUikaFieldDesc* OutDesc)
+{
+    if (!Owner.ptr || !Path || !PathLen || !OutLeaf || !OutDesc) return EUikaErrorCode::NullArgument;
+
+    UStruct* Struct = static_cast<UStruct*>(Owner.ptr);
+    EUikaResolveKind Kind = EUikaResolveKind::Property;
+    uint64 Offset = 0;
+    uint32 Pos = 0;
+    for (;;)
+    {
+        // Segment: Name or Name[Index]
+        const uint32 NameStart = Pos;
+        while (Pos < PathLen && Path[Pos] != '.' && Path[Pos] != '[') ++Pos;
+        if (Pos == NameStart) return EUikaErrorCode::InvalidOperation;
+
+        FProperty* Property = static_cast<FProperty*>(
+            CachedLookup(Kind, Struct, Path + NameStart, Pos - NameStart));
+        if (!Property) return EUikaErrorCode::PropertyNotFound;
+
+        bool bIndexed = false;
+        uint32 Index = 0;
+        if (Pos < PathLen && Path[Pos] == '[')
+        {
+            const uint32 DigitsStart = ++Pos;
+            while (Pos < PathLen && Path[Pos] >= '0' && Path[Pos] <= '9')
+            {
+                Index = Index * 10 + (Path[Pos++] - '0');
+                if (Index >= static_cast<uint32>(Property->ArrayDim)) return EUikaErrorCode::IndexOutOfRange;
+            }
+            if (Pos == DigitsStart || Pos >= PathLen || Path[Pos] != ']') return EUikaErrorCode::InvalidOperation;
+            ++Pos;
+            bIndexed = true;
+        }
+        Offset += Property->GetOffset_ForInternal() + uint64(Index) * Property->GetElementSize();
+
+        if (Pos == PathLen)
+        {
+            const EUikaErrorCode Code = GetFieldDescImpl(UikaFPropertyHandle{ Property }, OutDesc);
+            if (Code != EUikaErrorCode::Ok) return Code;
+            if (Offset > MAX_uint32) return EUikaErrorCode::InternalError;
+            OutDesc->offset = static_cast<uint32>(Offset);
+            if (bIndexed) OutDesc->array_dim = 1;
+            *OutLeaf = UikaFPropertyHandle{ Property };
+            return EUikaErrorCode::Ok;
+        }
+        if (Path[Pos] != '.' || ++Pos == PathLen) return EUikaErrorCode::InvalidOperation;
+
+        const FStructProperty* StructProp = CastField<FStructProperty>(Property);
+        if (!StructProp) return EUikaErrorCode::TypeMismatch;
+        Struct = StructProp->Struct;
+        Kind = EUikaResolveKind::StructProperty;
+    }
+}
+
+static uint64 GetLayoutHashImpl(UikaUClassHandle Cls)
+{
+    const UStruct* Struct = static_cast<UStruct*>(Cls.ptr);
+    if (!Struct) return 0;
+
+    // FNV-1a over (name, type, offset, size, dim) of every property, including super.
+    uint64 Hash = 14695981039346656037ull;
+    auto Mix = [&Hash](uint32 Value)
+    {
+        for (int32 i = 0; i < 4; ++i)
+        {
+            Hash ^= (Value >> (i * 8)) & 0xFF;
+            Hash *= 1099511628211ull;
+        }
+    };
+
+    Mix(static_cast<uint32>(Struct->GetPropertiesSize()));
+    for (TFieldIterator<FProperty> It(Struct); It; ++It)
+    {
+        Mix(FCrc::StrCrc32(*It->GetName()));
+        Mix(FCrc::StrCrc32(*It->GetClass()->GetName()));
+        Mix(static_cast<uint32>(It->GetOffset_ForInternal()));
+        Mix(static_cast<uint32>(It->GetElementSize()));
+        Mix(static_cast<uint32>(It->ArrayDim));
+    }
+    return Hash;
+}
+
+// ---------------------------------------------------------------------------
+// Cache invalidation hooks (called from UikaModule.cpp)
+// ---------------------------------------------------------------------------
+
+void UikaReflectionCacheRegisterListeners()
+{
+    GPostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&PruneFramePlans);
+#if WITH_EDITOR
+    GObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddLambda(
+        [](const TMap<UObject*, UObject*>&)
+        {
+            FlushLookupCache();
+            FlushFramePlans();
+        });
+#endif
+}
+
+void UikaReflectionCacheUnregisterListeners()
+{
+    FCoreUObjectDelegates::GetPostGarbageCollect().Remove(GPostGarbageCollectHandle);
+    GPostGarbageCollectHandle.Reset();
+#if WITH_EDITOR
+    FCoreUObjectDelegates::OnObjectsReplaced.Remove(GObjectsReplacedHandle);
+    GObjectsReplacedHandle.Reset();
+#endif
+    FlushLookupCache();
+    FlushFramePlans();
+}
+
+// ---------------------------------------------------------------------------
+// Batched resolution
+// ---------------------------------------------------------------------------
+
+static uint32 ResolveManyImpl(FUikaResolveReq* Reqs, uint32 Count)
+{
+    if (!Reqs) return 0;
+
+    uint32 Resolved = 0;
+    for (uint32 i = 0; i < Count; ++i)
+    {
+        FUikaResolveReq& Req = Reqs[i];
+        const EUikaResolveKind Kind = static_cast<EUikaResolveKind>(Req.kind);
+
+        void* Owner = Req.owner;
+        if (Req.owner_index != UIKA_RESOLVE_NO_OWNER_INDEX)
+        {
+            Owner = Req.owner_index < i ? Reqs[Req.owner_index].result : nullptr;
+        }
+
+        const bool bNeedsOwner = Kind != EUikaResolveKind::Class && Kind != EUikaResolveKind::Struct;
+        Req.result = (bNeedsOwner && !Owner)
+            ? nullptr
+            : CachedLookup(Kind, Owner, Req.name.ptr, Req.name.len);
+        if (Req.result) ++Resolved;
+    }
+    return Resolved;
+}
+
+// ---------------------------------------------------------------------------
+// Command buffers
+// ---------------------------------------------------------------------------
+
+static EUikaErrorCode ExecuteCommandBufferImpl(const uint8* Buf, uint32 Len, uint32* OutExecuted, uint32* OutFailed)
+{
+    uint32 Executed = 0;
+    uint32 Failed = 0;
+    EUikaErrorCode Result = EUikaErrorCode::Ok;
+
+    if (!Buf && Len > 0)
+    {
+        Result = EUikaErrorCode::NullArgument;
+    }
+    else if (!IsAligned(Buf, UIKA_CMD_ALIGN))
+    {
+        Result = EUikaErrorCode::InvalidOperation;
+    }
+    else
+    {
+        void* const* Thunks = UikaGetCmdTable();
+        const uint32 FuncCount = UikaGetFuncCount();
+
+        uint32 Offset = 0;
+        while (Offset < Len)
+        {
+            FUikaCommandHeader Header;
+            if (Len - Offset < sizeof(Header))
+            {
+                Result = EUikaErrorCode::InvalidOperation;
+                break;
+            }
+            FMemory::Memcpy(&Header, Buf + Offset, sizeof(Header));
+            if (Header.size < sizeof(Header) || Header.size % UIKA_CMD_ALIGN != 0
+                || Header.size > Len - Offset || Header.func_id >= FuncCount)
+            {
+                Result = EUikaErrorCode::InvalidOperation;
+                break;
+            }
+
+            FUikaCommandThunk Thunk = reinterpret_cast<FUikaCommandThunk>(Thunks[Header.func_id]);
+            if (!Thunk || Thunk(Buf + Offset, Header.size) != static_cast<uint32_t>(EUikaErrorCode::Ok))
+            {
+                ++Failed;
+            }
+            ++Executed;
+            Offset += Header.size;
+        }
+    }
+    if (Executed > 0)
+    {
+        UikaBumpObjectEpoch();
+    }
+
+    if (OutExecuted) *OutExecuted = Executed;
+    if (OutFailed) *OutFailed = Failed;
+    return Result;
+}
+
+static bool HasCommandThunkImpl(uint32 FuncId)
+{
+    return FuncId < UikaGetFuncCount() && UikaGetCmdTable()[FuncId] != nullptr;
+}
+
 // ---------------------------------------------------------------------------
 // Static instance
 // ---------------------------------------------------------------------------
@@ -201,4 +729,15 @@ FUikaReflectionApi GReflectionApi = {
     &GetStructSizeImpl,
     &InitializeStructImpl,
     &DestroyStructImpl,
+    &GetFieldDescImpl,
+    &GetLayoutHashImpl,
+    &ResolveManyImpl,
+    &GetFrameLayoutImpl,
+    &InitParamsImpl,
+    &DestroyParamsImpl,
+    // Command buffers
+    &ExecuteCommandBufferImpl,
+    &HasCommandThunkImpl,
+    // Property paths
+    &ResolvePropertyPathImpl,
 };
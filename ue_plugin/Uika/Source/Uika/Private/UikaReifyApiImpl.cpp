@@ -11,17 +11,19 @@
 #include "UObject/UObjectArray.h"
 #include "UObject/UObjectIterator.h"
 
-// Helper: convert UTF-8 byte slice to FName.
-static FName ReifyUtf8ToFName(const uint8* Name, uint32 NameLen)
+// Helper: convert UTF-8 byte slice to FString. The slice is not
+// NUL-terminated (schema names sit back to back), so convert by length.
+static FString ReifyUtf8ToFString(const uint8* Name, uint32 NameLen)
 {
-    const FString Str(NameLen, UTF8_TO_TCHAR(reinterpret_cast<const char*>(Name)));
-    return FName(*Str);
+    const FUTF8ToTCHAR Wide(reinterpret_cast<const ANSICHAR*>(Name), NameLen);
+    return FString(Wide.Length(), Wide.Get());
 }
 
-// Helper: convert UTF-8 byte slice to FString.
-static FString ReifyUtf8ToFString(const uint8* Name, uint32 NameLen)
+// Helper: convert UTF-8 byte slice to FName.
+static FName ReifyUtf8ToFName(const uint8* Name, uint32 NameLen)
 {
-    return FString(NameLen, UTF8_TO_TCHAR(reinterpret_cast<const char*>(Name)));
+    const FUTF8ToTCHAR Wide(reinterpret_cast<const ANSICHAR*>(Name), NameLen);
+    return FName(Wide.Length(), Wide.Get());
 }
 
 // ---------------------------------------------------------------------------
@@ -320,6 +322,10 @@ static void CopyParamsFromParentFunction(UFunction* NewFunc, UFunction* ParentFu
 // Shared package pointer for all reified classes.
 static UPackage* GUikaReifyPackage = nullptr;
 
+// Every class created through create_class (rooted, never destroyed). Lets
+// instance enumeration visit only reified classes instead of all objects.
+static TArray<UUikaReifiedClass*> GReifiedClasses;
+
 static UPackage* GetOrCreateUikaPackage()
 {
     if (!GUikaReifyPackage)
@@ -352,8 +358,9 @@ static UikaUClassHandle CreateClassImpl(
     {
         // Update the Rust type ID (may have changed if Rust struct layout changed).
         Existing->RustTypeId = RustTypeId;
+        GReifiedClasses.AddUnique(Existing);
 
-        UE_LOG(LogUika, Display,
+        UE_LOG(LogUika, Verbose,
             TEXT("[Uika] Hot reload: reusing existing class %s (type_id: %llu)"),
             *ClassName, RustTypeId);
 
@@ -412,8 +419,9 @@ static UikaUClassHandle CreateClassImpl(
 
     // Prevent garbage collection.
     NewClass->AddToRoot();
+    GReifiedClasses.Add(NewClass);
 
-    UE_LOG(LogUika, Display, TEXT("[Uika] Created reified class: %s (parent: %s, type_id: %llu)"),
+    UE_LOG(LogUika, Verbose, TEXT("[Uika] Created reified class: %s (parent: %s, type_id: %llu)"),
         *ClassName, *ParentClass->GetName(), RustTypeId);
 
     return UikaUClassHandle{ NewClass };
@@ -438,7 +446,7 @@ static UikaFPropertyHandle AddPropertyImpl(
     {
         if (P->GetOwnerClass() == Class && P->GetFName() == PropName)
         {
-            UE_LOG(LogUika, Display,
+            UE_LOG(LogUika, Verbose,
                 TEXT("[Uika] Hot reload: reusing existing property %s::%s"),
                 *Class->GetName(), *PropName.ToString());
             return UikaFPropertyHandle{ P };
@@ -483,7 +491,7 @@ static UikaUFunctionHandle AddFunctionImpl(
         if (UUikaReifiedFunction* Reified = Cast<UUikaReifiedFunction>(ExistingFunc))
         {
             Reified->CallbackId = CallbackId;
-            UE_LOG(LogUika, Display,
+            UE_LOG(LogUika, Verbose,
                 TEXT("[Uika] Hot reload: updated CallbackId for %s::%s (id: %llu)"),
                 *Class->GetName(), *FuncName, CallbackId);
             return UikaUFunctionHandle{ ExistingFunc };
@@ -517,7 +525,7 @@ static UikaUFunctionHandle AddFunctionImpl(
         if (ParentFunc)
         {
             CopyParamsFromParentFunction(NewFunc, ParentFunc);
-            UE_LOG(LogUika, Display,
+            UE_LOG(LogUika, Verbose,
                 TEXT("[Uika] Override %s::%s: copied params from parent %s"),
                 *Class->GetName(), *FuncName, *ParentFunc->GetOuter()->GetName());
         }
@@ -603,7 +611,11 @@ static EUikaErrorCode FinalizeClassImpl(UikaUClassHandle Cls)
     // Hot reload path: if already finalized (Bind/StaticLink done), skip.
     if (Class->HasAnyClassFlags(CLASS_Constructed))
     {
-        UE_LOG(LogUika, Display,
+        // Functions and subobjects may have been added by the new DLL; refresh
+        // the tables.
+        Class->BuildDispatchTables();
+        Class->BuildConstructionPlan();
+        UE_LOG(LogUika, Verbose,
             TEXT("[Uika] Hot reload: class %s already finalized, skipping"),
             *Class->GetName());
         return EUikaErrorCode::Ok;
@@ -620,6 +632,13 @@ static EUikaErrorCode FinalizeClassImpl(UikaUClassHandle Cls)
     // Finalize the class itself.
     Class->Bind();
     Class->StaticLink(true);
+    Class->ReserveRustDataSlot();
+
+    // Thunk dispatch table and per-function bytecode param plans.
+    Class->BuildDispatchTables();
+
+    // Subobject construction plan; the CDO below is the first user.
+    Class->BuildConstructionPlan();
 
     // Build the GC reference token stream so the garbage collector can
     // properly trace UObject* references within instances of this class.
@@ -641,7 +660,7 @@ static EUikaErrorCode FinalizeClassImpl(UikaUClassHandle Cls)
             {
                 ActorCDO->PrimaryActorTick.bCanEverTick = true;
                 ActorCDO->PrimaryActorTick.bStartWithTickEnabled = true;
-                UE_LOG(LogUika, Display,
+                UE_LOG(LogUika, Verbose,
                     TEXT("[Uika] Enabled tick for %s (ReceiveTick override detected)"),
                     *Class->GetName());
                 break;
@@ -649,17 +668,20 @@ static EUikaErrorCode FinalizeClassImpl(UikaUClassHandle Cls)
         }
     }
 
-    UE_LOG(LogUika, Display, TEXT("[Uika] Finalized reified class: %s (size: %d, super_size: %d)"),
+    // Per-class diagnostics are Verbose (enable with `-LogCmds="LogUika Verbose"`);
+    // with hundreds of classes they dominated registration time at Display.
+    UE_LOG(LogUika, Verbose, TEXT("[Uika] Finalized reified class: %s (size: %d, super_size: %d)"),
         *Class->GetName(), Class->GetPropertiesSize(),
         Class->GetSuperClass() ? Class->GetSuperClass()->GetPropertiesSize() : 0);
 
     // Validate property chain integrity.
+    const bool bLogProperties = UE_LOG_ACTIVE(LogUika, VeryVerbose);
     int32 PropCount = 0;
     for (FProperty* P = Class->PropertyLink; P; P = P->PropertyLinkNext)
     {
-        if (P->GetOwnerClass() == Class)
+        if (bLogProperties && P->GetOwnerClass() == Class)
         {
-            UE_LOG(LogUika, Display, TEXT("[Uika]   Property: %s offset=%d size=%d"),
+            UE_LOG(LogUika, VeryVerbose, TEXT("[Uika]   Property: %s offset=%d size=%d"),
                 *P->GetName(), P->GetOffset_ForInternal(), P->GetSize());
         }
         PropCount++;
@@ -669,7 +691,7 @@ static EUikaErrorCode FinalizeClassImpl(UikaUClassHandle Cls)
             break;
         }
     }
-    UE_LOG(LogUika, Display, TEXT("[Uika]   Total properties in chain: %d"), PropCount);
+    UE_LOG(LogUika, VeryVerbose, TEXT("[Uika]   Total properties in chain: %d"), PropCount);
 
     return EUikaErrorCode::Ok;
 }
@@ -716,7 +738,7 @@ static EUikaErrorCode AddDefaultSubobjectImpl(
     });
     RC->ComponentDefs.Add(MoveTemp(Def));
 
-    UE_LOG(LogUika, Display, TEXT("[Uika] Registered default subobject '%s' (class: %s) on %s"),
+    UE_LOG(LogUika, Verbose, TEXT("[Uika] Registered default subobject '%s' (class: %s) on %s"),
         *Def.SubobjectName.ToString(), *CompUClass->GetName(), *RC->GetName());
 
     return EUikaErrorCode::Ok;
@@ -735,71 +757,527 @@ static UikaUObjectHandle FindDefaultSubobjectImpl(
 }
 
 // ---------------------------------------------------------------------------
-// FUikaDeleteListener — Notifies Rust when a reified-class instance is GC'd
+// Hot reload helpers (called from UikaModule.cpp)
 // ---------------------------------------------------------------------------
 
-class FUikaDeleteListener : public FUObjectArray::FUObjectDeleteListener
+void UikaReifyForEachReifiedInstance(
+    TFunctionRef<void(UObject*, UUikaReifiedClass*)> Callback)
 {
-public:
-    virtual void NotifyUObjectDeleted(const UObjectBase* Object, int32 Index) override
+    // Walks the per-class instance registries (CDOs are never registered,
+    // they don't have meaningful Rust instance data).
+    TArray<UObject*> Instances;
+    for (UUikaReifiedClass* ReifiedClass : GReifiedClasses)
     {
-        // Only handle objects whose class is a reified class.
-        const UClass* ObjClass = Object->GetClass();
-        const UUikaReifiedClass* ReifiedClass = Cast<UUikaReifiedClass>(ObjClass);
-        if (!ReifiedClass)
+        Instances.Reset();
+        ReifiedClass->GetLiveInstances(Instances);
+        for (UObject* Obj : Instances)
         {
-            return;
+            Callback(Obj, ReifiedClass);
         }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Instance enumeration
+// ---------------------------------------------------------------------------
 
-        const FUikaRustCallbacks* Callbacks = GetUikaRustCallbacks();
-        if (Callbacks && Callbacks->drop_rust_instance)
+// Write live instances of every reified class that is Cls or derives from it
+// (Cls may be native, e.g. AActor for all Rust actors). Garbage-flagged
+// objects are skipped. out_count receives the total; BufferTooSmall if it
+// exceeds Capacity (the first Capacity handles are still written).
+static EUikaErrorCode GetInstancesImpl(
+    UikaUClassHandle Cls,
+    UikaUObjectHandle* Out, uint32 Capacity,
+    uint32* OutCount)
+{
+    UClass* Class = static_cast<UClass*>(Cls.ptr);
+    if (!Class || !OutCount)
+    {
+        return EUikaErrorCode::NullArgument;
+    }
+    if (Capacity > 0 && !Out)
+    {
+        return EUikaErrorCode::NullArgument;
+    }
+
+    uint32 Count = 0;
+    TArray<UObject*> Instances;
+    for (UUikaReifiedClass* ReifiedClass : GReifiedClasses)
+    {
+        // Every instance matches when Class is the reified class or one of
+        // its ancestors. A Blueprint subclass of it (whose instances are
+        // registered with this reified ancestor) matches per instance.
+        const bool bAllMatch = ReifiedClass->IsChildOf(Class);
+        if (!bAllMatch && !Class->IsChildOf(ReifiedClass))
+        {
+            continue;
+        }
+        Instances.Reset();
+        ReifiedClass->GetLiveInstances(Instances);
+        for (UObject* Obj : Instances)
         {
-            Callbacks->drop_rust_instance(
-                UikaUObjectHandle{ const_cast<UObjectBase*>(Object) },
-                ReifiedClass->RustTypeId,
-                nullptr);
+            if (!IsValid(Obj) || (!bAllMatch && !Obj->GetClass()->IsChildOf(Class)))
+            {
+                continue;
+            }
+            if (Count < Capacity)
+            {
+                Out[Count] = UikaUObjectHandle{ Obj };
+            }
+            ++Count;
         }
     }
 
-    virtual void OnUObjectArrayShutdown() override
+    *OutCount = Count;
+    return Count > Capacity ? EUikaErrorCode::BufferTooSmall : EUikaErrorCode::Ok;
+}
+
+// ---------------------------------------------------------------------------
+// Hot-reload snapshot arena
+// ---------------------------------------------------------------------------
+
+// Pages mapped straight from the OS and owned by the plugin module. The
+// outgoing DLL writes its instance snapshot here and the incoming DLL reads
+// it in place, so the bytes never pass through either DLL's heap allocator.
+static void*  GSnapshotArena = nullptr;
+static SIZE_T GSnapshotMappedSize = 0;
+static uint32 GSnapshotLen = 0;
+
+// Unmap the snapshot arena (module hook, after restore and on shutdown).
+void UikaReifySnapshotRelease()
+{
+    if (GSnapshotArena)
     {
-        GUObjectArray.RemoveUObjectDeleteListener(this);
+        FPlatformMemory::BinnedFreeToOS(GSnapshotArena, GSnapshotMappedSize);
     }
-};
-
-static FUikaDeleteListener GDeleteListener;
+    GSnapshotArena = nullptr;
+    GSnapshotMappedSize = 0;
+    GSnapshotLen = 0;
+}
 
-void UikaReifyRegisterDeleteListener()
+static uint8* SnapshotAllocImpl(uint32 Size)
 {
-    GUObjectArray.AddUObjectDeleteListener(&GDeleteListener);
+    UikaReifySnapshotRelease();
+    if (Size == 0)
+    {
+        return nullptr;
+    }
+
+    const SIZE_T PageSize = FPlatformMemory::GetConstants().PageSize;
+    const SIZE_T MappedSize = Align(static_cast<SIZE_T>(Size), PageSize);
+    GSnapshotArena = FPlatformMemory::BinnedAllocFromOS(MappedSize);
+    if (!GSnapshotArena)
+    {
+        UE_LOG(LogUika, Error,
+            TEXT("[Uika] SnapshotAlloc: failed to map %u bytes"), Size);
+        return nullptr;
+    }
+    GSnapshotMappedSize = MappedSize;
+    GSnapshotLen = Size;
+    return static_cast<uint8*>(GSnapshotArena);
 }
 
-void UikaReifyUnregisterDeleteListener()
+static const uint8* SnapshotDataImpl(uint32* OutLen)
 {
-    GUObjectArray.RemoveUObjectDeleteListener(&GDeleteListener);
+    if (OutLen)
+    {
+        *OutLen = GSnapshotLen;
+    }
+    return static_cast<const uint8*>(GSnapshotArena);
 }
 
 // ---------------------------------------------------------------------------
-// Hot reload helpers (called from UikaModule.cpp)
+// Schema registration
 // ---------------------------------------------------------------------------
 
-void UikaReifyForEachReifiedInstance(
-    TFunctionRef<void(UObject*, UUikaReifiedClass*)> Callback)
+namespace
 {
-    for (FThreadSafeObjectIterator It; It; ++It)
+    struct FSchemaName
+    {
+        const uint8* Data = nullptr;
+        uint16 Len = 0;
+    };
+
+    struct FSchemaProp
+    {
+        FSchemaName Name;
+        uint32 PropType = 0;
+        uint64 Flags = 0;
+        const uint8* Default = nullptr;
+        uint16 DefaultLen = 0;
+    };
+
+    struct FSchemaComponent
+    {
+        FSchemaName Name;
+        UClass* Class = nullptr;
+        uint32 Flags = 0;
+        FSchemaName Attach;
+    };
+
+    struct FSchemaParam
+    {
+        FSchemaName Name;
+        uint32 PropType = 0;
+        uint64 Flags = 0;
+    };
+
+    struct FSchemaFunction
     {
-        UObject* Obj = static_cast<UObject*>(*It);
-        // Skip CDOs — they don't have meaningful Rust instance data.
-        if (Obj->HasAnyFlags(RF_ClassDefaultObject))
+        FSchemaName Name;
+        uint64 CallbackId = 0;
+        uint32 Flags = 0;
+        int32 FirstParam = 0;
+        int32 ParamCount = 0;
+    };
+
+    // Members of a class are contiguous ranges in the per-kind arrays.
+    struct FSchemaClass
+    {
+        uint64 TypeId = 0;
+        UClass* Parent = nullptr;
+        int32 ParentIndex = INDEX_NONE;
+        FSchemaName Name;
+        int32 FirstProp = 0, PropCount = 0;
+        int32 FirstComponent = 0, ComponentCount = 0;
+        int32 FirstFunction = 0, FunctionCount = 0;
+    };
+
+    struct FParsedSchema
+    {
+        TArray<FSchemaClass> Classes;
+        TArray<FSchemaProp> Props;
+        TArray<FSchemaComponent> Components;
+        TArray<FSchemaFunction> Functions;
+        TArray<FSchemaParam> Params;
+    };
+
+    struct FSchemaReader
+    {
+        const uint8* Cur;
+        const uint8* End;
+
+        template <typename T>
+        bool Read(T& Out)
         {
+            if (End - Cur < static_cast<ptrdiff_t>(sizeof(T))) return false;
+            FMemory::Memcpy(&Out, Cur, sizeof(T));
+            Cur += sizeof(T);
+            return true;
+        }
+
+        bool Bytes(uint32 Len, const uint8*& Out)
+        {
+            if (static_cast<uint64>(End - Cur) < Len) return false;
+            Out = Cur;
+            Cur += Len;
+            return true;
+        }
+
+        bool Name(FSchemaName& Out)
+        {
+            return Read(Out.Len) && Bytes(Out.Len, Out.Data);
+        }
+    };
+}
+
+static bool SchemaNameEquals(const FSchemaName& A, const FSchemaName& B)
+{
+    return A.Len == B.Len && FMemory::Memcmp(A.Data, B.Data, A.Len) == 0;
+}
+
+// Types that need FUikaReifyPropExtra handles cannot be described.
+static bool IsSchemaPropType(uint32 PropType)
+{
+    return PropType <= static_cast<uint32>(EUikaReifyPropType::Class);
+}
+
+// Parse and validate the whole schema. Nothing is created unless this
+// succeeds, so a malformed blob never leaves half-registered classes.
+static EUikaErrorCode ParseClassSchema(const uint8* Blob, uint32 Len, FParsedSchema& Out)
+{
+    FSchemaReader Reader{ Blob, Blob + Len };
+    uint32 Version = 0, ClassCount = 0;
+    if (!Reader.Read(Version) || Version != UIKA_CLASS_SCHEMA_VERSION
+        || !Reader.Read(ClassCount) || ClassCount == 0)
+    {
+        return EUikaErrorCode::InvalidOperation;
+    }
+
+    Out.Classes.Reserve(ClassCount);
+    for (uint32 i = 0; i < ClassCount; ++i)
+    {
+        FSchemaClass Class;
+        uint64 ParentBits = 0;
+        FSchemaName ParentName;
+        uint32 RecordCount = 0;
+        if (!Reader.Read(Class.TypeId) || !Reader.Read(ParentBits)
+            || !Reader.Name(Class.Name) || !Reader.Name(ParentName)
+            || !Reader.Read(RecordCount) || Class.Name.Len == 0)
+        {
+            return EUikaErrorCode::InvalidOperation;
+        }
+
+        Class.Parent = reinterpret_cast<UClass*>(static_cast<UPTRINT>(ParentBits));
+        if (!Class.Parent)
+        {
+            // Reified parent registered by this same schema.
+            for (int32 j = 0; j < Out.Classes.Num(); ++j)
+            {
+                if (SchemaNameEquals(Out.Classes[j].Name, ParentName))
+                {
+                    Class.ParentIndex = j;
+                    break;
+                }
+            }
+            if (Class.ParentIndex == INDEX_NONE) return EUikaErrorCode::InvalidOperation;
+        }
+
+        Class.FirstProp = Out.Props.Num();
+        Class.FirstComponent = Out.Components.Num();
+        Class.FirstFunction = Out.Functions.Num();
+        for (uint32 r = 0; r < RecordCount; ++r)
+        {
+            uint8 Kind = 0;
+            if (!Reader.Read(Kind)) return EUikaErrorCode::InvalidOperation;
+            switch (Kind)
+            {
+            case UIKA_SCHEMA_PROPERTY:
+            {
+                FSchemaProp Prop;
+                if (!Reader.Name(Prop.Name) || !Reader.Read(Prop.PropType) || !Reader.Read(Prop.Flags)
+                    || !Reader.Read(Prop.DefaultLen) || !Reader.Bytes(Prop.DefaultLen, Prop.Default)
+                    || !IsSchemaPropType(Prop.PropType))
+                {
+                    return EUikaErrorCode::InvalidOperation;
+                }
+                Out.Props.Add(Prop);
+                break;
+            }
+            case UIKA_SCHEMA_COMPONENT:
+            {
+                FSchemaComponent Comp;
+                uint64 ClassBits = 0;
+                if (!Reader.Name(Comp.Name) || !Reader.Read(ClassBits) || !Reader.Read(Comp.Flags)
+                    || !Reader.Name(Comp.Attach))
+                {
+                    return EUikaErrorCode::InvalidOperation;
+                }
+                Comp.Class = reinterpret_cast<UClass*>(static_cast<UPTRINT>(ClassBits));
+                if (!Comp.Class) return EUikaErrorCode::NullArgument;
+                Out.Components.Add(Comp);
+                break;
+            }
+            case UIKA_SCHEMA_FUNCTION:
+            {
+                FSchemaFunction Func;
+                if (!Reader.Name(Func.Name) || !Reader.Read(Func.CallbackId) || !Reader.Read(Func.Flags))
+                {
+                    return EUikaErrorCode::InvalidOperation;
+                }
+                Func.FirstParam = Out.Params.Num();
+                Out.Functions.Add(Func);
+                break;
+            }
+            case UIKA_SCHEMA_PARAM:
+            {
+                FSchemaParam Param;
+                if (!Reader.Name(Param.Name) || !Reader.Read(Param.PropType) || !Reader.Read(Param.Flags)
+                    || !IsSchemaPropType(Param.PropType))
+                {
+                    return EUikaErrorCode::InvalidOperation;
+                }
+                // A parameter belongs to the latest function of this class.
+                if (Out.Functions.Num() == Class.FirstFunction) return EUikaErrorCode::InvalidOperation;
+                Out.Params.Add(Param);
+                Out.Functions.Last().ParamCount++;
+                break;
+            }
+            default:
+                return EUikaErrorCode::InvalidOperation;
+            }
+        }
+        Class.PropCount = Out.Props.Num() - Class.FirstProp;
+        Class.ComponentCount = Out.Components.Num() - Class.FirstComponent;
+        Class.FunctionCount = Out.Functions.Num() - Class.FirstFunction;
+        Out.Classes.Add(Class);
+    }
+
+    return Reader.Cur == Reader.End ? EUikaErrorCode::Ok : EUikaErrorCode::InvalidOperation;
+}
+
+// Write a schema default into the CDO. Bools go through the property (they
+// may be bitfields); everything else is copied at the element size.
+static bool ApplySchemaDefault(UObject* CDO, FProperty* Prop, const FSchemaProp& Desc)
+{
+    if (FBoolProperty* BoolProp = CastField<FBoolProperty>(Prop))
+    {
+        if (Desc.DefaultLen != 1) return false;
+        BoolProp->SetPropertyValue_InContainer(CDO, Desc.Default[0] != 0);
+        return true;
+    }
+    if (Desc.DefaultLen != Prop->GetElementSize() || !Prop->HasAnyPropertyFlags(CPF_IsPlainOldData))
+    {
+        return false;
+    }
+    FMemory::Memcpy(Prop->ContainerPtrToValuePtr<void>(CDO), Desc.Default, Desc.DefaultLen);
+    return true;
+}
+
+// Build every class in one pass with the same per-item logic as the
+// individual entries: create all (parents first), add members, finalize and
+// write CDO defaults. UClass creation, linking and CDO construction are
+// game-thread-only in UE, so classes are built serially; the gain is doing
+// it without a Rust/C++ crossing per member.
+static EUikaErrorCode RegisterClassFromSchemaImpl(
+    const uint8* Blob, uint32 Len,
+    UikaUClassHandle* OutClasses, uint32 OutCapacity)
+{
+    if (!Blob || (OutCapacity > 0 && !OutClasses))
+    {
+        return EUikaErrorCode::NullArgument;
+    }
+
+    FParsedSchema Schema;
+    const EUikaErrorCode ParseResult = ParseClassSchema(Blob, Len, Schema);
+    if (ParseResult != EUikaErrorCode::Ok)
+    {
+        UE_LOG(LogUika, Error, TEXT("[Uika] RegisterClassFromSchema: malformed schema (%u bytes)"), Len);
+        return ParseResult;
+    }
+    if (OutCapacity < static_cast<uint32>(Schema.Classes.Num()))
+    {
+        return EUikaErrorCode::BufferTooSmall;
+    }
+
+    const double StartSeconds = FPlatformTime::Seconds();
+    const int32 ClassCount = Schema.Classes.Num();
+    TArray<UUikaReifiedClass*> Created;
+    Created.SetNumZeroed(ClassCount);
+    int32 MemberFailures = 0;
+
+    // Phase 1: create every class. Parents precede their children.
+    for (int32 i = 0; i < ClassCount; ++i)
+    {
+        const FSchemaClass& Desc = Schema.Classes[i];
+        UClass* Parent = Desc.Parent ? Desc.Parent : Created[Desc.ParentIndex];
+        if (!Parent) continue;
+        const UikaUClassHandle Handle = CreateClassImpl(
+            Desc.Name.Data, Desc.Name.Len, UikaUClassHandle{ Parent }, Desc.TypeId);
+        Created[i] = Cast<UUikaReifiedClass>(static_cast<UClass*>(Handle.ptr));
+    }
+
+    // Phase 2: properties, default subobjects, functions and parameters.
+    TArray<FProperty*> PropHandles;
+    PropHandles.SetNumZeroed(Schema.Props.Num());
+    for (int32 i = 0; i < ClassCount; ++i)
+    {
+        UUikaReifiedClass* Class = Created[i];
+        if (!Class) continue;
+        const FSchemaClass& Desc = Schema.Classes[i];
+        const UikaUClassHandle Cls{ Class };
+
+        for (int32 p = Desc.FirstProp; p < Desc.FirstProp + Desc.PropCount; ++p)
+        {
+            const FSchemaProp& Prop = Schema.Props[p];
+            PropHandles[p] = static_cast<FProperty*>(AddPropertyImpl(
+                Cls, Prop.Name.Data, Prop.Name.Len, Prop.PropType, Prop.Flags, nullptr).ptr);
+            MemberFailures += PropHandles[p] ? 0 : 1;
+        }
+
+        for (int32 c = Desc.FirstComponent; c < Desc.FirstComponent + Desc.ComponentCount; ++c)
+        {
+            const FSchemaComponent& Comp = Schema.Components[c];
+            const EUikaErrorCode Result = AddDefaultSubobjectImpl(
+                Cls, Comp.Name.Data, Comp.Name.Len, UikaUClassHandle{ Comp.Class },
+                Comp.Flags, Comp.Attach.Data, Comp.Attach.Len);
+            MemberFailures += Result == EUikaErrorCode::Ok ? 0 : 1;
+        }
+
+        for (int32 f = Desc.FirstFunction; f < Desc.FirstFunction + Desc.FunctionCount; ++f)
+        {
+            const FSchemaFunction& Func = Schema.Functions[f];
+            const UikaUFunctionHandle FuncHandle = AddFunctionImpl(
+                Cls, Func.Name.Data, Func.Name.Len, Func.CallbackId, Func.Flags);
+            if (!FuncHandle.ptr)
+            {
+                ++MemberFailures;
+                continue;
+            }
+            for (int32 a = Func.FirstParam; a < Func.FirstParam + Func.ParamCount; ++a)
+            {
+                const FSchemaParam& Param = Schema.Params[a];
+                const EUikaErrorCode Result = AddFunctionParamImpl(
+                    FuncHandle, Param.Name.Data, Param.Name.Len, Param.PropType, Param.Flags, nullptr);
+                MemberFailures += Result == EUikaErrorCode::Ok ? 0 : 1;
+            }
+        }
+    }
+
+    // Phase 3: finalize and apply CDO defaults (also on hot reload, like the
+    // per-call path).
+    int32 Registered = 0;
+    for (int32 i = 0; i < ClassCount; ++i)
+    {
+        UUikaReifiedClass* Class = Created[i];
+        if (Class && FinalizeClassImpl(UikaUClassHandle{ Class }) != EUikaErrorCode::Ok)
+        {
+            Class = nullptr;
+        }
+        OutClasses[i] = UikaUClassHandle{ Class };
+        if (!Class)
+        {
+            UE_LOG(LogUika, Error, TEXT("[Uika] RegisterClassFromSchema: failed to register %s"),
+                *ReifyUtf8ToFString(Schema.Classes[i].Name.Data, Schema.Classes[i].Name.Len));
             continue;
         }
-        UUikaReifiedClass* ReifiedClass = Cast<UUikaReifiedClass>(Obj->GetClass());
-        if (ReifiedClass)
+        ++Registered;
+
+        const FSchemaClass& Desc = Schema.Classes[i];
+        UObject* CDO = Class->GetDefaultObject();
+        for (int32 p = Desc.FirstProp; p < Desc.FirstProp + Desc.PropCount; ++p)
         {
-            Callback(Obj, ReifiedClass);
+            const FSchemaProp& Prop = Schema.Props[p];
+            if (Prop.DefaultLen == 0 || !PropHandles[p] || !CDO) continue;
+            if (!ApplySchemaDefault(CDO, PropHandles[p], Prop))
+            {
+                UE_LOG(LogUika, Warning, TEXT("[Uika] RegisterClassFromSchema: bad default for %s::%s"),
+                    *Class->GetName(), *PropHandles[p]->GetName());
+                ++MemberFailures;
+            }
         }
     }
+
+    UE_LOG(LogUika, Display,
+        TEXT("[Uika] Registered %d/%d classes from schema (%d properties, %d functions) in %.2f ms"),
+        Registered, ClassCount, Schema.Props.Num(), Schema.Functions.Num(),
+        (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+
+    if (MemberFailures > 0)
+    {
+        UE_LOG(LogUika, Warning, TEXT("[Uika] RegisterClassFromSchema: %d members failed to register"),
+            MemberFailures);
+    }
+    return Registered == ClassCount && MemberFailures == 0
+        ? EUikaErrorCode::Ok
+        : EUikaErrorCode::InternalError;
+}
+
+// ---------------------------------------------------------------------------
+// Class tick
+// ---------------------------------------------------------------------------
+
+// Defined in UikaClassTick.cpp.
+extern EUikaErrorCode UikaClassTickEnable(UUikaReifiedClass* Class, uint32 TickGroup);
+
+static EUikaErrorCode EnableClassTickImpl(UikaUClassHandle Cls, uint32 TickGroup)
+{
+    UUikaReifiedClass* Class = Cast<UUikaReifiedClass>(static_cast<UClass*>(Cls.ptr));
+    if (!Class)
+    {
+        return Cls.ptr ? EUikaErrorCode::InvalidCast : EUikaErrorCode::NullArgument;
+    }
+    return UikaClassTickEnable(Class, TickGroup);
 }
 
 // ---------------------------------------------------------------------------
@@ -815,4 +1293,11 @@ FUikaReifyApi GReifyApi = {
     &GetCdoImpl,
     &AddDefaultSubobjectImpl,
     &FindDefaultSubobjectImpl,
+    &GetInstancesImpl,
+    &SnapshotAllocImpl,
+    &SnapshotDataImpl,
+    // Schema registration
+    &RegisterClassFromSchemaImpl,
+    // Class tick
+    &EnableClassTickImpl,
 };
@@ -0,0 +1,197 @@
+// UikaTaskApiImpl.cpp — FUikaTaskApi implementation.
+// Launches Rust jobs on UE::Tasks workers, runs ParallelFor over Rust ranges,
+// and drains the Rust game-thread continuation queue at the start of every frame.
+
+#include "UikaApiTable.h"
+#include "UikaModule.h"
+#include "UikaTrace.h"
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Misc/CoreDelegates.h"
+#include "Tasks/Task.h"
+
+#include <atomic>
+
+extern const FUikaRustCallbacks* GetUikaRustCallbacks();
+
+// ---------------------------------------------------------------------------
+// Task registry
+// ---------------------------------------------------------------------------
+
+namespace
+{
+    // Live task ids -> tasks. Entries go away on release; GInFlight still
+    // counts released tasks until their bodies return.
+    FCriticalSection GTaskLock;
+    TMap<uint64, UE::Tasks::FTask> GTasks;
+    uint64 GNextTaskId = 1;
+    std::atomic<int32> GInFlight{ 0 };
+
+    FDelegateHandle GBeginFrameHandle;
+}
+
+static bool FindTask(uint64 TaskId, UE::Tasks::FTask& OutTask)
+{
+    FScopeLock Lock(&GTaskLock);
+    if (const UE::Tasks::FTask* Task = GTasks.Find(TaskId))
+    {
+        OutTask = *Task;
+        return true;
+    }
+    return false;
+}
+
+// ---------------------------------------------------------------------------
+// Implementations
+// ---------------------------------------------------------------------------
+
+static uint64 LaunchImpl(uint64 Job, const uint64* Prereqs, uint32 PrereqCount)
+{
+    const FUikaRustCallbacks* Callbacks = GetUikaRustCallbacks();
+    if (!Callbacks || !Callbacks->run_job)
+    {
+        return 0;
+    }
+    void (*RunJob)(uint64) = Callbacks->run_job;
+
+    FScopeLock Lock(&GTaskLock);
+    TArray<UE::Tasks::FTask> Prerequisites;
+    Prerequisites.Reserve(PrereqCount);
+    for (uint32 i = 0; Prereqs && i < PrereqCount; ++i)
+    {
+        if (const UE::Tasks::FTask* Task = GTasks.Find(Prereqs[i]))
+        {
+            Prerequisites.Add(*Task);
+        }
+    }
+
+    GInFlight.fetch_add(1, std::memory_order_relaxed);
+    UE::Tasks::FTask Task = UE::Tasks::Launch(
+        TEXT("UikaJob"),
+        [RunJob, Job]()
+        {
+            UIKA_TRACE_SCOPE(Uika_RunJob);
+            RunJob(Job);
+            GInFlight.fetch_sub(1, std::memory_order_release);
+        },
+        Prerequisites);
+
+    const uint64 TaskId = GNextTaskId++;
+    GTasks.Add(TaskId, MoveTemp(Task));
+    return TaskId;
+}
+
+static bool WaitImpl(uint64 TaskId, uint32 TimeoutMs)
+{
+    UE::Tasks::FTask Task;
+    if (!FindTask(TaskId, Task))
+    {
+        return true;
+    }
+    if (TimeoutMs == MAX_uint32)
+    {
+        Task.Wait();
+        return true;
+    }
+    return Task.Wait(FTimespan::FromMilliseconds(TimeoutMs));
+}
+
+static bool IsCompletedImpl(uint64 TaskId)
+{
+    UE::Tasks::FTask Task;
+    return !FindTask(TaskId, Task) || Task.IsCompleted();
+}
+
+static void ReleaseImpl(uint64 TaskId)
+{
+    FScopeLock Lock(&GTaskLock);
+    GTasks.Remove(TaskId);
+}
+
+static void ParallelForImpl(uint64 Job, uint32 Count, uint32 MinBatch)
+{
+    const FUikaRustCallbacks* Callbacks = GetUikaRustCallbacks();
+    if (!Callbacks || !Callbacks->run_job_range || Count == 0)
+    {
+        return;
+    }
+    void (*RunRange)(uint64, uint32, uint32) = Callbacks->run_job_range;
+
+    // One Rust call per chunk rather than per index.
+    const uint32 Batch = FMath::Max(MinBatch, 1u);
+    const int32 NumChunks = static_cast<int32>((Count + Batch - 1) / Batch);
+    UIKA_TRACE_SCOPE(Uika_ParallelFor);
+    ParallelFor(NumChunks, [RunRange, Job, Count, Batch](int32 Chunk)
+    {
+        const uint32 Begin = static_cast<uint32>(Chunk) * Batch;
+        RunRange(Job, Begin, FMath::Min(Begin + Batch, Count));
+    });
+}
+
+static uint32 WorkerCountImpl()
+{
+    return static_cast<uint32>(FTaskGraphInterface::Get().GetNumWorkerThreads());
+}
+
+static bool IsGameThreadImpl()
+{
+    return IsInGameThread();
+}
+
+// ---------------------------------------------------------------------------
+// Game-thread continuation drain and module hooks
+// ---------------------------------------------------------------------------
+
+static void DrainGameThreadQueue()
+{
+    const FUikaRustCallbacks* Callbacks = GetUikaRustCallbacks();
+    if (Callbacks && Callbacks->drain_game_thread_queue)
+    {
+        UIKA_TRACE_SCOPE(Uika_DrainGameThreadQueue);
+        Callbacks->drain_game_thread_queue();
+    }
+}
+
+void UikaTaskRegisterHooks()
+{
+    GBeginFrameHandle = FCoreDelegates::OnBeginFrame.AddStatic(&DrainGameThreadQueue);
+}
+
+void UikaTaskUnregisterHooks()
+{
+    FCoreDelegates::OnBeginFrame.Remove(GBeginFrameHandle);
+    GBeginFrameHandle.Reset();
+}
+
+// Block until no task body can still call into the Rust DLL. Called before
+// the DLL is unloaded (shutdown and hot reload).
+void UikaTaskWaitForAll()
+{
+    TArray<UE::Tasks::FTask> Pending;
+    {
+        FScopeLock Lock(&GTaskLock);
+        GTasks.GenerateValueArray(Pending);
+        GTasks.Reset();
+    }
+    UE::Tasks::Wait(Pending);
+
+    // Released tasks are no longer in GTasks.
+    while (GInFlight.load(std::memory_order_acquire) > 0)
+    {
+        FPlatformProcess::Sleep(0.001f);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Export
+// ---------------------------------------------------------------------------
+
+FUikaTaskApi GTaskApi = {
+    &LaunchImpl,
+    &WaitImpl,
+    &IsCompletedImpl,
+    &ReleaseImpl,
+    &ParallelForImpl,
+    &WorkerCountImpl,
+    &IsGameThreadImpl,
+};
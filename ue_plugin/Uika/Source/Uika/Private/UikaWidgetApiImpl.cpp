@@ -1,13 +1,17 @@
 // UikaWidgetApiImpl.cpp — FUikaWidgetApi implementation.
-// Provides CreateWidget (C++ template, not in reflection), WidgetTree, and RootWidget access.
+// Provides CreateWidget (C++ template, not in reflection), WidgetTree, and RootWidget access,
+// plus declarative construction of a whole widget hierarchy in one call.
 
 #include "UikaApiTable.h"
 #include "Blueprint/UserWidget.h"
 #include "Blueprint/WidgetTree.h"
+#include "Components/PanelSlot.h"
+#include "Components/PanelWidget.h"
 #include "Components/Widget.h"
 #include "GameFramework/PlayerController.h"
 #include "Engine/GameInstance.h"
 #include "Engine/World.h"
+#include "UObject/UObjectGlobals.h"
 
 // ---------------------------------------------------------------------------
 // Implementations
@@ -75,6 +79,243 @@ static UikaUObjectHandle GetWidgetTreeImpl(UikaUObjectHandle UserWidgetHandle)
     return UikaUObjectHandle{ UserWidget->WidgetTree };
 }
 
+// ---------------------------------------------------------------------------
+// Declarative construction (build_widget_tree)
+// ---------------------------------------------------------------------------
+
+namespace
+{
+    struct FWidgetInitDesc
+    {
+        uint8 Target;
+        uint8 Kind;
+        const uint8* Prop;
+        uint16 PropLen;
+        const uint8* Value;
+        uint32 ValueLen;
+    };
+
+    struct FWidgetNodeDesc
+    {
+        UClass* Class;
+        int32 Parent;
+        uint32 Flags;
+        const uint8* Name;
+        uint16 NameLen;
+        int32 FirstInit;
+        int32 InitCount;
+    };
+
+    // Bounds-checked little-endian reader over the description buffer.
+    struct FWidgetDescReader
+    {
+        const uint8* Cur;
+        const uint8* End;
+
+        template <typename T>
+        bool Read(T& Out)
+        {
+            if (End - Cur < static_cast<ptrdiff_t>(sizeof(T))) return false;
+            FMemory::Memcpy(&Out, Cur, sizeof(T));
+            Cur += sizeof(T);
+            return true;
+        }
+
+        bool Bytes(uint32 Len, const uint8*& Out)
+        {
+            if (static_cast<uint64>(End - Cur) < Len) return false;
+            Out = Cur;
+            Cur += Len;
+            return true;
+        }
+    };
+}
+
+static FName MakeDescName(const uint8* Utf8, uint16 Len, EFindName FindType)
+{
+    const FUTF8ToTCHAR Wide(reinterpret_cast<const ANSICHAR*>(Utf8), Len);
+    return FName(Wide.Length(), Wide.Get(), FindType);
+}
+
+// Parse and validate the whole description. Nothing is constructed unless
+// this succeeds, so a malformed buffer never leaves a half-built tree.
+static EUikaErrorCode ParseWidgetDesc(const uint8* Desc, uint32 DescLen,
+    TArray<FWidgetNodeDesc>& OutNodes, TArray<FWidgetInitDesc>& OutInits, uint32& OutKeepCount)
+{
+    FWidgetDescReader Reader{ Desc, Desc + DescLen };
+    uint32 NodeCount = 0;
+    if (!Reader.Read(NodeCount) || NodeCount == 0) return EUikaErrorCode::InvalidOperation;
+
+    OutNodes.Reserve(NodeCount);
+    OutKeepCount = 0;
+    bool bHasRoot = false;
+
+    for (uint32 i = 0; i < NodeCount; ++i)
+    {
+        FWidgetNodeDesc Node;
+        uint64 ClassBits = 0;
+        uint16 InitCount = 0;
+        if (!Reader.Read(ClassBits) || !Reader.Read(Node.Parent) || !Reader.Read(Node.Flags)
+            || !Reader.Read(Node.NameLen) || !Reader.Bytes(Node.NameLen, Node.Name)
+            || !Reader.Read(InitCount))
+        {
+            return EUikaErrorCode::InvalidOperation;
+        }
+
+        Node.Class = reinterpret_cast<UClass*>(static_cast<UPTRINT>(ClassBits));
+        if (!Node.Class) return EUikaErrorCode::NullArgument;
+        if (!Node.Class->IsChildOf(UWidget::StaticClass()) || Node.Class->HasAnyClassFlags(CLASS_Abstract))
+        {
+            return EUikaErrorCode::InvalidCast;
+        }
+
+        if (Node.Parent < 0)
+        {
+            if (bHasRoot) return EUikaErrorCode::InvalidOperation;
+            bHasRoot = true;
+        }
+        else if (Node.Parent >= static_cast<int32>(i)
+            || !OutNodes[Node.Parent].Class->IsChildOf(UPanelWidget::StaticClass()))
+        {
+            return EUikaErrorCode::InvalidOperation;
+        }
+
+        Node.FirstInit = OutInits.Num();
+        Node.InitCount = InitCount;
+        for (uint16 j = 0; j < InitCount; ++j)
+        {
+            FWidgetInitDesc Init;
+            if (!Reader.Read(Init.Target) || !Reader.Read(Init.Kind)
+                || !Reader.Read(Init.PropLen) || !Reader.Bytes(Init.PropLen, Init.Prop)
+                || !Reader.Read(Init.ValueLen) || !Reader.Bytes(Init.ValueLen, Init.Value))
+            {
+                return EUikaErrorCode::InvalidOperation;
+            }
+            if (Init.Target > UIKA_WIDGET_INIT_SLOT || Init.Kind > UIKA_WIDGET_VALUE_TEXT)
+            {
+                return EUikaErrorCode::InvalidOperation;
+            }
+            // Slots only exist for children; the root has nothing to target.
+            if (Init.Target == UIKA_WIDGET_INIT_SLOT && Node.Parent < 0)
+            {
+                return EUikaErrorCode::InvalidOperation;
+            }
+            OutInits.Add(Init);
+        }
+
+        if (Node.Flags & UIKA_WIDGET_NODE_KEEP) ++OutKeepCount;
+        OutNodes.Add(Node);
+    }
+
+    if (!bHasRoot || Reader.Cur != Reader.End) return EUikaErrorCode::InvalidOperation;
+    return EUikaErrorCode::Ok;
+}
+
+static EUikaErrorCode ApplyWidgetInit(UObject* Target, const FWidgetInitDesc& Init)
+{
+    const FName PropName = MakeDescName(Init.Prop, Init.PropLen, FNAME_Find);
+    FProperty* Property = PropName.IsNone() ? nullptr : Target->GetClass()->FindPropertyByName(PropName);
+    if (!Property) return EUikaErrorCode::PropertyNotFound;
+
+    void* Dest = Property->ContainerPtrToValuePtr<void>(Target);
+    if (Init.Kind == UIKA_WIDGET_VALUE_RAW)
+    {
+        if (!Property->HasAnyPropertyFlags(CPF_IsPlainOldData)) return EUikaErrorCode::TypeMismatch;
+        if (Init.ValueLen != static_cast<uint32>(Property->GetElementSize())) return EUikaErrorCode::TypeMismatch;
+        FMemory::Memcpy(Dest, Init.Value, Init.ValueLen);
+        return EUikaErrorCode::Ok;
+    }
+
+    // ImportText needs a terminated buffer; the value bytes are not.
+    const FUTF8ToTCHAR Wide(reinterpret_cast<const ANSICHAR*>(Init.Value), static_cast<int32>(Init.ValueLen));
+    const FString Text(Wide.Length(), Wide.Get());
+    if (!Property->ImportText_Direct(*Text, Dest, Target, PPF_None))
+    {
+        return EUikaErrorCode::TypeMismatch;
+    }
+    return EUikaErrorCode::Ok;
+}
+
+// Construct every node in order, attach it to its parent panel and apply its
+// initializers. The root is only installed once all nodes succeeded; on
+// failure the new widgets stay unreferenced and are collected.
+static EUikaErrorCode BuildWidgetTreeImpl(
+    UikaUObjectHandle UserWidgetHandle,
+    const uint8* Desc,
+    uint32 DescLen,
+    UikaUObjectHandle* OutHandles,
+    uint32 OutCapacity,
+    uint32* OutCount)
+{
+    if (OutCount) *OutCount = 0;
+    UUserWidget* UserWidget = Cast<UUserWidget>(static_cast<UObject*>(UserWidgetHandle.ptr));
+    if (!UserWidget || !Desc) return EUikaErrorCode::NullArgument;
+
+    UWidgetTree* Tree = UserWidget->WidgetTree;
+    if (!Tree) return EUikaErrorCode::InvalidOperation;
+
+    TArray<FWidgetNodeDesc> Nodes;
+    TArray<FWidgetInitDesc> Inits;
+    uint32 KeepCount = 0;
+    const EUikaErrorCode ParseResult = ParseWidgetDesc(Desc, DescLen, Nodes, Inits, KeepCount);
+    if (ParseResult != EUikaErrorCode::Ok) return ParseResult;
+
+    if (OutCount) *OutCount = KeepCount;
+    if (KeepCount > OutCapacity) return EUikaErrorCode::BufferTooSmall;
+    if (KeepCount > 0 && !OutHandles) return EUikaErrorCode::NullArgument;
+
+    TArray<UWidget*, TInlineAllocator<32>> Built;
+    Built.Reserve(Nodes.Num());
+    UWidget* Root = nullptr;
+
+    for (const FWidgetNodeDesc& Node : Nodes)
+    {
+        const FName Name = Node.NameLen > 0 ? MakeDescName(Node.Name, Node.NameLen, FNAME_Add) : NAME_None;
+        // ConstructWidget would replace an existing widget of that name in
+        // place, breaking whatever still references it.
+        if (!Name.IsNone() && StaticFindObjectFast(UWidget::StaticClass(), Tree, Name))
+        {
+            return EUikaErrorCode::InvalidOperation;
+        }
+        UWidget* Widget = Tree->ConstructWidget<UWidget>(Node.Class, Name);
+        if (!Widget) return EUikaErrorCode::InternalError;
+
+        UPanelSlot* Slot = nullptr;
+        if (Node.Parent < 0)
+        {
+            Root = Widget;
+        }
+        else
+        {
+            Slot = CastChecked<UPanelWidget>(Built[Node.Parent])->AddChild(Widget);
+            if (!Slot) return EUikaErrorCode::InvalidOperation;
+        }
+
+        for (int32 j = Node.FirstInit; j < Node.FirstInit + Node.InitCount; ++j)
+        {
+            const FWidgetInitDesc& Init = Inits[j];
+            UObject* Target = Init.Target == UIKA_WIDGET_INIT_SLOT ? static_cast<UObject*>(Slot) : Widget;
+            const EUikaErrorCode InitResult = ApplyWidgetInit(Target, Init);
+            if (InitResult != EUikaErrorCode::Ok) return InitResult;
+        }
+        if (Slot) Slot->SynchronizeProperties();
+
+        Built.Add(Widget);
+    }
+
+    Tree->RootWidget = Root;
+
+    uint32 Written = 0;
+    for (int32 i = 0; i < Nodes.Num(); ++i)
+    {
+        if (Nodes[i].Flags & UIKA_WIDGET_NODE_KEEP)
+        {
+            OutHandles[Written++] = UikaUObjectHandle{ Built[i] };
+        }
+    }
+    return EUikaErrorCode::Ok;
+}
+
 // ---------------------------------------------------------------------------
 // Static instance
 // ---------------------------------------------------------------------------
@@ -83,4 +324,6 @@ FUikaWidgetApi GWidgetApi = {
     &CreateWidgetImpl,
     &SetRootWidgetImpl,
     &GetWidgetTreeImpl,
+    // Declarative construction
+    &BuildWidgetTreeImpl,
 };
@@ -1,11 +1,33 @@
 // UikaWorldApiImpl.cpp — FUikaWorldApi implementation.
 
 #include "UikaApiTable.h"
+#include "UikaTrace.h"
+#include "UikaActorIndexSubsystem.h"
+#include "UikaActorPoolSubsystem.h"
 #include "UObject/UObjectGlobals.h"
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/Pawn.h"
 #include "EngineUtils.h"
+#include "Engine/StreamableManager.h"
+
+extern const FUikaRustCallbacks* GetUikaRustCallbacks();
+
+// Object epoch bump (defined in UikaLifecycleApiImpl.cpp).
+extern void UikaBumpObjectEpoch();
+
+// State mirrors (defined in UikaMirror.cpp).
+extern EUikaErrorCode UikaMirrorCreate(UikaUObjectHandle World, const FUikaMirrorColumn* Columns, uint32 ColumnCount,
+    const UikaUObjectHandle* Objs, uint32 ObjCount, uint32 TickGroup, uint64* OutId, FUikaMirrorView* OutView);
+extern EUikaErrorCode UikaMirrorSetObjects(uint64 Id, const UikaUObjectHandle* Objs, uint32 ObjCount, FUikaMirrorView* OutView);
+extern EUikaErrorCode UikaMirrorDestroy(uint64 Id);
+
+// Batched collision queries (defined in UikaCollisionQueries.cpp).
+extern EUikaErrorCode UikaTraceBatch(UikaUObjectHandle World, const FUikaTraceRequest* Requests, uint32 Count,
+    FUikaTraceHit* OutHits);
+extern EUikaErrorCode UikaTraceBatchAsync(UikaUObjectHandle World, const FUikaTraceRequest* Requests, uint32 Count,
+    uint64 CallbackId, uint64* OutBatch);
+extern EUikaErrorCode UikaCancelTraceBatch(uint64 BatchId);
 
 // Helper: convert UTF-8 byte slice to FString.
 static FString Utf8ToFStr(const uint8* Buf, uint32 Len)
@@ -13,6 +35,20 @@ static FString Utf8ToFStr(const uint8* Buf, uint32 Len)
     return FString(Len, UTF8_TO_TCHAR(reinterpret_cast<const char*>(Buf)));
 }
 
+// Helper: copy a transform from a Rust buffer. The buffer comes from
+// UScriptStruct::GetStructureSize() which may be smaller than sizeof(FTransform)
+// due to C++ SIMD alignment padding. Copy what we have and leave the rest as identity.
+static FTransform ReadSpawnTransform(const uint8* Buf, uint32 Size)
+{
+    FTransform Transform = FTransform::Identity;
+    if (Buf && Size > 0)
+    {
+        const uint32 CopySize = FMath::Min(Size, static_cast<uint32>(sizeof(FTransform)));
+        FMemory::Memcpy(&Transform, Buf, CopySize);
+    }
+    return Transform;
+}
+
 // ---------------------------------------------------------------------------
 // Implementations
 // ---------------------------------------------------------------------------
@@ -31,15 +67,7 @@ static UikaUObjectHandle SpawnActorImpl(
         return UikaUObjectHandle{ nullptr };
     }
 
-    // Copy transform from Rust buffer. The buffer comes from UScriptStruct::GetStructureSize()
-    // which may be smaller than sizeof(FTransform) due to C++ SIMD alignment padding.
-    // Copy what we have and leave the rest as identity.
-    FTransform SpawnTransform = FTransform::Identity;
-    if (TransformBuf && TransformSize > 0)
-    {
-        const uint32 CopySize = FMath::Min(TransformSize, static_cast<uint32>(sizeof(FTransform)));
-        FMemory::Memcpy(&SpawnTransform, TransformBuf, CopySize);
-    }
+    const FTransform SpawnTransform = ReadSpawnTransform(TransformBuf, TransformSize);
 
     FActorSpawnParameters Params;
     AActor* Owner = Cast<AActor>(static_cast<UObject*>(OwnerHandle.ptr));
@@ -49,9 +77,43 @@ static UikaUObjectHandle SpawnActorImpl(
     }
 
     AActor* Spawned = World->SpawnActor(Class, &SpawnTransform, Params);
+    UikaBumpObjectEpoch();
     return UikaUObjectHandle{ Spawned };
 }
 
+// Copy the indexed actors of Class into OutBuf (as many as fit) and return
+// the total count. Falls back to a full actor scan for worlds without the
+// index subsystem.
+static uint32 CollectActorsOfClass(UWorld* World, UClass* Class, uint8* OutBuf, uint32 BufByteSize)
+{
+    const uint32 BufCapacity = BufByteSize / static_cast<uint32>(sizeof(UikaUObjectHandle));
+    UikaUObjectHandle* HandleBuf = reinterpret_cast<UikaUObjectHandle*>(OutBuf);
+    uint32 Count = 0;
+
+    if (UUikaActorIndexSubsystem* Index = World->GetSubsystem<UUikaActorIndexSubsystem>())
+    {
+        for (const UUikaActorIndexSubsystem::FEntry& Entry : Index->GetActors(Class))
+        {
+            if (HandleBuf && Count < BufCapacity)
+            {
+                HandleBuf[Count] = UikaUObjectHandle{ Entry.Actor };
+            }
+            ++Count;
+        }
+        return Count;
+    }
+
+    for (TActorIterator<AActor> It(World, Class); It; ++It)
+    {
+        if (HandleBuf && Count < BufCapacity)
+        {
+            HandleBuf[Count] = UikaUObjectHandle{ *It };
+        }
+        ++Count;
+    }
+    return Count;
+}
+
 static EUikaErrorCode GetAllActorsOfClassImpl(
     UikaUObjectHandle WorldHandle,
     UikaUClassHandle ClsHandle,
@@ -67,18 +129,7 @@ static EUikaErrorCode GetAllActorsOfClassImpl(
         return EUikaErrorCode::NullArgument;
     }
 
-    const uint32 BufCapacity = BufByteSize / static_cast<uint32>(sizeof(UikaUObjectHandle));
-    UikaUObjectHandle* HandleBuf = reinterpret_cast<UikaUObjectHandle*>(OutBuf);
-    uint32 Count = 0;
-    for (TActorIterator<AActor> It(World, Class); It; ++It)
-    {
-        if (HandleBuf && Count < BufCapacity)
-        {
-            HandleBuf[Count] = UikaUObjectHandle{ *It };
-        }
-        ++Count;
-    }
-
+    const uint32 Count = CollectActorsOfClass(World, Class, OutBuf, BufByteSize);
     if (OutCount) *OutCount = Count;
     return EUikaErrorCode::Ok;
 }
@@ -142,12 +193,7 @@ static UikaUObjectHandle SpawnActorDeferredImpl(
         return UikaUObjectHandle{ nullptr };
     }
 
-    FTransform SpawnTransform = FTransform::Identity;
-    if (TransformBuf && TransformSize > 0)
-    {
-        const uint32 CopySize = FMath::Min(TransformSize, static_cast<uint32>(sizeof(FTransform)));
-        FMemory::Memcpy(&SpawnTransform, TransformBuf, CopySize);
-    }
+    const FTransform SpawnTransform = ReadSpawnTransform(TransformBuf, TransformSize);
 
     FActorSpawnParameters Params;
     Params.bDeferConstruction = true;
@@ -167,6 +213,7 @@ static UikaUObjectHandle SpawnActorDeferredImpl(
     }
 
     AActor* Spawned = World->SpawnActor(Class, &SpawnTransform, Params);
+    UikaBumpObjectEpoch();
     return UikaUObjectHandle{ Spawned };
 }
 
@@ -178,17 +225,457 @@ static EUikaErrorCode FinishSpawningImpl(
     AActor* Actor = Cast<AActor>(static_cast<UObject*>(ActorHandle.ptr));
     if (!Actor) return EUikaErrorCode::NullArgument;
 
-    FTransform SpawnTransform = FTransform::Identity;
-    if (TransformBuf && TransformSize > 0)
+    const FTransform SpawnTransform = ReadSpawnTransform(TransformBuf, TransformSize);
+
+    Actor->FinishSpawning(SpawnTransform);
+    UikaBumpObjectEpoch();
+    return EUikaErrorCode::Ok;
+}
+
+// ---------------------------------------------------------------------------
+// Batched spawning
+// ---------------------------------------------------------------------------
+
+// Spawn parameters shared by every actor of a batch. An Undefined collision
+// method is resolved once from the class default object instead of per spawn.
+static FActorSpawnParameters MakeBatchSpawnParams(
+    UClass* Class,
+    UikaUObjectHandle OwnerHandle,
+    UikaUObjectHandle InstigatorHandle,
+    uint8 CollisionMethod,
+    bool bDeferConstruction)
+{
+    FActorSpawnParameters Params;
+    Params.bDeferConstruction = bDeferConstruction;
+
+    ESpawnActorCollisionHandlingMethod Method =
+        static_cast<ESpawnActorCollisionHandlingMethod>(CollisionMethod);
+    if (Method == ESpawnActorCollisionHandlingMethod::Undefined)
     {
-        const uint32 CopySize = FMath::Min(TransformSize, static_cast<uint32>(sizeof(FTransform)));
-        FMemory::Memcpy(&SpawnTransform, TransformBuf, CopySize);
+        if (const AActor* Cdo = Class->GetDefaultObject<AActor>())
+        {
+            Method = Cdo->SpawnCollisionHandlingMethod;
+        }
     }
+    Params.SpawnCollisionHandlingOverride = Method;
 
-    Actor->FinishSpawning(SpawnTransform);
+    if (AActor* Owner = Cast<AActor>(static_cast<UObject*>(OwnerHandle.ptr)))
+    {
+        Params.Owner = Owner;
+    }
+    if (APawn* Instigator = Cast<APawn>(static_cast<UObject*>(InstigatorHandle.ptr)))
+    {
+        Params.Instigator = Instigator;
+    }
+    return Params;
+}
+
+// Transform I of a batch: buffers are Stride bytes apart, each Stride bytes
+// long. A null buffer means identity for every actor.
+static FTransform ReadBatchTransform(const uint8* Transforms, uint32 Stride, uint32 I)
+{
+    return ReadSpawnTransform(Transforms ? Transforms + static_cast<SIZE_T>(I) * Stride : nullptr, Stride);
+}
+
+static EUikaErrorCode SpawnBatch(
+    UikaUObjectHandle WorldHandle,
+    UikaUClassHandle ClsHandle,
+    const uint8* Transforms,
+    uint32 TransformStride,
+    uint32 Count,
+    UikaUObjectHandle OwnerHandle,
+    UikaUObjectHandle InstigatorHandle,
+    uint8 CollisionMethod,
+    bool bDeferConstruction,
+    UikaUObjectHandle* OutHandles,
+    uint32* OutSpawned)
+{
+    if (OutSpawned) *OutSpawned = 0;
+    UWorld* World = Cast<UWorld>(static_cast<UObject*>(WorldHandle.ptr));
+    UClass* Class = static_cast<UClass*>(ClsHandle.ptr);
+    if (!World || !Class || !OutHandles) return EUikaErrorCode::NullArgument;
+    if (!Class->IsChildOf(AActor::StaticClass())) return EUikaErrorCode::InvalidCast;
+
+    const FActorSpawnParameters Params =
+        MakeBatchSpawnParams(Class, OwnerHandle, InstigatorHandle, CollisionMethod, bDeferConstruction);
+    uint32 Spawned = 0;
+    for (uint32 i = 0; i < Count; ++i)
+    {
+        const FTransform SpawnTransform = ReadBatchTransform(Transforms, TransformStride, i);
+        AActor* Actor = World->SpawnActor(Class, &SpawnTransform, Params);
+        OutHandles[i] = UikaUObjectHandle{ Actor };
+        if (Actor) ++Spawned;
+    }
+    UikaBumpObjectEpoch();
+
+    if (OutSpawned) *OutSpawned = Spawned;
+    return EUikaErrorCode::Ok;
+}
+
+static EUikaErrorCode SpawnActorsBatchImpl(
+    UikaUObjectHandle WorldHandle,
+    UikaUClassHandle ClsHandle,
+    const uint8* Transforms,
+    uint32 TransformStride,
+    uint32 Count,
+    UikaUObjectHandle OwnerHandle,
+    uint8 CollisionMethod,
+    UikaUObjectHandle* OutHandles,
+    uint32* OutSpawned)
+{
+    return SpawnBatch(WorldHandle, ClsHandle, Transforms, TransformStride, Count,
+        OwnerHandle, UikaUObjectHandle{ nullptr }, CollisionMethod, false, OutHandles, OutSpawned);
+}
+
+static EUikaErrorCode SpawnActorsDeferredBatchImpl(
+    UikaUObjectHandle WorldHandle,
+    UikaUClassHandle ClsHandle,
+    const uint8* Transforms,
+    uint32 TransformStride,
+    uint32 Count,
+    UikaUObjectHandle OwnerHandle,
+    UikaUObjectHandle InstigatorHandle,
+    uint8 CollisionMethod,
+    UikaUObjectHandle* OutHandles,
+    uint32* OutSpawned)
+{
+    return SpawnBatch(WorldHandle, ClsHandle, Transforms, TransformStride, Count,
+        OwnerHandle, InstigatorHandle, CollisionMethod, true, OutHandles, OutSpawned);
+}
+
+static EUikaErrorCode FinishSpawningBatchImpl(
+    const UikaUObjectHandle* Actors,
+    const uint8* Transforms,
+    uint32 TransformStride,
+    uint32 Count)
+{
+    if (!Actors) return Count == 0 ? EUikaErrorCode::Ok : EUikaErrorCode::NullArgument;
+
+    for (uint32 i = 0; i < Count; ++i)
+    {
+        // Slots left null by a failed spawn are skipped.
+        AActor* Actor = Cast<AActor>(static_cast<UObject*>(Actors[i].ptr));
+        if (!Actor) continue;
+        Actor->FinishSpawning(ReadBatchTransform(Transforms, TransformStride, i));
+    }
+    UikaBumpObjectEpoch();
+    return EUikaErrorCode::Ok;
+}
+
+// ---------------------------------------------------------------------------
+// Per-class actor index
+// ---------------------------------------------------------------------------
+
+static EUikaErrorCode GetActorsOfClassIndexedImpl(
+    UikaUObjectHandle WorldHandle,
+    UikaUClassHandle ClsHandle,
+    uint8* OutBuf,
+    uint32 BufByteSize,
+    uint32* OutCount,
+    uint64* OutGeneration)
+{
+    UWorld* World = Cast<UWorld>(static_cast<UObject*>(WorldHandle.ptr));
+    UClass* Class = static_cast<UClass*>(ClsHandle.ptr);
+    if (OutCount) *OutCount = 0;
+    if (OutGeneration) *OutGeneration = 0;
+    if (!World || !Class) return EUikaErrorCode::NullArgument;
+
+    UUikaActorIndexSubsystem* Index = World->GetSubsystem<UUikaActorIndexSubsystem>();
+    if (!Index) return EUikaErrorCode::InvalidOperation;
+
+    const uint32 Count = CollectActorsOfClass(World, Class, OutBuf, BufByteSize);
+    if (OutCount) *OutCount = Count;
+    if (OutGeneration) *OutGeneration = Index->GetGeneration();
+    return EUikaErrorCode::Ok;
+}
+
+static EUikaErrorCode GetActorChangesImpl(
+    UikaUObjectHandle WorldHandle,
+    UikaUClassHandle ClsHandle,
+    uint64 Since,
+    FUikaActorChange* OutChanges,
+    uint32 Capacity,
+    uint32* OutCount,
+    uint64* OutGeneration)
+{
+    UWorld* World = Cast<UWorld>(static_cast<UObject*>(WorldHandle.ptr));
+    UClass* Class = static_cast<UClass*>(ClsHandle.ptr);
+    if (OutCount) *OutCount = 0;
+    if (OutGeneration) *OutGeneration = 0;
+    if (!World || !Class) return EUikaErrorCode::NullArgument;
+
+    UUikaActorIndexSubsystem* Index = World->GetSubsystem<UUikaActorIndexSubsystem>();
+    if (!Index) return EUikaErrorCode::InvalidOperation;
+    if (OutGeneration) *OutGeneration = Index->GetGeneration();
+
+    TArray<const UUikaActorIndexSubsystem::FChange*> Changes;
+    if (!Index->GetChanges(Class, Since, Changes))
+    {
+        return EUikaErrorCode::IndexOutOfRange;
+    }
+
+    const uint32 Count = static_cast<uint32>(Changes.Num());
+    if (OutCount) *OutCount = Count;
+    if (Count > Capacity || (Count > 0 && !OutChanges))
+    {
+        return EUikaErrorCode::BufferTooSmall;
+    }
+
+    for (uint32 i = 0; i < Count; ++i)
+    {
+        OutChanges[i].actor = UikaUObjectHandle{ Changes[i]->Actor };
+        OutChanges[i].added = Changes[i]->bAdded ? 1u : 0u;
+        OutChanges[i]._pad = 0;
+    }
     return EUikaErrorCode::Ok;
 }
 
+// ---------------------------------------------------------------------------
+// Actor pooling
+// ---------------------------------------------------------------------------
+
+static UUikaActorPoolSubsystem* GetActorPool(UikaUObjectHandle WorldHandle)
+{
+    UWorld* World = Cast<UWorld>(static_cast<UObject*>(WorldHandle.ptr));
+    return World ? World->GetSubsystem<UUikaActorPoolSubsystem>() : nullptr;
+}
+
+static EUikaErrorCode PoolPrewarmImpl(
+    UikaUObjectHandle WorldHandle,
+    UikaUClassHandle ClsHandle,
+    uint32 Count,
+    uint32* OutSpawned)
+{
+    if (OutSpawned) *OutSpawned = 0;
+    UUikaActorPoolSubsystem* Pool = GetActorPool(WorldHandle);
+    UClass* Class = static_cast<UClass*>(ClsHandle.ptr);
+    if (!Pool || !Class) return EUikaErrorCode::NullArgument;
+    if (!Class->IsChildOf(AActor::StaticClass())) return EUikaErrorCode::InvalidCast;
+
+    const int32 Spawned = Pool->Prewarm(Class, static_cast<int32>(FMath::Min<uint32>(Count, MAX_int32)));
+    if (OutSpawned) *OutSpawned = static_cast<uint32>(Spawned);
+    return EUikaErrorCode::Ok;
+}
+
+static EUikaErrorCode PoolAcquireImpl(
+    UikaUObjectHandle WorldHandle,
+    UikaUClassHandle ClsHandle,
+    const uint8* TransformBuf,
+    uint32 TransformSize,
+    UikaUObjectHandle* OutActor,
+    bool* OutReused)
+{
+    if (OutReused) *OutReused = false;
+    if (!OutActor) return EUikaErrorCode::NullArgument;
+    *OutActor = UikaUObjectHandle{ nullptr };
+
+    UUikaActorPoolSubsystem* Pool = GetActorPool(WorldHandle);
+    UClass* Class = static_cast<UClass*>(ClsHandle.ptr);
+    if (!Pool || !Class) return EUikaErrorCode::NullArgument;
+    if (!Class->IsChildOf(AActor::StaticClass())) return EUikaErrorCode::InvalidCast;
+
+    bool bReused = false;
+    AActor* Actor = Pool->Acquire(Class, ReadSpawnTransform(TransformBuf, TransformSize), bReused);
+    UikaBumpObjectEpoch();
+    if (!Actor) return EUikaErrorCode::InternalError;
+
+    *OutActor = UikaUObjectHandle{ Actor };
+    if (OutReused) *OutReused = bReused;
+    return EUikaErrorCode::Ok;
+}
+
+static EUikaErrorCode PoolReleaseImpl(UikaUObjectHandle ActorHandle)
+{
+    AActor* Actor = Cast<AActor>(static_cast<UObject*>(ActorHandle.ptr));
+    if (!IsValid(Actor)) return EUikaErrorCode::ObjectDestroyed;
+
+    UWorld* World = Actor->GetWorld();
+    UUikaActorPoolSubsystem* Pool = World ? World->GetSubsystem<UUikaActorPoolSubsystem>() : nullptr;
+    if (!Pool) return EUikaErrorCode::InvalidOperation;
+
+    return Pool->Release(Actor) ? EUikaErrorCode::Ok : EUikaErrorCode::InvalidOperation;
+}
+
+static EUikaErrorCode PoolClearImpl(
+    UikaUObjectHandle WorldHandle,
+    UikaUClassHandle ClsHandle,
+    uint32* OutDestroyed)
+{
+    if (OutDestroyed) *OutDestroyed = 0;
+    UUikaActorPoolSubsystem* Pool = GetActorPool(WorldHandle);
+    if (!Pool) return EUikaErrorCode::NullArgument;
+
+    const int32 Destroyed = Pool->Clear(static_cast<UClass*>(ClsHandle.ptr));
+    UikaBumpObjectEpoch();
+    if (OutDestroyed) *OutDestroyed = static_cast<uint32>(Destroyed);
+    return EUikaErrorCode::Ok;
+}
+
+// ---------------------------------------------------------------------------
+// Asynchronous asset loading
+// ---------------------------------------------------------------------------
+
+// One in-flight load_object(s)_async request. Completion is delivered through
+// invoke_delegate_callback with a FUikaAssetLoadResult* as the params pointer.
+struct FUikaAssetLoadRequest
+{
+    uint64 CallbackId = 0;
+    TArray<FSoftObjectPath> Paths;
+    TWeakObjectPtr<UClass> Class;
+    TSharedPtr<FStreamableHandle> Handle;
+};
+
+// Created on first use: FStreamableManager is an FGCObject and must not be
+// constructed during static initialization.
+static TUniquePtr<FStreamableManager> GUikaStreamable;
+static TMap<uint64, FUikaAssetLoadRequest> GAssetLoads;
+static uint64 GNextAssetLoadId = 1;
+
+// The removed request keeps its streamable handle (and so the loaded objects)
+// alive until the callback returns; Rust roots the results before then, as
+// nothing else references them once the handle is released.
+static void DeliverAssetLoad(uint64 RequestId, uint32 Status)
+{
+    FUikaAssetLoadRequest Request;
+    if (!GAssetLoads.RemoveAndCopyValue(RequestId, Request))
+    {
+        return;
+    }
+
+    TArray<UikaUObjectHandle> Objects;
+    Objects.SetNumZeroed(Request.Paths.Num());
+    if (Status == UIKA_ASSET_LOAD_OK)
+    {
+        UClass* Class = Request.Class.Get();
+        for (int32 i = 0; i < Request.Paths.Num(); ++i)
+        {
+            UObject* Obj = Request.Paths[i].ResolveObject();
+            if (Obj && (!Class || Obj->IsA(Class)))
+            {
+                Objects[i] = UikaUObjectHandle{ Obj };
+            }
+        }
+    }
+
+    const FUikaRustCallbacks* Callbacks = GetUikaRustCallbacks();
+    if (Callbacks && Callbacks->invoke_delegate_callback)
+    {
+        UIKA_TRACE_SCOPE(Uika_AssetLoadCallback);
+        FUikaAssetLoadResult Result{ RequestId, Objects.GetData(), static_cast<uint32>(Objects.Num()), Status };
+        Callbacks->invoke_delegate_callback(Request.CallbackId, reinterpret_cast<uint8*>(&Result));
+    }
+}
+
+static EUikaErrorCode StartAssetLoad(
+    UClass* Class,
+    TArray<FSoftObjectPath>&& Paths,
+    int32 Priority,
+    uint64 CallbackId,
+    uint64* OutRequest)
+{
+    if (!GUikaStreamable)
+    {
+        GUikaStreamable = MakeUnique<FStreamableManager>();
+    }
+
+    const uint64 RequestId = GNextAssetLoadId++;
+    *OutRequest = RequestId;
+
+    // Register before requesting: already-loaded assets may complete inside
+    // RequestAsyncLoad itself.
+    FUikaAssetLoadRequest& Request = GAssetLoads.Add(RequestId);
+    Request.CallbackId = CallbackId;
+    Request.Paths = Paths;
+    Request.Class = Class;
+
+    TSharedPtr<FStreamableHandle> Handle = GUikaStreamable->RequestAsyncLoad(
+        MoveTemp(Paths),
+        FStreamableDelegate::CreateLambda([RequestId]()
+        {
+            DeliverAssetLoad(RequestId, UIKA_ASSET_LOAD_OK);
+        }),
+        static_cast<TAsyncLoadPriority>(Priority));
+
+    if (FUikaAssetLoadRequest* Pending = GAssetLoads.Find(RequestId))
+    {
+        Pending->Handle = Handle;
+        if (!Handle.IsValid())
+        {
+            // Nothing loadable was requested; complete with all-null results.
+            DeliverAssetLoad(RequestId, UIKA_ASSET_LOAD_OK);
+        }
+    }
+    return EUikaErrorCode::Ok;
+}
+
+static EUikaErrorCode LoadObjectAsyncImpl(
+    UikaUClassHandle ClsHandle,
+    const uint8* PathUtf8,
+    uint32 PathLen,
+    int32 Priority,
+    uint64 CallbackId,
+    uint64* OutRequest)
+{
+    if (!OutRequest || !PathUtf8) return EUikaErrorCode::NullArgument;
+    *OutRequest = 0;
+
+    TArray<FSoftObjectPath> Paths;
+    Paths.Emplace(Utf8ToFStr(PathUtf8, PathLen));
+    return StartAssetLoad(static_cast<UClass*>(ClsHandle.ptr), MoveTemp(Paths), Priority, CallbackId, OutRequest);
+}
+
+static EUikaErrorCode LoadObjectsAsyncImpl(
+    UikaUClassHandle ClsHandle,
+    const UikaStrView* PathViews,
+    uint32 PathCount,
+    int32 Priority,
+    uint64 CallbackId,
+    uint64* OutRequest)
+{
+    if (!OutRequest || (!PathViews && PathCount > 0)) return EUikaErrorCode::NullArgument;
+    *OutRequest = 0;
+
+    TArray<FSoftObjectPath> Paths;
+    Paths.Reserve(PathCount);
+    for (uint32 i = 0; i < PathCount; ++i)
+    {
+        Paths.Emplace(Utf8ToFStr(PathViews[i].ptr, PathViews[i].len));
+    }
+    return StartAssetLoad(static_cast<UClass*>(ClsHandle.ptr), MoveTemp(Paths), Priority, CallbackId, OutRequest);
+}
+
+// Cancel an in-flight request. Its callback still fires, synchronously, with
+// UIKA_ASSET_LOAD_CANCELLED so the Rust side can release its state.
+static EUikaErrorCode CancelAssetLoadImpl(uint64 RequestId)
+{
+    FUikaAssetLoadRequest* Request = GAssetLoads.Find(RequestId);
+    if (!Request) return EUikaErrorCode::InvalidOperation;
+
+    TSharedPtr<FStreamableHandle> Handle = Request->Handle;
+    DeliverAssetLoad(RequestId, UIKA_ASSET_LOAD_CANCELLED);
+    if (Handle.IsValid())
+    {
+        Handle->CancelHandle();
+    }
+    return EUikaErrorCode::Ok;
+}
+
+// Drop every in-flight request without calling back: the callback ids belong
+// to the Rust DLL being unloaded.
+void UikaAssetLoadCancelAll()
+{
+    TMap<uint64, FUikaAssetLoadRequest> Pending = MoveTemp(GAssetLoads);
+    GAssetLoads.Reset();
+    for (auto& Pair : Pending)
+    {
+        if (Pair.Value.Handle.IsValid())
+        {
+            Pair.Value.Handle->CancelHandle();
+        }
+    }
+    GUikaStreamable.Reset();
+}
+
 // ---------------------------------------------------------------------------
 // Static instance
 // ---------------------------------------------------------------------------
@@ -202,4 +689,22 @@ FUikaWorldApi GWorldApi = {
     &NewObjectImpl,
     &SpawnActorDeferredImpl,
     &FinishSpawningImpl,
+    &GetActorsOfClassIndexedImpl,
+    &GetActorChangesImpl,
+    &SpawnActorsBatchImpl,
+    &SpawnActorsDeferredBatchImpl,
+    &FinishSpawningBatchImpl,
+    &PoolPrewarmImpl,
+    &PoolAcquireImpl,
+    &PoolReleaseImpl,
+    &PoolClearImpl,
+    &LoadObjectAsyncImpl,
+    &LoadObjectsAsyncImpl,
+    &CancelAssetLoadImpl,
+    &UikaMirrorCreate,
+    &UikaMirrorSetObjects,
+    &UikaMirrorDestroy,
+    &UikaTraceBatch,
+    &UikaTraceBatchAsync,
+    &UikaCancelTraceBatch,
 };
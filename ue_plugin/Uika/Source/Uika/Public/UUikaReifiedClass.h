@@ -14,6 +14,18 @@ struct FUikaComponentDef
     FName AttachParentName; // NAME_None = no parent
 };
 
+// One subobject of a compiled construction plan. Steps are ordered so that an
+// attach parent always precedes its children.
+struct FUikaConstructionStep
+{
+    FName SubobjectName;
+    UClass* ComponentClass = nullptr;
+    int32 AttachParent = INDEX_NONE; // index of the parent step
+    bool bIsRoot = false;
+    bool bIsTransient = false;
+    bool bIsScene = false; // ComponentClass derives from USceneComponent
+};
+
 // A UClass created at runtime by Rust via the Reify API.
 // Inherits from UBlueprintGeneratedClass so the engine treats it
 // similarly to Blueprint classes (CDO creation, property editing, etc.).
@@ -36,9 +48,67 @@ public:
     // Default subobject definitions registered from Rust.
     TArray<FUikaComponentDef> ComponentDefs;
 
+    // ComponentDefs compiled by BuildConstructionPlan: what UikaClassConstructor
+    // runs, with attach parents resolved to indices.
+    TArray<FUikaConstructionStep> ConstructionPlan;
+
+    // Rebuild ConstructionPlan from ComponentDefs. Call before the CDO is created.
+    void BuildConstructionPlan();
+
+    // Reified functions declared on this class, keyed by name. Built at
+    // FinalizeClass so the thunk can resolve itself without a hierarchy
+    // FindFunctionByName. Functions are children of the class (kept alive).
+    TMap<FName, class UUikaReifiedFunction*> FunctionDispatch;
+
+    // Rebuild FunctionDispatch and every function's ParamPlan.
+    void BuildDispatchTables();
+
+    // Byte offset of the hidden Rust instance data slot, INDEX_NONE before
+    // FinalizeClass. The slot is reserved past the last property by the
+    // topmost reified class of a hierarchy and inherited by everything
+    // below it, so it is not a property and is never copied from the CDO.
+    int32 RustDataOffset = INDEX_NONE;
+
+    // Reserve the slot (or adopt the reified parent's). Call after StaticLink.
+    void ReserveRustDataSlot();
+
+    void* GetRustData(const UObject* Obj) const
+    {
+        return RustDataOffset != INDEX_NONE
+            ? *reinterpret_cast<void* const*>(reinterpret_cast<const uint8*>(Obj) + RustDataOffset)
+            : nullptr;
+    }
+
+    void SetRustData(UObject* Obj, void* Data) const
+    {
+        if (RustDataOffset != INDEX_NONE)
+        {
+            *reinterpret_cast<void**>(reinterpret_cast<uint8*>(Obj) + RustDataOffset) = Data;
+        }
+    }
+
+    // Live non-CDO instances of this class and of its Blueprint children.
+    // Added by UikaClassConstructor, removed by the object tracker when the
+    // instance is destroyed; backs hot reload and get_instances.
+    void AddLiveInstance(UObject* Obj);
+    void RemoveLiveInstance(const UObjectBase* Obj);
+
+    // Snapshot of LiveInstances (taken under the lock; callers may re-enter).
+    void GetLiveInstances(TArray<UObject*>& Out) const;
+    int32 NumLiveInstances() const;
+
     // Custom constructor called by UE when instantiating objects of this class.
     static void UikaClassConstructor(const FObjectInitializer& ObjectInitializer);
 
+    // Nearest UUikaReifiedClass in Cls's super chain (Cls itself included), or
+    // null. Blueprint children are resolved once and cached.
+    static UUikaReifiedClass* FindReifiedClass(UClass* Cls);
+
+private:
+    TSet<UObject*> LiveInstances;
+    mutable FCriticalSection LiveInstancesLock;
+
+public:
     // Override: UBlueprintGeneratedClass assumes ClassGeneratedBy points to a
     // UBlueprint asset.  Reified classes have no Blueprint, so return this directly.
     virtual UClass* GetAuthoritativeClass() override;
@@ -4,6 +4,26 @@
 #include "UObject/ObjectMacros.h"
 #include "UUikaReifiedFunction.generated.h"
 
+// Precomputed parameter handling for the bytecode call path, built once at
+// FinalizeClass (or lazily on first call) instead of walking ChildProperties
+// on every invocation.
+struct FUikaParamPlan
+{
+    // Input params (declaration order, return value excluded) read via Stack.Step.
+    TArray<FProperty*, TInlineAllocator<8>> Inputs;
+    // Params whose temporaries need DestroyValue after the call.
+    TArray<FProperty*, TInlineAllocator<4>> NeedsDestroy;
+    // Return value descriptor; bReturnIsPod means a plain memcpy suffices.
+    FProperty* ReturnProp = nullptr;
+    int32 ReturnOffset = 0;
+    int32 ReturnSize = 0;
+    bool bReturnIsPod = false;
+    int32 FrameSize = 0;
+    // Owning class's UUikaReifiedClass::RustDataOffset.
+    int32 RustDataOffset = INDEX_NONE;
+    bool bBuilt = false;
+};
+
 // A UFunction created at runtime by Rust via the Reify API.
 // When UE calls this function (via ProcessEvent or Blueprint VM),
 // it dispatches to the registered Rust callback.
@@ -16,6 +36,12 @@ public:
     // Rust-side callback ID for dispatching to the correct Rust function.
     uint64 CallbackId = 0;
 
+    // Bytecode-path parameter plan (see BuildParamPlan).
+    FUikaParamPlan ParamPlan;
+
+    // (Re)build ParamPlan from ChildProperties. Call after StaticLink.
+    void BuildParamPlan();
+
     // Native thunk called by the Blueprint VM.
     DECLARE_FUNCTION(execCallRustFunction);
 };
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "UikaActorIndexSubsystem.generated.h"
+
+class AActor;
+class ULevel;
+
+// Per-class actor index backing FUikaWorldApi::get_all_actors_of_class.
+//
+// A class is indexed the first time it is queried (one TActorIterator scan);
+// afterwards its bucket is kept current from the world's spawn/destroy
+// handlers and level streaming, so queries cost O(result) instead of a full
+// actor scan. Every add/remove is also appended to a bounded change log
+// stamped with a monotonically increasing generation, which lets callers ask
+// for "changes since generation N" instead of re-reading whole buckets.
+UCLASS()
+class UUikaActorIndexSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    struct FChange
+    {
+        uint64 Generation;
+        // Identity only for removals — never dereferenced once removed.
+        AActor* Actor;
+        TWeakObjectPtr<UClass> Class;
+        bool bAdded;
+    };
+
+    struct FEntry
+    {
+        AActor* Actor;
+        TWeakObjectPtr<AActor> Weak;
+    };
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // Live actors of Class (and subclasses). Builds the bucket on first use;
+    // entries whose actor was collected without a destroy event are dropped.
+    const TArray<FEntry>& GetActors(UClass* Class);
+
+    // Append every change to an actor of Class with generation > Since.
+    // Returns false if part of that range was trimmed from the log; the
+    // caller must re-query the full set.
+    bool GetChanges(UClass* Class, uint64 Since, TArray<const FChange*>& OutChanges) const;
+
+    uint64 GetGeneration() const { return Generation; }
+
+private:
+    struct FClassBucket
+    {
+        TWeakObjectPtr<UClass> Class;
+        TArray<FEntry> Entries;
+        TMap<AActor*, int32> Slots;
+    };
+
+    void HandleActorSpawned(AActor* Actor);
+    void HandleActorDestroyed(AActor* Actor);
+    void HandleLevelAdded(ULevel* Level, UWorld* World);
+    void HandleLevelRemoved(ULevel* Level, UWorld* World);
+
+    void AddActor(AActor* Actor);
+    void RemoveActor(AActor* Actor);
+    void RecordChange(AActor* Actor, bool bAdded);
+    static void BucketAdd(FClassBucket& Bucket, AActor* Actor);
+    static void BucketRemove(FClassBucket& Bucket, AActor* Actor);
+    static void BucketRemoveAt(FClassBucket& Bucket, int32 Slot);
+
+    TMap<TObjectKey<UClass>, FClassBucket> Buckets;
+
+    TArray<FChange> Changes;
+    uint64 Generation = 0;
+    // Changes with generation <= HistoryFloor are no longer in the log.
+    uint64 HistoryFloor = 0;
+
+    FDelegateHandle SpawnedHandle;
+    FDelegateHandle DestroyedHandle;
+    FDelegateHandle LevelAddedHandle;
+    FDelegateHandle LevelRemovedHandle;
+};
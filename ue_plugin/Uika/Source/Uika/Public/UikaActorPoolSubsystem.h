@@ -0,0 +1,55 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "UikaActorPoolSubsystem.generated.h"
+
+class AActor;
+
+// Per-class actor pools backing the FUikaWorldApi pool_* entries.
+//
+// A released actor is hidden, its collision and ticking are switched off and
+// it is parked on its class's free list; acquiring it moves it into place and
+// switches them back on. Reified instances keep their Rust data across the
+// cycle: FUikaRustCallbacks::on_pool_release / on_pool_acquire are called
+// instead of drop_rust_instance / construct_rust_instance, so a pooled
+// projectile never pays for UikaClassConstructor, default subobject creation
+// or GC again after it has been pre-warmed.
+UCLASS()
+class UUikaActorPoolSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    // Spawn Count actors of Class straight into the pool. Returns how many
+    // were spawned.
+    int32 Prewarm(UClass* Class, int32 Count);
+
+    // Take a pooled actor of Class (spawning one if the pool is empty), place
+    // it at Transform and activate it. bOutReused is false for fresh spawns.
+    AActor* Acquire(UClass* Class, const FTransform& Transform, bool& bOutReused);
+
+    // Deactivate Actor and park it on its class's free list. Fails if the
+    // actor is already pooled or being destroyed.
+    bool Release(AActor* Actor);
+
+    // Destroy every pooled (inactive) actor of Class, or of all classes if
+    // Class is null. Returns how many were destroyed.
+    int32 Clear(UClass* Class);
+
+    int32 NumFree(UClass* Class) const;
+
+    // Whether Actor is parked on a free list.
+    bool IsPooled(const AActor* Actor) const { return Pooled.Contains(Actor); }
+
+private:
+    void Deactivate(AActor* Actor);
+    void Activate(AActor* Actor, const FTransform& Transform);
+    AActor* SpawnPooled(UClass* Class, const FTransform& Transform);
+
+    TMap<TObjectKey<UClass>, TArray<TWeakObjectPtr<AActor>>> FreeLists;
+    TSet<TObjectKey<AActor>> Pooled;
+};
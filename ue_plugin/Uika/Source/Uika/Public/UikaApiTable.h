@@ -18,6 +18,64 @@ struct UikaUStructHandle  { void* ptr; };
 struct UikaFNameHandle    { uint64 value; };
 struct UikaFWeakObjectHandle { int32 object_index; int32 object_serial_number; };
 
+// Borrowed UTF-8 slice (not null-terminated) for bulk entry points.
+struct UikaStrView { const uint8* ptr; uint32 len; uint32 _pad; };
+
+// Key/value field of a structured log record (FUikaLoggingApi::log_record).
+struct FUikaLogField { UikaStrView key; UikaStrView value; };
+
+// Borrowed UTF-16 view into live FString storage (len in code units).
+struct UikaUtf16View { const uint16* ptr; uint32 len; uint32 _pad; };
+
+// Read-only GUObjectArray view for inline weak resolution on the Rust side.
+// The first *num_chunks entries of chunks are published chunk bases; an index
+// past them goes through resolve_weak, which publishes its chunk.
+struct FUikaObjectArrayView
+{
+    const uint8* const* chunks;
+    const uint32* num_chunks;
+    uint32 elements_per_chunk;
+    uint32 item_size;       // sizeof(FUObjectItem)
+    uint32 object_offset;
+    uint32 flags_offset;
+    uint32 serial_offset;
+    int32  dead_flags;      // Unreachable | Garbage
+};
+
+// ---------------------------------------------------------------------------
+// Math ABI (uika-ffi/src/math_types.rs)
+// ---------------------------------------------------------------------------
+
+// Four double lanes per type, 16-byte aligned like VectorRegister4Double, so
+// FUikaTransform has the same 96-byte footprint as FTransform. Padding lanes
+// are written as zero and ignored on read.
+struct alignas(16) FUikaVector   { double x, y, z, _pad; };
+struct alignas(16) FUikaQuat     { double x, y, z, w; };
+struct alignas(16) FUikaRotator  { double pitch, yaw, roll, _pad; };
+struct alignas(16) FUikaTransform
+{
+    FUikaQuat   rotation;
+    FUikaVector translation;
+    FUikaVector scale;
+};
+
+// ---------------------------------------------------------------------------
+// Command buffers (uika-ffi/src/command_types.rs)
+// ---------------------------------------------------------------------------
+
+// Records start on UIKA_CMD_ALIGN boundaries: header, one 8-byte slot per
+// wrapper input, then the struct/string payload. Pointer-like inputs store
+// offset | (len << 32), the offset relative to the record start.
+constexpr uint32 UIKA_CMD_ALIGN     = 16;
+constexpr uint32 UIKA_CMD_SLOT_SIZE = 8;
+
+struct FUikaCommandHeader
+{
+    uint32 func_id;
+    uint32 size;            // whole record, header included
+    UikaUObjectHandle obj;  // null for static functions
+};
+
 // ---------------------------------------------------------------------------
 // Error codes
 // ---------------------------------------------------------------------------
@@ -57,6 +115,14 @@ struct FUikaCoreApi
     UikaFWeakObjectHandle (*make_weak)(UikaUObjectHandle obj);
     UikaUObjectHandle     (*resolve_weak)(UikaFWeakObjectHandle weak);
     bool                  (*is_weak_valid)(UikaFWeakObjectHandle weak);
+
+    // Bulk FName construction: out receives count handles.
+    EUikaErrorCode (*make_fnames_bulk)(const UikaStrView* names, uint32 count, UikaFNameHandle* out);
+
+    // Bulk / inline weak resolution. get_object_array_view returns
+    // InvalidOperation when the FUObjectItem layout is not supported.
+    EUikaErrorCode (*resolve_weak_many)(const UikaFWeakObjectHandle* weak, uint32 count, UikaUObjectHandle* out);
+    EUikaErrorCode (*get_object_array_view)(FUikaObjectArrayView* out);
 };
 
 // ---------------------------------------------------------------------------
@@ -67,6 +133,19 @@ struct FUikaLoggingApi
 {
     // level: 0=Display, 1=Warning, 2=Error.  msg is UTF-8 (not null-terminated).
     void (*log)(uint8 level, const uint8* msg, uint32 msg_len);
+
+    // -- Categories / verbosity --
+    // Id 0 is LogUika (also returned when the table is full).
+    uint16 (*register_category)(const uint8* name, uint32 name_len);
+    // ELogVerbosity per category id (256 entries), refreshed every frame on the game thread.
+    const uint8* (*verbosity_table)();
+
+    // -- Async records --
+    // Queued for the background drain thread (errors are written synchronously);
+    // safe from any thread.
+    // level as for log, plus 3=Verbose, 4=VeryVerbose.
+    void (*log_record)(uint8 level, uint16 category, const uint8* msg, uint32 msg_len,
+                       const FUikaLogField* fields, uint32 field_count);
 };
 
 // ---------------------------------------------------------------------------
@@ -79,6 +158,89 @@ struct FUikaLifecycleApi
     void (*remove_gc_root)(UikaUObjectHandle obj);
     void (*register_pinned)(UikaUObjectHandle obj);
     void (*unregister_pinned)(UikaUObjectHandle obj);
+
+    // Object destruction epoch: stable address of a uint64 bumped whenever an
+    // object may have stopped being IsValid. Read atomically.
+    const uint64* (*object_epoch)();
+
+    // Bulk variants of the four entries above.
+    void (*add_gc_root_many)(const UikaUObjectHandle* objs, uint32 count);
+    void (*remove_gc_root_many)(const UikaUObjectHandle* objs, uint32 count);
+    void (*register_pinned_many)(const UikaUObjectHandle* objs, uint32 count);
+    void (*unregister_pinned_many)(const UikaUObjectHandle* objs, uint32 count);
+};
+
+// ---------------------------------------------------------------------------
+// Property batch types
+// ---------------------------------------------------------------------------
+
+enum class EUikaPropKind : uint32
+{
+    Bool = 0, I32 = 1, I64 = 2, U8 = 3, F32 = 4, F64 = 5,
+    Name = 6, Object = 7, Enum = 8, Struct = 9, String = 10,
+};
+
+constexpr uint32 UIKA_PROP_OP_READ  = 0;
+constexpr uint32 UIKA_PROP_OP_WRITE = 1;
+
+// One entry of FUikaPropertyApi::batch. The value lives at
+// io_buf + buf_offset (unaligned), occupying buf_size bytes.
+struct FUikaPropOp
+{
+    UikaFPropertyHandle prop;
+    uint32 kind;        // EUikaPropKind
+    uint32 op;          // UIKA_PROP_OP_READ / UIKA_PROP_OP_WRITE
+    uint32 buf_offset;
+    uint32 buf_size;
+};
+
+// gather / scatter element check.
+constexpr uint32 UIKA_GATHER_ANY  = 0;
+constexpr uint32 UIKA_GATHER_BOOL = 0xFFFFFFFFu;
+
+// Field layout descriptor (FUikaReflectionApi::get_field_desc).
+constexpr uint32 UIKA_FIELD_POD  = 1;   // raw load/store of elem_size bytes at offset is valid
+constexpr uint32 UIKA_FIELD_BOOL = 2;   // FBoolProperty: use bool_* members
+constexpr uint32 UIKA_FIELD_OBJECT = 4; // FObjectPropertyBase: one UikaUObjectHandle via the PropertyApi
+
+struct FUikaFieldDesc
+{
+    uint32 offset;
+    uint32 elem_size;
+    uint32 array_dim;
+    uint32 flags;
+    uint8  bool_byte_offset;
+    uint8  bool_byte_mask;
+    uint8  bool_field_mask;
+    uint8  _pad;
+};
+
+// Batched handle resolution (FUikaReflectionApi::resolve_many).
+enum class EUikaResolveKind : uint32
+{
+    Class = 0, Struct = 1, Property = 2, StructProperty = 3, Function = 4, FunctionParam = 5,
+};
+
+constexpr uint32 UIKA_RESOLVE_NO_OWNER_INDEX = 0xFFFFFFFFu;
+
+// If owner_index != UIKA_RESOLVE_NO_OWNER_INDEX, the owner is the result of
+// an earlier entry in the same batch. The C++ side fills result.
+struct FUikaResolveReq
+{
+    uint32      kind;           // EUikaResolveKind
+    uint32      owner_index;
+    void*       owner;
+    UikaStrView name;
+    void*       result;
+};
+
+// Cached parameter-frame layout of a UFunction (FUikaReflectionApi::get_frame_layout).
+struct FUikaFrameLayout
+{
+    uint32 size;            // ParmsSize
+    uint32 align;           // minimum alignment of the frame
+    uint32 init_count;      // params needing construction beyond zero-fill
+    uint32 destroy_count;   // params needing destruction
 };
 
 // ---------------------------------------------------------------------------
@@ -128,6 +290,45 @@ struct FUikaPropertyApi
         uint32 index, uint8* out_buf, uint32 buf_size);
     EUikaErrorCode (*set_property_at)(UikaUObjectHandle obj, UikaFPropertyHandle prop,
         uint32 index, const uint8* in_buf, uint32 buf_size);
+
+    // Batched access: run count read/write ops against one object in a single
+    // crossing. Stops at the first failing op and returns its error code.
+    EUikaErrorCode (*batch)(UikaUObjectHandle obj, const FUikaPropOp* ops, uint32 count, uint8* io_buf);
+
+    // Gather/scatter one property across many objects. Element i lives at
+    // buf + i * stride (stride 0 = element size). Null objects are zero-filled
+    // on gather and skipped on scatter. Supports bool, object, struct and POD props.
+    // elem: UIKA_GATHER_ANY, UIKA_GATHER_BOOL, or the element size the property
+    // must have (TypeMismatch otherwise).
+    EUikaErrorCode (*gather)(const UikaUObjectHandle* objs, uint32 count, UikaFPropertyHandle prop,
+        uint8* out_buf, uint32 stride, uint32 elem);
+    EUikaErrorCode (*scatter)(const UikaUObjectHandle* objs, uint32 count, UikaFPropertyHandle prop,
+        const uint8* in_buf, uint32 stride, uint32 elem);
+
+    // FString/FText read converted straight from the in-place storage.
+    // out_len always receives the exact UTF-8 length; returns BufferTooSmall
+    // (writing nothing) if buf_len is shorter.
+    EUikaErrorCode (*get_string_exact)(UikaUObjectHandle obj, UikaFPropertyHandle prop,
+        uint8* buf, uint32 buf_len, uint32* out_len);
+    // Borrowed UTF-16 view of the live string. Valid until the property is
+    // written or the container is destroyed.
+    EUikaErrorCode (*get_string_view)(UikaUObjectHandle obj, UikaFPropertyHandle prop, UikaUtf16View* out);
+
+    // Math fast paths: FVector / FRotator / FTransform properties in the
+    // canonical math ABI (TypeMismatch for any other struct).
+    EUikaErrorCode (*get_vector)(UikaUObjectHandle obj, UikaFPropertyHandle prop, FUikaVector* out);
+    EUikaErrorCode (*set_vector)(UikaUObjectHandle obj, UikaFPropertyHandle prop, const FUikaVector* val);
+    EUikaErrorCode (*get_rotator)(UikaUObjectHandle obj, UikaFPropertyHandle prop, FUikaRotator* out);
+    EUikaErrorCode (*set_rotator)(UikaUObjectHandle obj, UikaFPropertyHandle prop, const FUikaRotator* val);
+    EUikaErrorCode (*get_transform)(UikaUObjectHandle obj, UikaFPropertyHandle prop, FUikaTransform* out);
+    EUikaErrorCode (*set_transform)(UikaUObjectHandle obj, UikaFPropertyHandle prop, const FUikaTransform* val);
+
+    // Property paths: one element of leaf at obj + offset (resolve_property_path).
+    // Bool, POD and object leaves only; anything else is TypeMismatch.
+    EUikaErrorCode (*get_at_offset)(UikaUObjectHandle obj, UikaFPropertyHandle leaf, uint32 offset,
+                                    uint8* out_buf, uint32 buf_size);
+    EUikaErrorCode (*set_at_offset)(UikaUObjectHandle obj, UikaFPropertyHandle leaf, uint32 offset,
+                                    const uint8* in_buf, uint32 buf_size);
 };
 
 // ---------------------------------------------------------------------------
@@ -169,12 +370,48 @@ struct FUikaReflectionApi
 
     // Destroy struct memory (calls C++ destructors for non-trivial members).
     EUikaErrorCode (*destroy_struct)(UikaUStructHandle ustruct, uint8* data);
+
+    // Layout descriptor for direct (zero-crossing) POD field access.
+    EUikaErrorCode (*get_field_desc)(UikaFPropertyHandle prop, FUikaFieldDesc* out);
+
+    // Hash of a UClass/UScriptStruct property layout. Struct handles are cast
+    // to UikaUClassHandle (same convention as FUikaReifyPropExtra::enum_handle).
+    uint64 (*get_layout_hash)(UikaUClassHandle cls);
+
+    // Batched resolution through the reflection cache. Returns the number of
+    // non-null results.
+    uint32 (*resolve_many)(FUikaResolveReq* reqs, uint32 count);
+
+    // Parameter frames in caller-owned memory (uses the cached frame plan).
+    // init_params returns BufferTooSmall if buf_len < size, InvalidOperation
+    // if buf is not aligned to align.
+    EUikaErrorCode (*get_frame_layout)(UikaUFunctionHandle func, FUikaFrameLayout* out);
+    EUikaErrorCode (*init_params)(UikaUFunctionHandle func, uint8* buf, uint32 buf_len);
+    EUikaErrorCode (*destroy_params)(UikaUFunctionHandle func, uint8* buf);
+
+    // Command buffers: run every record through its generated packed-args
+    // thunk in one crossing. Records without a thunk or whose wrapper fails
+    // count as failed and are skipped; a malformed record stops the walk
+    // with InvalidOperation.
+    EUikaErrorCode (*execute_command_buffer)(const uint8* buf, uint32 len, uint32* out_executed, uint32* out_failed);
+    bool (*has_command_thunk)(uint32 func_id);
+
+    // -- Property paths --
+    // Resolve "Transform.Translation.X" / "Slots[2].Count" through struct
+    // properties and fixed-array indices. out_desc->offset is measured from
+    // the container base; an indexed leaf has array_dim 1.
+    EUikaErrorCode (*resolve_property_path)(UikaUClassHandle owner, const uint8* path, uint32 path_len,
+                                            UikaFPropertyHandle* out_leaf, FUikaFieldDesc* out_desc);
 };
 
 // ---------------------------------------------------------------------------
 // Placeholder sub-tables (filled in later phases)
 // ---------------------------------------------------------------------------
 
+// FUikaContainerApi::array_sort keys.
+constexpr uint32 UIKA_SORT_BY_VALUE    = 0;   // natural order of numerics, bools, enums, strings, names, text
+constexpr uint32 UIKA_SORT_BY_DISTANCE = 1;   // actor/scene-component elements by distance to origin
+
 struct FUikaContainerApi
 {
     // -- TArray --
@@ -230,7 +467,79 @@ struct FUikaContainerApi
         uint8* out_buf, uint32 buf_size, uint32* out_total_written, int32* out_count);
     EUikaErrorCode (*set_copy_all)(UikaUObjectHandle obj, UikaFPropertyHandle prop,
         uint8* out_buf, uint32 buf_size, uint32* out_total_written, int32* out_count);
+
+    // Cursor iteration: a cursor is an internal sparse index, -1 = end.
+    // *_iter_next reads the entry at *cursor and advances it.
+    int32 (*map_iter_begin)(UikaUObjectHandle obj, UikaFPropertyHandle prop);
+    EUikaErrorCode (*map_iter_next)(UikaUObjectHandle obj, UikaFPropertyHandle prop,
+        int32* cursor,
+        uint8* out_key_buf, uint32 key_buf_size, uint32* out_key_written,
+        uint8* out_val_buf, uint32 val_buf_size, uint32* out_val_written);
+    int32 (*set_iter_begin)(UikaUObjectHandle obj, UikaFPropertyHandle prop);
+    EUikaErrorCode (*set_iter_next)(UikaUObjectHandle obj, UikaFPropertyHandle prop,
+        int32* cursor, uint8* out_buf, uint32 buf_size, uint32* out_written);
+    // Exact-size queries: the byte count *_copy_all would write (array
+    // out_count < 0 = raw format).
+    EUikaErrorCode (*array_copy_size)(UikaUObjectHandle obj, UikaFPropertyHandle prop,
+        uint32* out_size, int32* out_count);
+    EUikaErrorCode (*map_copy_size)(UikaUObjectHandle obj, UikaFPropertyHandle prop,
+        uint32* out_size, int32* out_count);
+    EUikaErrorCode (*set_copy_size)(UikaUObjectHandle obj, UikaFPropertyHandle prop,
+        uint32* out_size, int32* out_count);
+    // Chunked copies: cursor 0 = begin, -1 = done. Writes whole frames only;
+    // out_count = frames (pairs for maps) in this chunk.
+    EUikaErrorCode (*array_copy_chunk)(UikaUObjectHandle obj, UikaFPropertyHandle prop,
+        int32* cursor, uint8* out_buf, uint32 buf_size, uint32* out_written, int32* out_count);
+    EUikaErrorCode (*map_copy_chunk)(UikaUObjectHandle obj, UikaFPropertyHandle prop,
+        int32* cursor, uint8* out_buf, uint32 buf_size, uint32* out_written, int32* out_count);
+    EUikaErrorCode (*set_copy_chunk)(UikaUObjectHandle obj, UikaFPropertyHandle prop,
+        int32* cursor, uint8* out_buf, uint32 buf_size, uint32* out_written, int32* out_count);
+    // In-place TArray data for raw-copyable inner types. The pointer is valid
+    // until the array is next resized. append_raw zero-fills when data is null.
+    EUikaErrorCode (*array_data)(UikaUObjectHandle obj, UikaFPropertyHandle prop,
+        uint8** out_data, int32* out_len, uint32* out_elem_size);
+    EUikaErrorCode (*array_reserve)(UikaUObjectHandle obj, UikaFPropertyHandle prop, int32 capacity);
+    EUikaErrorCode (*array_append_raw)(UikaUObjectHandle obj, UikaFPropertyHandle prop,
+        const uint8* data, int32 count, uint8** out_data);
+    // Bulk map/set population from the *_copy_all framed layout; one rehash.
+    EUikaErrorCode (*map_set_all)(UikaUObjectHandle obj, UikaFPropertyHandle prop,
+        const uint8* in_buf, uint32 buf_size, int32 count);
+    EUikaErrorCode (*map_add_many)(UikaUObjectHandle obj, UikaFPropertyHandle prop,
+        const uint8* in_buf, uint32 buf_size, int32 count);
+    EUikaErrorCode (*set_set_all)(UikaUObjectHandle obj, UikaFPropertyHandle prop,
+        const uint8* in_buf, uint32 buf_size, int32 count);
+    EUikaErrorCode (*set_add_many)(UikaUObjectHandle obj, UikaFPropertyHandle prop,
+        const uint8* in_buf, uint32 buf_size, int32 count);
+    // Container algorithms, run in place (elements compared via FProperty::Identical).
+    EUikaErrorCode (*array_find)(UikaUObjectHandle obj, UikaFPropertyHandle prop,
+        const uint8* in_buf, uint32 buf_size, int32 start, int32* out_index);
+    EUikaErrorCode (*array_remove_all_by_value)(UikaUObjectHandle obj, UikaFPropertyHandle prop,
+        const uint8* in_buf, uint32 buf_size, int32* out_removed);
+    EUikaErrorCode (*array_dedupe)(UikaUObjectHandle obj, UikaFPropertyHandle prop, int32* out_removed);
+    // Stable sort. origin: 3 doubles, read only for UIKA_SORT_BY_DISTANCE.
+    EUikaErrorCode (*array_sort)(UikaUObjectHandle obj, UikaFPropertyHandle prop,
+        uint32 key, bool descending, const double* origin);
+    EUikaErrorCode (*array_swap)(UikaUObjectHandle obj, UikaFPropertyHandle prop, int32 a, int32 b);
+    EUikaErrorCode (*array_insert_at)(UikaUObjectHandle obj, UikaFPropertyHandle prop,
+        int32 index, const uint8* in_buf, uint32 buf_size);
+    EUikaErrorCode (*array_remove_range)(UikaUObjectHandle obj, UikaFPropertyHandle prop,
+        int32 index, int32 count);
+    EUikaErrorCode (*set_union)(UikaUObjectHandle obj, UikaFPropertyHandle prop,
+        UikaUObjectHandle other_obj, UikaFPropertyHandle other_prop);
+    EUikaErrorCode (*set_difference)(UikaUObjectHandle obj, UikaFPropertyHandle prop,
+        UikaUObjectHandle other_obj, UikaFPropertyHandle other_prop);
+};
+
+// Queued delegate events (FUikaDelegateApi::take_queued_events).
+// data holds count records: [u64 callback_id][u32 payload_len][u32 param_count]
+// then payload_len bytes of [u32 size][bytes] params (read_param encoding).
+struct FUikaDelegateEventBatch
+{
+    const uint8* data;
+    uint32 len;
+    uint32 count;
 };
+
 struct FUikaDelegateApi
 {
     EUikaErrorCode (*bind_delegate)(UikaUObjectHandle obj, UikaFPropertyHandle prop, uint64 callback_id);
@@ -249,6 +558,14 @@ struct FUikaDelegateApi
         uint8* out_buf,
         uint32 out_buf_size,
         uint32* out_written);
+
+    // Queued variants: fires are copied into the event buffer instead of
+    // calling Rust. Signatures with non-queueable params return TypeMismatch.
+    EUikaErrorCode (*bind_delegate_queued)(UikaUObjectHandle obj, UikaFPropertyHandle prop, uint64 callback_id);
+    EUikaErrorCode (*add_multicast_queued)(UikaUObjectHandle obj, UikaFPropertyHandle prop, uint64 callback_id);
+
+    // Hand over all events queued since the previous call (valid until the next call).
+    EUikaErrorCode (*take_queued_events)(FUikaDelegateEventBatch* out);
 };
 // ---------------------------------------------------------------------------
 // Reify API types
@@ -276,6 +593,14 @@ struct FUikaReifyPropExtra
 // FUikaReifyApi — runtime class creation, property/function registration
 // ---------------------------------------------------------------------------
 
+// register_class_from_schema layout version / record kinds (layout documented
+// in uika-ffi/src/reify_types.rs).
+constexpr uint32 UIKA_CLASS_SCHEMA_VERSION = 1;
+constexpr uint8  UIKA_SCHEMA_PROPERTY  = 0;
+constexpr uint8  UIKA_SCHEMA_COMPONENT = 1;
+constexpr uint8  UIKA_SCHEMA_FUNCTION  = 2;
+constexpr uint8  UIKA_SCHEMA_PARAM     = 3;
+
 struct FUikaReifyApi
 {
     UikaUClassHandle (*create_class)(
@@ -314,7 +639,38 @@ struct FUikaReifyApi
     UikaUObjectHandle (*find_default_subobject)(
         UikaUObjectHandle owner,
         const uint8* name, uint32 name_len);
+
+    // Live instances of reified classes that are cls or derive from it.
+    // out_count = total; BufferTooSmall if it exceeds capacity.
+    EUikaErrorCode (*get_instances)(
+        UikaUClassHandle cls,
+        UikaUObjectHandle* out, uint32 capacity,
+        uint32* out_count);
+
+    // Hot-reload snapshot arena (plugin-owned, survives the DLL swap).
+    uint8* (*snapshot_alloc)(uint32 size);
+    const uint8* (*snapshot_data)(uint32* out_len);
+
+    // Schema registration
+    // Create, populate and finalize every class in a schema in one call.
+    // out_classes gets one handle per class (null where a class failed).
+    EUikaErrorCode (*register_class_from_schema)(
+        const uint8* blob, uint32 len,
+        UikaUClassHandle* out_classes, uint32 out_capacity);
+
+    // Class tick
+    // One tick function per world calling FUikaRustCallbacks::tick_class with
+    // every live instance of cls that has begun play (tick_group: ETickingGroup).
+    EUikaErrorCode (*enable_class_tick)(UikaUClassHandle cls, uint32 tick_group);
 };
+
+// build_widget_tree description flags / initializer selectors.
+constexpr uint32 UIKA_WIDGET_NODE_KEEP   = 1u << 0;
+constexpr uint8  UIKA_WIDGET_INIT_WIDGET = 0;
+constexpr uint8  UIKA_WIDGET_INIT_SLOT   = 1;
+constexpr uint8  UIKA_WIDGET_VALUE_RAW   = 0;
+constexpr uint8  UIKA_WIDGET_VALUE_TEXT  = 1;
+
 struct FUikaWidgetApi
 {
     // Create a UMG widget. owning_object should be a PlayerController, World, or GameInstance.
@@ -325,6 +681,104 @@ struct FUikaWidgetApi
 
     // Get the WidgetTree UObject from a UUserWidget.
     UikaUObjectHandle (*get_widget_tree)(UikaUObjectHandle user_widget);
+
+    // Declarative construction
+    // Build a whole hierarchy from a serialized description (layout documented
+    // in uika-ffi/src/widget_types.rs). Handles of UIKA_WIDGET_NODE_KEEP nodes
+    // go to out_handles in node order.
+    EUikaErrorCode (*build_widget_tree)(UikaUObjectHandle user_widget, const uint8* desc, uint32 desc_len,
+                                        UikaUObjectHandle* out_handles, uint32 out_capacity, uint32* out_count);
+};
+
+// One add/remove from the per-class actor index (FUikaWorldApi::get_actor_changes).
+// For removals actor is identity only and must not be dereferenced.
+struct FUikaActorChange
+{
+    UikaUObjectHandle actor;
+    uint32 added;           // 1 = added, 0 = removed
+    uint32 _pad;
+};
+
+constexpr uint32 UIKA_ASSET_LOAD_OK        = 0;
+constexpr uint32 UIKA_ASSET_LOAD_CANCELLED = 1;
+
+// Completion record of an async asset load, valid only during the callback.
+// objects[i] corresponds to the i-th requested path (null if it failed to load).
+struct FUikaAssetLoadResult
+{
+    uint64 request_id;
+    const UikaUObjectHandle* objects;
+    uint32 count;
+    uint32 status;          // UIKA_ASSET_LOAD_*
+};
+
+constexpr uint32 UIKA_MIRROR_PROPERTY  = 0;   // POD property at offset
+constexpr uint32 UIKA_MIRROR_TRANSFORM = 1;   // component-to-world, FUikaTransform
+constexpr uint32 UIKA_MIRROR_VELOCITY  = 2;   // velocity, FUikaVector
+
+struct FUikaMirrorColumn
+{
+    UikaFPropertyHandle prop;   // UIKA_MIRROR_PROPERTY only
+    uint32 kind;                // UIKA_MIRROR_*
+    uint32 offset;
+};
+
+// Snapshot s lives in buffers[s & 1] (s = *sequence). Per buffer: SoA columns
+// at column_offsets (16-byte aligned), then dirty and alive row bitsets (u64 words).
+struct FUikaMirrorView
+{
+    const uint8* buffers[2];
+    const uint64* sequence;
+    const uint32* column_offsets;
+    const uint32* column_sizes;
+    uint32 row_count;
+    uint32 column_count;
+    uint32 dirty_offset;
+    uint32 alive_offset;
+};
+
+constexpr uint32 UIKA_TRACE_LINE           = 0;   // single blocking line trace
+constexpr uint32 UIKA_TRACE_SWEEP_SPHERE   = 1;   // single blocking sphere sweep
+constexpr uint32 UIKA_TRACE_OVERLAP_SPHERE = 2;   // sphere overlap at start
+constexpr uint32 UIKA_TRACE_COMPLEX        = 1u << 0;
+
+struct FUikaTraceRequest
+{
+    FUikaVector start;
+    FUikaVector end;
+    UikaUObjectHandle ignore;   // actor to skip, may be null
+    uint32 kind;                // UIKA_TRACE_*
+    uint32 channel;             // ECollisionChannel
+    float radius;
+    uint32 flags;               // UIKA_TRACE_COMPLEX
+    uint64 _pad;
+};
+
+constexpr uint32 UIKA_TRACE_HIT_BLOCKING = 1u << 0;
+
+// Compact FHitResult / FOverlapResult; zeroed with count == 0 on no hit.
+struct FUikaTraceHit
+{
+    FUikaVector location;
+    FUikaVector normal;
+    UikaUObjectHandle actor;
+    UikaUObjectHandle component;
+    float distance;
+    float time;
+    uint32 count;               // overlaps: number of overlaps; traces: 0 or 1
+    uint32 flags;               // UIKA_TRACE_HIT_*
+};
+
+constexpr uint32 UIKA_TRACE_BATCH_OK        = 0;
+constexpr uint32 UIKA_TRACE_BATCH_CANCELLED = 1;
+
+// Completion record of an async trace batch, valid only during the callback.
+struct FUikaTraceBatchResult
+{
+    uint64 batch_id;
+    const FUikaTraceHit* hits;
+    uint32 count;
+    uint32 status;              // UIKA_TRACE_BATCH_*
 };
 
 struct FUikaWorldApi
@@ -349,6 +803,89 @@ struct FUikaWorldApi
     // Finish spawning a deferred actor (triggers BeginPlay).
     EUikaErrorCode (*finish_spawning)(UikaUObjectHandle actor,
         const uint8* transform_buf, uint32 transform_size);
+
+    // Per-class actor index (UUikaActorIndexSubsystem)
+    EUikaErrorCode (*get_actors_of_class_indexed)(UikaUObjectHandle world, UikaUClassHandle cls,
+        uint8* out_buf, uint32 buf_byte_size, uint32* out_count, uint64* out_generation);
+    // IndexOutOfRange: history since `since` was trimmed. BufferTooSmall:
+    // out_count holds the required capacity.
+    EUikaErrorCode (*get_actor_changes)(UikaUObjectHandle world, UikaUClassHandle cls,
+        uint64 since, FUikaActorChange* out_changes, uint32 capacity,
+        uint32* out_count, uint64* out_generation);
+
+    // Batched spawning. transforms holds count transform buffers of
+    // transform_stride bytes each (null = identity). out_handles gets one
+    // entry per transform, null where the spawn failed.
+    EUikaErrorCode (*spawn_actors_batch)(UikaUObjectHandle world, UikaUClassHandle cls,
+        const uint8* transforms, uint32 transform_stride, uint32 count,
+        UikaUObjectHandle owner, uint8 collision_method,
+        UikaUObjectHandle* out_handles, uint32* out_spawned);
+    EUikaErrorCode (*spawn_actors_deferred_batch)(UikaUObjectHandle world, UikaUClassHandle cls,
+        const uint8* transforms, uint32 transform_stride, uint32 count,
+        UikaUObjectHandle owner, UikaUObjectHandle instigator, uint8 collision_method,
+        UikaUObjectHandle* out_handles, uint32* out_spawned);
+    EUikaErrorCode (*finish_spawning_batch)(const UikaUObjectHandle* actors,
+        const uint8* transforms, uint32 transform_stride, uint32 count);
+
+    // Actor pooling (UUikaActorPoolSubsystem). Pools are keyed by exact class.
+    EUikaErrorCode (*pool_prewarm)(UikaUObjectHandle world, UikaUClassHandle cls,
+        uint32 count, uint32* out_spawned);
+    // out_reused is false when the pool was empty and a fresh actor was spawned.
+    EUikaErrorCode (*pool_acquire)(UikaUObjectHandle world, UikaUClassHandle cls,
+        const uint8* transform_buf, uint32 transform_size,
+        UikaUObjectHandle* out_actor, bool* out_reused);
+    EUikaErrorCode (*pool_release)(UikaUObjectHandle actor);
+    // Destroy pooled (inactive) actors of cls, or of every class if cls is null.
+    EUikaErrorCode (*pool_clear)(UikaUObjectHandle world, UikaUClassHandle cls, uint32* out_destroyed);
+
+    // Asynchronous asset loading (FStreamableManager). Completion calls
+    // invoke_delegate_callback(callback_id, (uint8*)&FUikaAssetLoadResult).
+    // cls may be null; results that are not cls are reported as null.
+    EUikaErrorCode (*load_object_async)(UikaUClassHandle cls, const uint8* path_utf8, uint32 path_len,
+        int32 priority, uint64 callback_id, uint64* out_request);
+    EUikaErrorCode (*load_objects_async)(UikaUClassHandle cls, const UikaStrView* paths, uint32 path_count,
+        int32 priority, uint64 callback_id, uint64* out_request);
+    // Fires the request's callback synchronously with UIKA_ASSET_LOAD_CANCELLED.
+    EUikaErrorCode (*cancel_async_load)(uint64 request);
+
+    // State mirrors: per-frame SoA snapshots filled by a tick function at tick_group.
+    EUikaErrorCode (*mirror_create)(UikaUObjectHandle world, const FUikaMirrorColumn* columns, uint32 column_count,
+        const UikaUObjectHandle* objs, uint32 obj_count, uint32 tick_group,
+        uint64* out_id, FUikaMirrorView* out_view);
+    // Reallocates the buffers; every row is dirty in the fresh snapshot.
+    EUikaErrorCode (*mirror_set_objects)(uint64 id, const UikaUObjectHandle* objs, uint32 obj_count,
+        FUikaMirrorView* out_view);
+    EUikaErrorCode (*mirror_destroy)(uint64 id);
+
+    // Batched collision queries. trace_batch runs synchronously into out_hits
+    // (one per request); trace_batch_async submits UWorld async traces and
+    // delivers an FUikaTraceBatchResult through invoke_delegate_callback the
+    // next frame. Cancelling fires the callback with UIKA_TRACE_BATCH_CANCELLED.
+    EUikaErrorCode (*trace_batch)(UikaUObjectHandle world, const FUikaTraceRequest* requests, uint32 count,
+        FUikaTraceHit* out_hits);
+    EUikaErrorCode (*trace_batch_async)(UikaUObjectHandle world, const FUikaTraceRequest* requests, uint32 count,
+        uint64 callback_id, uint64* out_batch);
+    EUikaErrorCode (*cancel_trace_batch)(uint64 batch);
+};
+
+// ---------------------------------------------------------------------------
+// Task API (any thread; task bodies call back into FUikaRustCallbacks)
+// ---------------------------------------------------------------------------
+
+struct FUikaTaskApi
+{
+    // Launch run_job(job) after every task in prereqs (unknown ids ignored).
+    // Returns a non-zero task id, or 0 if the Rust callbacks are unavailable.
+    uint64 (*launch)(uint64 job, const uint64* prereqs, uint32 prereq_count);
+    // timeout_ms == UINT32_MAX waits forever. Unknown ids count as completed.
+    bool (*wait)(uint64 task, uint32 timeout_ms);
+    bool (*is_completed)(uint64 task);
+    // Forget the id; the task still runs to completion.
+    void (*release)(uint64 task);
+    // run_job_range(job, begin, end) over 0..count in chunks of >= min_batch; blocks until done.
+    void (*parallel_for)(uint64 job, uint32 count, uint32 min_batch);
+    uint32 (*worker_count)();
+    bool (*is_game_thread)();
 };
 
 // ---------------------------------------------------------------------------
@@ -370,6 +907,7 @@ struct FUikaApiTable
     const FUikaWorldApi*        world;
     const FUikaLoggingApi*      logging;
     const FUikaWidgetApi*       widget;
+    const FUikaTaskApi*         task;
 
     // Generated function-pointer array
     const void* const*          func_table;
@@ -380,14 +918,58 @@ struct FUikaApiTable
 // Rust callback table (returned by uika_init)
 // ---------------------------------------------------------------------------
 
+// One destroyed reified-class instance, delivered in batches by
+// FUikaRustCallbacks::drop_rust_instances.
+struct FUikaDeadInstance
+{
+    UikaUObjectHandle handle;
+    uint64 type_id;
+};
+
+// One instance in a tick_class batch (data: the object's Rust instance slot).
+struct FUikaTickInstance
+{
+    UikaUObjectHandle handle;
+    void* data;
+};
+
 struct FUikaRustCallbacks
 {
     void (*drop_rust_instance)(UikaUObjectHandle handle, uint64 type_id, uint8* rust_data);
-    void (*invoke_rust_function)(uint64 callback_id, UikaUObjectHandle obj, uint8* params);
+    void (*invoke_rust_function)(uint64 callback_id, UikaUObjectHandle obj, void* rust_data, uint8* params);
     void (*invoke_delegate_callback)(uint64 callback_id, uint8* params);
     void (*on_shutdown)();
-    void (*construct_rust_instance)(UikaUObjectHandle obj, uint64 type_id, bool is_cdo);
+    // Returns the Rust instance data pointer, stored in the object's slot
+    // (UUikaReifiedClass::SetRustData).
+    void* (*construct_rust_instance)(UikaUObjectHandle obj, uint64 type_id, bool is_cdo);
     void (*notify_pinned_destroyed)(UikaUObjectHandle handle);
+
+    // Batched destroy notifications, called once per GC purge by the object tracker.
+    void (*drop_rust_instances)(const FUikaDeadInstance* entries, uint32 count);
+    void (*notify_pinned_destroyed_many)(const UikaUObjectHandle* handles, uint32 count);
+
+    // Hot-reload state preservation around TeardownReifiedInstances /
+    // ReconstructReifiedInstances. Both return the number of instances handled.
+    uint32 (*snapshot_rust_instances)();
+    uint32 (*restore_rust_instances)();
+
+    // Actor pooling: a reified actor left or re-entered play through the pool.
+    // Replaces drop_rust_instance / construct_rust_instance for that cycle.
+    void (*on_pool_release)(UikaUObjectHandle handle, uint64 type_id);
+    void (*on_pool_acquire)(UikaUObjectHandle handle, uint64 type_id);
+
+    // Uika.Stats: log the top_n FFI entries by time and call count, then
+    // optionally reset the counters (a notice when built without ffi-stats).
+    void (*dump_ffi_stats)(uint32 top_n, bool reset);
+
+    // Jobs: task body for FUikaTaskApi::launch, one chunk of parallel_for,
+    // and the per-frame game-thread continuation drain (OnBeginFrame).
+    void (*run_job)(uint64 job);
+    void (*run_job_range)(uint64 job, uint32 begin, uint32 end);
+    void (*drain_game_thread_queue)();
+
+    // Class tick (reify.enable_class_tick): all instances due this frame.
+    void (*tick_class)(uint64 type_id, FUikaTickInstance* instances, uint32 count, float delta_seconds);
 };
 
 // ---------------------------------------------------------------------------
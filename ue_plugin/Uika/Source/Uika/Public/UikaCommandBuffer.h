@@ -0,0 +1,46 @@
+// Slot readers for generated command-buffer thunks (UikaCmd_*).
+// Record layout: uika-ffi/src/command_types.rs. The executor has already
+// checked the header; thunks check that their slots and payloads fit.
+#pragma once
+#include "UikaApiTable.h"
+
+// Target object of a record.
+static inline void* UikaCmdObject(const uint8_t* Record)
+{
+    FUikaCommandHeader Header;
+    FMemory::Memcpy(&Header, Record, sizeof(Header));
+    return Header.obj.ptr;
+}
+
+// True if the record is large enough for SlotCount argument slots.
+static inline bool UikaCmdHasSlots(uint32_t Size, uint32_t SlotCount)
+{
+    return Size >= sizeof(FUikaCommandHeader) + SlotCount * UIKA_CMD_SLOT_SIZE;
+}
+
+// Scalar argument stored in the low bytes of slot Index.
+template <typename T>
+static inline T UikaCmdScalar(const uint8_t* Record, uint32_t Index)
+{
+    static_assert(sizeof(T) <= UIKA_CMD_SLOT_SIZE, "command slot holds at most 8 bytes");
+    T Value;
+    FMemory::Memcpy(&Value, Record + sizeof(FUikaCommandHeader) + Index * UIKA_CMD_SLOT_SIZE, sizeof(T));
+    return Value;
+}
+
+// Struct/string argument: slot Index holds offset | (len << 32). Fails if the
+// payload lies outside the record or is shorter than MinLen.
+static inline bool UikaCmdPayload(const uint8_t* Record, uint32_t Size, uint32_t Index, uint32_t MinLen,
+    const uint8_t*& OutPtr, uint32_t& OutLen)
+{
+    const uint64 Packed = UikaCmdScalar<uint64>(Record, Index);
+    const uint32 Offset = static_cast<uint32>(Packed);
+    const uint32 Len = static_cast<uint32>(Packed >> 32);
+    if (Offset > Size || Len > Size - Offset || Len < MinLen)
+    {
+        return false;
+    }
+    OutPtr = Record + Offset;
+    OutLen = Len;
+    return true;
+}
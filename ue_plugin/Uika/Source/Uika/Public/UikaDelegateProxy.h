@@ -5,11 +5,18 @@
 #include "UikaDelegateProxy.generated.h"
 
 struct FUikaRustCallbacks;
+class FProperty;
 
 // Proxy UObject that bridges UE delegates to Rust closures.
 // Uses the FakeFuncName mechanism: the proxy is bound to a delegate via
 // BindUFunction(Proxy, FakeFuncName). When the delegate fires, UE calls
 // ProcessEvent on this proxy, which forwards to the Rust callback registry.
+//
+// Proxies are owned by the delegate API's proxy pool (UikaDelegateApiImpl.cpp):
+// they live in the transient package, are indexed by owner + property +
+// CallbackId while bound, and are reset and recycled on unbind instead of being
+// left for GC. A released proxy is not rebound before the next frame, so a
+// stale delegate copy firing it is ignored rather than reaching a new callback.
 UCLASS()
 class UUikaDelegateProxy : public UObject
 {
@@ -17,15 +24,25 @@ class UUikaDelegateProxy : public UObject
 
 public:
     // Rust-side callback ID (indexes into the delegate registry).
+    // 0 while the proxy sits in the pool; invocations are ignored.
     uint64 CallbackId = 0;
 
+    // Queued binding: fires are copied into the delegate API's event queue
+    // and delivered when Rust drains it, instead of invoking Rust inline.
+    bool bQueued = false;
+
     // The signature UFunction of the delegate this proxy is bound to.
     // Used by UE to validate parameter compatibility.
     UFunction* Signature = nullptr;
 
+    // The delegate property of OwnerObject this proxy is bound to; part of
+    // the pool's index key.
+    const FProperty* BoundProperty = nullptr;
+
     // Weak reference to the object that owns this delegate binding.
+    // Weak so that a pooled (GC-referenced) proxy never keeps its owner alive.
     UPROPERTY()
-    TObjectPtr<UObject> OwnerObject;
+    TWeakObjectPtr<UObject> OwnerObject;
 
     // The FName used for BindUFunction — must match a UFUNCTION on this class.
     static FName FakeFuncName;
@@ -34,6 +51,9 @@ public:
     UFUNCTION()
     void RustFakeCallable();
 
+    // Clear the binding state before the proxy is returned to the pool.
+    void ResetForPool();
+
     // Override ProcessEvent to intercept delegate invocations.
     virtual void ProcessEvent(UFunction* Function, void* Parms) override;
 };
@@ -3,6 +3,7 @@
 // so reinterpret_cast<FName*>(&uint64) is UB and reads past the 8-byte handle.
 #pragma once
 #include "UObject/NameTypes.h"
+#include "Misc/StringBuilder.h"
 
 static inline FName UikaUnpackFName(uint64_t Packed)
 {
@@ -16,3 +17,49 @@ static inline uint64_t UikaPackFName(const FName& Name)
     return static_cast<uint64>(Name.GetComparisonIndex().ToUnstableInt())
          | (static_cast<uint64>(Name.GetNumber()) << 32);
 }
+
+// Build an FName from a UTF-8 slice without an intermediate FString.
+// Pure-ASCII input (tags, sockets, section names) goes straight to the ANSI
+// constructor; anything else is widened into a stack buffer.
+static inline FName UikaUtf8ToFName(const uint8* Utf8, uint32 Len)
+{
+    if (!Utf8 || Len == 0)
+    {
+        return NAME_None;
+    }
+    for (uint32 i = 0; i < Len; ++i)
+    {
+        if (Utf8[i] & 0x80)
+        {
+            const auto Wide = StringCast<TCHAR>(reinterpret_cast<const UTF8CHAR*>(Utf8), static_cast<int32>(Len));
+            return FName(Wide.Length(), Wide.Get());
+        }
+    }
+    return FName(static_cast<int32>(Len), reinterpret_cast<const ANSICHAR*>(Utf8));
+}
+
+// Write an FName as UTF-8 into Buf (truncated to BufLen) and return the full
+// UTF-8 length. Uses stack builders only; ANSI names are copied verbatim.
+static inline uint32 UikaFNameToUtf8(const FName& Name, uint8* Buf, uint32 BufLen)
+{
+    TAnsiStringBuilder<256> Ansi;
+    if (Name.TryAppendAnsiString(Ansi))
+    {
+        const uint32 Len = static_cast<uint32>(Ansi.Len());
+        if (Buf && BufLen > 0)
+        {
+            FMemory::Memcpy(Buf, Ansi.GetData(), FMath::Min(Len, BufLen));
+        }
+        return Len;
+    }
+
+    TStringBuilder<256> Wide;
+    Name.AppendString(Wide);
+    const auto Utf8 = StringCast<UTF8CHAR>(Wide.GetData(), Wide.Len());
+    const uint32 Len = static_cast<uint32>(Utf8.Length());
+    if (Buf && BufLen > 0)
+    {
+        FMemory::Memcpy(Buf, Utf8.Get(), FMath::Min(Len, BufLen));
+    }
+    return Len;
+}
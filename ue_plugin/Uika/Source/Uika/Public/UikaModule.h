@@ -1,9 +1,22 @@
 #pragma once
 
 #include "Modules/ModuleManager.h"
+#include "Containers/Ticker.h"
+#include "Async/Future.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogUika, Log, All);
 
+/** A hot-copy of the Rust DLL, staged (and optionally pre-loaded) for a swap. */
+struct FUikaStagedDll
+{
+    FString Path;
+    /** Pre-loaded module handle, or null to load at swap time. */
+    void* Handle = nullptr;
+    /** Timestamp of DllSourcePath when the copy was taken. */
+    FDateTime SourceTimestamp;
+    bool bOk = false;
+};
+
 class FUikaModule : public IModuleInterface
 {
 public:
@@ -22,11 +35,33 @@ private:
 
     /** Reconstruct Rust instance data for all reified objects. */
     void ReconstructReifiedInstances();
+
+    /** Serialize opted-in Rust instance data into the snapshot arena (before teardown). */
+    void SnapshotReifiedInstances();
+
+    /** Restore Rust instance data from the snapshot arena, then release it (after reconstruct). */
+    void RestoreReifiedInstances();
+
     /** Unload the Rust DLL (teardown phase of reload, and used by ShutdownModule). */
     void UnloadRustDll();
 
-    /** Load a Rust DLL from the given path and initialize it. */
-    bool LoadRustDll(const FString& LoadPath);
+    /** Load a Rust DLL from the given path (or adopt a pre-loaded handle) and initialize it. */
+    bool LoadRustDll(const FString& LoadPath, void* PreloadedHandle = nullptr);
+
+    /** Next uika_hot_N.dll path for copy-on-load. */
+    FString MakeHotDllPath();
+
+    /** Replace the loaded DLL with a staged one: snapshot/teardown, unload, init, reconstruct/restore. */
+    void SwapToStagedDll(const FUikaStagedDll& Staged);
+
+    /** Core ticker: poll DllSourcePath, stage new builds off-thread, swap when staged. */
+    bool TickDllWatcher(float DeltaTime);
+
+    /** Start copying (and optionally pre-loading) the current build on a worker thread. */
+    void BeginStaging();
+
+    /** Wait for in-flight staging and discard its result. */
+    void CancelStaging();
 
     void* DllHandle = nullptr;
     const struct FUikaRustCallbacks* RustCallbacks = nullptr;
@@ -39,4 +74,14 @@ private:
 
     /** Incrementing counter for copy-on-reload filenames. */
     int32 ReloadCount = 0;
+
+    /** DLL watcher state (Uika.HotReload.Watch). */
+    FTSTicker::FDelegateHandle WatcherTickHandle;
+    TFuture<FUikaStagedDll> StagingFuture;
+    /** Source timestamp of the build currently loaded. */
+    FDateTime LoadedSourceTimestamp;
+    /** Timestamp seen on the previous poll; staging starts once it holds still. */
+    FDateTime PendingSourceTimestamp;
+    /** Build that failed to stage or load; not retried until it changes. */
+    FDateTime FailedSourceTimestamp;
 };
@@ -0,0 +1,12 @@
+// Unreal Insights scopes around the entry points into Rust, on a dedicated
+// "Uika" trace channel (record with -trace=cpu,uika). Per-entry FFI counters
+// for the other direction live on the Rust side (ffi-stats, Uika.Stats).
+#pragma once
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+#if CPUPROFILERTRACE_ENABLED
+UE_TRACE_CHANNEL_EXTERN(UikaChannel)
+#define UIKA_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Name, UikaChannel)
+#else
+#define UIKA_TRACE_SCOPE(Name)
+#endif
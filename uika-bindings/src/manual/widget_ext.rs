@@ -45,3 +45,14 @@ pub fn get_widget_tree(
     let handle = user_widget.checked()?.raw();
     uika_runtime::widget::get_widget_tree_raw(handle)
 }
+
+/// Build a whole widget hierarchy under `user_widget` in one FFI call and
+/// install it as the root. Returns the handles of the nodes marked with
+/// `WidgetTreeDesc::keep`, in node order.
+pub fn build_widget_tree(
+    user_widget: &UObjectRef<impl UeClass>,
+    desc: &uika_runtime::widget::WidgetTreeDesc,
+) -> UikaResult<Vec<uika_ffi::UObjectHandle>> {
+    let handle = user_widget.checked()?.raw();
+    uika_runtime::widget::build_widget_tree_raw(handle, desc)
+}
@@ -1,6 +1,8 @@
 // Type-safe gameplay wrappers on top of uika_runtime::world raw functions.
 
-use uika_runtime::{OwnedStruct, UObjectRef, UeClass, UikaResult};
+use uika_ffi::{UikaTraceHit, UikaTraceRequest};
+use uika_runtime::world::{ActorChange, TraceBatch};
+use uika_runtime::{OwnedStruct, Pinned, UObjectRef, UeClass, UikaResult};
 
 use crate::core_ue::FTransform;
 use crate::engine::{Actor, ActorExt, World};
@@ -33,6 +35,23 @@ fn warn_no_root_component(handle: uika_ffi::UObjectHandle) {
     }
 }
 
+/// Concatenate transforms into one batch buffer; returns it with the stride.
+fn pack_transforms(transforms: &[OwnedStruct<FTransform>]) -> (Vec<u8>, usize) {
+    let stride = transforms.first().map_or(0, |t| t.as_bytes().len());
+    let mut packed = Vec::with_capacity(stride * transforms.len());
+    for transform in transforms {
+        packed.extend_from_slice(transform.as_bytes());
+    }
+    (packed, stride)
+}
+
+fn wrap_spawned<T: UeClass>(handles: Vec<uika_ffi::UObjectHandle>) -> Vec<Option<UObjectRef<T>>> {
+    handles
+        .into_iter()
+        .map(|h| (!h.is_null()).then(|| unsafe { UObjectRef::from_raw(h) }))
+        .collect()
+}
+
 /// Collision handling method for spawn operations.
 /// Maps to UE's `ESpawnActorCollisionHandlingMethod`.
 #[repr(u8)]
@@ -78,7 +97,44 @@ pub trait WorldSpawnExt {
         transform: &OwnedStruct<FTransform>,
     ) -> UikaResult<()>;
 
+    /// Spawn one `T` per transform in a single FFI call. Entries are `None`
+    /// where the spawn failed.
+    fn spawn_actors<T: UeClass>(
+        &self,
+        transforms: &[OwnedStruct<FTransform>],
+        collision_method: SpawnCollisionMethod,
+    ) -> UikaResult<Vec<Option<UObjectRef<T>>>>;
+
+    /// Spawn one deferred `T` per transform, call `init(index, actor)` on each,
+    /// then finish spawning them all (BeginPlay runs after every `init`).
+    fn spawn_actors_deferred<T: UeClass>(
+        &self,
+        transforms: &[OwnedStruct<FTransform>],
+        collision_method: SpawnCollisionMethod,
+        init: impl FnMut(usize, UObjectRef<T>),
+    ) -> UikaResult<Vec<Option<UObjectRef<T>>>>;
+
+    /// Spawn `count` inactive `T` actors into this world's actor pool.
+    fn pool_prewarm<T: UeClass>(&self, count: u32) -> UikaResult<u32>;
+
+    /// Take a `T` from the actor pool (spawning one if it is empty) and place
+    /// it at `transform`. Give it back with [`pool_release`].
+    fn pool_acquire<T: UeClass>(
+        &self,
+        transform: &OwnedStruct<FTransform>,
+    ) -> UikaResult<UObjectRef<T>>;
+
     fn get_all_actors_of_class<T: UeClass>(&self) -> UikaResult<Vec<UObjectRef<T>>>;
+
+    /// All actors of `T` plus the actor index generation they reflect.
+    fn get_actors_of_class_indexed<T: UeClass>(&self) -> UikaResult<(Vec<UObjectRef<T>>, u64)>;
+
+    /// Actors of `T` added/removed after generation `since`, and the current
+    /// generation. `None` means the history is gone; re-query the full set.
+    fn actor_changes<T: UeClass>(
+        &self,
+        since: u64,
+    ) -> UikaResult<Option<(Vec<ActorChange>, u64)>>;
 }
 
 impl WorldSpawnExt for UObjectRef<World> {
@@ -156,6 +212,63 @@ impl WorldSpawnExt for UObjectRef<World> {
         uika_runtime::world::finish_spawning_raw(actor_handle, &transform.to_bytes())
     }
 
+    fn spawn_actors<T: UeClass>(
+        &self,
+        transforms: &[OwnedStruct<FTransform>],
+        collision_method: SpawnCollisionMethod,
+    ) -> UikaResult<Vec<Option<UObjectRef<T>>>> {
+        let world = self.checked()?.raw();
+        let (packed, stride) = pack_transforms(transforms);
+        let handles = uika_runtime::world::spawn_actors_batch_raw(
+            world,
+            T::static_class(),
+            &packed,
+            stride,
+            transforms.len(),
+            uika_ffi::UObjectHandle::null(),
+            collision_method as u8,
+        )?;
+        Ok(wrap_spawned(handles))
+    }
+
+    fn spawn_actors_deferred<T: UeClass>(
+        &self,
+        transforms: &[OwnedStruct<FTransform>],
+        collision_method: SpawnCollisionMethod,
+        mut init: impl FnMut(usize, UObjectRef<T>),
+    ) -> UikaResult<Vec<Option<UObjectRef<T>>>> {
+        let world = self.checked()?.raw();
+        let (packed, stride) = pack_transforms(transforms);
+        let null = uika_ffi::UObjectHandle::null();
+        let handles = uika_runtime::world::spawn_actors_deferred_batch_raw(
+            world,
+            T::static_class(),
+            &packed,
+            stride,
+            transforms.len(),
+            null,
+            null,
+            collision_method as u8,
+            |index, handle| init(index, unsafe { UObjectRef::from_raw(handle) }),
+        )?;
+        Ok(wrap_spawned(handles))
+    }
+
+    fn pool_prewarm<T: UeClass>(&self, count: u32) -> UikaResult<u32> {
+        let world = self.checked()?.raw();
+        uika_runtime::world::pool_prewarm_raw(world, T::static_class(), count)
+    }
+
+    fn pool_acquire<T: UeClass>(
+        &self,
+        transform: &OwnedStruct<FTransform>,
+    ) -> UikaResult<UObjectRef<T>> {
+        let world = self.checked()?.raw();
+        let (handle, _reused) =
+            uika_runtime::world::pool_acquire_raw(world, T::static_class(), transform.as_bytes())?;
+        Ok(unsafe { UObjectRef::from_raw(handle) })
+    }
+
     fn get_all_actors_of_class<T: UeClass>(&self) -> UikaResult<Vec<UObjectRef<T>>> {
         let world = self.checked()?.raw();
         let class = T::static_class();
@@ -165,6 +278,59 @@ impl WorldSpawnExt for UObjectRef<World> {
             .map(|h| unsafe { UObjectRef::from_raw(h) })
             .collect())
     }
+
+    fn get_actors_of_class_indexed<T: UeClass>(&self) -> UikaResult<(Vec<UObjectRef<T>>, u64)> {
+        let world = self.checked()?.raw();
+        let class = T::static_class();
+        let (handles, generation) =
+            uika_runtime::world::get_actors_of_class_indexed_raw(world, class)?;
+        let actors = handles
+            .into_iter()
+            .map(|h| unsafe { UObjectRef::from_raw(h) })
+            .collect();
+        Ok((actors, generation))
+    }
+
+    fn actor_changes<T: UeClass>(
+        &self,
+        since: u64,
+    ) -> UikaResult<Option<(Vec<ActorChange>, u64)>> {
+        let world = self.checked()?.raw();
+        uika_runtime::world::actor_changes_raw(world, T::static_class(), since)
+    }
+}
+
+/// Extension trait for batched collision queries in a UWorld.
+///
+/// Build requests with `UikaTraceRequest::line` / `sweep_sphere` /
+/// `overlap_sphere`; `channel` is an `ECollisionChannel` value. Every call
+/// runs the whole batch in one crossing and returns compact
+/// [`UikaTraceHit`]s instead of `FHitResult` structs.
+pub trait WorldTraceExt {
+    /// Run the queries now, refilling `hits` with one result per request.
+    fn trace_batch(&self, requests: &[UikaTraceRequest], hits: &mut Vec<UikaTraceHit>) -> UikaResult<()>;
+
+    /// Submit the queries as async traces. The returned batch resolves during
+    /// the next world tick; the physics work runs off the game thread.
+    fn trace_batch_async(&self, requests: &[UikaTraceRequest]) -> UikaResult<TraceBatch>;
+}
+
+impl WorldTraceExt for UObjectRef<World> {
+    fn trace_batch(&self, requests: &[UikaTraceRequest], hits: &mut Vec<UikaTraceHit>) -> UikaResult<()> {
+        let world = self.checked()?.raw();
+        uika_runtime::world::trace_batch_raw(world, requests, hits)
+    }
+
+    fn trace_batch_async(&self, requests: &[UikaTraceRequest]) -> UikaResult<TraceBatch> {
+        let world = self.checked()?.raw();
+        uika_runtime::world::trace_batch_async_raw(world, requests)
+    }
+}
+
+/// Deactivate `actor` and return it to its world's actor pool instead of
+/// destroying it.
+pub fn pool_release(actor: &UObjectRef<impl UeClass>) -> UikaResult<()> {
+    uika_runtime::world::pool_release_raw(actor.checked()?.raw())
 }
 
 /// Find an already-loaded object by class and path.
@@ -181,6 +347,28 @@ pub fn load_object<T: UeClass>(path: &str) -> UikaResult<UObjectRef<T>> {
     Ok(unsafe { UObjectRef::from_raw(handle) })
 }
 
+/// Load an object by class and path without blocking the game thread.
+///
+/// The returned future resolves once FStreamableManager has finished loading;
+/// dropping it before then cancels the load. The object is pinned, since
+/// nothing else keeps a freshly streamed asset from being collected.
+pub fn load_object_async<T: UeClass>(
+    path: &str,
+    priority: i32,
+) -> UikaResult<impl std::future::Future<Output = UikaResult<Pinned<T>>>> {
+    let load = uika_runtime::world::load_object_async_raw(T::static_class(), path, priority)?;
+    let path = path.to_owned();
+    Ok(async move {
+        let assets = load.await?;
+        match assets.first() {
+            Some(h) if !h.is_null() => Pinned::new(unsafe { UObjectRef::from_raw(*h) }),
+            _ => Err(uika_runtime::UikaError::InvalidOperation(format!(
+                "load_object_async: failed to load: {path}"
+            ))),
+        }
+    })
+}
+
 /// Create a new UObject of the given class, parented to `outer`.
 pub fn new_object<T: UeClass>(outer: &UObjectRef<impl UeClass>) -> UikaResult<UObjectRef<T>> {
     let outer_handle = outer.checked()?.raw();
@@ -134,6 +134,9 @@ struct BuildContext {
     crate_path: Option<PathBuf>,
     /// Extra features for `cargo build` (from `[build].features`).
     features: Vec<String>,
+    /// Used-symbols manifest and the directories scanned to produce it
+    /// (from `[codegen.prune]`).
+    prune: Option<(PathBuf, Vec<PathBuf>)>,
 }
 
 impl BuildContext {
@@ -178,6 +181,24 @@ impl BuildContext {
             .map(|b| b.features.clone())
             .unwrap_or_default();
 
+        let prune = config.codegen.prune.as_ref().and_then(|prune| {
+            let mut dirs: Vec<PathBuf> = if prune.scan.is_empty() {
+                crate_path.iter().cloned().collect()
+            } else {
+                prune.scan.iter().map(|d| config_dir.join(d)).collect()
+            };
+            if dirs.is_empty() {
+                eprintln!(
+                    "Warning: [codegen.prune] has no scan directories and [build].crate_path \
+                     is not set; the used-symbols manifest will not be refreshed."
+                );
+                return None;
+            }
+            // Hand-written extensions inside uika-bindings call generated code too.
+            dirs.push(config_dir.join(&config.codegen.paths.rust_out).join("manual"));
+            Some((config_dir.join(&prune.manifest), dirs))
+        });
+
         BuildContext {
             engine_path,
             project_path,
@@ -187,6 +208,7 @@ impl BuildContext {
             config_dir: config_dir.to_path_buf(),
             crate_path,
             features,
+            prune,
         }
     }
 
@@ -275,8 +297,19 @@ impl BuildContext {
         );
     }
 
-    /// Step 2: Run codegen (in-process).
+    /// Step 2: Run codegen (in-process). With pruning configured, the
+    /// used-symbols manifest is rewritten from the game sources first.
     fn step2_codegen(&self) {
+        if let Some((manifest, dirs)) = &self.prune {
+            let dirs: Vec<&Path> = dirs.iter().map(PathBuf::as_path).collect();
+            let idents = uika_codegen::usage::scan_identifiers(&dirs);
+            uika_codegen::usage::write_manifest(manifest, &idents);
+            eprintln!(
+                "  Scanned {} identifiers into {}",
+                idents.len(),
+                manifest.display()
+            );
+        }
         uika_codegen::run_generate(&self.config_path);
     }
 
@@ -54,6 +54,13 @@ MovieSceneTracks = { module = "movie_scene_tracks", feature = "movie" }
 classes = []
 structs = []
 functions = []
+
+# Emit only the functions the game crate calls. `uika build` rescans the
+# sources before codegen and rewrites the manifest.
+# [codegen.prune]
+# manifest = "generated/used_symbols.txt"
+# scan = ["my-game/src"]
+# keep = []
 "##;
 
 /// Stub UikaFuncIds.h — empty namespace with FUNC_COUNT = 0.
@@ -81,10 +88,16 @@ void UikaFillFuncTable() {}
 
 static void* GUikaFuncTable[1]; // placeholder (FUNC_COUNT == 0)
 
+static void* GUikaCmdTable[1]; // placeholder: no recordable functions
+
 void** UikaGetFuncTable() {
     return GUikaFuncTable;
 }
 
+void** UikaGetCmdTable() {
+    return GUikaCmdTable;
+}
+
 uint32_t UikaGetFuncCount() {
     return 0;
 }
@@ -51,6 +51,28 @@ pub struct CodegenConfig {
     pub paths: CodegenPaths,
     pub modules: HashMap<String, ModuleMapping>,
     pub blocklist: Blocklist,
+    /// Usage-driven pruning of the function table. Off when omitted.
+    #[serde(default)]
+    pub prune: Option<PruneConfig>,
+    /// Merge per-class wrapper files into unity files of roughly this many
+    /// functions each (per module). Off when omitted or 0.
+    #[serde(default)]
+    pub unity_chunk_functions: Option<usize>,
+}
+
+#[derive(Deserialize)]
+pub struct PruneConfig {
+    /// Used-symbols manifest (relative to config file location). Written by
+    /// `uika build` before codegen; if it does not exist yet, nothing is pruned.
+    pub manifest: String,
+    /// Source directories scanned for identifiers (relative to config file
+    /// location). Defaults to `[build].crate_path`. The `manual/` directory
+    /// next to the generated bindings is always scanned.
+    #[serde(default)]
+    pub scan: Vec<String>,
+    /// Functions kept regardless of usage, in "Class.Function" format.
+    #[serde(default)]
+    pub keep: Vec<String>,
 }
 
 #[derive(Deserialize)]
@@ -2,13 +2,15 @@
 
 use std::collections::BTreeMap;
 
-use crate::context::FuncEntry;
-use crate::cpp_gen::wrapper::cpp_wrapper_name;
+use crate::context::{CodegenContext, FuncEntry};
+use crate::cpp_gen::wrapper::{cpp_command_thunk_name, cpp_wrapper_name};
+use crate::type_map::is_command_eligible;
 
 /// Generate the UikaFillFuncTable.cpp file.
 pub fn generate_fill_table(
     entries: &[FuncEntry],
     _by_class: &BTreeMap<(String, String), Vec<&FuncEntry>>,
+    ctx: &CodegenContext,
 ) -> String {
     let mut out = String::with_capacity(entries.len() * 80 + 1024);
 
@@ -20,6 +22,10 @@ pub fn generate_fill_table(
     for entry in entries {
         let c_name = cpp_wrapper_name(&entry.class_name, &entry.func_name);
         out.push_str(&format!("extern \"C\" uint32_t {c_name}(...);\n"));
+        if is_command_eligible(&entry.func, ctx) {
+            let thunk = cpp_command_thunk_name(&entry.class_name, &entry.func_name);
+            out.push_str(&format!("extern \"C\" uint32_t {thunk}(const uint8_t* Record, uint32_t Size);\n"));
+        }
     }
     out.push('\n');
 
@@ -28,6 +34,9 @@ pub fn generate_fill_table(
         "static void* GUikaFuncTable[UikaFuncId::FUNC_COUNT];\n\n"
     ));
 
+    // Command-buffer thunks, null for functions that cannot be recorded
+    out.push_str("static void* GUikaCmdTable[UikaFuncId::FUNC_COUNT];\n\n");
+
     // Fill function
     out.push_str("void UikaFillFuncTable() {\n");
     for entry in entries {
@@ -37,6 +46,12 @@ pub fn generate_fill_table(
         out.push_str(&format!(
             "    GUikaFuncTable[UikaFuncId::{const_name}] = (void*)&{c_name};\n"
         ));
+        if is_command_eligible(&entry.func, ctx) {
+            let thunk = cpp_command_thunk_name(&entry.class_name, &entry.func_name);
+            out.push_str(&format!(
+                "    GUikaCmdTable[UikaFuncId::{const_name}] = (void*)&{thunk};\n"
+            ));
+        }
     }
     out.push_str("}\n\n");
 
@@ -45,6 +60,10 @@ pub fn generate_fill_table(
     out.push_str("    return GUikaFuncTable;\n");
     out.push_str("}\n\n");
 
+    out.push_str("void** UikaGetCmdTable() {\n");
+    out.push_str("    return GUikaCmdTable;\n");
+    out.push_str("}\n\n");
+
     out.push_str(&format!(
         "uint32_t UikaGetFuncCount() {{\n    return UikaFuncId::FUNC_COUNT;\n}}\n"
     ));
@@ -4,17 +4,20 @@ pub mod wrapper;
 pub mod func_ids;
 pub mod fill_table;
 
-use std::collections::BTreeMap;
+use std::collections::{BTreeMap, HashSet};
 use std::path::Path;
 
-use crate::context::CodegenContext;
+use crate::context::{CodegenContext, FuncEntry};
 
 /// Generate all C++ code into the output directory.
-pub fn generate(ctx: &CodegenContext, out_dir: &Path) {
+///
+/// `unity_chunk_functions` merges each module's wrapper files into unity
+/// files of roughly that many functions.
+pub fn generate(ctx: &CodegenContext, out_dir: &Path, unity_chunk_functions: Option<usize>) {
     std::fs::create_dir_all(out_dir).expect("Failed to create C++ output directory");
 
     // Group func entries by (module, class) for per-file generation
-    let mut by_class: BTreeMap<(String, String), Vec<&crate::context::FuncEntry>> = BTreeMap::new();
+    let mut by_class: BTreeMap<(String, String), Vec<&FuncEntry>> = BTreeMap::new();
     for entry in &ctx.func_table {
         by_class
             .entry((entry.module_name.clone(), entry.class_name.clone()))
@@ -22,21 +25,70 @@ pub fn generate(ctx: &CodegenContext, out_dir: &Path) {
             .push(entry);
     }
 
-    // Generate per-class wrapper files
-    for ((module, class), entries) in &by_class {
-        let code = wrapper::generate_wrapper_file(entries, ctx);
-        let filename = format!("UikaFunc_{}_{}.cpp", module, class);
-        std::fs::write(out_dir.join(&filename), code)
-            .unwrap_or_else(|e| panic!("Failed to write {filename}: {e}"));
+    // Generate wrapper files: one per class, or unity files of several
+    // classes per module when unity_chunk_functions is set
+    let mut written: HashSet<String> = HashSet::new();
+    match unity_chunk_functions.filter(|&n| n > 0) {
+        None => {
+            for ((module, class), entries) in &by_class {
+                let filename = format!("UikaFunc_{}_{}.cpp", module, class);
+                write_wrapper_file(out_dir, &filename, entries, ctx);
+                written.insert(filename);
+            }
+        }
+        Some(chunk_functions) => {
+            let mut by_module: BTreeMap<&str, Vec<&Vec<&FuncEntry>>> = BTreeMap::new();
+            for ((module, _), entries) in &by_class {
+                by_module.entry(module.as_str()).or_default().push(entries);
+            }
+            for (module, classes) in by_module {
+                // Classes are never split, so a chunk may overshoot the target.
+                let mut chunk: Vec<&FuncEntry> = Vec::new();
+                let mut index = 0;
+                for (i, entries) in classes.iter().enumerate() {
+                    chunk.extend(entries.iter().copied());
+                    if chunk.len() >= chunk_functions || i + 1 == classes.len() {
+                        let filename = format!("UikaFunc_{module}_Unity{index}.cpp");
+                        write_wrapper_file(out_dir, &filename, &chunk, ctx);
+                        written.insert(filename);
+                        chunk.clear();
+                        index += 1;
+                    }
+                }
+            }
+        }
     }
 
+    // Drop wrapper files from earlier runs (pruned classes, other unity
+    // layout) so UBT does not compile stale duplicates
+    remove_stale_wrapper_files(out_dir, &written);
+
     // Generate UikaFuncIds.h
     let ids_code = func_ids::generate_cpp_func_ids(&ctx.func_table);
     std::fs::write(out_dir.join("UikaFuncIds.h"), ids_code)
         .expect("Failed to write UikaFuncIds.h");
 
     // Generate UikaFillFuncTable.cpp
-    let fill_code = fill_table::generate_fill_table(&ctx.func_table, &by_class);
+    let fill_code = fill_table::generate_fill_table(&ctx.func_table, &by_class, ctx);
     std::fs::write(out_dir.join("UikaFillFuncTable.cpp"), fill_code)
         .expect("Failed to write UikaFillFuncTable.cpp");
 }
+
+fn write_wrapper_file(out_dir: &Path, filename: &str, entries: &[&FuncEntry], ctx: &CodegenContext) {
+    let code = wrapper::generate_wrapper_file(entries, ctx);
+    std::fs::write(out_dir.join(filename), code)
+        .unwrap_or_else(|e| panic!("Failed to write {filename}: {e}"));
+}
+
+fn remove_stale_wrapper_files(out_dir: &Path, written: &HashSet<String>) {
+    let Ok(dir) = std::fs::read_dir(out_dir) else {
+        return;
+    };
+    for entry in dir.flatten() {
+        let name = entry.file_name().to_string_lossy().into_owned();
+        if name.starts_with("UikaFunc_") && name.ends_with(".cpp") && !written.contains(&name) {
+            std::fs::remove_file(entry.path())
+                .unwrap_or_else(|e| panic!("Failed to remove stale {name}: {e}"));
+        }
+    }
+}
@@ -87,6 +87,11 @@ pub fn generate_wrapper_file(entries: &[&FuncEntry], ctx: &CodegenContext) -> St
         includes.insert("\"UikaFNameHelper.h\"".to_string());
     }
 
+    let has_commands = entries.iter().any(|e| type_map::is_command_eligible(&e.func, ctx));
+    if has_commands {
+        includes.insert("\"UikaCommandBuffer.h\"".to_string());
+    }
+
     for inc in &includes {
         out.push_str(&format!("#include {inc}\n"));
     }
@@ -106,11 +111,15 @@ pub fn generate_wrapper_file(entries: &[&FuncEntry], ctx: &CodegenContext) -> St
     out.push_str("#define UIKA_ERROR_CODES_DEFINED\n");
     out.push_str("static constexpr uint32_t UikaErrorCode_Ok = 0;\n");
     out.push_str("static constexpr uint32_t UikaErrorCode_ObjectDestroyed = 1;\n");
+    out.push_str("static constexpr uint32_t UikaErrorCode_InvalidOperation = 8;\n");
     out.push_str("#endif\n\n");
 
-    // Generate each wrapper
+    // Generate each wrapper, followed by its command-buffer thunk if it has one
     for entry in entries {
         generate_wrapper_function(&mut out, entry, ctx);
+        if type_map::is_command_eligible(&entry.func, ctx) {
+            generate_command_thunk(&mut out, entry, ctx);
+        }
     }
 
     out.push_str("#ifdef _MSC_VER\n");
@@ -125,6 +134,11 @@ pub fn cpp_wrapper_name(class_name: &str, func_name: &str) -> String {
     format!("Uika_{class_name}_{func_name}")
 }
 
+/// Build the command-buffer thunk name: UikaCmd_ClassName_FuncName
+pub fn cpp_command_thunk_name(class_name: &str, func_name: &str) -> String {
+    format!("UikaCmd_{class_name}_{func_name}")
+}
+
 /// Generate a single extern "C" wrapper function.
 fn generate_wrapper_function(out: &mut String, entry: &FuncEntry, ctx: &CodegenContext) {
     let func = &entry.func;
@@ -389,6 +403,100 @@ fn generate_wrapper_function(out: &mut String, entry: &FuncEntry, ctx: &CodegenC
     out.push_str("}\n\n");
 }
 
+// ---------------------------------------------------------------------------
+// Command-buffer thunks
+// ---------------------------------------------------------------------------
+
+/// Generate the packed-args thunk for an eligible wrapper: unpack one slot per
+/// input from the record (layout in uika-ffi/src/command_types.rs), give
+/// every output thunk-local storage, and call the wrapper.
+fn generate_command_thunk(out: &mut String, entry: &FuncEntry, ctx: &CodegenContext) {
+    let func = &entry.func;
+    let is_static = func.is_static || (func.func_flags & FUNC_STATIC != 0);
+    let wrapper_name = cpp_wrapper_name(&entry.class_name, &entry.func_name);
+    let thunk_name = cpp_command_thunk_name(&entry.class_name, &entry.func_name);
+
+    let slot_count = func
+        .params
+        .iter()
+        .filter(|p| type_map::param_direction(p) == ParamDirection::In)
+        .count();
+
+    out.push_str(&format!(
+        "extern \"C\" uint32_t {thunk_name}(const uint8_t* Record, uint32_t Size) {{\n\
+         \x20   if (!UikaCmdHasSlots(Size, {slot_count})) return UikaErrorCode_InvalidOperation;\n"
+    ));
+
+    let mut args = Vec::new();
+    if !is_static {
+        args.push("UikaCmdObject(Record)".to_string());
+    }
+
+    let mut slot = 0u32;
+    for param in &func.params {
+        let dir = type_map::param_direction(param);
+        let mapped = map_param(param);
+        let name = &param.name;
+        match dir {
+            ParamDirection::In => {
+                match mapped.rust_to_ffi {
+                    ConversionKind::StringUtf8 => {
+                        out.push_str(&format!(
+                            "    const uint8_t* {name}; uint32_t {name}Len;\n\
+                             \x20   if (!UikaCmdPayload(Record, Size, {slot}, 0, {name}, {name}Len)) return UikaErrorCode_InvalidOperation;\n"
+                        ));
+                        args.push(format!("reinterpret_cast<const char*>({name})"));
+                        args.push(format!("{name}Len"));
+                    }
+                    ConversionKind::StructOpaque => {
+                        let struct_cpp = resolve_struct_opaque_cpp_type(param, ctx);
+                        out.push_str(&format!(
+                            "    const uint8_t* {name}; uint32_t {name}Len;\n\
+                             \x20   if (!UikaCmdPayload(Record, Size, {slot}, sizeof({struct_cpp}), {name}, {name}Len)) return UikaErrorCode_InvalidOperation;\n"
+                        ));
+                        args.push(name.clone());
+                    }
+                    _ => {
+                        let cpp_type = scalar_input_cpp_type(&mapped, param, dir);
+                        args.push(format!("UikaCmdScalar<{cpp_type}>(Record, {slot})"));
+                    }
+                }
+                slot += 1;
+            }
+            ParamDirection::Out | ParamDirection::Return => {
+                let local = if dir == ParamDirection::Return {
+                    "__ReturnValue".to_string()
+                } else {
+                    format!("__Out{name}")
+                };
+                match mapped.ffi_to_rust {
+                    // Struct out-params are null-checked by the wrapper.
+                    ConversionKind::StructOpaque if dir == ParamDirection::Out => {
+                        args.push("nullptr".to_string());
+                    }
+                    ConversionKind::StructOpaque => {
+                        let struct_cpp = resolve_struct_opaque_cpp_type(param, ctx);
+                        out.push_str(&format!(
+                            "    alignas(16) uint8_t {local}[sizeof({struct_cpp})];\n"
+                        ));
+                        args.push(local);
+                    }
+                    _ => {
+                        let ptr_type = scalar_output_cpp_type(&mapped, param);
+                        let value_type = ptr_type.strip_suffix('*').unwrap_or(&ptr_type);
+                        out.push_str(&format!("    {value_type} {local}{{}};\n"));
+                        args.push(format!("&{local}"));
+                    }
+                }
+            }
+            ParamDirection::InOut => unreachable!("InOut functions are not command-eligible"),
+        }
+    }
+
+    out.push_str(&format!("    return {wrapper_name}({});\n", args.join(", ")));
+    out.push_str("}\n\n");
+}
+
 // ---------------------------------------------------------------------------
 // Signature expansion helpers
 // ---------------------------------------------------------------------------
@@ -7,9 +7,11 @@ pub mod context;
 pub mod type_map;
 pub mod defaults;
 pub mod filter;
+pub mod usage;
 pub mod rust_gen;
 pub mod cpp_gen;
 
+use std::collections::{BTreeSet, HashSet};
 use std::path::Path;
 
 use crate::config::UikaConfig;
@@ -96,9 +98,22 @@ pub fn run_generate(config_path: &Path) {
     eprintln!("uika-codegen: filtering...");
     filter::apply_filters(&mut ctx, &codegen.blocklist);
 
+    // Load the used-symbols manifest when pruning is configured
+    let used = codegen.prune.as_ref().and_then(|prune| {
+        let manifest = config_dir.join(&prune.manifest);
+        let used = usage::load_manifest(&manifest);
+        if used.is_none() {
+            eprintln!(
+                "  warning: {} not found, generating all functions",
+                manifest.display()
+            );
+        }
+        used.map(|idents| (idents, prune.keep.iter().cloned().collect::<HashSet<_>>()))
+    });
+
     // Build function table (assign FuncIds)
     eprintln!("uika-codegen: building function table...");
-    build_func_table(&mut ctx);
+    build_func_table(&mut ctx, used.as_ref());
     eprintln!("  {} functions in func_table", ctx.func_table.len());
 
     // Generate Rust code
@@ -122,7 +137,7 @@ pub fn run_generate(config_path: &Path) {
 
     // Generate C++ code
     eprintln!("uika-codegen: generating C++ code...");
-    cpp_gen::generate(&ctx, &cpp_out);
+    cpp_gen::generate(&ctx, &cpp_out, codegen.unity_chunk_functions);
 
     // Generate module_deps.txt for Uika.Build.cs
     generate_module_deps(codegen, &cpp_out);
@@ -232,8 +247,15 @@ fn verify_output(ctx: &context::CodegenContext, rust_out: &Path, cpp_out: &Path)
 }
 
 /// Assign deterministic FuncIds to all exportable functions.
-fn build_func_table(ctx: &mut context::CodegenContext) {
+///
+/// With `used` (manifest identifiers, "Class.Function" keep list), only
+/// functions the game references are kept.
+fn build_func_table(
+    ctx: &mut context::CodegenContext,
+    used: Option<&(BTreeSet<String>, HashSet<String>)>,
+) {
     let mut entries = Vec::new();
+    let mut pruned = 0usize;
 
     for (module_name, classes) in &ctx.module_classes {
         for class in classes {
@@ -258,12 +280,21 @@ fn build_func_table(ctx: &mut context::CodegenContext) {
                 if !all_supported {
                     continue;
                 }
+                let rust_func_name = naming::to_snake_case(&func.name);
+                if let Some((idents, keep)) = used {
+                    if !usage::is_used(idents, &rust_func_name)
+                        && !keep.contains(&format!("{}.{}", class.name, func.name))
+                    {
+                        pruned += 1;
+                        continue;
+                    }
+                }
                 entries.push(context::FuncEntry {
                     func_id: 0, // assigned below
                     module_name: module_name.clone(),
                     class_name: class.name.clone(),
                     func_name: func.name.clone(),
-                    rust_func_name: naming::to_snake_case(&func.name),
+                    rust_func_name,
                     func: func.clone(),
                     cpp_class_name: class.cpp_name.clone(),
                     header: class.header.clone(),
@@ -272,6 +303,10 @@ fn build_func_table(ctx: &mut context::CodegenContext) {
         }
     }
 
+    if used.is_some() {
+        eprintln!("  pruned {pruned} unused functions");
+    }
+
     // Sort by (module, class, func) for deterministic IDs
     entries.sort_by(|a, b| {
         a.module_name
@@ -43,11 +43,13 @@ pub fn generate_class(class: &ClassInfo, ctx: &CodegenContext) -> String {
     // UeClass trait impl
     let name_bytes_len = name.len();
     let byte_lit = format!("b\"{}\\0\"", name);
+    // Module-level cache so the module's `prefetch_handles` can fill it.
     out.push_str(&format!(
-        "impl uika_runtime::UeClass for {name} {{\n\
+        "#[allow(non_upper_case_globals)]\n\
+         pub(crate) static __UIKA_CLASS_{name}: std::sync::OnceLock<uika_runtime::UClassHandle> = std::sync::OnceLock::new();\n\n\
+         impl uika_runtime::UeClass for {name} {{\n\
          \x20   fn static_class() -> uika_runtime::UClassHandle {{\n\
-         \x20       static CACHE: std::sync::OnceLock<uika_runtime::UClassHandle> = std::sync::OnceLock::new();\n\
-         \x20       *CACHE.get_or_init(|| unsafe {{\n\
+         \x20       *__UIKA_CLASS_{name}.get_or_init(|| unsafe {{\n\
          \x20           uika_runtime::ffi_dispatch::reflection_get_static_class({byte_lit}.as_ptr(), {name_bytes_len})\n\
          \x20       }})\n\
          \x20   }}\n\
@@ -153,6 +155,17 @@ pub fn generate_class(class: &ClassInfo, ctx: &CodegenContext) -> String {
         generate_function(&mut out, entry, &entry.class_name, ctx);
     }
 
+    // Command-buffer recorders for fire-and-forget-capable functions
+    for entry in &class_funcs {
+        let cmd_name = format!("{}_cmd", entry.rust_func_name);
+        if type_map::is_command_eligible(&entry.func, ctx)
+            && !func_names.contains(&cmd_name)
+            && !prop_names.contains(&cmd_name)
+        {
+            generate_command_function(&mut out, entry, &cmd_name, ctx);
+        }
+    }
+
     out.push_str("}\n\n");
 
     // Empty impls — Checked and Pinned both satisfy ValidHandle
@@ -166,6 +179,87 @@ pub fn generate_class(class: &ClassInfo, ctx: &CodegenContext) -> String {
     out
 }
 
+// ---------------------------------------------------------------------------
+// Command-buffer recorders
+// ---------------------------------------------------------------------------
+
+/// Generate `{func}_cmd`: same inputs as the direct wrapper, but the call is
+/// appended to a `CommandBuffer` and runs when the buffer is submitted.
+/// Outputs and the return value are discarded.
+fn generate_command_function(out: &mut String, entry: &FuncEntry, cmd_name: &str, ctx: &CodegenContext) {
+    let func = &entry.func;
+    let func_id = entry.func_id;
+    let is_static = func.is_static || (func.func_flags & FUNC_STATIC != 0);
+
+    let inputs: Vec<(&ParamInfo, MappedType)> = func
+        .params
+        .iter()
+        .filter(|p| type_map::param_direction(p) == ParamDirection::In)
+        .map(|p| (p, type_map::map_param_type(p)))
+        .collect();
+
+    let mut sig = if is_static {
+        format!("    fn {cmd_name}(cmd: &mut uika_runtime::CommandBuffer")
+    } else {
+        format!("    fn {cmd_name}(&self, cmd: &mut uika_runtime::CommandBuffer")
+    };
+    let mut default_unwraps: Vec<(String, String)> = Vec::new();
+    for (param, mapped) in &inputs {
+        let pname = escape_reserved(&to_snake_case(&param.name));
+        let default_expr = defaults::parse_default_literal(param, mapped, ctx);
+        let ty = match mapped.rust_to_ffi {
+            ConversionKind::StringUtf8 => "&str".to_string(),
+            ConversionKind::StructOpaque => {
+                let si = ctx.structs.get(param.struct_name.as_deref().expect("StructOpaque param must have struct_name"))
+                    .expect("struct must exist in context");
+                format!("&uika_runtime::OwnedStruct<{}>", si.cpp_name)
+            }
+            _ => mapped.rust_type.clone(),
+        };
+        // Owned structs never take a default literal (same as the direct wrapper).
+        match default_expr {
+            Some(expr) if mapped.rust_to_ffi != ConversionKind::StructOpaque => {
+                sig.push_str(&format!(", {pname}: Option<{ty}>"));
+                default_unwraps.push((pname, expr));
+            }
+            _ => sig.push_str(&format!(", {pname}: {ty}")),
+        }
+    }
+    sig.push(')');
+
+    out.push_str(&format!("    /// Record `{}` into `cmd` instead of calling it.\n", func.name));
+    out.push_str(&sig);
+    out.push_str(" {\n");
+    for (pname, default_expr) in &default_unwraps {
+        out.push_str(&format!("        let {pname} = {pname}.unwrap_or({default_expr});\n"));
+    }
+    let target = if is_static { "uika_runtime::UObjectHandle::null()" } else { "self.handle()" };
+    out.push_str("        // SAFETY: one slot per input, in wrapper order, with the wrapper's FFI types.\n");
+    if inputs.is_empty() {
+        out.push_str(&format!("        unsafe {{ cmd.record({func_id}, {target}, 0) }};\n"));
+        out.push_str("    }\n\n");
+        return;
+    }
+    out.push_str(&format!(
+        "        let mut __args = unsafe {{ cmd.record({func_id}, {target}, {}) }};\n",
+        inputs.len()
+    ));
+    for (param, mapped) in &inputs {
+        let pname = escape_reserved(&to_snake_case(&param.name));
+        let write = match mapped.rust_to_ffi {
+            ConversionKind::StringUtf8 => format!("__args.str({pname});"),
+            ConversionKind::StructOpaque => format!("__args.bytes({pname}.as_bytes());"),
+            ConversionKind::ObjectRef => format!("__args.scalar({pname}.raw());"),
+            ConversionKind::EnumCast | ConversionKind::IntCast => {
+                format!("__args.scalar({pname} as {});", mapped.rust_ffi_type)
+            }
+            _ => format!("__args.scalar({pname});"),
+        };
+        out.push_str(&format!("        {write}\n"));
+    }
+    out.push_str("    }\n\n");
+}
+
 // ---------------------------------------------------------------------------
 // Container param helpers (delegated to type_map)
 // ---------------------------------------------------------------------------
@@ -225,6 +319,16 @@ pub(super) fn is_scalar_output_returnable(dir: ParamDirection, mapped: &MappedTy
 // Function implementation (dispatch)
 // ---------------------------------------------------------------------------
 
+/// Non-pure, non-const calls may destroy objects: hold an `EpochFence` so
+/// cached `is_valid` results are dropped once the call returns.
+fn epoch_fence(func: &FunctionInfo) -> &'static str {
+    if func.func_flags & (FUNC_BLUEPRINT_PURE | FUNC_CONST) != 0 {
+        ""
+    } else {
+        "        let _epoch = uika_runtime::object_ref::EpochFence;\n"
+    }
+}
+
 /// Generate a function wrapper (direct call via func_table).
 fn generate_function(out: &mut String, entry: &FuncEntry, class_name: &str, ctx: &CodegenContext) {
     let has_container = entry.func.params.iter().any(|p| is_container_param(p));
@@ -466,8 +570,10 @@ fn generate_scalar_function(out: &mut String, entry: &FuncEntry, class_name: &st
     out.push_str(&format!(
         "        const FN_ID: u32 = {func_id};\n\
          \x20       type Fn = unsafe extern \"C\" fn({ffi_params}) -> uika_runtime::UikaErrorCode;\n\
-         \x20       let __uika_fn: Fn = unsafe {{ std::mem::transmute(*(uika_runtime::api().func_table.add(FN_ID as usize))) }};\n"
+         \x20       let __uika_fn: Fn = unsafe {{ std::mem::transmute(*(uika_runtime::api().func_table.add(FN_ID as usize))) }};\n\
+         \x20       let _stats = uika_runtime::ffi_stats::func_scope(FN_ID);\n"
     ));
+    out.push_str(epoch_fence(func));
 
     // Get handle for instance methods (pre-validated via ValidHandle)
     if !is_static {
@@ -910,8 +1016,10 @@ fn generate_container_function(out: &mut String, entry: &FuncEntry, class_name:
 
     out.push_str(&format!(
         "        type Fn = unsafe extern \"C\" fn({ffi_params}) -> uika_runtime::UikaErrorCode;\n\
-         \x20       let __uika_fn: Fn = unsafe {{ std::mem::transmute(*(uika_runtime::api().func_table.add(FN_ID as usize))) }};\n"
+         \x20       let __uika_fn: Fn = unsafe {{ std::mem::transmute(*(uika_runtime::api().func_table.add(FN_ID as usize))) }};\n\
+         \x20       let _stats = uika_runtime::ffi_stats::func_scope(FN_ID);\n"
     ));
+    out.push_str(epoch_fence(func));
 
     // === Get handle (pre-validated via ValidHandle) ===
     if !is_static {
@@ -1103,9 +1211,7 @@ fn emit_container_populate(out: &mut String, param: &ParamInfo, idx: usize, pnam
                 "        {{\n\
                  \x20           let __h = uika_runtime::UObjectHandle(__temp_{idx} as *mut std::ffi::c_void);\n\
                  \x20           let __set = uika_runtime::UeSet::<{elem_type}>::new(__h, __cprops[{idx}]);\n\
-                 \x20           for __elem in {pname} {{\n\
-                 \x20               let _ = __set.add(__elem);\n\
-                 \x20           }}\n\
+                 \x20           let _ = __set.add_many({pname});\n\
                  \x20       }}\n"
             ));
         }
@@ -1114,9 +1220,7 @@ fn emit_container_populate(out: &mut String, param: &ParamInfo, idx: usize, pnam
                 "        {{\n\
                  \x20           let __h = uika_runtime::UObjectHandle(__temp_{idx} as *mut std::ffi::c_void);\n\
                  \x20           let __map = uika_runtime::UeMap::<{elem_type}>::new(__h, __cprops[{idx}]);\n\
-                 \x20           for (__k, __v) in {pname} {{\n\
-                 \x20               let _ = __map.add(__k, __v);\n\
-                 \x20           }}\n\
+                 \x20           let _ = __map.add_many({pname}.iter().map(|(__k, __v)| (__k, __v)));\n\
                  \x20       }}\n"
             ));
         }
@@ -1148,12 +1252,7 @@ fn emit_container_read(out: &mut String, param: &ParamInfo, idx: usize, ctx: &Co
                 "        let __out_{idx} = if __result == uika_runtime::UikaErrorCode::Ok {{\n\
                  \x20           let __h = uika_runtime::UObjectHandle(__temp_{idx} as *mut std::ffi::c_void);\n\
                  \x20           let __set = uika_runtime::UeSet::<{elem_type}>::new(__h, __cprops[{idx}]);\n\
-                 \x20           let __len = __set.len().unwrap_or(0);\n\
-                 \x20           let mut __v = Vec::with_capacity(__len);\n\
-                 \x20           for __i in 0..__len {{\n\
-                 \x20               if let Ok(__val) = __set.get_element(__i) {{ __v.push(__val); }}\n\
-                 \x20           }}\n\
-                 \x20           __v\n\
+                 \x20           __set.iter().flatten().collect::<Vec<_>>()\n\
                  \x20       }} else {{ Vec::new() }};\n"
             ));
         }
@@ -1162,12 +1261,7 @@ fn emit_container_read(out: &mut String, param: &ParamInfo, idx: usize, ctx: &Co
                 "        let __out_{idx} = if __result == uika_runtime::UikaErrorCode::Ok {{\n\
                  \x20           let __h = uika_runtime::UObjectHandle(__temp_{idx} as *mut std::ffi::c_void);\n\
                  \x20           let __map = uika_runtime::UeMap::<{elem_type}>::new(__h, __cprops[{idx}]);\n\
-                 \x20           let __len = __map.len().unwrap_or(0);\n\
-                 \x20           let mut __v = Vec::with_capacity(__len);\n\
-                 \x20           for __i in 0..__len {{\n\
-                 \x20               if let Ok(__pair) = __map.get_pair(__i) {{ __v.push(__pair); }}\n\
-                 \x20           }}\n\
-                 \x20           __v\n\
+                 \x20           __map.iter().flatten().collect::<Vec<_>>()\n\
                  \x20       }} else {{ Vec::new() }};\n"
             ));
         }
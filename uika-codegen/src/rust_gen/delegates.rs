@@ -380,6 +380,7 @@ pub fn generate_delegate_structs(
                  \x20       }})\n\
                  \x20   }}\n"
             ));
+            generate_queued_method(out, d, &callback_sig);
             out.push_str("}\n\n");
             continue;
         }
@@ -494,6 +495,61 @@ pub fn generate_delegate_structs(
              \x20   }}\n"
         ));
 
+        generate_queued_method(out, d, &callback_sig);
         out.push_str("}\n\n");
     }
 }
+
+/// Generate the queued counterpart of bind/add (`bind_queued`/`add_queued`).
+/// Fires are copied into the C++ event queue and the closure runs from
+/// `uika_runtime::drain_queued_events`, decoding params from the record.
+fn generate_queued_method(out: &mut String, d: &DelegateInfo, callback_sig: &str) {
+    let method_name = if d.is_multicast { "add_queued" } else { "bind_queued" };
+    let api_fn = if d.is_multicast { "bind_multicast_queued" } else { "bind_unicast_queued" };
+    let q = if d.params.is_empty() { "_q" } else { "q" };
+
+    out.push_str(&format!(
+        "\n    pub fn {method_name}(&self, mut callback: impl FnMut({callback_sig}) + Send + 'static) -> uika_runtime::UikaResult<uika_runtime::DelegateBinding> {{\n\
+         \x20       uika_runtime::delegate_registry::{api_fn}(self.owner, self.prop, move |{q}: &mut uika_runtime::QueuedParams<'_>| {{\n"
+    ));
+
+    if d.params.is_empty() {
+        out.push_str(
+            "            callback();\n\
+             \x20       })\n\
+             \x20   }\n"
+        );
+        return;
+    }
+
+    out.push_str("            unsafe {\n");
+    for p in &d.params {
+        let var_name = &p.name;
+        let read = match &p.conversion {
+            ParamConversion::Primitive(ty) if ty == "bool" => "q.read_bool()".to_string(),
+            ParamConversion::Primitive(ty) => format!("q.read::<{ty}>()"),
+            ParamConversion::ObjectRef(_) => {
+                "q.read::<uika_runtime::UObjectHandle>().map(|h| uika_runtime::UObjectRef::from_raw(h))".to_string()
+            }
+            ParamConversion::Enum { rust_type, repr } => format!(
+                "q.read::<{repr}>().map(|v| {rust_type}::from_value(v).unwrap_or_else(|| std::mem::transmute(v)))"
+            ),
+            ParamConversion::FName => "q.read::<u64>().map(uika_runtime::FNameHandle)".to_string(),
+            ParamConversion::String => "q.read_string()".to_string(),
+            ParamConversion::Struct { cpp_name, .. } => format!(
+                "q.next_bytes().map(|b| uika_runtime::OwnedStruct::<{cpp_name}>::from_bytes(b.to_vec()))"
+            ),
+        };
+        out.push_str(&format!(
+            "                let Some({var_name}) = {read} else {{ return; }};\n"
+        ));
+    }
+
+    let call_args = d.params.iter().map(|p| p.name.as_str()).collect::<Vec<_>>().join(", ");
+    out.push_str(&format!(
+        "                callback({call_args});\n\
+         \x20           }}\n\
+         \x20       }})\n\
+         \x20   }}\n"
+    ));
+}
@@ -20,6 +20,13 @@ pub fn generate_rust_func_ids(entries: &[FuncEntry]) -> String {
         entries.len()
     ));
 
+    // Slot names for uika_runtime::ffi_stats, indexed by func id.
+    out.push_str("\npub static FUNC_NAMES: [&str; FUNC_COUNT as usize] = [\n");
+    for entry in entries {
+        out.push_str(&format!("    \"{}.{}\",\n", entry.class_name, entry.func_name));
+    }
+    out.push_str("];\n");
+
     out
 }
 
@@ -38,9 +38,53 @@ pub fn generate_module_mod(
         }
     }
 
+    write_prefetch_fn(&mut out, structs, classes);
+
     out
 }
 
+/// Write `prefetch_handles()`, which fills every class/struct handle cache of
+/// this module with one `resolve_many` call per kind.
+fn write_prefetch_fn(out: &mut String, structs: Option<&[StructInfo]>, classes: Option<&[ClassInfo]>) {
+    out.push_str(
+        "/// Resolve this module's class and struct handles in one batch.\n\
+         pub fn prefetch_handles() {\n",
+    );
+    if let Some(classes) = classes.filter(|c| !c.is_empty()) {
+        out.push_str("    uika_runtime::reflection::prefetch_classes(&[\n");
+        for c in classes {
+            let path = mod_path(&to_snake_case(&c.name));
+            let name = &c.name;
+            out.push_str(&format!("        (&self::{path}::__UIKA_CLASS_{name}, \"{name}\"),\n"));
+        }
+        out.push_str("    ]);\n");
+    }
+    let structs: Vec<&StructInfo> = structs
+        .map(|s| s.iter().filter(|s| s.has_static_struct).collect())
+        .unwrap_or_default();
+    if !structs.is_empty() {
+        out.push_str("    uika_runtime::reflection::prefetch_structs(&[\n");
+        for s in structs {
+            let path = mod_path(&to_snake_case(&s.name));
+            out.push_str(&format!(
+                "        (&self::{path}::__UIKA_STRUCT_{}, \"{}\"),\n",
+                s.cpp_name, s.name
+            ));
+        }
+        out.push_str("    ]);\n");
+    }
+    out.push_str("}\n");
+}
+
+/// In-code path for a sub-module (keyword names need `r#`).
+fn mod_path(mod_name: &str) -> String {
+    if is_reserved(mod_name) {
+        format!("r#{mod_name}")
+    } else {
+        mod_name.to_string()
+    }
+}
+
 /// Write `mod foo; pub use foo::*;` handling keyword escaping.
 /// File on disk is named `foo.rs` but in code we use `r#foo` if needed.
 fn write_mod_use(out: &mut String, mod_name: &str) {
@@ -79,5 +123,22 @@ pub fn generate_lib_rs(ctx: &CodegenContext) -> String {
     // Hand-written manual override module (not generated).
     out.push_str("pub mod manual;\n\n");
 
+    // Batch handle prefetch across every enabled module.
+    out.push_str(
+        "/// Resolve the class and struct handles of every enabled module in\n\
+         /// batches. Called once at startup; lookups stay lazy for anything missed.\n\
+         pub fn prefetch_handles() {\n\
+         \x20   uika_runtime::ffi_stats::register_func_names(&func_ids::FUNC_NAMES);\n",
+    );
+    let mut modules: Vec<&String> = ctx.enabled_modules.iter().collect();
+    modules.sort();
+    for module in modules {
+        if let Some(feature) = ctx.feature_for_module(module) {
+            out.push_str(&format!("    #[cfg(feature = \"{feature}\")]\n"));
+        }
+        out.push_str(&format!("    crate::{module}::prefetch_handles();\n"));
+    }
+    out.push_str("}\n");
+
     out
 }
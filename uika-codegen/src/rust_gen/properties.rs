@@ -317,6 +317,49 @@ fn emit_prop_lookup(out: &mut String, byte_lit: &str, prop_name_len: usize, pctx
     ));
 }
 
+/// Whether a Rust scalar type can use the FieldDesc direct-access path.
+/// Strings, text, names, objects, enums and structs always go through FFI.
+fn is_direct_scalar(rust_type: &str) -> bool {
+    matches!(
+        rust_type,
+        "bool" | "i8" | "u8" | "i16" | "u16" | "i32" | "u32" | "i64" | "u64" | "f32" | "f64"
+    )
+}
+
+/// Generates the FieldDesc OnceLock lookup (after `emit_prop_lookup`).
+fn emit_field_lookup(out: &mut String) {
+    out.push_str(
+        "        static FIELD: std::sync::OnceLock<uika_runtime::FieldDesc> = std::sync::OnceLock::new();\n\
+         \x20       let field = FIELD.get_or_init(|| uika_runtime::FieldDesc::query(prop));\n",
+    );
+}
+
+/// Emit the direct-read fast path (raw load, no FFI crossing) for POD scalars.
+fn emit_direct_read(out: &mut String, rust_type: &str, c: &str) {
+    if rust_type == "bool" {
+        out.push_str(&format!(
+            "        if field.is_bool() && !{c}.is_null() {{ return unsafe {{ field.read_bool({c}) }}; }}\n"
+        ));
+    } else {
+        out.push_str(&format!(
+            "        if field.is_direct::<{rust_type}>() && !{c}.is_null() {{ return unsafe {{ field.read::<{rust_type}>({c}) }}; }}\n"
+        ));
+    }
+}
+
+/// Emit the direct-write fast path (raw store, no FFI crossing) for POD scalars.
+fn emit_direct_write(out: &mut String, rust_type: &str, c: &str) {
+    if rust_type == "bool" {
+        out.push_str(&format!(
+            "        if field.is_bool() && !{c}.is_null() {{ unsafe {{ field.write_bool({c}, val) }}; return; }}\n"
+        ));
+    } else {
+        out.push_str(&format!(
+            "        if field.is_direct::<{rust_type}>() && !{c}.is_null() {{ unsafe {{ field.write::<{rust_type}>({c}, val) }}; return; }}\n"
+        ));
+    }
+}
+
 /// Emit pre-access (validity check) if needed.
 fn emit_pre_access(out: &mut String, pctx: &PropertyContext) {
     if !pctx.pre_access.is_empty() {
@@ -341,11 +384,19 @@ fn generate_primitive_getter(
     let default = default_value_for(rust_type);
     let c = &pctx.container_expr;
 
+    let direct = is_direct_scalar(rust_type);
+
     out.push_str(&format!(
         "    fn get_{rust_name}(&self) -> {rust_type} {{\n"
     ));
     emit_prop_lookup(out, byte_lit, prop_name_len, pctx);
+    if direct {
+        emit_field_lookup(out);
+    }
     emit_pre_access(out, pctx);
+    if direct {
+        emit_direct_read(out, rust_type, c);
+    }
     out.push_str(&format!(
         "        let mut out = {default};\n\
          \x20       uika_runtime::ffi_infallible_ctx(unsafe {{ uika_runtime::ffi_dispatch::property_{getter}({c}, prop, &mut out) }}, \"{rust_name}\");\n\
@@ -368,11 +419,19 @@ fn generate_int_cast_getter(
     let default = default_value_for(ffi_type);
     let c = &pctx.container_expr;
 
+    let direct = is_direct_scalar(rust_type);
+
     out.push_str(&format!(
         "    fn get_{rust_name}(&self) -> {rust_type} {{\n"
     ));
     emit_prop_lookup(out, byte_lit, prop_name_len, pctx);
+    if direct {
+        emit_field_lookup(out);
+    }
     emit_pre_access(out, pctx);
+    if direct {
+        emit_direct_read(out, rust_type, c);
+    }
     out.push_str(&format!(
         "        let mut out = {default};\n\
          \x20       uika_runtime::ffi_infallible_ctx(unsafe {{ uika_runtime::ffi_dispatch::property_{getter}({c}, prop, &mut out) }}, \"{rust_name}\");\n\
@@ -396,13 +455,12 @@ fn generate_string_getter(
     emit_prop_lookup(out, byte_lit, prop_name_len, pctx);
     emit_pre_access(out, pctx);
     out.push_str(&format!(
-        "        let mut buf = vec![0u8; 512];\n\
-         \x20       let mut out_len: u32 = 0;\n\
-         \x20       uika_runtime::ffi_infallible_ctx(unsafe {{\n\
-         \x20           uika_runtime::ffi_dispatch::property_get_string({c}, prop, buf.as_mut_ptr(), buf.len() as u32, &mut out_len)\n\
-         \x20       }}, \"{rust_name}\");\n\
-         \x20       buf.truncate(out_len as usize);\n\
-         \x20       String::from_utf8_lossy(&buf).into_owned()\n\
+        "        let mut value = String::new();\n\
+         \x20       uika_runtime::ffi_infallible_ctx(\n\
+         \x20           uika_runtime::ue_string::read_string_into({c}, prop, &mut value),\n\
+         \x20           \"{rust_name}\",\n\
+         \x20       );\n\
+         \x20       value\n\
          \x20   }}\n\n"
     ));
 }
@@ -494,11 +552,19 @@ fn generate_primitive_setter(
     let setter = &mapped.property_setter;
     let c = &pctx.container_expr;
 
+    let direct = is_direct_scalar(rust_type);
+
     out.push_str(&format!(
         "    fn set_{rust_name}(&self, val: {rust_type}) {{\n"
     ));
     emit_prop_lookup(out, byte_lit, prop_name_len, pctx);
+    if direct {
+        emit_field_lookup(out);
+    }
     emit_pre_access(out, pctx);
+    if direct {
+        emit_direct_write(out, rust_type, c);
+    }
     out.push_str(&format!(
         "        uika_runtime::ffi_infallible_ctx(unsafe {{ uika_runtime::ffi_dispatch::property_{setter}({c}, prop, val) }}, \"{rust_name}\");\n\
          \x20   }}\n\n"
@@ -518,11 +584,19 @@ fn generate_int_cast_setter(
     let setter = &mapped.property_setter;
     let c = &pctx.container_expr;
 
+    let direct = is_direct_scalar(rust_type);
+
     out.push_str(&format!(
         "    fn set_{rust_name}(&self, val: {rust_type}) {{\n"
     ));
     emit_prop_lookup(out, byte_lit, prop_name_len, pctx);
+    if direct {
+        emit_field_lookup(out);
+    }
     emit_pre_access(out, pctx);
+    if direct {
+        emit_direct_write(out, rust_type, c);
+    }
     out.push_str(&format!(
         "        uika_runtime::ffi_infallible_ctx(unsafe {{ uika_runtime::ffi_dispatch::property_{setter}({c}, prop, val as {ffi_type}) }}, \"{rust_name}\");\n\
          \x20   }}\n\n"
@@ -39,11 +39,13 @@ pub fn generate_struct(s: &StructInfo, ctx: &CodegenContext) -> String {
         let name_len = name_bytes.len();
         let byte_lit = format!("b\"{}\\0\"", stripped);
 
+        // Module-level cache so the module's `prefetch_handles` can fill it.
         out.push_str(&format!(
-            "impl uika_runtime::UeStruct for {name} {{\n\
+            "#[allow(non_upper_case_globals)]\n\
+             pub(crate) static __UIKA_STRUCT_{name}: std::sync::OnceLock<uika_runtime::UStructHandle> = std::sync::OnceLock::new();\n\n\
+             impl uika_runtime::UeStruct for {name} {{\n\
              \x20   fn static_struct() -> uika_runtime::UStructHandle {{\n\
-             \x20       static CACHE: std::sync::OnceLock<uika_runtime::UStructHandle> = std::sync::OnceLock::new();\n\
-             \x20       *CACHE.get_or_init(|| unsafe {{\n\
+             \x20       *__UIKA_STRUCT_{name}.get_or_init(|| unsafe {{\n\
              \x20           uika_runtime::ffi_dispatch::reflection_find_struct({byte_lit}.as_ptr(), {name_len})\n\
              \x20       }})\n\
              \x20   }}\n\
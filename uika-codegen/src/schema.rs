@@ -164,7 +164,7 @@ pub use uika_ue_flags::{
     CPF_CONST_PARM, CPF_OUT_PARM, CPF_REFERENCE_PARM, CPF_RETURN_PARM,
     CPF_NATIVE_ACCESS_SPECIFIER_PRIVATE as CPF_NATIVE_ACCESS_PRIVATE,
     CPF_NATIVE_ACCESS_SPECIFIER_PROTECTED as CPF_NATIVE_ACCESS_PROTECTED,
-    FUNC_NATIVE, FUNC_STATIC, FUNC_BLUEPRINT_EVENT,
+    FUNC_NATIVE, FUNC_STATIC, FUNC_BLUEPRINT_EVENT, FUNC_BLUEPRINT_PURE, FUNC_CONST,
 };
 
 // ---------------------------------------------------------------------------
@@ -678,3 +678,53 @@ pub fn container_elem_type_str(param: &ParamInfo, ctx: &CodegenContext) -> Optio
         _ => None,
     }
 }
+
+// ---------------------------------------------------------------------------
+// Command-buffer eligibility
+// ---------------------------------------------------------------------------
+
+/// Map a function parameter to its MappedType.
+pub fn map_param_type(param: &ParamInfo) -> MappedType {
+    map_property_type(
+        &param.prop_type,
+        param.class_name.as_deref(),
+        param.struct_name.as_deref(),
+        param.enum_name.as_deref(),
+        param.enum_underlying_type.as_deref(),
+        param.meta_class_name.as_deref(),
+        param.interface_name.as_deref(),
+    )
+}
+
+/// Whether a function gets a packed-args command-buffer thunk (C++) and a
+/// `_cmd` recorder (Rust). Every input must fit a fixed slot or the record
+/// payload (scalars, objects, names, enums, strings, structs with a
+/// UScriptStruct), and every output must be discardable into thunk-local
+/// storage. InOut, container and string-output functions are call-only.
+pub fn is_command_eligible(func: &crate::schema::FunctionInfo, ctx: &CodegenContext) -> bool {
+    func.params.iter().all(|param| {
+        if is_container_param(param) {
+            return false;
+        }
+        let mapped = map_param_type(param);
+        if !mapped.supported {
+            return false;
+        }
+        match param_direction(param) {
+            ParamDirection::InOut => false,
+            ParamDirection::In => match mapped.rust_to_ffi {
+                ConversionKind::StructOpaque => param
+                    .struct_name
+                    .as_deref()
+                    .and_then(|sn| ctx.structs.get(sn))
+                    .is_some_and(|si| si.has_static_struct),
+                _ => true,
+            },
+            ParamDirection::Out | ParamDirection::Return => match mapped.ffi_to_rust {
+                ConversionKind::StringUtf8 => false,
+                ConversionKind::StructOpaque => param.struct_name.is_some(),
+                _ => true,
+            },
+        }
+    })
+}
@@ -0,0 +1,106 @@
+// Used-symbols manifest: which generated function bindings the game calls.
+//
+// `uika build` scans the game crate's sources for Rust identifiers and writes
+// them, one per line, to the manifest named by `[codegen.prune]`. Codegen
+// then keeps only func_table entries whose method name (or its `_cmd`
+// recorder) appears in the manifest. Matching is by name alone, so a
+// coincidental identifier keeps a binding alive; that over-approximation is
+// deliberate — a missing binding is a compile error in the game crate, an
+// extra one only costs build time.
+
+use std::collections::BTreeSet;
+use std::path::Path;
+
+/// Collect every identifier in the `.rs` files under `dirs` (recursively).
+pub fn scan_identifiers(dirs: &[&Path]) -> BTreeSet<String> {
+    let mut idents = BTreeSet::new();
+    for dir in dirs {
+        scan_dir(dir, &mut idents);
+    }
+    idents
+}
+
+fn scan_dir(dir: &Path, idents: &mut BTreeSet<String>) {
+    let Ok(entries) = std::fs::read_dir(dir) else {
+        return;
+    };
+    for entry in entries.flatten() {
+        let path = entry.path();
+        if path.is_dir() {
+            // Build output can hold copies of the generated bindings.
+            if path.file_name().is_some_and(|n| n == "target") {
+                continue;
+            }
+            scan_dir(&path, idents);
+        } else if path.extension().is_some_and(|ext| ext == "rs") {
+            if let Ok(source) = std::fs::read_to_string(&path) {
+                collect_identifiers(&source, idents);
+            }
+        }
+    }
+}
+
+/// Split `source` into identifier-like tokens. Comments and string contents
+/// are not skipped; `r#type` yields `r` and `type`.
+pub fn collect_identifiers(source: &str, idents: &mut BTreeSet<String>) {
+    let is_ident_char = |c: char| c == '_' || c.is_ascii_alphanumeric();
+    for token in source.split(|c: char| !is_ident_char(c)) {
+        if token.starts_with(|c: char| c == '_' || c.is_ascii_alphabetic()) {
+            idents.insert(token.to_string());
+        }
+    }
+}
+
+/// Write the manifest: a header comment, then one identifier per line.
+pub fn write_manifest(path: &Path, idents: &BTreeSet<String>) {
+    if let Some(parent) = path.parent() {
+        std::fs::create_dir_all(parent)
+            .unwrap_or_else(|e| panic!("Failed to create {}: {e}", parent.display()));
+    }
+    let mut content = String::with_capacity(idents.len() * 16 + 64);
+    content.push_str("# Auto-generated by uika build. Identifiers used by the game crate.\n");
+    for ident in idents {
+        content.push_str(ident);
+        content.push('\n');
+    }
+    std::fs::write(path, content)
+        .unwrap_or_else(|e| panic!("Failed to write {}: {e}", path.display()));
+}
+
+/// Read a manifest written by [`write_manifest`]. Blank lines and `#`
+/// comments are ignored, so the file can also be maintained by hand.
+pub fn load_manifest(path: &Path) -> Option<BTreeSet<String>> {
+    let content = std::fs::read_to_string(path).ok()?;
+    Some(
+        content
+            .lines()
+            .map(str::trim)
+            .filter(|l| !l.is_empty() && !l.starts_with('#'))
+            .map(str::to_string)
+            .collect(),
+    )
+}
+
+/// Whether a generated method named `rust_func_name` is referenced.
+pub fn is_used(idents: &BTreeSet<String>, rust_func_name: &str) -> bool {
+    idents.contains(rust_func_name) || idents.contains(&format!("{rust_func_name}_cmd"))
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_collect_identifiers() {
+        let mut idents = BTreeSet::new();
+        collect_identifiers(
+            "actor.set_actor_hidden_in_game(true); w.r#type(2); x.k2_get_actor_location_cmd(&mut c);",
+            &mut idents,
+        );
+        assert!(idents.contains("set_actor_hidden_in_game"));
+        assert!(idents.contains("type"));
+        assert!(!idents.contains("2"));
+        assert!(is_used(&idents, "k2_get_actor_location"));
+        assert!(!is_used(&idents, "get_actor_label"));
+    }
+}
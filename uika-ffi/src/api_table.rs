@@ -1,8 +1,15 @@
 use std::ffi::c_void;
 
+use crate::delegate_types::UikaDelegateEventBatch;
 use crate::error::UikaErrorCode;
 use crate::handles::*;
+use crate::math_types::{UikaRotator, UikaTransform, UikaVector};
+use crate::property_types::{UikaFieldDesc, UikaPropOp};
+use crate::reflection_types::{UikaFrameLayout, UikaResolveReq};
 use crate::reify_types::UikaReifyPropExtra;
+use crate::world_types::{
+    UikaActorChange, UikaMirrorColumn, UikaMirrorView, UikaTraceHit, UikaTraceRequest,
+};
 
 // Re-export FWeakObjectHandle for use by api_table consumers.
 pub use crate::handles::FWeakObjectHandle;
@@ -29,6 +36,7 @@ pub struct UikaApiTable {
     pub world: *const UikaWorldApi,
     pub logging: *const UikaLoggingApi,
     pub widget: *const UikaWidgetApi,
+    pub task: *const UikaTaskApi,
 
     // ---- Generated function-pointer array (codegen) ----
     /// Flat array indexed by codegen-assigned FuncId. Each pointer targets a
@@ -93,6 +101,31 @@ pub struct UikaCoreApi {
 
     /// Check if a weak pointer is still valid (without resolving).
     pub is_weak_valid: unsafe extern "C" fn(weak: FWeakObjectHandle) -> bool,
+
+    // -- Bulk FName construction --
+
+    /// Create `count` FNames from UTF-8 slices in one call. `out` receives
+    /// `count` handles. Empty slices produce `NAME_None`.
+    pub make_fnames_bulk: unsafe extern "C" fn(
+        names: *const UikaStrView,
+        count: u32,
+        out: *mut FNameHandle,
+    ) -> UikaErrorCode,
+
+    // -- Bulk / inline weak resolution --
+
+    /// Resolve `count` weak pointers in one call. `out` receives `count`
+    /// handles, null for expired entries.
+    pub resolve_weak_many: unsafe extern "C" fn(
+        weak: *const FWeakObjectHandle,
+        count: u32,
+        out: *mut UObjectHandle,
+    ) -> UikaErrorCode,
+
+    /// Fill `out` with the object array view. `InvalidOperation` when this
+    /// engine build's `FUObjectItem` layout is not supported; callers then
+    /// stay on `resolve_weak`.
+    pub get_object_array_view: unsafe extern "C" fn(out: *mut UikaObjectArrayView) -> UikaErrorCode,
 }
 
 // ---------------------------------------------------------------------------
@@ -104,6 +137,28 @@ pub struct UikaLoggingApi {
     /// Bridge to UE_LOG. `level`: 0=Display, 1=Warning, 2=Error.
     /// `msg` is a UTF-8 byte slice (not null-terminated).
     pub log: unsafe extern "C" fn(level: u8, msg: *const u8, msg_len: u32),
+
+    // -- Categories / verbosity --
+    /// Register (or look up) a log category by name and return its id.
+    /// Id 0 is `LogUika`, which is also returned when the table is full.
+    pub register_category: unsafe extern "C" fn(name: *const u8, name_len: u32) -> u16,
+    /// Effective `ELogVerbosity` of every registered category, indexed by
+    /// id (256 entries). Refreshed on the game thread every frame and on
+    /// `register_category`; lives as long as the module.
+    pub verbosity_table: unsafe extern "C" fn() -> *const u8,
+
+    // -- Async records --
+    /// Queue a structured record for the background drain thread; errors
+    /// are written and flushed synchronously. Safe from any thread.
+    /// `level`: as for `log`, plus 3=Verbose, 4=VeryVerbose.
+    pub log_record: unsafe extern "C" fn(
+        level: u8,
+        category: u16,
+        msg: *const u8,
+        msg_len: u32,
+        fields: *const UikaLogField,
+        field_count: u32,
+    ),
 }
 
 // ---------------------------------------------------------------------------
@@ -112,7 +167,9 @@ pub struct UikaLoggingApi {
 
 #[repr(C)]
 pub struct UikaLifecycleApi {
-    /// Add a GC root (prevents UE garbage collection).
+    /// Add a GC root (prevents UE garbage collection). Objects are held by
+    /// the plugin's root set (an FGCObject), not `AddToRoot`; each call needs
+    /// a matching `remove_gc_root`.
     pub add_gc_root: unsafe extern "C" fn(obj: UObjectHandle),
     /// Remove a GC root.
     pub remove_gc_root: unsafe extern "C" fn(obj: UObjectHandle),
@@ -120,6 +177,24 @@ pub struct UikaLifecycleApi {
     pub register_pinned: unsafe extern "C" fn(obj: UObjectHandle),
     /// Unregister a Pinned object from destroy notification.
     pub unregister_pinned: unsafe extern "C" fn(obj: UObjectHandle),
+
+    // -- Object epoch --
+
+    /// Address of the object destruction epoch: a `u64` C++ bumps whenever
+    /// an object may have stopped being valid (deletes, GC start, calls that
+    /// run game code). Read it atomically; the address is stable.
+    pub object_epoch: unsafe extern "C" fn() -> *const u64,
+
+    // -- Bulk root set / pinned registration --
+
+    /// `add_gc_root` for `count` objects. Roots are counted per object.
+    pub add_gc_root_many: unsafe extern "C" fn(objs: *const UObjectHandle, count: u32),
+    /// `remove_gc_root` for `count` objects.
+    pub remove_gc_root_many: unsafe extern "C" fn(objs: *const UObjectHandle, count: u32),
+    /// `register_pinned` for `count` objects.
+    pub register_pinned_many: unsafe extern "C" fn(objs: *const UObjectHandle, count: u32),
+    /// `unregister_pinned` for `count` objects.
+    pub unregister_pinned_many: unsafe extern "C" fn(objs: *const UObjectHandle, count: u32),
 }
 
 // ---------------------------------------------------------------------------
@@ -175,6 +250,100 @@ pub struct UikaPropertyApi {
         obj: UObjectHandle, prop: FPropertyHandle,
         index: u32, in_buf: *const u8, buf_size: u32,
     ) -> UikaErrorCode,
+
+    // -- Batched access (one crossing for many properties on one object) --
+
+    /// Run `count` read/write ops against `obj` in order. Each op moves one
+    /// property value to/from `io_buf + ops[i].buf_offset`. Stops at the first
+    /// failing op and returns its error; earlier ops have already been applied.
+    pub batch: unsafe extern "C" fn(
+        obj: UObjectHandle,
+        ops: *const UikaPropOp,
+        count: u32,
+        io_buf: *mut u8,
+    ) -> UikaErrorCode,
+
+    // -- Gather/scatter (one property, many objects) --
+
+    /// Copy `prop` from each of `count` objects into `out_buf + i * stride`
+    /// (`stride` 0 = element size). Null objects produce zeroed elements.
+    /// Supports bool (1 byte), object (handle), plain-old-data struct and POD
+    /// properties; `TypeMismatch` otherwise, or if the element does not match
+    /// `elem` (`UIKA_GATHER_ANY`, `UIKA_GATHER_BOOL` or an element size).
+    /// Each slot receives exactly the element size.
+    pub gather: unsafe extern "C" fn(
+        objs: *const UObjectHandle,
+        count: u32,
+        prop: FPropertyHandle,
+        out_buf: *mut u8,
+        stride: u32,
+        elem: u32,
+    ) -> UikaErrorCode,
+
+    /// Write `in_buf + i * stride` into `prop` on each of `count` objects.
+    /// Null objects are skipped. `elem` as for `gather`.
+    pub scatter: unsafe extern "C" fn(
+        objs: *const UObjectHandle,
+        count: u32,
+        prop: FPropertyHandle,
+        in_buf: *const u8,
+        stride: u32,
+        elem: u32,
+    ) -> UikaErrorCode,
+
+    /// Read an FString/FText converted straight from its in-place storage.
+    /// `out_len` always receives the exact UTF-8 length. Returns
+    /// `BufferTooSmall` (writing nothing) if `buf_len` is shorter.
+    pub get_string_exact: unsafe extern "C" fn(
+        obj: UObjectHandle,
+        prop: FPropertyHandle,
+        buf: *mut u8,
+        buf_len: u32,
+        out_len: *mut u32,
+    ) -> UikaErrorCode,
+
+    /// Borrow the live UTF-16 storage of an FString/FText. The view is only
+    /// valid until the property is written or the container is destroyed.
+    pub get_string_view: unsafe extern "C" fn(
+        obj: UObjectHandle,
+        prop: FPropertyHandle,
+        out: *mut UikaUtf16View,
+    ) -> UikaErrorCode,
+
+    // --- Math fast paths ---
+
+    /// Read an FVector property in the canonical math ABI. Unlike `get_struct`
+    /// there is no size negotiation; `TypeMismatch` if the property is not an
+    /// FVector. The same holds for the rotator/transform accessors below.
+    pub get_vector: unsafe extern "C" fn(obj: UObjectHandle, prop: FPropertyHandle, out: *mut UikaVector) -> UikaErrorCode,
+    pub set_vector: unsafe extern "C" fn(obj: UObjectHandle, prop: FPropertyHandle, val: *const UikaVector) -> UikaErrorCode,
+    pub get_rotator: unsafe extern "C" fn(obj: UObjectHandle, prop: FPropertyHandle, out: *mut UikaRotator) -> UikaErrorCode,
+    pub set_rotator: unsafe extern "C" fn(obj: UObjectHandle, prop: FPropertyHandle, val: *const UikaRotator) -> UikaErrorCode,
+    pub get_transform: unsafe extern "C" fn(obj: UObjectHandle, prop: FPropertyHandle, out: *mut UikaTransform) -> UikaErrorCode,
+    pub set_transform: unsafe extern "C" fn(obj: UObjectHandle, prop: FPropertyHandle, val: *const UikaTransform) -> UikaErrorCode,
+
+    // --- Property paths ---
+
+    /// Copy one element of `leaf` stored at `obj + offset` (from
+    /// `reflection.resolve_property_path`) into `out_buf`, without touching
+    /// the enclosing structs. Bools are one byte (0/1), objects one
+    /// `UObjectHandle`, POD leaves the property's element layout; any other
+    /// leaf is `TypeMismatch`. `BufferTooSmall` if `buf_size` is short.
+    pub get_at_offset: unsafe extern "C" fn(
+        obj: UObjectHandle,
+        leaf: FPropertyHandle,
+        offset: u32,
+        out_buf: *mut u8,
+        buf_size: u32,
+    ) -> UikaErrorCode,
+    /// Write one element of `leaf` at `obj + offset` from `in_buf`.
+    pub set_at_offset: unsafe extern "C" fn(
+        obj: UObjectHandle,
+        leaf: FPropertyHandle,
+        offset: u32,
+        in_buf: *const u8,
+        buf_size: u32,
+    ) -> UikaErrorCode,
 }
 
 // ---------------------------------------------------------------------------
@@ -259,6 +428,68 @@ pub struct UikaReflectionApi {
 
     /// Destroy struct memory (calls C++ destructors for non-trivial members).
     pub destroy_struct: unsafe extern "C" fn(ustruct: UStructHandle, data: *mut u8) -> UikaErrorCode,
+
+    // ---- Layout descriptors (direct field access) ----
+
+    /// Describe a property's offset, size and POD/bool layout within its container.
+    pub get_field_desc: unsafe extern "C" fn(prop: FPropertyHandle, out: *mut UikaFieldDesc) -> UikaErrorCode,
+
+    /// Hash of a UClass/UScriptStruct property layout (names, types, offsets,
+    /// sizes). Struct handles are passed cast to `UClassHandle`. Returns 0 for null.
+    pub get_layout_hash: unsafe extern "C" fn(cls: UClassHandle) -> u64,
+
+    // ---- Batched resolution ----
+
+    /// Resolve `count` lookups in one call, filling each `result`. All
+    /// name lookups share the C++ reflection cache. Returns the number of
+    /// non-null results.
+    pub resolve_many: unsafe extern "C" fn(reqs: *mut UikaResolveReq, count: u32) -> u32,
+
+    // ---- Parameter frames (cached per-UFunction plan) ----
+
+    /// Size, alignment and construct/destroy counts of a UFunction's frame.
+    pub get_frame_layout: unsafe extern "C" fn(func: UFunctionHandle, out: *mut UikaFrameLayout) -> UikaErrorCode,
+
+    /// Initialize a parameter frame in caller-owned memory. Returns
+    /// `BufferTooSmall` if `buf_len < size`, `InvalidOperation` if misaligned.
+    pub init_params: unsafe extern "C" fn(func: UFunctionHandle, buf: *mut u8, buf_len: u32) -> UikaErrorCode,
+
+    /// Destroy a frame initialized by `init_params` (memory is not freed).
+    pub destroy_params: unsafe extern "C" fn(func: UFunctionHandle, buf: *mut u8) -> UikaErrorCode,
+
+    // ---- Command buffers (packed calls of generated wrappers) ----
+
+    /// Execute every record of a command buffer (see `command_types`) in one
+    /// crossing, dispatching each through its generated packed-args thunk.
+    /// A record whose function has no thunk, or whose wrapper fails (e.g.
+    /// destroyed target), is counted in `*out_failed` and skipped. Returns
+    /// `InvalidOperation` at the first malformed record; `*out_executed`
+    /// then holds how many records were processed before it.
+    pub execute_command_buffer: unsafe extern "C" fn(
+        buf: *const u8,
+        len: u32,
+        out_executed: *mut u32,
+        out_failed: *mut u32,
+    ) -> UikaErrorCode,
+
+    /// Whether `func_id` has a command-buffer thunk.
+    pub has_command_thunk: unsafe extern "C" fn(func_id: u32) -> bool,
+
+    // ---- Property paths ----
+
+    /// Resolve a dotted path (`"Transform.Translation.X"`, `"Slots[2].Count"`)
+    /// through struct properties and fixed-array indices, starting at a class
+    /// (or struct, cast to `UClassHandle`). `out_desc` describes the leaf with
+    /// `offset` measured from the container base; an indexed leaf has
+    /// `array_dim` 1. `PropertyNotFound` / `TypeMismatch` (step into a
+    /// non-struct) / `IndexOutOfRange` / `InvalidOperation` (malformed path).
+    pub resolve_property_path: unsafe extern "C" fn(
+        owner: UClassHandle,
+        path: *const u8,
+        path_len: u32,
+        out_leaf: *mut FPropertyHandle,
+        out_desc: *mut UikaFieldDesc,
+    ) -> UikaErrorCode,
 }
 
 /// Phase 7: Container operations (TArray / TMap / TSet).
@@ -372,8 +603,168 @@ pub struct UikaContainerApi {
         out_buf: *mut u8, buf_size: u32,
         out_total_written: *mut u32, out_count: *mut i32,
     ) -> UikaErrorCode,
+
+    // -- Cursor iteration (TMap / TSet) --
+    // A cursor is an internal sparse index; -1 means end. Any add/remove
+    // invalidates outstanding cursors.
+
+    /// First valid cursor, or -1 if the map is empty or the object is invalid.
+    pub map_iter_begin: unsafe extern "C" fn(obj: UObjectHandle, prop: FPropertyHandle) -> i32,
+
+    /// Read the pair at `*cursor`, then advance `*cursor` to the next valid
+    /// index (-1 at the end). IndexOutOfRange if `*cursor` is not a valid slot.
+    pub map_iter_next: unsafe extern "C" fn(
+        obj: UObjectHandle, prop: FPropertyHandle,
+        cursor: *mut i32,
+        out_key_buf: *mut u8, key_buf_size: u32, out_key_written: *mut u32,
+        out_val_buf: *mut u8, val_buf_size: u32, out_val_written: *mut u32,
+    ) -> UikaErrorCode,
+
+    /// First valid cursor, or -1 if the set is empty or the object is invalid.
+    pub set_iter_begin: unsafe extern "C" fn(obj: UObjectHandle, prop: FPropertyHandle) -> i32,
+
+    /// Read the element at `*cursor`, then advance `*cursor` (see `map_iter_next`).
+    pub set_iter_next: unsafe extern "C" fn(
+        obj: UObjectHandle, prop: FPropertyHandle,
+        cursor: *mut i32,
+        out_buf: *mut u8, buf_size: u32, out_written: *mut u32,
+    ) -> UikaErrorCode,
+    // --- Exact-size queries and chunked copies ---
+
+    /// Exact byte count `array_copy_all` would write. `out_count` < 0 means
+    /// raw format (`-out_count` elements).
+    pub array_copy_size: unsafe extern "C" fn(
+        obj: UObjectHandle, prop: FPropertyHandle,
+        out_size: *mut u32, out_count: *mut i32,
+    ) -> UikaErrorCode,
+    /// Exact byte count `map_copy_all` would write.
+    pub map_copy_size: unsafe extern "C" fn(
+        obj: UObjectHandle, prop: FPropertyHandle,
+        out_size: *mut u32, out_count: *mut i32,
+    ) -> UikaErrorCode,
+    /// Exact byte count `set_copy_all` would write.
+    pub set_copy_size: unsafe extern "C" fn(
+        obj: UObjectHandle, prop: FPropertyHandle,
+        out_size: *mut u32, out_count: *mut i32,
+    ) -> UikaErrorCode,
+    /// Copy as many whole elements as fit, starting at `*cursor` (0 = begin).
+    /// Advances `*cursor` (-1 = done). `out_count` is the element count in
+    /// this chunk, negative for raw format. If the first element does not
+    /// fit, returns BufferTooSmall with its exact size in `out_written`.
+    pub array_copy_chunk: unsafe extern "C" fn(
+        obj: UObjectHandle, prop: FPropertyHandle,
+        cursor: *mut i32,
+        out_buf: *mut u8, buf_size: u32, out_written: *mut u32, out_count: *mut i32,
+    ) -> UikaErrorCode,
+    /// Map counterpart of `array_copy_chunk` (framed key/value pairs).
+    pub map_copy_chunk: unsafe extern "C" fn(
+        obj: UObjectHandle, prop: FPropertyHandle,
+        cursor: *mut i32,
+        out_buf: *mut u8, buf_size: u32, out_written: *mut u32, out_count: *mut i32,
+    ) -> UikaErrorCode,
+    /// Set counterpart of `array_copy_chunk`.
+    pub set_copy_chunk: unsafe extern "C" fn(
+        obj: UObjectHandle, prop: FPropertyHandle,
+        cursor: *mut i32,
+        out_buf: *mut u8, buf_size: u32, out_written: *mut u32, out_count: *mut i32,
+    ) -> UikaErrorCode,
+
+    // --- In-place TArray data (raw-copyable inner types only) ---
+
+    /// Pointer to the array's element storage (null when empty), its length
+    /// and element size. Valid until the array is next resized.
+    pub array_data: unsafe extern "C" fn(
+        obj: UObjectHandle, prop: FPropertyHandle,
+        out_data: *mut *mut u8, out_len: *mut i32, out_elem_size: *mut u32,
+    ) -> UikaErrorCode,
+    /// Ensure capacity for at least `capacity` elements (one reallocation).
+    pub array_reserve: unsafe extern "C" fn(
+        obj: UObjectHandle, prop: FPropertyHandle, capacity: i32,
+    ) -> UikaErrorCode,
+    /// Append `count` elements in one growth, copied from `data` or zeroed
+    /// when `data` is null. `out_data` (optional) receives the first new one.
+    pub array_append_raw: unsafe extern "C" fn(
+        obj: UObjectHandle, prop: FPropertyHandle,
+        data: *const u8, count: i32, out_data: *mut *mut u8,
+    ) -> UikaErrorCode,
+
+    // --- Bulk map/set population ---
+
+    /// Replace the map with `count` framed key/value pairs (the
+    /// `map_copy_all` layout). Reserves once and rehashes once.
+    pub map_set_all: unsafe extern "C" fn(
+        obj: UObjectHandle, prop: FPropertyHandle,
+        in_buf: *const u8, buf_size: u32, count: i32,
+    ) -> UikaErrorCode,
+    /// Insert or replace `count` framed pairs with a single rehash.
+    pub map_add_many: unsafe extern "C" fn(
+        obj: UObjectHandle, prop: FPropertyHandle,
+        in_buf: *const u8, buf_size: u32, count: i32,
+    ) -> UikaErrorCode,
+    /// Replace the set with `count` framed elements.
+    pub set_set_all: unsafe extern "C" fn(
+        obj: UObjectHandle, prop: FPropertyHandle,
+        in_buf: *const u8, buf_size: u32, count: i32,
+    ) -> UikaErrorCode,
+    /// Insert `count` framed elements with a single rehash.
+    pub set_add_many: unsafe extern "C" fn(
+        obj: UObjectHandle, prop: FPropertyHandle,
+        in_buf: *const u8, buf_size: u32, count: i32,
+    ) -> UikaErrorCode,
+
+    // --- Container algorithms (in place, no element data copied out) ---
+
+    /// Index of the first element at or after `start` identical to the one
+    /// in `in_buf` (`FProperty::Identical`), or -1 in `out_index`.
+    pub array_find: unsafe extern "C" fn(
+        obj: UObjectHandle, prop: FPropertyHandle,
+        in_buf: *const u8, buf_size: u32, start: i32, out_index: *mut i32,
+    ) -> UikaErrorCode,
+    /// Remove every element identical to the one in `in_buf`.
+    pub array_remove_all_by_value: unsafe extern "C" fn(
+        obj: UObjectHandle, prop: FPropertyHandle,
+        in_buf: *const u8, buf_size: u32, out_removed: *mut i32,
+    ) -> UikaErrorCode,
+    /// Remove repeated elements, keeping the first occurrence in order.
+    pub array_dedupe: unsafe extern "C" fn(
+        obj: UObjectHandle, prop: FPropertyHandle, out_removed: *mut i32,
+    ) -> UikaErrorCode,
+    /// Stable sort by `key` (`UIKA_SORT_*`). `origin` points to 3 doubles and
+    /// is read only for `UIKA_SORT_BY_DISTANCE`.
+    pub array_sort: unsafe extern "C" fn(
+        obj: UObjectHandle, prop: FPropertyHandle,
+        key: u32, descending: bool, origin: *const f64,
+    ) -> UikaErrorCode,
+    pub array_swap: unsafe extern "C" fn(
+        obj: UObjectHandle, prop: FPropertyHandle, a: i32, b: i32,
+    ) -> UikaErrorCode,
+    /// Insert one element before `index` (`index == len` appends).
+    pub array_insert_at: unsafe extern "C" fn(
+        obj: UObjectHandle, prop: FPropertyHandle,
+        index: i32, in_buf: *const u8, buf_size: u32,
+    ) -> UikaErrorCode,
+    pub array_remove_range: unsafe extern "C" fn(
+        obj: UObjectHandle, prop: FPropertyHandle, index: i32, count: i32,
+    ) -> UikaErrorCode,
+    /// Add every element of another TSet property of the same element type.
+    pub set_union: unsafe extern "C" fn(
+        obj: UObjectHandle, prop: FPropertyHandle,
+        other_obj: UObjectHandle, other_prop: FPropertyHandle,
+    ) -> UikaErrorCode,
+    /// Remove every element also present in another TSet property.
+    pub set_difference: unsafe extern "C" fn(
+        obj: UObjectHandle, prop: FPropertyHandle,
+        other_obj: UObjectHandle, other_prop: FPropertyHandle,
+    ) -> UikaErrorCode,
 }
 
+/// `UikaContainerApi::array_sort` key: natural order of numerics, bools,
+/// enums, strings, names and text.
+pub const UIKA_SORT_BY_VALUE: u32 = 0;
+/// `UikaContainerApi::array_sort` key: actor / scene-component elements by
+/// distance to the origin; other elements sort last.
+pub const UIKA_SORT_BY_DISTANCE: u32 = 1;
+
 /// Phase 8: Delegate binding / unbinding / broadcast.
 #[repr(C)]
 pub struct UikaDelegateApi {
@@ -413,6 +804,27 @@ pub struct UikaDelegateApi {
         out_buf_size: u32,
         out_written: *mut u32,
     ) -> UikaErrorCode,
+
+    /// Like `bind_delegate`, but each fire is copied into the queued-event
+    /// buffer instead of calling into Rust. The signature may only carry
+    /// by-value primitives, enums, names, strings, text, objects and POD
+    /// structs (no return value or out params); otherwise `TypeMismatch`.
+    pub bind_delegate_queued: unsafe extern "C" fn(
+        obj: UObjectHandle,
+        prop: FPropertyHandle,
+        callback_id: u64,
+    ) -> UikaErrorCode,
+    /// Queued counterpart of `add_multicast`. Removal uses `remove_multicast`.
+    pub add_multicast_queued: unsafe extern "C" fn(
+        obj: UObjectHandle,
+        prop: FPropertyHandle,
+        callback_id: u64,
+    ) -> UikaErrorCode,
+    /// Hand over every event queued since the previous call and start a new
+    /// queue. The returned view is valid until the next call.
+    pub take_queued_events: unsafe extern "C" fn(
+        out: *mut UikaDelegateEventBatch,
+    ) -> UikaErrorCode,
 }
 
 /// Phase 9: Reify — runtime class creation, property/function registration.
@@ -471,11 +883,64 @@ pub struct UikaReifyApi {
         owner: UObjectHandle,
         name: *const u8, name_len: u32,
     ) -> UObjectHandle,
+
+    /// Live reified instances whose class is `cls` or derives from it (`cls`
+    /// may be native, reified or a Blueprint subclass of a reified class).
+    /// Garbage-flagged objects are skipped. Writes up to `capacity` handles;
+    /// `out_count` receives the total, and the call returns `BufferTooSmall`
+    /// if the total exceeds `capacity`.
+    pub get_instances: unsafe extern "C" fn(
+        cls: UClassHandle,
+        out: *mut UObjectHandle,
+        capacity: u32,
+        out_count: *mut u32,
+    ) -> UikaErrorCode,
+
+    /// Map a hot-reload snapshot arena of `size` bytes, replacing any previous
+    /// one. The arena belongs to the plugin, not to either DLL, so it survives
+    /// the DLL swap. Returns null when `size` is 0 or mapping fails.
+    pub snapshot_alloc: unsafe extern "C" fn(size: u32) -> *mut u8,
+
+    /// The current snapshot arena, or null if none; `out_len` receives the
+    /// size passed to `snapshot_alloc`.
+    pub snapshot_data: unsafe extern "C" fn(out_len: *mut u32) -> *const u8,
+
+    // --- Schema registration ---
+
+    /// Create, populate and finalize every class in a serialized schema
+    /// (layout in `reify_types`) in one call. `out_classes` receives one
+    /// handle per class in schema order, null for classes that could not be
+    /// created or finalized. Returns `InvalidOperation` for a malformed
+    /// schema (nothing is created), `BufferTooSmall` if `out_capacity` is
+    /// below the class count, and `InternalError` if any class or member
+    /// failed.
+    pub register_class_from_schema: unsafe extern "C" fn(
+        blob: *const u8,
+        len: u32,
+        out_classes: *mut UClassHandle,
+        out_capacity: u32,
+    ) -> UikaErrorCode,
+
+    // --- Class tick ---
+
+    /// Tick every live instance of `cls` (and of its Blueprint children)
+    /// through one tick function per world in `tick_group` (`UIKA_TICK_GROUP_*`):
+    /// each frame `UikaRustCallbacks::tick_class` receives the handles of all
+    /// instances that have begun play. Instances are not ticked while pooled,
+    /// being destroyed or when their world is paused. Per-actor `ReceiveTick`
+    /// is unaffected. `InvalidCast` if `cls` is not a reified actor class.
+    pub enable_class_tick: unsafe extern "C" fn(cls: UClassHandle, tick_group: u32) -> UikaErrorCode,
 }
 
 pub const UIKA_COMP_ROOT: u32 = 1;
 pub const UIKA_COMP_TRANSIENT: u32 = 2;
 
+/// `enable_class_tick` groups (values of `ETickingGroup`).
+pub const UIKA_TICK_GROUP_PRE_PHYSICS: u32 = 0;
+pub const UIKA_TICK_GROUP_DURING_PHYSICS: u32 = 2;
+pub const UIKA_TICK_GROUP_POST_PHYSICS: u32 = 4;
+pub const UIKA_TICK_GROUP_POST_UPDATE_WORK: u32 = 6;
+
 /// Widget creation and WidgetTree management (UMG).
 ///
 /// `CreateWidget<T>()` is a C++ template not in UE reflection, so we expose it
@@ -499,6 +964,28 @@ pub struct UikaWidgetApi {
     pub get_widget_tree: unsafe extern "C" fn(
         user_widget: UObjectHandle,
     ) -> UObjectHandle,
+
+    // --- Declarative construction ---
+
+    /// Build a whole widget hierarchy under `user_widget`'s WidgetTree from a
+    /// serialized description (see `widget_types` for the layout): construct
+    /// every node, add it to its parent panel, apply widget and slot
+    /// initializers, and set the root. The description is validated before
+    /// anything is constructed.
+    ///
+    /// Handles of nodes flagged `UIKA_WIDGET_NODE_KEEP` are written to
+    /// `out_handles` in node order; `*out_count` receives how many there are.
+    /// Returns `BufferTooSmall` (building nothing) if that exceeds
+    /// `out_capacity`. A node name already taken by a widget in the tree is
+    /// an `InvalidOperation` rather than a replacement.
+    pub build_widget_tree: unsafe extern "C" fn(
+        user_widget: UObjectHandle,
+        desc: *const u8,
+        desc_len: u32,
+        out_handles: *mut UObjectHandle,
+        out_capacity: u32,
+        out_count: *mut u32,
+    ) -> UikaErrorCode,
 }
 
 /// World-level queries (spawn, find actors, etc.).
@@ -564,4 +1051,238 @@ pub struct UikaWorldApi {
         transform_buf: *const u8,
         transform_size: u32,
     ) -> UikaErrorCode,
+
+    // --- Per-class actor index ---
+
+    /// Like `get_all_actors_of_class`, answered from the world's per-class
+    /// actor index, and also writes the index generation the result reflects.
+    /// Pass that generation to `get_actor_changes` to receive only later
+    /// adds/removes.
+    pub get_actors_of_class_indexed: unsafe extern "C" fn(
+        world: UObjectHandle,
+        class: UClassHandle,
+        out_buf: *mut u8,
+        buf_byte_size: u32,
+        out_count: *mut u32,
+        out_generation: *mut u64,
+    ) -> UikaErrorCode,
+
+    /// Changes to actors of `class` (and subclasses) after generation `since`,
+    /// oldest first. `out_generation` receives the current generation.
+    /// Returns `IndexOutOfRange` if that history was trimmed (re-query the
+    /// full set), or `BufferTooSmall` with the required count in `out_count`.
+    pub get_actor_changes: unsafe extern "C" fn(
+        world: UObjectHandle,
+        class: UClassHandle,
+        since: u64,
+        out_changes: *mut UikaActorChange,
+        capacity: u32,
+        out_count: *mut u32,
+        out_generation: *mut u64,
+    ) -> UikaErrorCode,
+
+    // --- Batched spawning ---
+
+    /// Spawn `count` actors of `class` in one call. `transforms` holds `count`
+    /// FTransform buffers of `transform_stride` bytes each (null = identity
+    /// for all). Spawn parameters are built once per batch;
+    /// an Undefined `collision_method` is resolved once from the class default.
+    /// `out_handles` (length `count`) receives null where a spawn failed;
+    /// `out_spawned` receives the number of successful spawns.
+    pub spawn_actors_batch: unsafe extern "C" fn(
+        world: UObjectHandle,
+        class: UClassHandle,
+        transforms: *const u8,
+        transform_stride: u32,
+        count: u32,
+        owner: UObjectHandle,
+        collision_method: u8,
+        out_handles: *mut UObjectHandle,
+        out_spawned: *mut u32,
+    ) -> UikaErrorCode,
+
+    /// Deferred-construction variant of `spawn_actors_batch`. Configure the
+    /// actors, then complete them all with `finish_spawning_batch`.
+    pub spawn_actors_deferred_batch: unsafe extern "C" fn(
+        world: UObjectHandle,
+        class: UClassHandle,
+        transforms: *const u8,
+        transform_stride: u32,
+        count: u32,
+        owner: UObjectHandle,
+        instigator: UObjectHandle,
+        collision_method: u8,
+        out_handles: *mut UObjectHandle,
+        out_spawned: *mut u32,
+    ) -> UikaErrorCode,
+
+    /// Call FinishSpawning on each of `count` deferred actors (null entries are
+    /// skipped), with transforms laid out as in `spawn_actors_batch`.
+    pub finish_spawning_batch: unsafe extern "C" fn(
+        actors: *const UObjectHandle,
+        transforms: *const u8,
+        transform_stride: u32,
+        count: u32,
+    ) -> UikaErrorCode,
+
+    // --- Actor pooling ---
+
+    /// Spawn `count` actors of `class` directly into the world's pool
+    /// (hidden, no collision, not ticking). Pools are keyed by exact class.
+    pub pool_prewarm: unsafe extern "C" fn(
+        world: UObjectHandle,
+        class: UClassHandle,
+        count: u32,
+        out_spawned: *mut u32,
+    ) -> UikaErrorCode,
+
+    /// Take a pooled actor of `class`, move it to the transform and restore
+    /// its class-default visibility, collision and ticking. Spawns a fresh
+    /// actor if the pool is empty (`out_reused` = false).
+    pub pool_acquire: unsafe extern "C" fn(
+        world: UObjectHandle,
+        class: UClassHandle,
+        transform_buf: *const u8,
+        transform_size: u32,
+        out_actor: *mut UObjectHandle,
+        out_reused: *mut bool,
+    ) -> UikaErrorCode,
+
+    /// Deactivate an actor and return it to its class's pool.
+    /// `InvalidOperation` if it is already pooled or being destroyed.
+    pub pool_release: unsafe extern "C" fn(actor: UObjectHandle) -> UikaErrorCode,
+
+    /// Destroy the pooled (inactive) actors of `class`, or of every class if
+    /// `class` is null.
+    pub pool_clear: unsafe extern "C" fn(
+        world: UObjectHandle,
+        class: UClassHandle,
+        out_destroyed: *mut u32,
+    ) -> UikaErrorCode,
+
+    // --- Asynchronous asset loading ---
+
+    /// Start loading the object at `path_utf8` through FStreamableManager.
+    /// `priority` is a TAsyncLoadPriority (higher loads first). On completion
+    /// (or cancellation) C++ calls `invoke_delegate_callback(callback_id, p)`
+    /// with `p` pointing at a `UikaAssetLoadResult`. `class` may be null.
+    /// The request stops keeping the objects loaded when the callback
+    /// returns; the callback must root any it keeps.
+    pub load_object_async: unsafe extern "C" fn(
+        class: UClassHandle,
+        path_utf8: *const u8,
+        path_len: u32,
+        priority: i32,
+        callback_id: u64,
+        out_request: *mut u64,
+    ) -> UikaErrorCode,
+
+    /// Batched `load_object_async`: one request and one callback for all
+    /// `paths`, with results in path order.
+    pub load_objects_async: unsafe extern "C" fn(
+        class: UClassHandle,
+        paths: *const UikaStrView,
+        path_count: u32,
+        priority: i32,
+        callback_id: u64,
+        out_request: *mut u64,
+    ) -> UikaErrorCode,
+
+    /// Cancel an in-flight request. Its callback fires synchronously with
+    /// `UIKA_ASSET_LOAD_CANCELLED`. `InvalidOperation` if it already completed.
+    pub cancel_async_load: unsafe extern "C" fn(request: u64) -> UikaErrorCode,
+
+    // --- State mirrors ---
+
+    /// Subscribe `objs` to a per-frame mirror of `columns`, filled by a tick
+    /// function in `world` at `tick_group` (`UIKA_TICK_GROUP_*`). The first
+    /// snapshot is taken before returning. Property columns must be POD
+    /// (`TypeMismatch` otherwise). Game thread only.
+    pub mirror_create: unsafe extern "C" fn(
+        world: UObjectHandle,
+        columns: *const UikaMirrorColumn,
+        column_count: u32,
+        objs: *const UObjectHandle,
+        obj_count: u32,
+        tick_group: u32,
+        out_id: *mut u64,
+        out_view: *mut UikaMirrorView,
+    ) -> UikaErrorCode,
+
+    /// Replace the rows of a mirror and take a fresh snapshot (every row
+    /// dirty). The buffers are reallocated: the previous view is invalid.
+    pub mirror_set_objects: unsafe extern "C" fn(
+        id: u64,
+        objs: *const UObjectHandle,
+        obj_count: u32,
+        out_view: *mut UikaMirrorView,
+    ) -> UikaErrorCode,
+
+    /// Stop filling a mirror and free its buffers.
+    pub mirror_destroy: unsafe extern "C" fn(id: u64) -> UikaErrorCode,
+
+    // --- Batched collision queries ---
+
+    /// Run `count` line / sweep / overlap queries in one call, writing one
+    /// `UikaTraceHit` per request to `out_hits`. Game thread only.
+    pub trace_batch: unsafe extern "C" fn(
+        world: UObjectHandle,
+        requests: *const UikaTraceRequest,
+        count: u32,
+        out_hits: *mut UikaTraceHit,
+    ) -> UikaErrorCode,
+
+    /// Submit the queries as `UWorld` async traces. During the next world
+    /// tick C++ calls `invoke_delegate_callback(callback_id, p)` with `p`
+    /// pointing at a `UikaTraceBatchResult`. Submit from the game thread
+    /// while the world ticks.
+    pub trace_batch_async: unsafe extern "C" fn(
+        world: UObjectHandle,
+        requests: *const UikaTraceRequest,
+        count: u32,
+        callback_id: u64,
+        out_batch: *mut u64,
+    ) -> UikaErrorCode,
+
+    /// Cancel a pending async batch. Its callback fires synchronously with
+    /// `UIKA_TRACE_BATCH_CANCELLED`. `InvalidOperation` if it already completed.
+    pub cancel_trace_batch: unsafe extern "C" fn(batch: u64) -> UikaErrorCode,
+}
+
+// ---------------------------------------------------------------------------
+// Task API
+// ---------------------------------------------------------------------------
+
+/// Worker-thread tasks on UE's task system (`UE::Tasks`).
+///
+/// Every entry may be called from any thread. Task bodies run Rust code via
+/// `UikaRustCallbacks::run_job` / `run_job_range`; `job` is an opaque Rust
+/// value passed back unchanged. Task ids are never 0.
+#[repr(C)]
+pub struct UikaTaskApi {
+    /// Launch a task that calls `run_job(job)` once every task in `prereqs`
+    /// has completed. Unknown (released) prerequisite ids are ignored.
+    /// Returns 0 if the Rust callbacks are not available.
+    pub launch: unsafe extern "C" fn(job: u64, prereqs: *const u64, prereq_count: u32) -> u64,
+
+    /// Wait up to `timeout_ms` (`u32::MAX` = forever) for a task. Returns
+    /// whether it completed. Unknown ids count as completed.
+    pub wait: unsafe extern "C" fn(task: u64, timeout_ms: u32) -> bool,
+
+    /// Non-blocking completion check. Unknown ids count as completed.
+    pub is_completed: unsafe extern "C" fn(task: u64) -> bool,
+
+    /// Forget a task id. The task itself still runs to completion.
+    pub release: unsafe extern "C" fn(task: u64),
+
+    /// Split `0..count` into chunks of at least `min_batch` items and call
+    /// `run_job_range(job, begin, end)` for each across the workers (the
+    /// calling thread helps). Returns when every chunk is done.
+    pub parallel_for: unsafe extern "C" fn(job: u64, count: u32, min_batch: u32),
+
+    /// Number of task-graph worker threads.
+    pub worker_count: unsafe extern "C" fn() -> u32,
+
+    /// Whether the calling thread is the game thread.
+    pub is_game_thread: unsafe extern "C" fn() -> bool,
 }
@@ -1,5 +1,22 @@
 use crate::handles::UObjectHandle;
 
+/// One destroyed reified-class instance (see `drop_rust_instances`).
+#[repr(C)]
+#[derive(Clone, Copy, Debug)]
+pub struct UikaDeadInstance {
+    pub handle: UObjectHandle,
+    pub type_id: u64,
+}
+
+/// One instance in a `tick_class` batch: the object and the Rust data
+/// pointer read from its instance slot.
+#[repr(C)]
+#[derive(Clone, Copy, Debug)]
+pub struct UikaTickInstance {
+    pub handle: UObjectHandle,
+    pub data: *mut u8,
+}
+
 /// Callback table filled by Rust and returned to C++ from `uika_init`.
 /// C++ calls into Rust through these function pointers.
 #[repr(C)]
@@ -12,9 +29,12 @@ pub struct UikaRustCallbacks {
     ),
 
     /// UE → Rust function call forwarding (for Rust-defined UFunctions).
+    /// `rust_data` is the pointer stored in the object's instance slot by
+    /// `construct_rust_instance` (null if none was stored).
     pub invoke_rust_function: extern "C" fn(
         callback_id: u64,
         obj: UObjectHandle,
+        rust_data: *mut u8,
         params: *mut u8,
     ),
 
@@ -24,13 +44,63 @@ pub struct UikaRustCallbacks {
     /// Shutdown notification — Rust should release all resources.
     pub on_shutdown: extern "C" fn(),
 
-    /// Called by C++ when a reified class instance is constructed.
+    /// Called by C++ when a reified class instance is constructed. Returns
+    /// the instance data pointer, which C++ keeps in a hidden slot of the
+    /// object and passes back to `invoke_rust_function` and `tick_class`.
     pub construct_rust_instance: extern "C" fn(
         obj: UObjectHandle,
         type_id: u64,
         is_cdo: bool,
-    ),
+    ) -> *mut u8,
 
     /// Called by C++ when a Pinned object is destroyed (DestroyActor, level unload, etc.).
     pub notify_pinned_destroyed: extern "C" fn(handle: UObjectHandle),
+
+    /// Batched `drop_rust_instance`: every reified instance destroyed since
+    /// the last delivery, called once per GC purge.
+    pub drop_rust_instances: extern "C" fn(entries: *const UikaDeadInstance, count: u32),
+
+    /// Batched `notify_pinned_destroyed`, called once per GC purge.
+    pub notify_pinned_destroyed_many: extern "C" fn(handles: *const UObjectHandle, count: u32),
+
+    /// Hot reload, before teardown: serialize opted-in instance data into the
+    /// reify snapshot arena. Returns the number of instances written.
+    pub snapshot_rust_instances: extern "C" fn() -> u32,
+
+    /// Hot reload, after reconstruct: restore instance data from the snapshot
+    /// arena. Returns the number of instances restored.
+    pub restore_rust_instances: extern "C" fn() -> u32,
+
+    /// A reified actor was parked in an actor pool. Its Rust data stays
+    /// allocated (no `drop_rust_instance`) until it is acquired again.
+    pub on_pool_release: extern "C" fn(handle: UObjectHandle, type_id: u64),
+
+    /// A parked reified actor was taken out of an actor pool. Not called for
+    /// the fresh actor an acquire on an empty pool spawns.
+    pub on_pool_acquire: extern "C" fn(handle: UObjectHandle, type_id: u64),
+
+    /// `Uika.Stats`: log the `top_n` FFI entries by time and by call count,
+    /// then zero the counters if `reset` is set. Logs a notice instead when
+    /// the DLL was built without the `ffi-stats` feature.
+    pub dump_ffi_stats: extern "C" fn(top_n: u32, reset: bool),
+
+    /// Task body: run the job launched with `task.launch`. Worker thread.
+    pub run_job: extern "C" fn(job: u64),
+
+    /// One chunk of `task.parallel_for`: indices `begin..end`. Any thread.
+    pub run_job_range: extern "C" fn(job: u64, begin: u32, end: u32),
+
+    /// Start of every frame, on the game thread: run the continuations
+    /// queued with `run_on_game_thread` since the last drain.
+    pub drain_game_thread_queue: extern "C" fn(),
+
+    /// Class tick of `reify.enable_class_tick`: one call per class per world
+    /// per frame with every instance due to tick. Game thread. The array is
+    /// scratch owned by C++ and may be modified during the call.
+    pub tick_class: extern "C" fn(
+        type_id: u64,
+        instances: *mut UikaTickInstance,
+        count: u32,
+        delta_seconds: f32,
+    ),
 }
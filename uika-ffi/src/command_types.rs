@@ -0,0 +1,33 @@
+// Command buffer FFI types: the record layout consumed by
+// `reflection.execute_command_buffer`.
+//
+// A command buffer is a sequence of records, each starting on a
+// UIKA_CMD_ALIGN boundary:
+//
+// ```text
+// UikaCommandHeader     func_id, record size (header included, a multiple of
+//                       UIKA_CMD_ALIGN), target object (null for statics)
+// u64 slot × N          one per input parameter of the generated wrapper, in
+//                       declaration order
+// payload               struct and string bytes, each UIKA_CMD_ALIGN-aligned
+// ```
+//
+// Scalars (bool, integers, enums, floats, object handles, FNames) occupy the
+// low bytes of their slot, little-endian. Struct and string inputs store
+// `offset | (len << 32)`, with the offset measured from the record start.
+// Outputs and return values of the wrapper are discarded.
+
+use crate::handles::UObjectHandle;
+
+/// Record start and payload alignment.
+pub const UIKA_CMD_ALIGN: u32 = 16;
+/// Size of one argument slot.
+pub const UIKA_CMD_SLOT_SIZE: u32 = 8;
+
+#[repr(C)]
+#[derive(Clone, Copy, Debug)]
+pub struct UikaCommandHeader {
+    pub func_id: u32,
+    pub size: u32,
+    pub obj: UObjectHandle,
+}
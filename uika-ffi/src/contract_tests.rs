@@ -1,10 +1,20 @@
 // Compile-time contract tests: ensure handle sizes match C++ expectations.
 // These const assertions fail at compile time if sizes drift.
 
-use std::mem::size_of;
+use std::mem::{align_of, size_of};
 
 use crate::handles::*;
 use crate::error::UikaErrorCode;
+use crate::property_types::{UikaFieldDesc, UikaPropOp};
+use crate::reflection_types::{UikaFrameLayout, UikaResolveReq};
+use crate::delegate_types::UikaDelegateEventBatch;
+use crate::callbacks::{UikaDeadInstance, UikaTickInstance};
+use crate::world_types::{
+    UikaActorChange, UikaAssetLoadResult, UikaMirrorColumn, UikaMirrorView, UikaTraceBatchResult,
+    UikaTraceHit, UikaTraceRequest,
+};
+use crate::math_types::{UikaQuat, UikaRotator, UikaTransform, UikaVector};
+use crate::command_types::{UikaCommandHeader, UIKA_CMD_ALIGN};
 
 const _: () = assert!(size_of::<UObjectHandle>() == 8);
 const _: () = assert!(size_of::<UClassHandle>() == 8);
@@ -13,4 +23,62 @@ const _: () = assert!(size_of::<UFunctionHandle>() == 8);
 const _: () = assert!(size_of::<UStructHandle>() == 8);
 const _: () = assert!(size_of::<FNameHandle>() == 8);
 const _: () = assert!(size_of::<FWeakObjectHandle>() == 8);
+const _: () = assert!(size_of::<UikaStrView>() == 16);
+const _: () = assert!(size_of::<UikaUtf16View>() == 16);
+// Log field: two string views.
+const _: () = assert!(size_of::<UikaLogField>() == 32);
+// Object array view: 2 pointers + 6 x u32.
+const _: () = assert!(size_of::<UikaObjectArrayView>() == 40);
 const _: () = assert!(size_of::<UikaErrorCode>() == 4);
+
+// Batched property op descriptor: 8-byte handle + 4 x u32.
+const _: () = assert!(size_of::<UikaPropOp>() == 24);
+
+// Field descriptor: 4 x u32 + 4 x u8.
+const _: () = assert!(size_of::<UikaFieldDesc>() == 20);
+
+// Resolve request: 2 x u32 + owner pointer + UikaStrView + result pointer.
+const _: () = assert!(size_of::<UikaResolveReq>() == 40);
+
+// Frame layout: 4 x u32.
+const _: () = assert!(size_of::<UikaFrameLayout>() == 16);
+
+// Queued delegate event batch: data pointer + 2 x u32.
+const _: () = assert!(size_of::<UikaDelegateEventBatch>() == 16);
+
+// Dead instance record: handle + type id.
+const _: () = assert!(size_of::<UikaDeadInstance>() == 16);
+
+// Class tick record: handle + instance data pointer.
+const _: () = assert!(size_of::<UikaTickInstance>() == 16);
+
+// Actor index change record: handle + added flag + padding.
+const _: () = assert!(size_of::<UikaActorChange>() == 16);
+
+// Async asset load result: request id + objects pointer + 2 x u32.
+const _: () = assert!(size_of::<UikaAssetLoadResult>() == 24);
+
+// Mirror column: property handle + 2 x u32.
+const _: () = assert!(size_of::<UikaMirrorColumn>() == 16);
+
+// Mirror view: 5 pointers + 4 x u32.
+const _: () = assert!(size_of::<UikaMirrorView>() == 56);
+
+// Trace request: 2 vectors + ignore handle + 4 x u32 + padding (16-aligned).
+const _: () = assert!(size_of::<UikaTraceRequest>() == 96 && align_of::<UikaTraceRequest>() == 16);
+
+// Trace hit: 2 vectors + 2 handles + 4 x 32-bit fields.
+const _: () = assert!(size_of::<UikaTraceHit>() == 96 && align_of::<UikaTraceHit>() == 16);
+
+// Trace batch result: batch id + hits pointer + 2 x u32.
+const _: () = assert!(size_of::<UikaTraceBatchResult>() == 24);
+
+// Math ABI: four f64 lanes per register, 16-byte aligned (VectorRegister4Double).
+const _: () = assert!(size_of::<UikaVector>() == 32 && align_of::<UikaVector>() == 16);
+const _: () = assert!(size_of::<UikaQuat>() == 32 && align_of::<UikaQuat>() == 16);
+const _: () = assert!(size_of::<UikaRotator>() == 32 && align_of::<UikaRotator>() == 16);
+const _: () = assert!(size_of::<UikaTransform>() == 96 && align_of::<UikaTransform>() == 16);
+
+// Command buffer record header: func id + size + target handle, one alignment unit.
+const _: () = assert!(size_of::<UikaCommandHeader>() == 16);
+const _: () = assert!(size_of::<UikaCommandHeader>() as u32 == UIKA_CMD_ALIGN);
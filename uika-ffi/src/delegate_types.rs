@@ -0,0 +1,28 @@
+// Delegate FFI types: the queued-event batch handed to Rust by
+// `delegate.take_queued_events`.
+
+/// Borrowed view of all delegate events queued since the previous take.
+///
+/// `data` holds `count` records back to back, each laid out as
+/// `[u64 callback_id][u32 payload_len][u32 param_count]` followed by
+/// `payload_len` bytes of parameters. Each parameter is `[u32 size][bytes]`,
+/// with bytes encoded by the same rules as `delegate.read_param`. Records
+/// are not aligned; read them with unaligned loads.
+///
+/// The view stays valid until the next `take_queued_events` call.
+#[repr(C)]
+#[derive(Clone, Copy, Debug)]
+pub struct UikaDelegateEventBatch {
+    pub data: *const u8,
+    pub len: u32,
+    pub count: u32,
+}
+
+impl Default for UikaDelegateEventBatch {
+    fn default() -> Self {
+        Self { data: core::ptr::null(), len: 0, count: 0 }
+    }
+}
+
+/// Size of the per-record header (`callback_id`, `payload_len`, `param_count`).
+pub const UIKA_QUEUED_EVENT_HEADER_SIZE: usize = 16;
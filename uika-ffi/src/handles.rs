@@ -81,6 +81,68 @@ impl Default for FWeakObjectHandle {
     }
 }
 
+/// Borrowed UTF-8 string slice passed across the FFI boundary (not
+/// null-terminated). Used by bulk entry points that take many strings.
+#[repr(C)]
+#[derive(Clone, Copy, Debug)]
+pub struct UikaStrView {
+    pub ptr: *const u8,
+    pub len: u32,
+    pub _pad: u32,
+}
+
+impl UikaStrView {
+    #[inline]
+    pub fn new(s: &str) -> Self {
+        UikaStrView { ptr: s.as_ptr(), len: s.len() as u32, _pad: 0 }
+    }
+}
+
+/// Key/value field of a structured log record (`logging.log_record`).
+#[repr(C)]
+#[derive(Clone, Copy, Debug)]
+pub struct UikaLogField {
+    pub key: UikaStrView,
+    pub value: UikaStrView,
+}
+
+/// Borrowed UTF-16 view into live FString storage (`len` in code units).
+/// Only valid until the owning string is modified or freed.
+#[repr(C)]
+#[derive(Clone, Copy, Debug)]
+pub struct UikaUtf16View {
+    pub ptr: *const u16,
+    pub len: u32,
+    pub _pad: u32,
+}
+
+impl Default for UikaUtf16View {
+    fn default() -> Self {
+        UikaUtf16View { ptr: core::ptr::null(), len: 0, _pad: 0 }
+    }
+}
+
+/// Read-only view of `GUObjectArray` for resolving weak pointers without a
+/// crossing (`core.get_object_array_view`). `chunks` points at a C++-owned
+/// table of chunk base addresses, of which the first `*num_chunks` are
+/// published; chunks never move once published. An index in an unpublished
+/// chunk must go through `resolve_weak`, which publishes it. Game thread only.
+#[repr(C)]
+#[derive(Clone, Copy, Debug)]
+pub struct UikaObjectArrayView {
+    pub chunks: *const *const u8,
+    pub num_chunks: *const u32,
+    pub elements_per_chunk: u32,
+    /// `sizeof(FUObjectItem)` and the offsets of its fields.
+    pub item_size: u32,
+    pub object_offset: u32,
+    pub flags_offset: u32,
+    pub serial_offset: u32,
+    /// Internal object flags that make `FWeakObjectPtr::Get` return null
+    /// (Unreachable | Garbage).
+    pub dead_flags: i32,
+}
+
 // Handles are raw FFI identifiers. They can be sent across threads
 // (but must only be *used* on the game thread).
 // Sync is needed for OnceLock caching in generated code.
@@ -96,3 +158,7 @@ unsafe impl Send for UStructHandle {}
 unsafe impl Sync for UStructHandle {}
 unsafe impl Send for FWeakObjectHandle {}
 unsafe impl Sync for FWeakObjectHandle {}
+unsafe impl Send for UikaLogField {}
+unsafe impl Sync for UikaLogField {}
+unsafe impl Send for UikaObjectArrayView {}
+unsafe impl Sync for UikaObjectArrayView {}
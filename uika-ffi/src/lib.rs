@@ -6,6 +6,13 @@ pub mod error;
 pub mod api_table;
 pub mod callbacks;
 pub mod reify_types;
+pub mod property_types;
+pub mod reflection_types;
+pub mod delegate_types;
+pub mod world_types;
+pub mod widget_types;
+pub mod math_types;
+pub mod command_types;
 pub mod contract_tests;
 
 pub use handles::*;
@@ -13,4 +20,11 @@ pub use error::*;
 pub use api_table::*;
 pub use callbacks::*;
 pub use reify_types::*;
+pub use property_types::*;
+pub use reflection_types::*;
+pub use delegate_types::*;
+pub use world_types::*;
+pub use widget_types::*;
+pub use math_types::*;
+pub use command_types::*;
 pub use uika_ue_flags::*;
@@ -0,0 +1,62 @@
+// Math FFI types: the canonical, SIMD-aligned ABI for vectors, rotators,
+// quaternions and transforms crossing the boundary.
+//
+// Every type is four f64 lanes (32 bytes), 16-byte aligned like UE's
+// VectorRegister4Double, so a `UikaTransform` is the same 96 bytes as a
+// C++ FTransform (Rotation, Translation, Scale3D registers). Padding lanes
+// are written as zero and ignored on read.
+
+/// FVector (x, y, z) padded to a full register.
+#[repr(C, align(16))]
+#[derive(Clone, Copy, Debug, Default, PartialEq)]
+pub struct UikaVector {
+    pub x: f64,
+    pub y: f64,
+    pub z: f64,
+    pub _pad: f64,
+}
+
+/// FQuat (x, y, z, w).
+#[repr(C, align(16))]
+#[derive(Clone, Copy, Debug, PartialEq)]
+pub struct UikaQuat {
+    pub x: f64,
+    pub y: f64,
+    pub z: f64,
+    pub w: f64,
+}
+
+impl Default for UikaQuat {
+    fn default() -> Self {
+        Self { x: 0.0, y: 0.0, z: 0.0, w: 1.0 }
+    }
+}
+
+/// FRotator (pitch, yaw, roll in degrees) padded to a full register.
+#[repr(C, align(16))]
+#[derive(Clone, Copy, Debug, Default, PartialEq)]
+pub struct UikaRotator {
+    pub pitch: f64,
+    pub yaw: f64,
+    pub roll: f64,
+    pub _pad: f64,
+}
+
+/// FTransform: rotation, translation and 3D scale. Defaults to identity.
+#[repr(C, align(16))]
+#[derive(Clone, Copy, Debug, PartialEq)]
+pub struct UikaTransform {
+    pub rotation: UikaQuat,
+    pub translation: UikaVector,
+    pub scale: UikaVector,
+}
+
+impl Default for UikaTransform {
+    fn default() -> Self {
+        Self {
+            rotation: UikaQuat::default(),
+            translation: UikaVector::default(),
+            scale: UikaVector { x: 1.0, y: 1.0, z: 1.0, _pad: 0.0 },
+        }
+    }
+}
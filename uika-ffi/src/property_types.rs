@@ -0,0 +1,84 @@
+// Property FFI types: batched property operation descriptors and field
+// layout descriptors for direct (zero-crossing) POD access.
+
+use crate::handles::*;
+
+/// Value kind for a batched property operation. Selects how the C++ side
+/// interprets the property and the bytes at `buf_offset` in the I/O buffer.
+#[repr(u32)]
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub enum UikaPropKind {
+    /// 1 byte (0/1). Bit-field safe via FBoolProperty.
+    Bool = 0,
+    I32 = 1,
+    I64 = 2,
+    U8 = 3,
+    F32 = 4,
+    F64 = 5,
+    /// Packed `FNameHandle` (8 bytes).
+    Name = 6,
+    /// `UObjectHandle` (8 bytes).
+    Object = 7,
+    /// Enum value widened to i64 (8 bytes).
+    Enum = 8,
+    /// Raw struct memory (`buf_size` bytes, CopyScriptStruct). Plain-old-data
+    /// structs only; others are `TypeMismatch`.
+    Struct = 9,
+    /// FString/FText as `[u32 utf8_len][utf8 bytes]` within `buf_size` bytes.
+    String = 10,
+}
+
+/// Read the property into the I/O buffer.
+pub const UIKA_PROP_OP_READ: u32 = 0;
+/// Write the property from the I/O buffer.
+pub const UIKA_PROP_OP_WRITE: u32 = 1;
+
+/// One entry of a `property.batch` call.
+///
+/// `buf_offset`/`buf_size` locate this op's value inside the shared I/O
+/// buffer. Offsets need not be aligned — both sides use unaligned copies.
+#[repr(C)]
+#[derive(Clone, Copy, Debug)]
+pub struct UikaPropOp {
+    pub prop: FPropertyHandle,
+    /// `UikaPropKind` discriminant.
+    pub kind: u32,
+    /// `UIKA_PROP_OP_READ` or `UIKA_PROP_OP_WRITE`.
+    pub op: u32,
+    pub buf_offset: u32,
+    pub buf_size: u32,
+}
+
+/// `gather`/`scatter` element check: accept whatever the property holds.
+pub const UIKA_GATHER_ANY: u32 = 0;
+/// `gather`/`scatter` element check: the property must be a bool. Any other
+/// non-zero value is the element size a non-bool property must have.
+pub const UIKA_GATHER_BOOL: u32 = u32::MAX;
+
+/// Field is plain-old-data: a raw load/store of `elem_size` bytes at
+/// `offset` is equivalent to the typed PropertyApi accessor.
+pub const UIKA_FIELD_POD: u32 = 1;
+/// Field is an FBoolProperty; use the `bool_*` members (bit-field safe).
+pub const UIKA_FIELD_BOOL: u32 = 2;
+/// Field is an FObjectPropertyBase; read and written as one `UObjectHandle`
+/// through the PropertyApi, never in place.
+pub const UIKA_FIELD_OBJECT: u32 = 4;
+
+/// Memory layout of one property inside its container (UObject or struct).
+///
+/// Bool access: the byte at `offset + bool_byte_offset` holds the value;
+/// read tests `bool_field_mask`, write clears `bool_field_mask` then ORs
+/// `bool_byte_mask` (mirrors FBoolProperty::SetPropertyValue).
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default)]
+pub struct UikaFieldDesc {
+    pub offset: u32,
+    pub elem_size: u32,
+    pub array_dim: u32,
+    /// `UIKA_FIELD_POD` | `UIKA_FIELD_BOOL` | `UIKA_FIELD_OBJECT`.
+    pub flags: u32,
+    pub bool_byte_offset: u8,
+    pub bool_byte_mask: u8,
+    pub bool_field_mask: u8,
+    pub _pad: u8,
+}
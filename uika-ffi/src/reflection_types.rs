@@ -0,0 +1,58 @@
+// Reflection FFI types: batched handle resolution requests and parameter
+// frame layouts.
+
+use core::ffi::c_void;
+
+use crate::handles::UikaStrView;
+
+/// What a `UikaResolveReq` looks up, and how `owner` is interpreted.
+#[repr(u32)]
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub enum UikaResolveKind {
+    /// UClass by short name (owner unused).
+    Class = 0,
+    /// UScriptStruct by short name (owner unused).
+    Struct = 1,
+    /// FProperty on the UClass in `owner`.
+    Property = 2,
+    /// FProperty on the UScriptStruct in `owner`.
+    StructProperty = 3,
+    /// UFunction on the UClass in `owner`.
+    Function = 4,
+    /// Parameter FProperty on the UFunction in `owner`.
+    FunctionParam = 5,
+}
+
+/// `owner_index` value meaning "use the `owner` pointer as given".
+pub const UIKA_RESOLVE_NO_OWNER_INDEX: u32 = u32::MAX;
+
+/// One entry of a `reflection.resolve_many` call. The C++ side fills
+/// `result` (null if not found).
+///
+/// If `owner_index` is not `UIKA_RESOLVE_NO_OWNER_INDEX`, the owner is the
+/// `result` of an earlier entry in the same batch, so a class and its
+/// members can be resolved in one call.
+#[repr(C)]
+#[derive(Clone, Copy, Debug)]
+pub struct UikaResolveReq {
+    /// `UikaResolveKind` discriminant.
+    pub kind: u32,
+    pub owner_index: u32,
+    pub owner: *mut c_void,
+    pub name: UikaStrView,
+    pub result: *mut c_void,
+}
+
+/// Cached parameter-frame layout of a UFunction (`reflection.get_frame_layout`).
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default, PartialEq, Eq)]
+pub struct UikaFrameLayout {
+    /// `ParmsSize` in bytes.
+    pub size: u32,
+    /// Minimum alignment of the frame.
+    pub align: u32,
+    /// Parameters needing construction beyond zero-fill.
+    pub init_count: u32,
+    /// Parameters needing destruction.
+    pub destroy_count: u32,
+}
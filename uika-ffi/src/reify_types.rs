@@ -1,4 +1,36 @@
-// Reify FFI types: property type enum, extra metadata struct, and flag constants.
+// Reify FFI types: property type enum, extra metadata struct, flag constants,
+// and the class schema consumed by `reify.register_class_from_schema`.
+//
+// Schema layout. All integers are little-endian and unaligned; strings are
+// UTF-8 without a terminator.
+//
+// ```text
+// u32 version             UIKA_CLASS_SCHEMA_VERSION
+// u32 class_count
+// class × class_count:
+//     u64 rust_type_id
+//     u64 parent          UClassHandle, or 0 to use the class named
+//                         parent_name earlier in this schema
+//     u16 name_len
+//     u8  name[name_len]
+//     u16 parent_name_len
+//     u8  parent_name[parent_name_len]
+//     u32 record_count
+//     record × record_count:
+//         u8 kind         UIKA_SCHEMA_*
+//         PROPERTY:  u16 name_len, name, u32 prop_type, u64 prop_flags,
+//                    u16 default_len, default[default_len]
+//         COMPONENT: u16 name_len, name, u64 component_class, u32 flags
+//                    (UIKA_COMP_*), u16 attach_len, attach[attach_len]
+//         FUNCTION:  u16 name_len, name, u64 callback_id, u32 func_flags
+//         PARAM:     u16 name_len, name, u32 prop_type, u64 param_flags
+//                    (belongs to the preceding FUNCTION record)
+// ```
+//
+// Property and parameter types that need `UikaReifyPropExtra` handles
+// (Struct, Enum) cannot be described; Object and Class ones get UObject. A
+// non-empty default is written into the CDO after the class is finalized and
+// must be exactly the property's element size (1 byte for bool).
 
 use crate::handles::*;
 
@@ -54,3 +86,11 @@ impl Default for UikaReifyPropExtra {
     }
 }
 
+/// Current class schema version.
+pub const UIKA_CLASS_SCHEMA_VERSION: u32 = 1;
+
+/// Schema record kinds.
+pub const UIKA_SCHEMA_PROPERTY: u8 = 0;
+pub const UIKA_SCHEMA_COMPONENT: u8 = 1;
+pub const UIKA_SCHEMA_FUNCTION: u8 = 2;
+pub const UIKA_SCHEMA_PARAM: u8 = 3;
@@ -0,0 +1,41 @@
+// Widget FFI types: the serialized description consumed by
+// `widget.build_widget_tree`.
+//
+// All integers are little-endian and unaligned; strings are UTF-8 without a
+// terminator.
+//
+// ```text
+// u32 node_count
+// node × node_count:
+//     u64 class           UClassHandle of a UWidget subclass
+//     i32 parent          index of an earlier node (a UPanelWidget), or -1
+//                         for the tree root (exactly one node)
+//     u32 flags           UIKA_WIDGET_NODE_*
+//     u16 name_len        0 = let UE generate the name
+//     u8  name[name_len]
+//     u16 init_count
+//     init × init_count:
+//         u8  target      UIKA_WIDGET_INIT_WIDGET / UIKA_WIDGET_INIT_SLOT
+//         u8  kind        UIKA_WIDGET_VALUE_RAW / UIKA_WIDGET_VALUE_TEXT
+//         u16 prop_len
+//         u8  prop[prop_len]
+//         u32 value_len
+//         u8  value[value_len]
+// ```
+//
+// Raw values are copied straight into the property and must be exactly its
+// element size; only plain-old-data properties accept them. Text values go
+// through the property's text import (`(Left=4,Top=0,...)`, `HAlign_Center`).
+
+/// Return this node's handle in `out_handles`.
+pub const UIKA_WIDGET_NODE_KEEP: u32 = 1 << 0;
+
+/// Initializer targets the widget itself.
+pub const UIKA_WIDGET_INIT_WIDGET: u8 = 0;
+/// Initializer targets the panel slot the widget was added to.
+pub const UIKA_WIDGET_INIT_SLOT: u8 = 1;
+
+/// Value bytes are the property's in-memory representation.
+pub const UIKA_WIDGET_VALUE_RAW: u8 = 0;
+/// Value bytes are UE export text, imported with `ImportText`.
+pub const UIKA_WIDGET_VALUE_TEXT: u8 = 1;
@@ -0,0 +1,211 @@
+// World FFI types: per-class actor index deltas returned by
+// `world.get_actor_changes`, async asset load completions, state mirror
+// layouts (`world.mirror_*`), and batched collision queries (`world.trace_*`).
+
+use crate::handles::{FPropertyHandle, UObjectHandle};
+use crate::math_types::UikaVector;
+
+/// One add/remove recorded by the per-class actor index.
+///
+/// For removals `actor` is identity only — the object is being destroyed or
+/// streamed out and must not be dereferenced.
+#[repr(C)]
+#[derive(Clone, Copy, Debug)]
+pub struct UikaActorChange {
+    pub actor: UObjectHandle,
+    /// 1 if the actor was added (spawned / streamed in), 0 if removed.
+    pub added: u32,
+    pub _pad: u32,
+}
+
+impl Default for UikaActorChange {
+    fn default() -> Self {
+        Self { actor: UObjectHandle::null(), added: 0, _pad: 0 }
+    }
+}
+
+/// The request completed; `objects` holds the loaded assets.
+pub const UIKA_ASSET_LOAD_OK: u32 = 0;
+/// The request was cancelled; every entry of `objects` is null.
+pub const UIKA_ASSET_LOAD_CANCELLED: u32 = 1;
+
+/// Completion record of `world.load_object(s)_async`, passed as the params
+/// pointer of `invoke_delegate_callback`. Valid only during the callback.
+///
+/// `objects[i]` is the asset loaded for the i-th requested path, or null if
+/// it failed to load or is not of the requested class.
+#[repr(C)]
+#[derive(Clone, Copy, Debug)]
+pub struct UikaAssetLoadResult {
+    pub request_id: u64,
+    pub objects: *const UObjectHandle,
+    pub count: u32,
+    /// `UIKA_ASSET_LOAD_*`.
+    pub status: u32,
+}
+
+/// Mirror column: a plain-old-data property at `offset` from the object base
+/// (a top-level `FieldDesc` or a resolved property path), copied raw.
+pub const UIKA_MIRROR_PROPERTY: u32 = 0;
+/// Mirror column: component-to-world of the actor's root component (or of the
+/// scene component itself), as a `UikaTransform`.
+pub const UIKA_MIRROR_TRANSFORM: u32 = 1;
+/// Mirror column: `AActor::GetVelocity` / component velocity, as a `UikaVector`.
+pub const UIKA_MIRROR_VELOCITY: u32 = 2;
+
+/// Source of one column of a state mirror. `prop`/`offset` are only used by
+/// `UIKA_MIRROR_PROPERTY`.
+#[repr(C)]
+#[derive(Clone, Copy, Debug)]
+pub struct UikaMirrorColumn {
+    pub prop: FPropertyHandle,
+    /// `UIKA_MIRROR_*`.
+    pub kind: u32,
+    pub offset: u32,
+}
+
+/// Layout of a state mirror. Two C++-owned buffers alternate: snapshot `s`
+/// lives in `buffers[s & 1]`, where `s` is the atomic `*sequence` (0 before
+/// the first fill). In each buffer column `c` is `row_count` values of
+/// `column_sizes[c]` bytes at `column_offsets[c]` (16-byte aligned), followed
+/// by two bitsets of `row_count` bits in u64 words: rows that changed since
+/// the previous snapshot (`dirty_offset`) and rows whose object was alive
+/// (`alive_offset`). A snapshot stays intact until the fill after next begins.
+#[repr(C)]
+#[derive(Clone, Copy, Debug)]
+pub struct UikaMirrorView {
+    pub buffers: [*const u8; 2],
+    pub sequence: *const u64,
+    pub column_offsets: *const u32,
+    pub column_sizes: *const u32,
+    pub row_count: u32,
+    pub column_count: u32,
+    pub dirty_offset: u32,
+    pub alive_offset: u32,
+}
+
+unsafe impl Send for UikaMirrorView {}
+unsafe impl Sync for UikaMirrorView {}
+
+/// Trace query: single blocking line trace from `start` to `end`.
+pub const UIKA_TRACE_LINE: u32 = 0;
+/// Trace query: single blocking sphere sweep of `radius` from `start` to `end`.
+pub const UIKA_TRACE_SWEEP_SPHERE: u32 = 1;
+/// Trace query: sphere overlap of `radius` at `start` (`end` is ignored).
+pub const UIKA_TRACE_OVERLAP_SPHERE: u32 = 2;
+
+/// Request flag: trace against complex collision.
+pub const UIKA_TRACE_COMPLEX: u32 = 1 << 0;
+
+/// One collision query of a `world.trace_batch*` call. `channel` is an
+/// `ECollisionChannel`; `ignore` is an actor to skip (may be null).
+#[repr(C)]
+#[derive(Clone, Copy, Debug)]
+pub struct UikaTraceRequest {
+    pub start: UikaVector,
+    pub end: UikaVector,
+    pub ignore: UObjectHandle,
+    /// `UIKA_TRACE_LINE` / `_SWEEP_SPHERE` / `_OVERLAP_SPHERE`.
+    pub kind: u32,
+    pub channel: u32,
+    pub radius: f32,
+    /// `UIKA_TRACE_COMPLEX`.
+    pub flags: u32,
+    pub _pad: u64,
+}
+
+impl UikaTraceRequest {
+    /// Line trace from `start` to `end` on `channel`.
+    pub fn line(start: UikaVector, end: UikaVector, channel: u32) -> Self {
+        Self::new(UIKA_TRACE_LINE, start, end, channel, 0.0)
+    }
+
+    /// Sphere sweep from `start` to `end` on `channel`.
+    pub fn sweep_sphere(start: UikaVector, end: UikaVector, radius: f32, channel: u32) -> Self {
+        Self::new(UIKA_TRACE_SWEEP_SPHERE, start, end, channel, radius)
+    }
+
+    /// Sphere overlap at `center` on `channel`.
+    pub fn overlap_sphere(center: UikaVector, radius: f32, channel: u32) -> Self {
+        Self::new(UIKA_TRACE_OVERLAP_SPHERE, center, center, channel, radius)
+    }
+
+    /// Skip `actor` (typically the querying pawn).
+    pub fn ignoring(mut self, actor: UObjectHandle) -> Self {
+        self.ignore = actor;
+        self
+    }
+
+    /// Trace against complex collision.
+    pub fn complex(mut self) -> Self {
+        self.flags |= UIKA_TRACE_COMPLEX;
+        self
+    }
+
+    fn new(kind: u32, start: UikaVector, end: UikaVector, channel: u32, radius: f32) -> Self {
+        Self { start, end, ignore: UObjectHandle::null(), kind, channel, radius, flags: 0, _pad: 0 }
+    }
+}
+
+/// Hit flag: the query found a blocking hit (or a blocking overlap).
+pub const UIKA_TRACE_HIT_BLOCKING: u32 = 1 << 0;
+
+/// Result of one `UikaTraceRequest`, compacted from `FHitResult` /
+/// `FOverlapResult`. Zeroed with `count == 0` when nothing was hit.
+///
+/// Traces and sweeps report the first blocking hit (impact point, impact
+/// normal, distance from `start`, `time` along the segment). Overlaps report
+/// the first overlapping component at `location = center`, with `count` set
+/// to the number of overlaps.
+#[repr(C)]
+#[derive(Clone, Copy, Debug)]
+pub struct UikaTraceHit {
+    pub location: UikaVector,
+    pub normal: UikaVector,
+    pub actor: UObjectHandle,
+    pub component: UObjectHandle,
+    pub distance: f32,
+    pub time: f32,
+    pub count: u32,
+    /// `UIKA_TRACE_HIT_*`.
+    pub flags: u32,
+}
+
+impl UikaTraceHit {
+    #[inline]
+    pub fn is_blocking(&self) -> bool {
+        self.flags & UIKA_TRACE_HIT_BLOCKING != 0
+    }
+}
+
+impl Default for UikaTraceHit {
+    fn default() -> Self {
+        Self {
+            location: UikaVector::default(),
+            normal: UikaVector::default(),
+            actor: UObjectHandle::null(),
+            component: UObjectHandle::null(),
+            distance: 0.0,
+            time: 0.0,
+            count: 0,
+            flags: 0,
+        }
+    }
+}
+
+/// The batch ran; `hits` has one entry per request, in order.
+pub const UIKA_TRACE_BATCH_OK: u32 = 0;
+/// The batch was cancelled (or its world torn down); `hits` is empty.
+pub const UIKA_TRACE_BATCH_CANCELLED: u32 = 1;
+
+/// Completion record of `world.trace_batch_async`, passed as the params
+/// pointer of `invoke_delegate_callback`. Valid only during the callback.
+#[repr(C)]
+#[derive(Clone, Copy, Debug)]
+pub struct UikaTraceBatchResult {
+    pub batch_id: u64,
+    pub hits: *const UikaTraceHit,
+    pub count: u32,
+    /// `UIKA_TRACE_BATCH_*`.
+    pub status: u32,
+}
@@ -17,6 +17,20 @@ mod uclass_impl;
 ///     chase_timer: f64,
 /// }
 /// ```
+///
+/// Add `snapshot` (`#[uclass(parent = Actor, snapshot)]`) to keep the
+/// Rust-private fields across `Uika.Reload`. Each field type must implement
+/// `uika::runtime::hot_snapshot::SnapshotField`; fields whose name or type
+/// changed between builds start from `Default`.
+///
+/// Add `pooled` for actors recycled through the world actor pool: the Rust
+/// data then survives release/acquire and the struct must implement
+/// `uika::runtime::reify_registry::PoolHooks`. Without it, no hooks run and
+/// a recycled actor keeps whatever Rust state it had when released.
+///
+/// Add `batch_tick` to tick all instances of the class in one call per
+/// frame: the struct must implement `uika::runtime::reify_registry::BatchTick`,
+/// whose `tick_batch` receives every instance in play as `&mut [Self]`.
 #[proc_macro_attribute]
 pub fn uclass(
     attr: proc_macro::TokenStream,
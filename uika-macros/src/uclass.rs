@@ -1,5 +1,5 @@
-// Core uclass macro expansion: parses #[uclass(parent = Type)] struct with
-// #[uproperty(...)] fields and generates the full reification boilerplate.
+// Core uclass macro expansion: parses #[uclass(parent = Type[, snapshot][, pooled][, batch_tick])] struct
+// with #[uproperty(...)] fields and generates the full reification boilerplate.
 
 use proc_macro2::TokenStream;
 use quote::{format_ident, quote};
@@ -16,6 +16,9 @@ use crate::prop_type;
 struct UClassArgs {
     parent_path: syn::Path,  // Full Rust path for compile-time type checking
     parent_name: String,     // Last segment string for runtime find_class
+    snapshot: bool,          // Preserve Rust fields across hot reload
+    pooled: bool,            // Forward actor-pool transitions to PoolHooks
+    batch_tick: bool,        // Class-level tick through BatchTick
 }
 
 fn parse_uclass_args(attr: TokenStream) -> syn::Result<UClassArgs> {
@@ -31,7 +34,19 @@ fn parse_uclass_args(attr: TokenStream) -> syn::Result<UClassArgs> {
             });
 
     let mut parent_path: Option<syn::Path> = None;
+    let mut snapshot = false;
+    let mut pooled = false;
+    let mut batch_tick = false;
     for meta in &metas {
+        if let Meta::Path(p) = meta {
+            if p.is_ident("snapshot") {
+                snapshot = true;
+            } else if p.is_ident("pooled") {
+                pooled = true;
+            } else if p.is_ident("batch_tick") {
+                batch_tick = true;
+            }
+        }
         if let Meta::NameValue(nv) = meta {
             if nv.path.is_ident("parent") {
                 if let Expr::Path(expr_path) = &nv.value {
@@ -62,7 +77,7 @@ fn parse_uclass_args(attr: TokenStream) -> syn::Result<UClassArgs> {
         .last()
         .map(|s| s.ident.to_string())
         .unwrap_or_default();
-    Ok(UClassArgs { parent_path, parent_name })
+    Ok(UClassArgs { parent_path, parent_name, snapshot, pooled, batch_tick })
 }
 
 /// Specifiers parsed from #[uproperty(...)].
@@ -270,13 +285,14 @@ pub fn expand_uclass(attr: TokenStream, item: TokenStream) -> syn::Result<TokenS
     // Generate names
     let rust_data_name = format_ident!("__{}RustData", struct_name);
     let class_handle_name = format_ident!("__UIKA_CLASS_HANDLE_{}", to_screaming_snake(&struct_name_str));
-    let register_fn_name = format_ident!("__uika_register_{}", to_snake_case(&struct_name_str));
-    let finalize_fn_name = format_ident!("__uika_finalize_{}", to_snake_case(&struct_name_str));
+    let describe_fn_name = format_ident!("__uika_describe_{}", to_snake_case(&struct_name_str));
 
     let type_id_value = prop_type::fnv1a_hash(&struct_name_str);
 
     // --- 1. Rewritten user struct (thin handle) ---
+    // repr(C): same layout as `reify_registry::TickInstance` (class tick).
     let user_struct = quote! {
+        #[repr(C)]
         #struct_vis struct #struct_name {
             #[doc(hidden)]
             pub __obj: ::uika::ffi::UObjectHandle,
@@ -471,20 +487,14 @@ pub fn expand_uclass(attr: TokenStream, item: TokenStream) -> syn::Result<TokenS
     let parent_name = args.parent_name.as_str();
     let parent_name_bytes = parent_name.as_bytes();
     let parent_name_len = parent_name.len() as u32;
-    let struct_name_bytes = struct_name_str.as_bytes();
-    let struct_name_byte_len = struct_name_str.len() as u32;
 
-    // Generate add_property calls
+    // Schema records for properties (CDO defaults are applied by C++ after finalize)
     let mut add_prop_stmts: Vec<TokenStream> = Vec::new();
-    let mut cdo_default_stmts: Vec<TokenStream> = Vec::new();
 
     for prop in &uprops {
         let info = prop_type::map_type(&prop.ty).unwrap();
         let ue_name = prop_type::to_pascal_case(&prop.ident.to_string());
-        let ue_name_bytes = ue_name.as_bytes();
-        let ue_name_len = ue_name.len() as u32;
         let prop_type_expr = &info.prop_type_expr;
-        let prop_var = format_ident!("_prop_{}", prop.ident);
 
         // Compute flags:
         //   BlueprintReadWrite → visible + editable in Details and Blueprint
@@ -508,97 +518,131 @@ pub fn expand_uclass(attr: TokenStream, item: TokenStream) -> syn::Result<TokenS
         }
         let flags_expr = quote! { #(#flag_parts)|* };
 
-        add_prop_stmts.push(quote! {
-            let #prop_var = unsafe {
-                ::uika::runtime::ffi_dispatch::reify_add_property(
-                    class,
-                    [#(#ue_name_bytes),*].as_ptr(),
-                    #ue_name_len,
-                    #prop_type_expr as u32,
-                    #flags_expr,
-                    std::ptr::null(),
-                )
-            };
-        });
-
-        // CDO default (unused — defaults are set in finalize)
         if let Some(ref default_expr) = prop.args.default_expr {
-            let setter_dispatch = format_ident!("property_{}", info.setter_fn);
-            cdo_default_stmts.push(quote! {
-                if !#prop_var.is_null() {
-                    unsafe { ::uika::runtime::ffi_dispatch::#setter_dispatch(cdo, #prop_var, #default_expr); }
-                }
+            let rust_type = &info.rust_type;
+            add_prop_stmts.push(quote! {
+                __schema.property_with_default::<#rust_type>(#ue_name, #prop_type_expr, #flags_expr, #default_expr);
+            });
+        } else {
+            add_prop_stmts.push(quote! {
+                __schema.property(#ue_name, #prop_type_expr, #flags_expr);
             });
         }
     }
 
-    // Generate add_default_subobject calls
+    // Schema records for default subobjects
     let mut add_comp_stmts: Vec<TokenStream> = Vec::new();
     for comp in &components {
         let comp_type = &comp.component_type;
         let comp_name = prop_type::to_pascal_case(&comp.ident.to_string());
-        let comp_name_bytes = comp_name.as_bytes();
-        let comp_name_len = comp_name.len() as u32;
 
         let mut flags: u32 = 0;
         if comp.is_root {
             flags |= 1; // UIKA_COMP_ROOT
         }
 
-        let (attach_ptr, attach_len) = if let Some(ref attach_name) = comp.attach_to {
-            let attach_pascal = prop_type::to_pascal_case(attach_name);
-            let attach_bytes = attach_pascal.as_bytes().to_vec();
-            let alen = attach_bytes.len() as u32;
-            (quote! { [#(#attach_bytes),*].as_ptr() }, quote! { #alen })
-        } else {
-            (quote! { std::ptr::null() }, quote! { 0u32 })
-        };
+        let attach_name = comp
+            .attach_to
+            .as_ref()
+            .map(|name| prop_type::to_pascal_case(name))
+            .unwrap_or_default();
 
         add_comp_stmts.push(quote! {
-            {
-                let comp_class = <#comp_type as ::uika::runtime::UeClass>::static_class();
-                unsafe {
-                    ::uika::runtime::ffi_dispatch::reify_add_default_subobject(
-                        class,
-                        [#(#comp_name_bytes),*].as_ptr(), #comp_name_len,
-                        comp_class,
-                        #flags,
-                        #attach_ptr, #attach_len,
-                    );
-                }
-            }
+            __schema.component(
+                #comp_name,
+                <#comp_type as ::uika::runtime::UeClass>::static_class(),
+                #flags,
+                #attach_name,
+            );
         });
     }
 
-    // Generate CDO default stmts for finalize (re-find properties by name)
-    let mut finalize_cdo_stmts: Vec<TokenStream> = Vec::new();
-    for prop in &uprops {
-        if let Some(ref default_expr) = prop.args.default_expr {
-            let info = prop_type::map_type(&prop.ty).unwrap();
-            let ue_name = prop_type::to_pascal_case(&prop.ident.to_string());
-            let ue_name_bytes = ue_name.as_bytes();
-            let ue_name_len = ue_name.len() as u32;
-            let setter_dispatch = format_ident!("property_{}", info.setter_fn);
-            finalize_cdo_stmts.push(quote! {
-                {
-                    let prop = unsafe {
-                        ::uika::runtime::ffi_dispatch::reflection_find_property(
-                            class,
-                            [#(#ue_name_bytes),*].as_ptr(),
-                            #ue_name_len,
-                        )
-                    };
-                    if !prop.is_null() {
-                        unsafe { ::uika::runtime::ffi_dispatch::#setter_dispatch(cdo, prop, #default_expr); }
-                    }
+    // Hot-reload snapshot hooks (#[uclass(..., snapshot)]): one record per
+    // Rust field, keyed by field name and declared type.
+    let snapshot_expr = if args.snapshot {
+        let mut save_stmts: Vec<TokenStream> = Vec::new();
+        let mut restore_stmts: Vec<TokenStream> = Vec::new();
+        for f in &rust_fields {
+            let ident = &f.ident;
+            let ty = &f.ty;
+            let name_str = ident.to_string();
+            let ty_str = quote!(#ty).to_string();
+            let hashes = quote! {
+                const { ::uika::runtime::hot_snapshot::field_hash(#name_str) },
+                const { ::uika::runtime::hot_snapshot::field_hash(#ty_str) }
+            };
+            save_stmts.push(quote! {
+                _w.field::<#ty>(#hashes, &_data.#ident);
+            });
+            restore_stmts.push(quote! {
+                if let Some(v) = _fields.get::<#ty>(#hashes) {
+                    _data.#ident = v;
                 }
             });
         }
-    }
+        quote! {
+            Some(::uika::runtime::reify_registry::SnapshotFns {
+                save: |ptr, _w| {
+                    let _data = unsafe { &*(ptr as *const #rust_data_name) };
+                    #(#save_stmts)*
+                },
+                restore: |ptr, _fields| {
+                    let _data = unsafe { &mut *(ptr as *mut #rust_data_name) };
+                    #(#restore_stmts)*
+                },
+            })
+        }
+    } else {
+        quote! { None }
+    };
 
-    let register_fn = quote! {
+    // Actor-pool hooks (#[uclass(..., pooled)]): forward to the user's
+    // PoolHooks impl on the thin handle struct.
+    let pool_expr = if args.pooled {
+        quote! {
+            Some(::uika::runtime::reify_registry::PoolFns {
+                acquire: |obj, ptr| {
+                    let mut _this = #struct_name { __obj: obj, __rust_data: ptr as *mut #rust_data_name };
+                    ::uika::runtime::reify_registry::PoolHooks::on_pool_acquire(&mut _this);
+                },
+                release: |obj, ptr| {
+                    let mut _this = #struct_name { __obj: obj, __rust_data: ptr as *mut #rust_data_name };
+                    ::uika::runtime::reify_registry::PoolHooks::on_pool_release(&mut _this);
+                },
+            })
+        }
+    } else {
+        quote! { None }
+    };
+
+    // Class tick (#[uclass(..., batch_tick)]): the batch is reinterpreted as
+    // handle structs and handed to the user's BatchTick impl.
+    let (batch_tick_expr, enable_tick_stmt) = if args.batch_tick {
+        (
+            quote! {
+                Some(|instances, delta_seconds| {
+                    // SAFETY: #struct_name is repr(C) { UObjectHandle, *mut data },
+                    // the layout of TickInstance.
+                    let this = unsafe {
+                        std::slice::from_raw_parts_mut(instances.as_mut_ptr() as *mut #struct_name, instances.len())
+                    };
+                    <#struct_name as ::uika::runtime::reify_registry::BatchTick>::tick_batch(this, delta_seconds);
+                })
+            },
+            quote! {
+                let _ = ::uika::runtime::reify_registry::enable_class_tick(
+                    class,
+                    <#struct_name as ::uika::runtime::reify_registry::BatchTick>::TICK_GROUP,
+                );
+            },
+        )
+    } else {
+        (quote! { None }, quote! {})
+    };
+
+    let describe_fn = quote! {
         #[doc(hidden)]
-        pub fn #register_fn_name() {
+        pub fn #describe_fn_name(__schema: &mut ::uika::runtime::ClassSchema) {
             const TYPE_ID: u64 = #type_id_value;
 
             // Register Rust type info
@@ -614,77 +658,36 @@ pub fn expand_uclass(attr: TokenStream, item: TokenStream) -> syn::Result<TokenS
                             let _ = unsafe { Box::from_raw(ptr as *mut #rust_data_name) };
                         }
                     },
+                    snapshot: #snapshot_expr,
+                    pool: #pool_expr,
+                    batch_tick: #batch_tick_expr,
                 },
             );
 
-            // Find parent class
+            // Find parent class. A parent declared by another #[uclass] may
+            // not exist yet; the schema resolves it by name in that case.
             let parent = unsafe {
                 ::uika::runtime::ffi_dispatch::reflection_find_class(
                     [#(#parent_name_bytes),*].as_ptr(),
                     #parent_name_len,
                 )
             };
-            if parent.is_null() {
+            if !__schema.class(TYPE_ID, #struct_name_str, #parent_name, parent, |class| {
+                #class_handle_name.set(class).ok();
+                #enable_tick_stmt
+            }) {
                 let msg = concat!("[Uika] ", stringify!(#struct_name), ": failed to find parent class '", #parent_name, "'");
                 let bytes = msg.as_bytes();
                 unsafe { ::uika::runtime::ffi_dispatch::logging_log(2, bytes.as_ptr(), bytes.len() as u32); }
                 return;
             }
 
-            // Create class
-            let class = unsafe {
-                ::uika::runtime::ffi_dispatch::reify_create_class(
-                    [#(#struct_name_bytes),*].as_ptr(),
-                    #struct_name_byte_len,
-                    parent,
-                    TYPE_ID,
-                )
-            };
-            if class.is_null() {
-                let msg = concat!("[Uika] ", stringify!(#struct_name), ": create_class failed");
-                let bytes = msg.as_bytes();
-                unsafe { ::uika::runtime::ffi_dispatch::logging_log(2, bytes.as_ptr(), bytes.len() as u32); }
-                return;
-            }
-            #class_handle_name.set(class).ok();
-
-            // Add properties (finalize deferred to __uika_finalize)
             #(#add_prop_stmts)*
 
-            // Register default subobjects
             #(#add_comp_stmts)*
         }
     };
 
-    let finalize_fn = quote! {
-        #[doc(hidden)]
-        pub fn #finalize_fn_name() {
-            let class = match #class_handle_name.get() {
-                Some(&c) if !c.is_null() => c,
-                _ => return,
-            };
-
-            // Finalize
-            let result = unsafe { ::uika::runtime::ffi_dispatch::reify_finalize_class(class) };
-            if result != ::uika::ffi::UikaErrorCode::Ok {
-                let msg = concat!("[Uika] ", stringify!(#struct_name), ": finalize_class failed");
-                let bytes = msg.as_bytes();
-                unsafe { ::uika::runtime::ffi_dispatch::logging_log(2, bytes.as_ptr(), bytes.len() as u32); }
-                return;
-            }
-
-            // Set CDO defaults
-            let cdo = unsafe { ::uika::runtime::ffi_dispatch::reify_get_cdo(class) };
-            if !cdo.is_null() {
-                #(#finalize_cdo_stmts)*
-            }
-
-            let msg = concat!("[Uika] ", stringify!(#struct_name), " registered successfully");
-            let bytes = msg.as_bytes();
-            unsafe { ::uika::runtime::ffi_dispatch::logging_log(0, bytes.as_ptr(), bytes.len() as u32); }
-        }
-    };
-
     // --- Compile-time parent type check ---
     let comp_type_checks: Vec<TokenStream> = components
         .iter()
@@ -733,13 +736,14 @@ pub fn expand_uclass(attr: TokenStream, item: TokenStream) -> syn::Result<TokenS
         #parent_check
         #deref_impl
         #accessors_impl
-        #register_fn
-        #finalize_fn
+        #describe_fn
 
         ::uika::__inventory::submit! {
             ::uika::runtime::reify_registry::ClassRegistration {
-                register: #register_fn_name,
-                finalize: #finalize_fn_name,
+                name: #struct_name_str,
+                parent_name: #parent_name,
+                type_id: #type_id_value,
+                describe: #describe_fn_name,
             }
         }
     })
@@ -7,7 +7,7 @@ use syn::{parse2, FnArg, Ident, ImplItem, ImplItemFn, ItemImpl, Meta, ReturnType
 use syn::punctuated::Punctuated;
 
 use crate::prop_type;
-use crate::uclass::{to_snake_case, to_screaming_snake};
+use crate::uclass::to_snake_case;
 
 // ---------------------------------------------------------------------------
 // Parsed ufunction info
@@ -45,7 +45,6 @@ pub fn expand_uclass_impl(_attr: TokenStream, item: TokenStream) -> syn::Result<
 
     let struct_name_str = struct_name.to_string();
     let rust_data_name = format_ident!("__{}RustData", struct_name);
-    let class_handle_name = format_ident!("__UIKA_CLASS_HANDLE_{}", to_screaming_snake(&struct_name_str));
 
     // Classify methods: collect #[ufunction] info, strip attrs
     let mut ufunctions: Vec<UFunctionInfo> = Vec::new();
@@ -67,9 +66,10 @@ pub fn expand_uclass_impl(_attr: TokenStream, item: TokenStream) -> syn::Result<
         }
     }
 
-    // Generate register_functions body
+    // Generate describe_functions body
+    let type_id_value = prop_type::fnv1a_hash(&struct_name_str);
     let register_fns_name = format_ident!(
-        "__uika_register_{}_functions",
+        "__uika_describe_{}_functions",
         to_snake_case(&struct_name_str),
     );
 
@@ -197,8 +197,7 @@ pub fn expand_uclass_impl(_attr: TokenStream, item: TokenStream) -> syn::Result<
             quote! { __this.#method_ident(#(#param_idents),*); }
         };
 
-        // Register callback and add function + params
-        let func_var = format_ident!("__func_{}", method_ident);
+        // Register callback and describe function + params
 
         register_stmts.push(quote! {
             let __callback_id = {
@@ -224,15 +223,7 @@ pub fn expand_uclass_impl(_attr: TokenStream, item: TokenStream) -> syn::Result<
                 callback_id
             };
 
-            let #func_var = unsafe {
-                ::uika::runtime::ffi_dispatch::reify_add_function(
-                    cls,
-                    [#(#ue_name_bytes),*].as_ptr(),
-                    #ue_name_len,
-                    __callback_id,
-                    #flags_expr,
-                )
-            };
+            __schema.function(#ue_name, __callback_id, #flags_expr);
         });
 
         // Add function params — skip for Override (C++ copies from parent function)
@@ -240,21 +231,10 @@ pub fn expand_uclass_impl(_attr: TokenStream, item: TokenStream) -> syn::Result<
             for param in &uf.params {
                 let info = prop_type::map_type(&param.rust_ty).unwrap();
                 let param_ue_name = &param.ue_name;
-                let param_ue_bytes = param_ue_name.as_bytes();
-                let param_ue_len = param_ue_name.len() as u32;
                 let prop_type_expr = &info.prop_type_expr;
 
                 register_stmts.push(quote! {
-                    unsafe {
-                        ::uika::runtime::ffi_dispatch::reify_add_function_param(
-                            #func_var,
-                            [#(#param_ue_bytes),*].as_ptr(),
-                            #param_ue_len,
-                            #prop_type_expr as u32,
-                            ::uika::ffi::CPF_PARM,
-                            std::ptr::null(),
-                        );
-                    }
+                    __schema.param(#param_ue_name, #prop_type_expr, ::uika::ffi::CPF_PARM);
                 });
             }
 
@@ -264,16 +244,11 @@ pub fn expand_uclass_impl(_attr: TokenStream, item: TokenStream) -> syn::Result<
                 let prop_type_expr = &info.prop_type_expr;
 
                 register_stmts.push(quote! {
-                    unsafe {
-                        ::uika::runtime::ffi_dispatch::reify_add_function_param(
-                            #func_var,
-                            b"ReturnValue".as_ptr(),
-                            11u32,
-                            #prop_type_expr as u32,
-                            ::uika::ffi::CPF_PARM | ::uika::ffi::CPF_OUT_PARM | ::uika::ffi::CPF_RETURN_PARM,
-                            std::ptr::null(),
-                        );
-                    }
+                    __schema.param(
+                        "ReturnValue",
+                        #prop_type_expr,
+                        ::uika::ffi::CPF_PARM | ::uika::ffi::CPF_OUT_PARM | ::uika::ffi::CPF_RETURN_PARM,
+                    );
                 });
             }
         }
@@ -281,11 +256,7 @@ pub fn expand_uclass_impl(_attr: TokenStream, item: TokenStream) -> syn::Result<
 
     let register_functions_fn = quote! {
         #[doc(hidden)]
-        pub fn #register_fns_name() {
-            let cls = match #class_handle_name.get() {
-                Some(&c) if !c.is_null() => c,
-                _ => return,
-            };
+        pub fn #register_fns_name(__schema: &mut ::uika::runtime::ClassSchema) {
             #(#register_stmts)*
         }
     };
@@ -296,7 +267,8 @@ pub fn expand_uclass_impl(_attr: TokenStream, item: TokenStream) -> syn::Result<
 
         ::uika::__inventory::submit! {
             ::uika::runtime::reify_registry::ClassFunctionRegistration {
-                register_functions: #register_fns_name,
+                type_id: #type_id_value,
+                describe_functions: #register_fns_name,
             }
         }
     })
@@ -338,7 +310,7 @@ fn parse_ufunction(method: &ImplItemFn) -> syn::Result<UFunctionInfo> {
                 let ty = (*pat_type.ty).clone();
                 // Override functions get their param types from the parent UFunction
                 // (C++ copies them), so any Copy+repr(C) type is valid.
-                // Non-override functions must use types known to reify_add_function_param.
+                // Non-override functions must use types known to the class schema.
                 if !is_override && prop_type::map_type(&ty).is_none() {
                     return Err(syn::Error::new_spanned(
                         &ty,
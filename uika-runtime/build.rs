@@ -52,12 +52,26 @@ fn main() {
     writeln!(output, "}}").unwrap();
     writeln!(output).unwrap();
 
+    // One ffi_stats slot per wrapper, in table order.
+    let mut stat_names: Vec<String> = Vec::new();
     for table in &tables {
         for func in &table.functions {
-            generate_dispatch_wrapper(&mut output, table, func);
+            generate_dispatch_wrapper(&mut output, table, func, stat_names.len());
+            stat_names.push(format!("{}.{}", table.module_name, func.name));
         }
     }
 
+    writeln!(output, "#[doc(hidden)]").unwrap();
+    writeln!(output, "pub const API_STAT_COUNT: usize = {};", stat_names.len()).unwrap();
+    writeln!(output).unwrap();
+    writeln!(output, "#[doc(hidden)]").unwrap();
+    writeln!(output, "#[cfg(feature = \"ffi-stats\")]").unwrap();
+    writeln!(output, "pub const API_STAT_NAMES: [&str; API_STAT_COUNT] = [").unwrap();
+    for name in &stat_names {
+        writeln!(output, "    \"{name}\",").unwrap();
+    }
+    writeln!(output, "];").unwrap();
+
     let out_dir = env::var("OUT_DIR").unwrap();
     let out_path = Path::new(&out_dir).join("ffi_dispatch.rs");
     fs::write(&out_path, &output).expect("Failed to write ffi_dispatch.rs");
@@ -67,7 +81,7 @@ fn main() {
 // Dispatch wrapper generation
 // ---------------------------------------------------------------------------
 
-fn generate_dispatch_wrapper(out: &mut String, table: &SubTable, func: &ApiFn) {
+fn generate_dispatch_wrapper(out: &mut String, table: &SubTable, func: &ApiFn, stat_slot: usize) {
     let fn_name = format!("{}_{}", table.module_name, func.name);
 
     let rust_params: Vec<(String, String)> = func
@@ -91,6 +105,7 @@ fn generate_dispatch_wrapper(out: &mut String, table: &SubTable, func: &ApiFn) {
     }
     writeln!(out, ") -> {rust_ret} {{").unwrap();
 
+    writeln!(out, "    let _stats = crate::ffi_stats::api_scope({stat_slot});").unwrap();
     write!(out, "    ((*crate::api::api().{}).{})(", table.module_name, func.name).unwrap();
     for (i, (name, _ty)) in rust_params.iter().enumerate() {
         if i > 0 {
@@ -132,8 +147,10 @@ fn rust_type_str(ty: &ApiType) -> String {
         // The wrapper casts back to the original pointer type at the call site.
         ApiType::CVoidPtr { mutability: Mutability::Mut } => "NativePtr".into(),
         ApiType::CVoidPtr { mutability: Mutability::Const } => "*const core::ffi::c_void".into(),
+        // Named #[repr(C)] structs are re-exported from the uika-ffi crate root
+        // (reify_types, property_types, ...).
         ApiType::NamedStructPtr { mutability, name } => {
-            format!("{} uika_ffi::reify_types::{name}", mut_qual(*mutability))
+            format!("{} uika_ffi::{name}", mut_qual(*mutability))
         }
         ApiType::Ptr { mutability, pointee } => {
             if matches!(**pointee, ApiType::U8) && *mutability == Mutability::Mut {
@@ -0,0 +1,270 @@
+// Class schema: a serialized description of reified classes, registered in a
+// single crossing through `reify.register_class_from_schema`.
+//
+// `#[uclass]` describes its properties and default subobjects and
+// `#[uclass_impl]` its functions into one shared `ClassSchema`; the C++ side
+// then creates, populates and finalizes every class in one pass (layout in
+// `uika_ffi::reify_types`). The per-item `reify_*` entries stay available
+// for code that builds classes by hand.
+
+use uika_ffi::{
+    UClassHandle, UikaReifyPropType, UIKA_CLASS_SCHEMA_VERSION, UIKA_SCHEMA_COMPONENT,
+    UIKA_SCHEMA_FUNCTION, UIKA_SCHEMA_PARAM, UIKA_SCHEMA_PROPERTY,
+};
+
+use crate::error::{check_ffi, UikaResult};
+use crate::ffi_dispatch;
+
+/// A value that can be stored as a CDO default in the schema. The encoding
+/// is the property's in-memory representation (1 byte for bool).
+pub trait SchemaDefault: Copy {
+    fn write_default(self, out: &mut Vec<u8>);
+}
+
+macro_rules! impl_schema_default {
+    ($($t:ty),*) => {$(
+        impl SchemaDefault for $t {
+            #[inline]
+            fn write_default(self, out: &mut Vec<u8>) {
+                out.extend_from_slice(&self.to_le_bytes());
+            }
+        }
+    )*};
+}
+
+impl_schema_default!(i8, u8, i16, u16, i32, u32, i64, u64, f32, f64);
+
+impl SchemaDefault for bool {
+    #[inline]
+    fn write_default(self, out: &mut Vec<u8>) {
+        out.push(self as u8);
+    }
+}
+
+/// Builder for the `register_class_from_schema` blob.
+///
+/// Records always go to the class opened by the latest successful
+/// [`class`](Self::class) call; parameters go to the latest function.
+pub struct ClassSchema {
+    buf: Vec<u8>,
+    names: Vec<String>,
+    on_registered: Vec<fn(UClassHandle)>,
+    /// Offset of the open class's record count.
+    record_count_at: Option<usize>,
+    has_function: bool,
+}
+
+impl Default for ClassSchema {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl ClassSchema {
+    pub fn new() -> Self {
+        let mut buf = Vec::with_capacity(4096);
+        buf.extend_from_slice(&UIKA_CLASS_SCHEMA_VERSION.to_le_bytes());
+        buf.extend_from_slice(&0u32.to_le_bytes());
+        Self {
+            buf,
+            names: Vec::new(),
+            on_registered: Vec::new(),
+            record_count_at: None,
+            has_function: false,
+        }
+    }
+
+    /// Number of classes described so far.
+    pub fn class_count(&self) -> u32 {
+        self.names.len() as u32
+    }
+
+    /// The serialized schema.
+    pub fn as_bytes(&self) -> &[u8] {
+        &self.buf
+    }
+
+    /// Open a new class. `parent` may be null when the parent is a class
+    /// described earlier in this schema; otherwise the class is rejected and
+    /// `false` returned. `on_registered` receives the created class.
+    pub fn class(
+        &mut self,
+        type_id: u64,
+        name: &str,
+        parent_name: &str,
+        parent: UClassHandle,
+        on_registered: fn(UClassHandle),
+    ) -> bool {
+        if parent.is_null() && !self.names.iter().any(|n| n == parent_name) {
+            return false;
+        }
+        self.buf.extend_from_slice(&type_id.to_le_bytes());
+        self.buf.extend_from_slice(&parent.to_addr().to_le_bytes());
+        self.name(name);
+        self.name(parent_name);
+        self.record_count_at = Some(self.buf.len());
+        self.buf.extend_from_slice(&0u32.to_le_bytes());
+        self.has_function = false;
+
+        self.names.push(name.to_string());
+        self.on_registered.push(on_registered);
+        let count = self.class_count();
+        self.buf[4..8].copy_from_slice(&count.to_le_bytes());
+        true
+    }
+
+    /// Add a property without a CDO default.
+    pub fn property(&mut self, name: &str, prop_type: UikaReifyPropType, flags: u64) {
+        self.property_record(name, prop_type, flags, |_| {});
+    }
+
+    /// Add a property whose CDO value is set to `default` after finalize.
+    pub fn property_with_default<T: SchemaDefault>(
+        &mut self,
+        name: &str,
+        prop_type: UikaReifyPropType,
+        flags: u64,
+        default: T,
+    ) {
+        self.property_record(name, prop_type, flags, |buf| default.write_default(buf));
+    }
+
+    /// Add a default subobject. `flags` are `UIKA_COMP_*`; an empty
+    /// `attach_parent` attaches to nothing.
+    pub fn component(&mut self, name: &str, class: UClassHandle, flags: u32, attach_parent: &str) {
+        self.record(UIKA_SCHEMA_COMPONENT);
+        self.name(name);
+        self.buf.extend_from_slice(&class.to_addr().to_le_bytes());
+        self.buf.extend_from_slice(&flags.to_le_bytes());
+        self.name(attach_parent);
+    }
+
+    /// Add a function dispatching to a `reify_registry` callback.
+    pub fn function(&mut self, name: &str, callback_id: u64, func_flags: u32) {
+        self.record(UIKA_SCHEMA_FUNCTION);
+        self.name(name);
+        self.buf.extend_from_slice(&callback_id.to_le_bytes());
+        self.buf.extend_from_slice(&func_flags.to_le_bytes());
+        self.has_function = true;
+    }
+
+    /// Add a parameter to the latest function (`CPF_PARM` is implied).
+    pub fn param(&mut self, name: &str, prop_type: UikaReifyPropType, param_flags: u64) {
+        assert!(self.has_function, "ClassSchema::param before function()");
+        self.record(UIKA_SCHEMA_PARAM);
+        self.name(name);
+        self.buf.extend_from_slice(&(prop_type as u32).to_le_bytes());
+        self.buf.extend_from_slice(&param_flags.to_le_bytes());
+    }
+
+    /// Register every described class. Classes that were created get their
+    /// `on_registered` call even if others failed.
+    pub fn submit(self) -> UikaResult<()> {
+        let count = self.class_count();
+        if count == 0 {
+            return Ok(());
+        }
+        let mut classes = vec![UClassHandle::null(); count as usize];
+        let code = unsafe {
+            ffi_dispatch::reify_register_class_from_schema(
+                self.buf.as_ptr(),
+                self.buf.len() as u32,
+                classes.as_mut_ptr(),
+                count,
+            )
+        };
+        for (class, on_registered) in classes.iter().zip(&self.on_registered) {
+            if !class.is_null() {
+                on_registered(*class);
+            }
+        }
+        check_ffi(code)
+    }
+
+    fn property_record(
+        &mut self,
+        name: &str,
+        prop_type: UikaReifyPropType,
+        flags: u64,
+        write_default: impl FnOnce(&mut Vec<u8>),
+    ) {
+        self.record(UIKA_SCHEMA_PROPERTY);
+        self.name(name);
+        self.buf.extend_from_slice(&(prop_type as u32).to_le_bytes());
+        self.buf.extend_from_slice(&flags.to_le_bytes());
+        let len_at = self.buf.len();
+        self.buf.extend_from_slice(&0u16.to_le_bytes());
+        write_default(&mut self.buf);
+        let len = (self.buf.len() - len_at - 2) as u16;
+        self.buf[len_at..len_at + 2].copy_from_slice(&len.to_le_bytes());
+    }
+
+    fn record(&mut self, kind: u8) {
+        let at = self.record_count_at.expect("ClassSchema record before class()");
+        let count = u32::from_le_bytes(self.buf[at..at + 4].try_into().unwrap()) + 1;
+        self.buf[at..at + 4].copy_from_slice(&count.to_le_bytes());
+        self.buf.push(kind);
+    }
+
+    fn name(&mut self, name: &str) {
+        let len = u16::try_from(name.len()).expect("ClassSchema name longer than 65535 bytes");
+        self.buf.extend_from_slice(&len.to_le_bytes());
+        self.buf.extend_from_slice(name.as_bytes());
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn schema_layout() {
+        let parent = UClassHandle::from_addr(0x1000);
+        let mut schema = ClassSchema::new();
+        assert!(schema.class(7, "Ship", "Pawn", parent, |_| {}));
+        schema.property_with_default("Speed", UikaReifyPropType::Float, 4, 2.5f32);
+        schema.function("Fire", 3, 0x400);
+        schema.param("Power", UikaReifyPropType::Int32, 0);
+        // Rust parent described above: no handle needed.
+        assert!(schema.class(8, "Frigate", "Ship", UClassHandle::null(), |_| {}));
+        // Unknown parent without a handle is rejected.
+        assert!(!schema.class(9, "Orphan", "Missing", UClassHandle::null(), |_| {}));
+
+        let b = schema.as_bytes();
+        let u16_at = |o: usize| u16::from_le_bytes(b[o..o + 2].try_into().unwrap());
+        let u32_at = |o: usize| u32::from_le_bytes(b[o..o + 4].try_into().unwrap());
+        let u64_at = |o: usize| u64::from_le_bytes(b[o..o + 8].try_into().unwrap());
+
+        assert_eq!(u32_at(0), UIKA_CLASS_SCHEMA_VERSION);
+        assert_eq!(u32_at(4), 2);
+        assert_eq!(u64_at(8), 7);
+        assert_eq!(u64_at(16), 0x1000);
+        assert_eq!(u16_at(24), 4);
+        assert_eq!(&b[26..30], b"Ship");
+        assert_eq!(u16_at(30), 4);
+        assert_eq!(&b[32..36], b"Pawn");
+        assert_eq!(u32_at(36), 3); // property, function, param
+
+        // Property: kind, name, type, flags, default.
+        assert_eq!(b[40], UIKA_SCHEMA_PROPERTY);
+        assert_eq!(u16_at(41), 5);
+        assert_eq!(&b[43..48], b"Speed");
+        assert_eq!(u32_at(48), UikaReifyPropType::Float as u32);
+        assert_eq!(u64_at(52), 4);
+        assert_eq!(u16_at(60), 4);
+        assert_eq!(&b[62..66], &2.5f32.to_le_bytes());
+
+        // Function, then its parameter.
+        assert_eq!(b[66], UIKA_SCHEMA_FUNCTION);
+        assert_eq!(&b[69..73], b"Fire");
+        assert_eq!(u64_at(73), 3);
+        assert_eq!(u32_at(81), 0x400);
+        assert_eq!(b[85], UIKA_SCHEMA_PARAM);
+
+        // Second class: null parent resolved by name on the C++ side.
+        let second = 86 + 2 + 5 + 4 + 8;
+        assert_eq!(u64_at(second), 8);
+        assert_eq!(u64_at(second + 8), 0);
+        assert_eq!(schema.class_count(), 2);
+    }
+}
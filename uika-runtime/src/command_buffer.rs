@@ -0,0 +1,329 @@
+// Command buffers: record fire-and-forget calls of generated function
+// wrappers into a linear arena and submit them in a single FFI crossing.
+//
+// Each record is a header, one 8-byte slot per wrapper input and an aligned
+// payload for struct/string arguments (layout in `uika_ffi::command_types`).
+// `submit` hands the whole arena to `execute_command_buffer`, which runs
+// every record through the generated packed-args thunk of its function.
+// Outputs and return values of recorded calls are discarded.
+//
+// Generated classes expose typed recorders as `<function>_cmd`; the raw
+// `record` API is what they are built on.
+
+use uika_ffi::{
+    FNameHandle, UClassHandle, UObjectHandle, UikaCommandHeader, UIKA_CMD_ALIGN,
+    UIKA_CMD_SLOT_SIZE,
+};
+
+use crate::error::{check_ffi, UikaError, UikaResult};
+use crate::ffi_dispatch;
+
+const ALIGN: usize = UIKA_CMD_ALIGN as usize;
+const SLOT: usize = UIKA_CMD_SLOT_SIZE as usize;
+const HEADER: usize = std::mem::size_of::<UikaCommandHeader>();
+
+/// One alignment unit of arena storage, so records and payloads can be
+/// placed on UIKA_CMD_ALIGN boundaries.
+#[repr(C, align(16))]
+#[derive(Clone, Copy)]
+struct Chunk([u8; ALIGN]);
+
+const ZERO_CHUNK: Chunk = Chunk([0; ALIGN]);
+
+#[inline]
+fn align_up(n: usize) -> usize {
+    (n + ALIGN - 1) & !(ALIGN - 1)
+}
+
+/// A value that fits in one argument slot.
+pub trait CommandScalar: Copy {
+    /// Slot encoding: the value in the low bytes, little-endian.
+    fn to_slot(self) -> u64;
+}
+
+macro_rules! impl_command_scalar_int {
+    ($($t:ty),*) => {$(
+        impl CommandScalar for $t {
+            #[inline]
+            fn to_slot(self) -> u64 {
+                // Sign/zero extension keeps the low bytes right for any
+                // narrower C++ parameter type.
+                self as i64 as u64
+            }
+        }
+    )*};
+}
+
+impl_command_scalar_int!(i8, u8, i16, u16, i32, u32, i64, u64);
+
+impl CommandScalar for bool {
+    #[inline]
+    fn to_slot(self) -> u64 {
+        self as u64
+    }
+}
+
+impl CommandScalar for f32 {
+    #[inline]
+    fn to_slot(self) -> u64 {
+        self.to_bits() as u64
+    }
+}
+
+impl CommandScalar for f64 {
+    #[inline]
+    fn to_slot(self) -> u64 {
+        self.to_bits()
+    }
+}
+
+impl CommandScalar for UObjectHandle {
+    #[inline]
+    fn to_slot(self) -> u64 {
+        self.to_addr()
+    }
+}
+
+impl CommandScalar for UClassHandle {
+    #[inline]
+    fn to_slot(self) -> u64 {
+        self.to_addr()
+    }
+}
+
+impl CommandScalar for FNameHandle {
+    #[inline]
+    fn to_slot(self) -> u64 {
+        self.0
+    }
+}
+
+/// Outcome of [`CommandBuffer::submit`].
+#[derive(Clone, Copy, Debug, Default, PartialEq, Eq)]
+pub struct CommandStats {
+    /// Records processed.
+    pub executed: u32,
+    /// Records whose call failed (destroyed target, no thunk). They are
+    /// skipped; the rest of the buffer still runs.
+    pub failed: u32,
+}
+
+/// Linear arena of recorded calls. Reuse one per system and frame: `submit`
+/// and `clear` keep the allocation.
+pub struct CommandBuffer {
+    chunks: Vec<Chunk>,
+    /// Bytes in use. A multiple of UIKA_CMD_ALIGN between records.
+    len: usize,
+    count: u32,
+}
+
+impl Default for CommandBuffer {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl CommandBuffer {
+    pub fn new() -> Self {
+        CommandBuffer { chunks: Vec::new(), len: 0, count: 0 }
+    }
+
+    /// Pre-allocate room for `bytes` of records.
+    pub fn with_capacity(bytes: usize) -> Self {
+        CommandBuffer { chunks: Vec::with_capacity(align_up(bytes) / ALIGN), len: 0, count: 0 }
+    }
+
+    /// Number of recorded calls.
+    pub fn len(&self) -> u32 {
+        self.count
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.count == 0
+    }
+
+    /// Size of the recorded data in bytes.
+    pub fn byte_len(&self) -> usize {
+        self.len
+    }
+
+    /// Drop all records, keeping the allocation.
+    pub fn clear(&mut self) {
+        self.chunks.clear();
+        self.len = 0;
+        self.count = 0;
+    }
+
+    pub fn as_bytes(&self) -> &[u8] {
+        // SAFETY: Chunk is plain bytes; `len` never exceeds the initialized chunks.
+        unsafe { std::slice::from_raw_parts(self.chunks.as_ptr().cast::<u8>(), self.len) }
+    }
+
+    fn bytes_mut(&mut self) -> &mut [u8] {
+        // SAFETY: as in `as_bytes`, over every initialized chunk.
+        unsafe {
+            std::slice::from_raw_parts_mut(self.chunks.as_mut_ptr().cast::<u8>(), self.chunks.len() * ALIGN)
+        }
+    }
+
+    /// Grow the used region to `new_len` bytes, zero-filling.
+    fn extend_to(&mut self, new_len: usize) {
+        let chunks = align_up(new_len) / ALIGN;
+        if chunks > self.chunks.len() {
+            self.chunks.resize(chunks, ZERO_CHUNK);
+        }
+        self.len = new_len;
+    }
+
+    /// Start recording a call of generated function `func_id` on `obj`
+    /// (null for static functions) taking `slot_count` inputs. The arguments
+    /// are written through the returned [`CommandArgs`]; the record is
+    /// finished when it is dropped.
+    ///
+    /// # Safety
+    /// Exactly `slot_count` arguments must be written, in the wrapper's input
+    /// order and with its parameter types. `obj` must be an object of the
+    /// function's class when the buffer is submitted. Generated `_cmd`
+    /// recorders uphold both.
+    pub unsafe fn record(&mut self, func_id: u32, obj: UObjectHandle, slot_count: u32) -> CommandArgs<'_> {
+        let start = self.len;
+        self.extend_to(start + HEADER + slot_count as usize * SLOT);
+        let header = UikaCommandHeader { func_id, size: 0, obj };
+        // SAFETY: the header region was just reserved; the arena is 16-aligned.
+        unsafe {
+            std::ptr::write(self.bytes_mut().as_mut_ptr().add(start).cast::<UikaCommandHeader>(), header);
+        }
+        CommandArgs { buf: self, start, next_slot: 0, slot_count }
+    }
+
+    /// Execute every recorded call in one FFI crossing, then clear the
+    /// buffer (also on error). Fails only if the buffer is malformed.
+    pub fn submit(&mut self) -> UikaResult<CommandStats> {
+        if self.is_empty() {
+            return Ok(CommandStats::default());
+        }
+        let len = u32::try_from(self.len)
+            .map_err(|_| UikaError::InvalidOperation("command buffer exceeds 4 GiB".into()));
+        let result = len.and_then(|len| {
+            let mut stats = CommandStats::default();
+            check_ffi(unsafe {
+                ffi_dispatch::reflection_execute_command_buffer(
+                    self.as_bytes().as_ptr(),
+                    len,
+                    &mut stats.executed,
+                    &mut stats.failed,
+                )
+            })?;
+            Ok(stats)
+        });
+        self.clear();
+        result
+    }
+}
+
+/// Whether generated function `func_id` can be recorded (has a C++ thunk).
+pub fn has_command_thunk(func_id: u32) -> bool {
+    unsafe { ffi_dispatch::reflection_has_command_thunk(func_id) }
+}
+
+/// Argument writer for one record. Finishes the record on drop.
+pub struct CommandArgs<'a> {
+    buf: &'a mut CommandBuffer,
+    start: usize,
+    next_slot: u32,
+    slot_count: u32,
+}
+
+impl CommandArgs<'_> {
+    fn write_slot(&mut self, value: u64) {
+        assert!(self.next_slot < self.slot_count, "more command arguments than slots");
+        let at = self.start + HEADER + self.next_slot as usize * SLOT;
+        self.buf.bytes_mut()[at..at + SLOT].copy_from_slice(&value.to_le_bytes());
+        self.next_slot += 1;
+    }
+
+    /// Write a scalar argument (number, bool, enum value, handle, FName).
+    pub fn scalar<T: CommandScalar>(&mut self, value: T) -> &mut Self {
+        self.write_slot(value.to_slot());
+        self
+    }
+
+    /// Write a struct argument by value. The bytes are copied into the
+    /// record payload.
+    pub fn bytes(&mut self, data: &[u8]) -> &mut Self {
+        let offset = align_up(self.buf.len);
+        self.buf.extend_to(offset + data.len());
+        self.buf.bytes_mut()[offset..offset + data.len()].copy_from_slice(data);
+
+        let rel = u32::try_from(offset - self.start).expect("command record exceeds 4 GiB");
+        let len = u32::try_from(data.len()).expect("command argument exceeds 4 GiB");
+        self.write_slot(rel as u64 | ((len as u64) << 32));
+        self
+    }
+
+    /// Write a UTF-8 string argument (FString / FText / FName-by-string).
+    pub fn str(&mut self, s: &str) -> &mut Self {
+        self.bytes(s.as_bytes())
+    }
+}
+
+impl Drop for CommandArgs<'_> {
+    fn drop(&mut self) {
+        debug_assert_eq!(self.next_slot, self.slot_count, "command record left with unwritten slots");
+        let end = align_up(self.buf.len);
+        self.buf.extend_to(end);
+        let size = u32::try_from(end - self.start).expect("command record exceeds 4 GiB");
+        let at = self.start + std::mem::offset_of!(UikaCommandHeader, size);
+        self.buf.bytes_mut()[at..at + 4].copy_from_slice(&size.to_le_bytes());
+        self.buf.count += 1;
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn header_at(bytes: &[u8], at: usize) -> (u32, u32, u64) {
+        let u32_at = |o: usize| u32::from_le_bytes(bytes[at + o..at + o + 4].try_into().unwrap());
+        let obj = u64::from_le_bytes(bytes[at + 8..at + 16].try_into().unwrap());
+        (u32_at(0), u32_at(4), obj)
+    }
+
+    #[test]
+    fn records_are_aligned_and_self_describing() {
+        let mut cmd = CommandBuffer::new();
+        unsafe {
+            cmd.record(7, UObjectHandle::from_addr(0x1000), 2).scalar(true).scalar(-2i32);
+            cmd.record(9, UObjectHandle::null(), 2).str("abc").scalar(1.5f32);
+        }
+        assert_eq!(cmd.len(), 2);
+
+        let bytes = cmd.as_bytes();
+        assert_eq!(bytes.as_ptr() as usize % ALIGN, 0);
+
+        // First record: header + 2 slots, already aligned.
+        assert_eq!(header_at(bytes, 0), (7, 32, 0x1000));
+        assert_eq!(&bytes[16..24], &1u64.to_le_bytes());
+        assert_eq!(&bytes[24..32], &(-2i64 as u64).to_le_bytes());
+
+        // Second record: header + 2 slots + 3 payload bytes padded to 16.
+        assert_eq!(header_at(bytes, 32), (9, 48, 0));
+        let packed = u64::from_le_bytes(bytes[48..56].try_into().unwrap());
+        let (offset, len) = (packed as u32 as usize, (packed >> 32) as usize);
+        assert_eq!((offset, len), (32, 3));
+        assert_eq!(&bytes[32 + offset..32 + offset + len], b"abc");
+        assert_eq!(&bytes[56..64], &(1.5f32.to_bits() as u64).to_le_bytes());
+        assert_eq!(cmd.byte_len(), 80);
+    }
+
+    #[test]
+    fn clear_keeps_nothing() {
+        let mut cmd = CommandBuffer::with_capacity(256);
+        unsafe {
+            cmd.record(1, UObjectHandle::null(), 0);
+        }
+        cmd.clear();
+        assert!(cmd.is_empty());
+        assert_eq!(cmd.byte_len(), 0);
+    }
+}
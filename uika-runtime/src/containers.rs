@@ -6,6 +6,7 @@
 use std::collections::{HashMap, HashSet};
 use std::hash::Hash;
 use std::marker::PhantomData;
+use std::mem::MaybeUninit;
 
 use uika_ffi::{FPropertyHandle, UObjectHandle, UikaErrorCode};
 
@@ -37,7 +38,10 @@ pub unsafe trait ContainerElement: Sized {
     const BUF_SIZE: u32;
 
     /// Whether this type can be bulk-copied as raw bytes (no per-element framing).
-    /// True for fixed-size primitives (bool, integers, floats) and FName.
+    /// True for fixed-size primitives (bool, integers, floats), FName and the
+    /// POD math structs whose layout matches the UE struct. A hint only: C++
+    /// decides per property, and raw paths fall back to framing (or report
+    /// `TypeMismatch` for in-place access) when it disagrees.
     const RAW_COPYABLE: bool = false;
 
     /// Interpret bytes from the C++ side into a Rust value.
@@ -91,6 +95,19 @@ impl_container_element_primitive!(u64);
 impl_container_element_primitive!(f32);
 impl_container_element_primitive!(f64);
 
+// POD math structs: `#[repr(C)]` layouts identical to the UE struct, which is
+// STRUCT_IsPlainOldData, so arrays of them take the raw memcpy path.
+impl_container_element_primitive!(glam::DVec2); // FVector2D
+impl_container_element_primitive!(glam::DVec3); // FVector
+impl_container_element_primitive!(glam::DVec4); // FVector4
+impl_container_element_primitive!(glam::DQuat); // FQuat
+impl_container_element_primitive!(crate::ue_math::Rotator); // FRotator
+impl_container_element_primitive!(crate::ue_math::LinearColor); // FLinearColor
+impl_container_element_primitive!(crate::ue_math::Plane); // FPlane
+impl_container_element_primitive!(crate::ue_math::Ray); // FRay
+impl_container_element_primitive!(crate::ue_math::Sphere); // FSphere
+impl_container_element_primitive!(crate::ue_math::BoxSphereBounds); // FBoxSphereBounds
+
 // UObjectHandle: 8-byte pointer, raw memcpy in C++
 unsafe impl ContainerElement for UObjectHandle {
     const BUF_SIZE: u32 = std::mem::size_of::<UObjectHandle>() as u32;
@@ -321,8 +338,9 @@ fn bulk_copy_with_retry(
     let mut count: i32 = 0;
     let code = call(buf.as_mut_ptr(), buf.len() as u32, &mut written, &mut count);
     if code == UikaErrorCode::BufferTooSmall {
-        // Retry with the size hint from C++
-        let needed = (written as usize).max(buf.len() * 2);
+        // C++ reports the exact required size; only a concurrent resize
+        // between the two calls can make the retry fail.
+        let needed = (written as usize).max(buf.len());
         buf.resize(needed, 0);
         check_ffi(call(
             buf.as_mut_ptr(),
@@ -337,6 +355,74 @@ fn bulk_copy_with_retry(
     Ok((buf, count))
 }
 
+/// Append one `[u32 written][data]` frame for `item`.
+fn push_framed<T: ContainerElement>(buf: &mut Vec<u8>, elem_buf: &mut [u8; MAX_ELEM_BUF], item: &T) {
+    let written = unsafe { item.write_to_buf(elem_buf.as_mut_ptr()) };
+    buf.extend_from_slice(&written.to_ne_bytes());
+    buf.extend_from_slice(&elem_buf[..written as usize]);
+}
+
+/// Split an array copy's signed count into (element count, raw stride).
+/// A negative count marks raw format; the stride is `bytes / count`.
+fn raw_layout(count: i32, bytes: usize) -> (usize, usize) {
+    if count < 0 {
+        let n = count.unsigned_abs() as usize;
+        (n, bytes / n)
+    } else {
+        (count as usize, 0)
+    }
+}
+
+/// Query the exact byte size of a bulk copy (`*_copy_size`).
+fn exact_copy_size(
+    call: impl FnOnce(*mut u32, *mut i32) -> UikaErrorCode,
+) -> UikaResult<usize> {
+    let mut size: u32 = 0;
+    let mut count: i32 = 0;
+    check_ffi(call(&mut size, &mut count))?;
+    Ok(size as usize)
+}
+
+/// Default scratch capacity for chunked copies when the caller passes an
+/// unallocated buffer.
+const CHUNK_SCRATCH_DEFAULT: usize = 64 * 1024;
+
+/// Drive a `*_copy_chunk` call until the cursor reports done, handing each
+/// chunk (whole buffer, bytes written, element count) to `decode`. `scratch` is reused
+/// across chunks and grows only when a single element does not fit.
+fn copy_chunks(
+    scratch: &mut Vec<u8>,
+    call: impl Fn(*mut i32, *mut u8, u32, *mut u32, *mut i32) -> UikaErrorCode,
+    mut decode: impl FnMut(&mut Vec<u8>, usize, i32),
+) -> UikaResult<()> {
+    if scratch.capacity() == 0 {
+        scratch.reserve(CHUNK_SCRATCH_DEFAULT);
+    }
+    let cap = scratch.capacity();
+    scratch.resize(cap, 0);
+    let mut cursor: i32 = 0;
+    while cursor >= 0 {
+        let mut written: u32 = 0;
+        let mut count: i32 = 0;
+        let code = call(
+            &mut cursor,
+            scratch.as_mut_ptr(),
+            scratch.len() as u32,
+            &mut written,
+            &mut count,
+        );
+        if code == UikaErrorCode::BufferTooSmall {
+            // `written` is the exact size of the element that did not fit.
+            let needed = (written as usize).max(scratch.len() * 2);
+            scratch.resize(needed, 0);
+            continue;
+        }
+        check_ffi(code)?;
+        decode(scratch, written as usize, count);
+    }
+    Ok(())
+}
+
 // ---------------------------------------------------------------------------
 // Bulk iterators
 // ---------------------------------------------------------------------------
@@ -501,21 +587,21 @@ impl<T: ContainerElement> UeArray<T> {
         }
         let owner = self.owner;
         let prop = self.prop;
-        // Raw-copyable types have no per-element framing overhead
+        // Raw-copyable sizes are known up front; framed ones are measured
         let estimate = if T::RAW_COPYABLE {
             len * T::BUF_SIZE as usize
         } else {
-            len * (T::BUF_SIZE as usize + 4)
+            exact_copy_size(|size, cnt| unsafe {
+                ffi_dispatch::container_array_copy_size(owner, prop, size, cnt)
+            })?
         };
         let (buf, count) = bulk_copy_with_retry(estimate, |out, size, written, cnt| unsafe {
             ffi_dispatch::container_array_copy_all(owner, prop, out, size, written, cnt)
         })?;
-        // Negative count = raw format from C++
-        let (actual_count, raw_elem_size) = if count < 0 {
-            ((-count) as usize, T::BUF_SIZE as usize)
-        } else {
-            (count as usize, 0)
-        };
+        // Negative count = raw format from C++. POD structs are raw on the
+        // C++ side even when T (e.g. OwnedStruct) is not, so take the stride
+        // from the data rather than T::BUF_SIZE.
+        let (actual_count, raw_elem_size) = raw_layout(count, buf.len());
         Ok(BulkArrayIter::<T> {
             buf,
             count: actual_count,
@@ -545,16 +631,14 @@ impl<T: ContainerElement> UeArray<T> {
         let estimate = if T::RAW_COPYABLE {
             len * T::BUF_SIZE as usize
         } else {
-            len * (T::BUF_SIZE as usize + 4)
+            exact_copy_size(|size, cnt| unsafe {
+                ffi_dispatch::container_array_copy_size(owner, prop, size, cnt)
+            })?
         };
         let (buf, count) = bulk_copy_with_retry(estimate, |out, size, written, cnt| unsafe {
             ffi_dispatch::container_array_copy_all(owner, prop, out, size, written, cnt)
         })?;
-        let (actual_count, raw_elem_size) = if count < 0 {
-            ((-count) as usize, T::BUF_SIZE as usize)
-        } else {
-            (count as usize, 0)
-        };
+        let (actual_count, raw_elem_size) = raw_layout(count, buf.len());
         Ok(BulkArrayIter {
             buf,
             count: actual_count,
@@ -565,6 +649,41 @@ impl<T: ContainerElement> UeArray<T> {
         })
     }
 
+    /// Exact number of bytes a bulk copy of this array transfers.
+    pub fn copy_size(&self) -> UikaResult<usize> {
+        let (owner, prop) = (self.owner, self.prop);
+        exact_copy_size(|size, cnt| unsafe {
+            ffi_dispatch::container_array_copy_size(owner, prop, size, cnt)
+        })
+    }
+
+    /// Stream all elements through `scratch` in bounded chunks, calling `f`
+    /// for each. `scratch` is reused (64 KiB if unallocated) and grows only
+    /// when a single element exceeds it, so large arrays never need one
+    /// allocation sized to the whole container.
+    pub fn copy_chunked(&self, scratch: &mut Vec<u8>, mut f: impl FnMut(T)) -> UikaResult<()> {
+        let (owner, prop) = (self.owner, self.prop);
+        copy_chunks(
+            scratch,
+            |cursor, out, size, written, cnt| unsafe {
+                ffi_dispatch::container_array_copy_chunk(owner, prop, cursor, out, size, written, cnt)
+            },
+            |buf, written, count| {
+                let (count, raw_elem_size) = raw_layout(count, written);
+                let mut iter = BulkArrayIter::<T> {
+                    buf: std::mem::take(buf),
+                    count,
+                    index: 0,
+                    offset: 0,
+                    raw_elem_size,
+                    _marker: PhantomData,
+                };
+                iter.by_ref().for_each(&mut f);
+                *buf = iter.buf;
+            },
+        )
+    }
+
     /// Replace all array elements from a slice in a single FFI call.
     pub fn set_all(&self, items: &[T]) -> UikaResult<()> {
         if items.is_empty() {
@@ -578,7 +697,7 @@ impl<T: ContainerElement> UeArray<T> {
                 unsafe { item.write_to_buf(buf.as_mut_ptr().add(i * elem_size)); }
             }
             // Negative count signals raw format to C++
-            check_ffi(unsafe {
+            match check_ffi(unsafe {
                 ffi_dispatch::container_array_set_all(
                     self.owner,
                     self.prop,
@@ -586,26 +705,220 @@ impl<T: ContainerElement> UeArray<T> {
                     buf.len() as u32,
                     -(items.len() as i32),
                 )
-            })
-        } else {
-            // Framed format: [u32 written][data] per element
-            let mut buf = Vec::with_capacity(items.len() * (T::BUF_SIZE as usize + 4));
-            let mut elem_buf = [0u8; MAX_ELEM_BUF];
-            for item in items {
-                let written = unsafe { item.write_to_buf(elem_buf.as_mut_ptr()) };
-                buf.extend_from_slice(&written.to_ne_bytes());
-                buf.extend_from_slice(&elem_buf[..written as usize]);
+            }) {
+                // C++ only memcpys structs flagged STRUCT_IsPlainOldData; a
+                // math struct the engine leaves unflagged goes framed.
+                Err(UikaError::TypeMismatch) => {}
+                result => return result,
             }
-            check_ffi(unsafe {
-                ffi_dispatch::container_array_set_all(
-                    self.owner,
-                    self.prop,
-                    buf.as_ptr(),
-                    buf.len() as u32,
-                    items.len() as i32,
-                )
-            })
         }
+        // Framed format: [u32 written][data] per element
+        let mut buf = Vec::with_capacity(items.len() * (T::BUF_SIZE as usize + 4));
+        let mut elem_buf = [0u8; MAX_ELEM_BUF];
+        for item in items {
+            push_framed(&mut buf, &mut elem_buf, item);
+        }
+        check_ffi(unsafe {
+            ffi_dispatch::container_array_set_all(
+                self.owner,
+                self.prop,
+                buf.as_ptr(),
+                buf.len() as u32,
+                items.len() as i32,
+            )
+        })
+    }
+}
+
+// ---------------------------------------------------------------------------
+// UeArray in-place access (raw-copyable element types)
+// ---------------------------------------------------------------------------
+
+impl<T: ContainerElement + Copy> UeArray<T> {
+    /// Element storage of the TArray, checked against `T`'s layout.
+    fn raw_data(&self) -> UikaResult<(*mut u8, usize)> {
+        if !T::RAW_COPYABLE {
+            return Err(UikaError::TypeMismatch);
+        }
+        let mut data = std::ptr::null_mut();
+        let mut len: i32 = 0;
+        let mut elem_size: u32 = 0;
+        check_ffi(unsafe {
+            ffi_dispatch::container_array_data(self.owner, self.prop, &mut data, &mut len, &mut elem_size)
+        })?;
+        // e.g. FName is wider than FNameHandle in case-preserving builds
+        if elem_size as usize != std::mem::size_of::<T>() {
+            return Err(UikaError::TypeMismatch);
+        }
+        Ok((data, len.max(0) as usize))
+    }
+
+    /// Borrow the array's elements in place, without copying.
+    ///
+    /// # Safety
+    /// The slice aliases the TArray allocation. While `f` runs, nothing may
+    /// resize or free this array: not through any copy of this handle
+    /// (`push`, `remove`, `clear`, ...), not from UE code `f` calls into,
+    /// and not by destroying or collecting the owner.
+    pub unsafe fn with_slice<R>(&self, f: impl FnOnce(&[T]) -> R) -> UikaResult<R> {
+        let (data, len) = self.raw_data()?;
+        if len == 0 {
+            return Ok(f(&[]));
+        }
+        Ok(f(unsafe { std::slice::from_raw_parts(data as *const T, len) }))
+    }
+
+    /// Mutably borrow the array's elements in place.
+    ///
+    /// # Safety
+    /// Same requirements as [`with_slice`](Self::with_slice); in addition no
+    /// other view of the storage (from another copy of this handle) may be
+    /// alive while `f` runs.
+    pub unsafe fn with_slice_mut<R>(&mut self, f: impl FnOnce(&mut [T]) -> R) -> UikaResult<R> {
+        let (data, len) = self.raw_data()?;
+        if len == 0 {
+            return Ok(f(&mut []));
+        }
+        Ok(f(unsafe { std::slice::from_raw_parts_mut(data as *mut T, len) }))
+    }
+
+    /// Ensure the array can hold `capacity` elements without reallocating.
+    pub fn reserve(&self, capacity: usize) -> UikaResult<()> {
+        check_ffi(unsafe {
+            ffi_dispatch::container_array_reserve(self.owner, self.prop, capacity as i32)
+        })
+    }
+
+    /// Append `items` with a single growth and memcpy.
+    pub fn append_raw(&self, items: &[T]) -> UikaResult<()> {
+        self.raw_data()?;
+        check_ffi(unsafe {
+            ffi_dispatch::container_array_append_raw(
+                self.owner,
+                self.prop,
+                items.as_ptr() as *const u8,
+                items.len() as i32,
+                std::ptr::null_mut(),
+            )
+        })
+    }
+
+    /// Append `count` elements with a single growth and let `f` initialize
+    /// them in place. The new storage is zero-filled, but `f` must write
+    /// every element: all-zero bytes are not a valid value of every `T`.
+    ///
+    /// # Safety
+    /// Same requirements as [`with_slice_mut`](Self::with_slice_mut) for
+    /// the new elements while `f` runs.
+    pub unsafe fn append_with<R>(
+        &mut self,
+        count: usize,
+        f: impl FnOnce(&mut [MaybeUninit<T>]) -> R,
+    ) -> UikaResult<R> {
+        self.raw_data()?;
+        let mut data = std::ptr::null_mut();
+        check_ffi(unsafe {
+            ffi_dispatch::container_array_append_raw(
+                self.owner,
+                self.prop,
+                std::ptr::null(),
+                count as i32,
+                &mut data,
+            )
+        })?;
+        if count == 0 {
+            return Ok(f(&mut []));
+        }
+        Ok(f(unsafe { std::slice::from_raw_parts_mut(data as *mut MaybeUninit<T>, count) }))
+    }
+}
+
+// ---------------------------------------------------------------------------
+// UeArray algorithms (run on the C++ side, elements never copied out)
+// ---------------------------------------------------------------------------
+
+impl<T: ContainerElement> UeArray<T> {
+    /// Index of the first element equal to `val` (UE `Identical` semantics).
+    pub fn find(&self, val: &T) -> UikaResult<Option<usize>> {
+        self.find_from(val, 0)
+    }
+
+    /// Like [`find`](Self::find), starting the search at `start`.
+    pub fn find_from(&self, val: &T, start: usize) -> UikaResult<Option<usize>> {
+        let mut buf = [0u8; MAX_ELEM_BUF];
+        let written = unsafe { val.write_to_buf(buf.as_mut_ptr()) };
+        let mut index: i32 = -1;
+        check_ffi(unsafe {
+            ffi_dispatch::container_array_find(
+                self.owner, self.prop, buf.as_ptr(), written, start as i32, &mut index,
+            )
+        })?;
+        Ok((index >= 0).then_some(index as usize))
+    }
+
+    pub fn contains(&self, val: &T) -> UikaResult<bool> {
+        Ok(self.find(val)?.is_some())
+    }
+
+    /// Remove every element equal to `val`. Returns how many were removed.
+    pub fn remove_all(&self, val: &T) -> UikaResult<usize> {
+        let mut buf = [0u8; MAX_ELEM_BUF];
+        let written = unsafe { val.write_to_buf(buf.as_mut_ptr()) };
+        let mut removed: i32 = 0;
+        check_ffi(unsafe {
+            ffi_dispatch::container_array_remove_all_by_value(
+                self.owner, self.prop, buf.as_ptr(), written, &mut removed,
+            )
+        })?;
+        Ok(removed as usize)
+    }
+
+    /// Remove repeated elements, keeping each first occurrence in order.
+    /// Returns how many were removed.
+    pub fn dedup(&self) -> UikaResult<usize> {
+        let mut removed: i32 = 0;
+        check_ffi(unsafe { ffi_dispatch::container_array_dedupe(self.owner, self.prop, &mut removed) })?;
+        Ok(removed as usize)
+    }
+
+    /// Stable sort by natural order (numerics, bools, enums, strings, names,
+    /// text). Other element types fail with `TypeMismatch`.
+    pub fn sort(&self, descending: bool) -> UikaResult<()> {
+        check_ffi(unsafe {
+            ffi_dispatch::container_array_sort(
+                self.owner, self.prop, uika_ffi::UIKA_SORT_BY_VALUE, descending, std::ptr::null(),
+            )
+        })
+    }
+
+    /// Stable sort of actor / scene-component elements by distance to
+    /// `origin`. Elements without a location sort last.
+    pub fn sort_by_distance(&self, origin: [f64; 3], descending: bool) -> UikaResult<()> {
+        check_ffi(unsafe {
+            ffi_dispatch::container_array_sort(
+                self.owner, self.prop, uika_ffi::UIKA_SORT_BY_DISTANCE, descending, origin.as_ptr(),
+            )
+        })
+    }
+
+    pub fn swap(&self, a: usize, b: usize) -> UikaResult<()> {
+        check_ffi(unsafe { ffi_dispatch::container_array_swap(self.owner, self.prop, a as i32, b as i32) })
+    }
+
+    /// Insert `val` before `index` (`index == len` appends).
+    pub fn insert(&self, index: usize, val: &T) -> UikaResult<()> {
+        let mut buf = [0u8; MAX_ELEM_BUF];
+        let written = unsafe { val.write_to_buf(buf.as_mut_ptr()) };
+        check_ffi(unsafe {
+            ffi_dispatch::container_array_insert_at(self.owner, self.prop, index as i32, buf.as_ptr(), written)
+        })
+    }
+
+    /// Remove `count` elements starting at `index`.
+    pub fn remove_range(&self, index: usize, count: usize) -> UikaResult<()> {
+        check_ffi(unsafe {
+            ffi_dispatch::container_array_remove_range(self.owner, self.prop, index as i32, count as i32)
+        })
     }
 }
 
@@ -705,7 +1018,9 @@ impl<K: ContainerElement, V: ContainerElement> UeMap<K, V> {
         check_ffi(unsafe { ffi_dispatch::container_map_clear(self.owner, self.prop) })
     }
 
-    /// Get the key-value pair at logical index (for iteration).
+    /// Get the key-value pair at logical index.
+    ///
+    /// O(n) per call (the map is sparse); iterate with [`iter`](Self::iter).
     pub fn get_pair(&self, logical_index: usize) -> UikaResult<(K, V)> {
         let mut key_buf = [0u8; MAX_ELEM_BUF];
         let mut key_written: u32 = 0;
@@ -733,13 +1048,20 @@ impl<K: ContainerElement, V: ContainerElement> UeMap<K, V> {
         })
     }
 
-    /// Returns an iterator over key-value pairs.
+    /// Returns an iterator over key-value pairs (one FFI call per pair,
+    /// amortized O(1) each). Adding or removing pairs while iterating ends
+    /// the iteration with an error.
     pub fn iter(&self) -> UeMapIter<'_, K, V> {
-        let len = self.len().unwrap_or(0);
+        let remaining = self.len().unwrap_or(0);
+        let cursor = if remaining == 0 {
+            -1
+        } else {
+            unsafe { ffi_dispatch::container_map_iter_begin(self.owner, self.prop) }
+        };
         UeMapIter {
             map: self,
-            index: 0,
-            len,
+            cursor,
+            remaining,
         }
     }
 }
@@ -753,28 +1075,54 @@ impl<'a, K: ContainerElement, V: ContainerElement> IntoIterator for &'a UeMap<K,
     }
 }
 
-/// Iterator over `UeMap<K, V>` key-value pairs.
+/// Iterator over `UeMap<K, V>` key-value pairs, driven by an internal-index
+/// cursor.
 pub struct UeMapIter<'a, K: ContainerElement, V: ContainerElement> {
     map: &'a UeMap<K, V>,
-    index: usize,
-    len: usize,
+    cursor: i32,
+    remaining: usize,
 }
 
 impl<K: ContainerElement, V: ContainerElement> Iterator for UeMapIter<'_, K, V> {
     type Item = UikaResult<(K, V)>;
 
     fn next(&mut self) -> Option<Self::Item> {
-        if self.index >= self.len {
+        if self.remaining == 0 || self.cursor < 0 {
             return None;
         }
-        let result = self.map.get_pair(self.index);
-        self.index += 1;
-        Some(result)
+        let mut key_buf = [0u8; MAX_ELEM_BUF];
+        let mut key_written: u32 = 0;
+        let mut val_buf = [0u8; MAX_ELEM_BUF];
+        let mut val_written: u32 = 0;
+
+        let code = unsafe {
+            ffi_dispatch::container_map_iter_next(
+                self.map.owner,
+                self.map.prop,
+                &mut self.cursor,
+                key_buf.as_mut_ptr(),
+                K::BUF_SIZE,
+                &mut key_written,
+                val_buf.as_mut_ptr(),
+                V::BUF_SIZE,
+                &mut val_written,
+            )
+        };
+        if let Err(e) = check_ffi(code) {
+            self.remaining = 0;
+            return Some(Err(e));
+        }
+        self.remaining -= 1;
+        Some(Ok(unsafe {
+            (
+                K::read_from_buf(key_buf.as_ptr(), key_written),
+                V::read_from_buf(val_buf.as_ptr(), val_written),
+            )
+        }))
     }
 
     fn size_hint(&self) -> (usize, Option<usize>) {
-        let remaining = self.len.saturating_sub(self.index);
-        (remaining, Some(remaining))
+        (self.remaining, Some(self.remaining))
     }
 }
 
@@ -799,7 +1147,13 @@ impl<K: ContainerElement, V: ContainerElement> UeMap<K, V> {
         }
         let owner = self.owner;
         let prop = self.prop;
-        let estimate = len * (K::BUF_SIZE as usize + V::BUF_SIZE as usize + 8);
+        let estimate = if K::RAW_COPYABLE && V::RAW_COPYABLE {
+            len * (K::BUF_SIZE as usize + V::BUF_SIZE as usize + 8)
+        } else {
+            exact_copy_size(|size, cnt| unsafe {
+                ffi_dispatch::container_map_copy_size(owner, prop, size, cnt)
+            })?
+        };
         let (buf, count) = bulk_copy_with_retry(estimate, |out, size, written, cnt| unsafe {
             ffi_dispatch::container_map_copy_all(owner, prop, out, size, written, cnt)
         })?;
@@ -811,6 +1165,82 @@ impl<K: ContainerElement, V: ContainerElement> UeMap<K, V> {
             _marker: PhantomData,
         })
     }
+
+    /// Exact number of bytes a bulk copy of this map transfers.
+    pub fn copy_size(&self) -> UikaResult<usize> {
+        let (owner, prop) = (self.owner, self.prop);
+        exact_copy_size(|size, cnt| unsafe {
+            ffi_dispatch::container_map_copy_size(owner, prop, size, cnt)
+        })
+    }
+
+    /// Stream all key-value pairs through `scratch` in bounded chunks.
+    /// See [`UeArray::copy_chunked`].
+    pub fn copy_chunked(&self, scratch: &mut Vec<u8>, mut f: impl FnMut(K, V)) -> UikaResult<()> {
+        let (owner, prop) = (self.owner, self.prop);
+        copy_chunks(
+            scratch,
+            |cursor, out, size, written, cnt| unsafe {
+                ffi_dispatch::container_map_copy_chunk(owner, prop, cursor, out, size, written, cnt)
+            },
+            |buf, _written, count| {
+                let mut iter = BulkMapIter::<K, V> {
+                    buf: std::mem::take(buf),
+                    count: count as usize,
+                    index: 0,
+                    offset: 0,
+                    _marker: PhantomData,
+                };
+                iter.by_ref().for_each(|(k, v)| f(k, v));
+                *buf = iter.buf;
+            },
+        )
+    }
+    /// Encode pairs in the framed `map_copy_all` layout.
+    fn encode_pairs<'a>(pairs: impl IntoIterator<Item = (&'a K, &'a V)>) -> (Vec<u8>, i32)
+    where
+        K: 'a,
+        V: 'a,
+    {
+        let pairs = pairs.into_iter();
+        let mut buf = Vec::with_capacity(pairs.size_hint().0 * 16);
+        let mut elem_buf = [0u8; MAX_ELEM_BUF];
+        let mut count = 0i32;
+        for (k, v) in pairs {
+            push_framed(&mut buf, &mut elem_buf, k);
+            push_framed(&mut buf, &mut elem_buf, v);
+            count += 1;
+        }
+        (buf, count)
+    }
+
+    /// Replace all pairs in a single FFI call (one reservation, one rehash).
+    /// Accepts `&HashMap<K, V>` or any iterator of borrowed pairs.
+    pub fn set_all<'a>(&self, pairs: impl IntoIterator<Item = (&'a K, &'a V)>) -> UikaResult<()>
+    where
+        K: 'a,
+        V: 'a,
+    {
+        let (buf, count) = Self::encode_pairs(pairs);
+        check_ffi(unsafe {
+            ffi_dispatch::container_map_set_all(self.owner, self.prop, buf.as_ptr(), buf.len() as u32, count)
+        })
+    }
+
+    /// Insert or replace many pairs in a single FFI call with one rehash.
+    pub fn add_many<'a>(&self, pairs: impl IntoIterator<Item = (&'a K, &'a V)>) -> UikaResult<()>
+    where
+        K: 'a,
+        V: 'a,
+    {
+        let (buf, count) = Self::encode_pairs(pairs);
+        if count == 0 {
+            return Ok(());
+        }
+        check_ffi(unsafe {
+            ffi_dispatch::container_map_add_many(self.owner, self.prop, buf.as_ptr(), buf.len() as u32, count)
+        })
+    }
 }
 
 impl<K: ContainerElement + Hash + Eq, V: ContainerElement> UeMap<K, V> {
@@ -824,6 +1254,10 @@ impl<K: ContainerElement + Hash + Eq, V: ContainerElement> UeMap<K, V> {
         }
         Ok(map)
     }
+    /// Replace the map's contents with `map` in a single FFI call.
+    pub fn set_from_hash_map(&self, map: &HashMap<K, V>) -> UikaResult<()> {
+        self.set_all(map)
+    }
 }
 
 // ---------------------------------------------------------------------------
@@ -893,7 +1327,9 @@ impl<T: ContainerElement> UeSet<T> {
         check_ffi(unsafe { ffi_dispatch::container_set_clear(self.owner, self.prop) })
     }
 
-    /// Get the element at logical index (for iteration).
+    /// Get the element at logical index.
+    ///
+    /// O(n) per call (the set is sparse); iterate with [`iter`](Self::iter).
     pub fn get_element(&self, logical_index: usize) -> UikaResult<T> {
         let mut buf = [0u8; MAX_ELEM_BUF];
         let mut written: u32 = 0;
@@ -910,13 +1346,20 @@ impl<T: ContainerElement> UeSet<T> {
         Ok(unsafe { T::read_from_buf(buf.as_ptr(), written) })
     }
 
-    /// Returns an iterator over the elements.
+    /// Returns an iterator over the elements (one FFI call per element,
+    /// amortized O(1) each). Adding or removing elements while iterating ends
+    /// the iteration with an error.
     pub fn iter(&self) -> UeSetIter<'_, T> {
-        let len = self.len().unwrap_or(0);
+        let remaining = self.len().unwrap_or(0);
+        let cursor = if remaining == 0 {
+            -1
+        } else {
+            unsafe { ffi_dispatch::container_set_iter_begin(self.owner, self.prop) }
+        };
         UeSetIter {
             set: self,
-            index: 0,
-            len,
+            cursor,
+            remaining,
         }
     }
 }
@@ -930,28 +1373,42 @@ impl<'a, T: ContainerElement> IntoIterator for &'a UeSet<T> {
     }
 }
 
-/// Iterator over `UeSet<T>` elements.
+/// Iterator over `UeSet<T>` elements, driven by an internal-index cursor.
 pub struct UeSetIter<'a, T: ContainerElement> {
     set: &'a UeSet<T>,
-    index: usize,
-    len: usize,
+    cursor: i32,
+    remaining: usize,
 }
 
 impl<T: ContainerElement> Iterator for UeSetIter<'_, T> {
     type Item = UikaResult<T>;
 
     fn next(&mut self) -> Option<Self::Item> {
-        if self.index >= self.len {
+        if self.remaining == 0 || self.cursor < 0 {
             return None;
         }
-        let result = self.set.get_element(self.index);
-        self.index += 1;
-        Some(result)
+        let mut buf = [0u8; MAX_ELEM_BUF];
+        let mut written: u32 = 0;
+        let code = unsafe {
+            ffi_dispatch::container_set_iter_next(
+                self.set.owner,
+                self.set.prop,
+                &mut self.cursor,
+                buf.as_mut_ptr(),
+                T::BUF_SIZE,
+                &mut written,
+            )
+        };
+        if let Err(e) = check_ffi(code) {
+            self.remaining = 0;
+            return Some(Err(e));
+        }
+        self.remaining -= 1;
+        Some(Ok(unsafe { T::read_from_buf(buf.as_ptr(), written) }))
     }
 
     fn size_hint(&self) -> (usize, Option<usize>) {
-        let remaining = self.len.saturating_sub(self.index);
-        (remaining, Some(remaining))
+        (self.remaining, Some(self.remaining))
     }
 }
 
@@ -976,7 +1433,13 @@ impl<T: ContainerElement> UeSet<T> {
         }
         let owner = self.owner;
         let prop = self.prop;
-        let estimate = len * (T::BUF_SIZE as usize + 4);
+        let estimate = if T::RAW_COPYABLE {
+            len * (T::BUF_SIZE as usize + 4)
+        } else {
+            exact_copy_size(|size, cnt| unsafe {
+                ffi_dispatch::container_set_copy_size(owner, prop, size, cnt)
+            })?
+        };
         let (buf, count) = bulk_copy_with_retry(estimate, |out, size, written, cnt| unsafe {
             ffi_dispatch::container_set_copy_all(owner, prop, out, size, written, cnt)
         })?;
@@ -988,6 +1451,93 @@ impl<T: ContainerElement> UeSet<T> {
             _marker: PhantomData,
         })
     }
+
+    /// Exact number of bytes a bulk copy of this set transfers.
+    pub fn copy_size(&self) -> UikaResult<usize> {
+        let (owner, prop) = (self.owner, self.prop);
+        exact_copy_size(|size, cnt| unsafe {
+            ffi_dispatch::container_set_copy_size(owner, prop, size, cnt)
+        })
+    }
+
+    /// Stream all elements through `scratch` in bounded chunks.
+    /// See [`UeArray::copy_chunked`].
+    pub fn copy_chunked(&self, scratch: &mut Vec<u8>, mut f: impl FnMut(T)) -> UikaResult<()> {
+        let (owner, prop) = (self.owner, self.prop);
+        copy_chunks(
+            scratch,
+            |cursor, out, size, written, cnt| unsafe {
+                ffi_dispatch::container_set_copy_chunk(owner, prop, cursor, out, size, written, cnt)
+            },
+            |buf, _written, count| {
+                let mut iter = BulkSetIter::<T> {
+                    buf: std::mem::take(buf),
+                    count: count as usize,
+                    index: 0,
+                    offset: 0,
+                    _marker: PhantomData,
+                };
+                iter.by_ref().for_each(&mut f);
+                *buf = iter.buf;
+            },
+        )
+    }
+
+    /// Add every element of `other` (same element type) in place.
+    pub fn union_with(&self, other: &UeSet<T>) -> UikaResult<()> {
+        check_ffi(unsafe {
+            ffi_dispatch::container_set_union(self.owner, self.prop, other.owner, other.prop)
+        })
+    }
+
+    /// Remove every element that is also in `other`, in place.
+    pub fn difference_with(&self, other: &UeSet<T>) -> UikaResult<()> {
+        check_ffi(unsafe {
+            ffi_dispatch::container_set_difference(self.owner, self.prop, other.owner, other.prop)
+        })
+    }
+
+    /// Encode elements in the framed `set_copy_all` layout.
+    fn encode_elements<'a>(items: impl IntoIterator<Item = &'a T>) -> (Vec<u8>, i32)
+    where
+        T: 'a,
+    {
+        let items = items.into_iter();
+        let mut buf = Vec::with_capacity(items.size_hint().0 * 8);
+        let mut elem_buf = [0u8; MAX_ELEM_BUF];
+        let mut count = 0i32;
+        for item in items {
+            push_framed(&mut buf, &mut elem_buf, item);
+            count += 1;
+        }
+        (buf, count)
+    }
+
+    /// Replace all elements in a single FFI call (one reservation, one
+    /// rehash). Accepts `&HashSet<T>`, slices, or any iterator of borrows.
+    pub fn set_all<'a>(&self, items: impl IntoIterator<Item = &'a T>) -> UikaResult<()>
+    where
+        T: 'a,
+    {
+        let (buf, count) = Self::encode_elements(items);
+        check_ffi(unsafe {
+            ffi_dispatch::container_set_set_all(self.owner, self.prop, buf.as_ptr(), buf.len() as u32, count)
+        })
+    }
+
+    /// Insert many elements in a single FFI call with one rehash.
+    pub fn add_many<'a>(&self, items: impl IntoIterator<Item = &'a T>) -> UikaResult<()>
+    where
+        T: 'a,
+    {
+        let (buf, count) = Self::encode_elements(items);
+        if count == 0 {
+            return Ok(());
+        }
+        check_ffi(unsafe {
+            ffi_dispatch::container_set_add_many(self.owner, self.prop, buf.as_ptr(), buf.len() as u32, count)
+        })
+    }
 }
 
 impl<T: ContainerElement + Hash + Eq> UeSet<T> {
@@ -1001,6 +1551,10 @@ impl<T: ContainerElement + Hash + Eq> UeSet<T> {
         }
         Ok(set)
     }
+    /// Replace the set's contents with `set` in a single FFI call.
+    pub fn set_from_hash_set(&self, set: &HashSet<T>) -> UikaResult<()> {
+        self.set_all(set)
+    }
 }
 
 // ---------------------------------------------------------------------------
@@ -1,76 +1,62 @@
 // Delegate callback registry: maps callback IDs to Rust closures.
 // When UE fires a delegate, the C++ proxy calls invoke_delegate_callback(id, params),
-// which looks up and calls the registered closure.
+// which looks up and calls the registered closure. Callbacks live in a
+// generation-checked slab, so a stale ID from an unbound delegate never
+// reaches a newer closure that reused its slot.
+//
+// Queued bindings skip the per-event FFI entry: C++ copies each fire into an
+// event queue and `drain_queued_events` delivers the whole batch in one pass.
 
-use std::collections::HashMap;
-use std::sync::atomic::{AtomicU64, Ordering};
-use std::sync::{Mutex, OnceLock};
+use std::sync::atomic::{AtomicBool, Ordering};
 
-use crate::lock_or_recover;
-
-use uika_ffi::{FPropertyHandle, UObjectHandle, UikaErrorCode};
+use uika_ffi::{
+    FPropertyHandle, UObjectHandle, UikaDelegateEventBatch, UikaErrorCode,
+    UIKA_QUEUED_EVENT_HEADER_SIZE,
+};
 
 use crate::error::{check_ffi, UikaResult};
 use crate::ffi_dispatch::NativePtr;
+use crate::slab::CallbackSlab;
+
+type DelegateCallback = Box<dyn FnMut(NativePtr) + Send>;
+
+static REGISTRY: CallbackSlab<DelegateCallback> = CallbackSlab::new();
 
-type DelegateCallback = Option<Box<dyn FnMut(NativePtr) + Send>>;
+/// Set while `drain_queued_events` runs. A nested take would swap out and
+/// reset the queue the outer drain is still reading.
+static DRAINING: AtomicBool = AtomicBool::new(false);
 
-static NEXT_ID: AtomicU64 = AtomicU64::new(1);
-static REGISTRY: OnceLock<Mutex<HashMap<u64, DelegateCallback>>> = OnceLock::new();
+struct DrainGuard;
 
-fn registry() -> &'static Mutex<HashMap<u64, DelegateCallback>> {
-    REGISTRY.get_or_init(|| Mutex::new(HashMap::new()))
+impl Drop for DrainGuard {
+    fn drop(&mut self) {
+        DRAINING.store(false, Ordering::Release);
+    }
 }
 
 /// Register a closure and return its unique callback ID.
 pub fn register_callback(f: impl FnMut(NativePtr) + Send + 'static) -> u64 {
-    let id = NEXT_ID.fetch_add(1, Ordering::Relaxed);
-    lock_or_recover(registry()).insert(id, Some(Box::new(f)));
-    id
+    REGISTRY.insert(Box::new(f))
 }
 
 /// Unregister a callback by its ID.
 pub fn unregister_callback(id: u64) {
-    lock_or_recover(registry()).remove(&id);
+    REGISTRY.remove(id);
 }
 
-/// Clear all callbacks and reset the ID counter.
+/// Invalidate every callback ID at once and drop the callbacks.
 /// Called during shutdown before DLL unload (enables hot reload).
 pub fn clear_all() {
-    if let Some(reg) = REGISTRY.get() {
-        lock_or_recover(reg).clear();
-    }
-    NEXT_ID.store(1, Ordering::Relaxed);
+    REGISTRY.clear();
 }
 
 /// Invoke a registered callback. Called from the FFI boundary.
 ///
-/// Uses a take-execute-replace pattern to avoid holding the registry lock
-/// during callback execution, which would deadlock if the callback
-/// registers, unregisters, or invokes other delegates.
+/// The lookup takes no lock, so the callback may freely register,
+/// unregister or invoke other delegates. A callback that re-enters itself
+/// is skipped; one unregistered while running is dropped when it returns.
 pub fn invoke(callback_id: u64, params: NativePtr) {
-    // 1. Briefly lock, take the callback out (replace with None).
-    let mut cb = {
-        let mut reg = lock_or_recover(registry());
-        reg.get_mut(&callback_id).and_then(|slot| slot.take())
-    };
-
-    // 2. Execute outside the lock — callback may freely access the registry.
-    if let Some(ref mut f) = cb {
-        f(params);
-    }
-
-    // 3. Put back only if the slot still exists and is None.
-    //    If unregister_callback was called during execution, the entry was
-    //    removed entirely, so get_mut returns None and we drop the callback.
-    if let Some(f) = cb {
-        let mut reg = lock_or_recover(registry());
-        if let Some(slot) = reg.get_mut(&callback_id) {
-            if slot.is_none() {
-                *slot = Some(f);
-            }
-        }
-    }
+    REGISTRY.call_mut(callback_id, |f| f(params));
 }
 
 // ---------------------------------------------------------------------------
@@ -167,3 +153,194 @@ pub fn bind_multicast(
     }
     Ok(DelegateBinding::new(id, owner, prop, true))
 }
+
+// ---------------------------------------------------------------------------
+// Queued bindings
+// ---------------------------------------------------------------------------
+
+/// Parameters of one queued delegate event, read in signature order.
+///
+/// Each value uses the `read_param` encoding: primitives, enums and object
+/// handles as raw bytes, FName as a packed `u64`, strings as
+/// `[u32 len][utf8]`, POD structs as raw struct bytes.
+pub struct QueuedParams<'a> {
+    data: &'a [u8],
+    remaining: u32,
+}
+
+impl<'a> QueuedParams<'a> {
+    /// Wrap an encoded parameter payload.
+    pub fn new(data: &'a [u8], param_count: u32) -> Self {
+        Self { data, remaining: param_count }
+    }
+
+    /// Decode the record passed to a queued callback: `[u32 payload_len]
+    /// [u32 param_count]` followed by the payload.
+    ///
+    /// # Safety
+    /// `record` must point into a live event batch.
+    unsafe fn from_record(record: NativePtr) -> Self {
+        unsafe {
+            let payload_len = core::ptr::read_unaligned(record as *const u32) as usize;
+            let param_count = core::ptr::read_unaligned(record.add(4) as *const u32);
+            let data = core::slice::from_raw_parts(record.add(8), payload_len);
+            Self::new(data, param_count)
+        }
+    }
+
+    /// Number of parameters not yet read.
+    pub fn remaining(&self) -> u32 {
+        self.remaining
+    }
+
+    /// Next parameter as raw encoded bytes.
+    pub fn next_bytes(&mut self) -> Option<&'a [u8]> {
+        if self.remaining == 0 || self.data.len() < 4 {
+            return None;
+        }
+        let size = u32::from_ne_bytes(self.data[..4].try_into().unwrap()) as usize;
+        let value = self.data.get(4..4 + size)?;
+        self.data = &self.data[4 + size..];
+        self.remaining -= 1;
+        Some(value)
+    }
+
+    /// Next parameter as a `Copy` value; `None` if its size differs from `T`.
+    pub fn read<T: Copy>(&mut self) -> Option<T> {
+        let bytes = self.next_bytes()?;
+        if bytes.len() != core::mem::size_of::<T>() {
+            return None;
+        }
+        Some(unsafe { core::ptr::read_unaligned(bytes.as_ptr() as *const T) })
+    }
+
+    /// Next parameter as a bool (UE bool params are one byte).
+    pub fn read_bool(&mut self) -> Option<bool> {
+        self.read::<u8>().map(|b| b != 0)
+    }
+
+    /// Next FString/FText parameter.
+    pub fn read_string(&mut self) -> Option<String> {
+        let bytes = self.next_bytes()?;
+        let len = u32::from_ne_bytes(bytes.get(..4)?.try_into().unwrap()) as usize;
+        Some(String::from_utf8_lossy(bytes.get(4..4 + len)?).into_owned())
+    }
+}
+
+/// Bind a closure to a unicast delegate in queued mode. Fires are delivered
+/// by [`drain_queued_events`] instead of synchronously.
+pub fn bind_unicast_queued(
+    owner: UObjectHandle,
+    prop: FPropertyHandle,
+    callback: impl FnMut(&mut QueuedParams<'_>) + Send + 'static,
+) -> UikaResult<DelegateBinding> {
+    let id = register_queued_callback(callback);
+    let result = unsafe { crate::ffi_dispatch::delegate_bind_delegate_queued(owner, prop, id) };
+    if result != UikaErrorCode::Ok {
+        unregister_callback(id);
+        check_ffi(result)?;
+    }
+    Ok(DelegateBinding::new(id, owner, prop, false))
+}
+
+/// Add a closure to a multicast delegate in queued mode. Fires are delivered
+/// by [`drain_queued_events`] instead of synchronously.
+pub fn bind_multicast_queued(
+    owner: UObjectHandle,
+    prop: FPropertyHandle,
+    callback: impl FnMut(&mut QueuedParams<'_>) + Send + 'static,
+) -> UikaResult<DelegateBinding> {
+    let id = register_queued_callback(callback);
+    let result = unsafe { crate::ffi_dispatch::delegate_add_multicast_queued(owner, prop, id) };
+    if result != UikaErrorCode::Ok {
+        unregister_callback(id);
+        check_ffi(result)?;
+    }
+    Ok(DelegateBinding::new(id, owner, prop, true))
+}
+
+fn register_queued_callback(mut callback: impl FnMut(&mut QueuedParams<'_>) + Send + 'static) -> u64 {
+    register_callback(move |record: NativePtr| {
+        let mut params = unsafe { QueuedParams::from_record(record) };
+        callback(&mut params);
+    })
+}
+
+/// Deliver every queued delegate event raised since the previous drain, in
+/// fire order. Call once per frame from the tick group that should observe
+/// them. Returns the number of events delivered.
+///
+/// Registry lookups take no lock. Events that fire while draining are
+/// queued for the next drain; a nested call from inside a queued callback
+/// delivers nothing and returns 0.
+/// Object handles in event parameters may have been destroyed since the
+/// fire; check validity before use.
+pub fn drain_queued_events() -> usize {
+    if !crate::api::is_api_initialized() {
+        return 0;
+    }
+    if DRAINING.swap(true, Ordering::Acquire) {
+        return 0;
+    }
+    let _guard = DrainGuard;
+    let mut batch = UikaDelegateEventBatch::default();
+    let code = unsafe { crate::ffi_dispatch::delegate_take_queued_events(&mut batch) };
+    if code != UikaErrorCode::Ok || batch.count == 0 || batch.data.is_null() {
+        return 0;
+    }
+    let bytes = unsafe { core::slice::from_raw_parts(batch.data, batch.len as usize) };
+
+    // 1. Index the records.
+    let mut records: Vec<(u64, usize)> = Vec::with_capacity(batch.count as usize);
+    let mut pos = 0usize;
+    while records.len() < batch.count as usize && pos + UIKA_QUEUED_EVENT_HEADER_SIZE <= bytes.len() {
+        let id = u64::from_ne_bytes(bytes[pos..pos + 8].try_into().unwrap());
+        let payload_len = u32::from_ne_bytes(bytes[pos + 8..pos + 12].try_into().unwrap()) as usize;
+        records.push((id, pos + 8));
+        pos += UIKA_QUEUED_EVENT_HEADER_SIZE + payload_len;
+    }
+
+    // 2. Run the batch. Each record is a lock-free registry lookup.
+    let mut delivered = 0;
+    for &(id, record) in &records {
+        if REGISTRY.call_mut(id, |f| f(bytes[record..].as_ptr() as NativePtr)).is_some() {
+            delivered += 1;
+        }
+    }
+    delivered
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn push_param(buf: &mut Vec<u8>, bytes: &[u8]) {
+        buf.extend_from_slice(&(bytes.len() as u32).to_ne_bytes());
+        buf.extend_from_slice(bytes);
+    }
+
+    #[test]
+    fn queued_params_decode_in_order() {
+        let mut payload = Vec::new();
+        push_param(&mut payload, &42i32.to_ne_bytes());
+        push_param(&mut payload, &[1u8]);
+        let mut s = 3u32.to_ne_bytes().to_vec();
+        s.extend_from_slice(b"hit");
+        push_param(&mut payload, &s);
+
+        let mut q = QueuedParams::new(&payload, 3);
+        assert_eq!(q.read::<i32>(), Some(42));
+        assert_eq!(q.read_bool(), Some(true));
+        assert_eq!(q.read_string().as_deref(), Some("hit"));
+        assert_eq!(q.remaining(), 0);
+        assert!(q.next_bytes().is_none());
+    }
+
+    #[test]
+    fn queued_params_reject_size_mismatch() {
+        let mut payload = Vec::new();
+        push_param(&mut payload, &7u16.to_ne_bytes());
+        let mut q = QueuedParams::new(&payload, 1);
+        assert_eq!(q.read::<u32>(), None);
+    }
+}
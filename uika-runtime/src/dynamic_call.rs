@@ -3,8 +3,13 @@
 // This is the "safety net" fallback for functions not covered by codegen's
 // direct call path. It uses UE's reflection system to find functions, allocate
 // parameter buffers, set/get parameter values, and invoke via ProcessEvent.
+//
+// Frames from `alloc_params` come from a C++ pool driven by a cached
+// per-UFunction frame plan. `ParamFrame` goes further for hot call sites: it
+// owns one buffer, re-initializes it in place per call and caches parameter
+// offsets by name.
 
-use uika_ffi::{FPropertyHandle, UFunctionHandle, UObjectHandle};
+use uika_ffi::{FPropertyHandle, UFunctionHandle, UObjectHandle, UikaFrameLayout};
 
 use crate::error::{check_ffi, UikaError, UikaResult};
 use crate::ffi_dispatch::{self, NativePtr, NATIVE_PTR_NULL, native_ptr_is_null};
@@ -44,6 +49,21 @@ impl DynamicCall {
         })
     }
 
+    /// Prepare a reflection call to an already-resolved function (e.g. a
+    /// handle cached in a `OnceLock`), skipping the name lookup.
+    pub fn with_function(obj: &UObjectRef<impl UeClass>, func: UFunctionHandle) -> UikaResult<Self> {
+        let h = obj.checked()?.raw();
+        if func.is_null() {
+            return Err(UikaError::FunctionNotFound("<null UFunction>".into()));
+        }
+        let params = unsafe { ffi_dispatch::reflection_alloc_params(func) };
+        Ok(DynamicCall {
+            obj: h,
+            func,
+            params,
+        })
+    }
+
     /// Write a parameter value into the params buffer.
     ///
     /// # Safety contract
@@ -132,3 +152,158 @@ impl Drop for DynamicCallResult {
         }
     }
 }
+
+// ---------------------------------------------------------------------------
+// ParamFrame
+// ---------------------------------------------------------------------------
+
+/// 16-byte aligned storage unit for `ParamFrame` buffers.
+#[derive(Clone, Copy)]
+#[repr(C, align(16))]
+struct FrameChunk([u8; 16]);
+
+const FRAME_ALIGN: u32 = 16;
+
+/// Reusable, caller-owned parameter frame for repeated reflection calls to
+/// one UFunction.
+///
+/// ```ignore
+/// let mut frame = ParamFrame::for_function(&obj, "ApplyDamage")?;
+/// for target in targets {
+///     frame.set::<f32>("Amount", 10.0)?;
+///     frame.call(&target)?;
+///     let dealt: f32 = frame.get("ReturnValue")?;
+///     frame.reset()?;
+/// }
+/// ```
+///
+/// The buffer is allocated once; `reset` destroys and re-initializes the
+/// parameters in place. Offsets looked up by name are cached per frame.
+pub struct ParamFrame {
+    func: UFunctionHandle,
+    layout: UikaFrameLayout,
+    storage: Vec<FrameChunk>,
+    live: bool,
+    offsets: Vec<(Box<str>, u32)>,
+}
+
+impl ParamFrame {
+    /// Create an initialized frame for `func`.
+    pub fn new(func: UFunctionHandle) -> UikaResult<Self> {
+        if func.is_null() {
+            return Err(UikaError::FunctionNotFound("<null UFunction>".into()));
+        }
+        let mut layout = UikaFrameLayout::default();
+        check_ffi(unsafe { ffi_dispatch::reflection_get_frame_layout(func, &mut layout) })?;
+        if layout.align > FRAME_ALIGN {
+            return Err(UikaError::InvalidOperation(format!(
+                "parameter frame alignment {} exceeds {FRAME_ALIGN}",
+                layout.align
+            )));
+        }
+        let chunks = (layout.size as usize).div_ceil(size_of::<FrameChunk>()).max(1);
+        let mut frame = ParamFrame {
+            func,
+            layout,
+            storage: vec![FrameChunk([0; 16]); chunks],
+            live: false,
+            offsets: Vec::new(),
+        };
+        frame.reset()?;
+        Ok(frame)
+    }
+
+    /// Find `func_name` on `obj`'s class and create a frame for it.
+    pub fn for_function(obj: &UObjectRef<impl UeClass>, func_name: &str) -> UikaResult<Self> {
+        let h = obj.checked()?.raw();
+        let func = unsafe {
+            ffi_dispatch::reflection_find_function(h, func_name.as_ptr(), func_name.len() as u32)
+        };
+        if func.is_null() {
+            return Err(UikaError::FunctionNotFound(func_name.to_string()));
+        }
+        Self::new(func)
+    }
+
+    #[inline]
+    pub fn function(&self) -> UFunctionHandle {
+        self.func
+    }
+
+    #[inline]
+    pub fn layout(&self) -> UikaFrameLayout {
+        self.layout
+    }
+
+    #[inline]
+    fn ptr(&mut self) -> NativePtr {
+        self.storage.as_mut_ptr() as NativePtr
+    }
+
+    /// Destroy the current parameter values and re-initialize to defaults.
+    pub fn reset(&mut self) -> UikaResult<()> {
+        let buf = self.ptr();
+        if self.live {
+            self.live = false;
+            check_ffi(unsafe { ffi_dispatch::reflection_destroy_params(self.func, buf) })?;
+        }
+        let cap = (self.storage.len() * size_of::<FrameChunk>()) as u32;
+        check_ffi(unsafe { ffi_dispatch::reflection_init_params(self.func, buf, cap) })?;
+        self.live = true;
+        Ok(())
+    }
+
+    /// Offset of the named parameter in the frame (cached after first use).
+    pub fn offset_of(&mut self, name: &str) -> UikaResult<u32> {
+        if let Some(&(_, offset)) = self.offsets.iter().find(|(n, _)| &**n == name) {
+            return Ok(offset);
+        }
+        let prop = unsafe {
+            ffi_dispatch::reflection_get_function_param(self.func, name.as_ptr(), name.len() as u32)
+        };
+        if prop.is_null() {
+            return Err(UikaError::PropertyNotFound(name.to_string()));
+        }
+        let offset = unsafe { ffi_dispatch::reflection_get_property_offset(prop) };
+        self.offsets.push((name.into(), offset));
+        Ok(offset)
+    }
+
+    /// Write a parameter value. Same type contract as [`DynamicCall::set`].
+    pub fn set<T: Copy>(&mut self, name: &str, value: T) -> UikaResult<()> {
+        let offset = self.offset_of(name)? as usize;
+        self.check_bounds::<T>(offset)?;
+        unsafe { ffi_dispatch::native_mem_write(self.ptr(), offset, value) };
+        Ok(())
+    }
+
+    /// Read a parameter or return value. Same type contract as [`DynamicCallResult::get`].
+    pub fn get<T: Copy>(&mut self, name: &str) -> UikaResult<T> {
+        let offset = self.offset_of(name)? as usize;
+        self.check_bounds::<T>(offset)?;
+        Ok(unsafe { ffi_dispatch::native_mem_read(self.ptr(), offset) })
+    }
+
+    fn check_bounds<T>(&self, offset: usize) -> UikaResult<()> {
+        if offset + size_of::<T>() > self.layout.size as usize {
+            return Err(UikaError::BufferTooSmall);
+        }
+        Ok(())
+    }
+
+    /// Invoke the function on `obj` with the current frame contents.
+    pub fn call(&mut self, obj: &UObjectRef<impl UeClass>) -> UikaResult<()> {
+        let h = obj.checked()?.raw();
+        let buf = self.ptr();
+        check_ffi(unsafe { ffi_dispatch::reflection_call_function(h, self.func, buf) })
+    }
+}
+
+impl Drop for ParamFrame {
+    fn drop(&mut self) {
+        if self.live {
+            let buf = self.ptr();
+            unsafe { ffi_dispatch::reflection_destroy_params(self.func, buf) };
+        }
+    }
+}
@@ -13,6 +13,8 @@ pub fn ffi_boundary<F, R>(default: R, f: F) -> R
 where
     F: FnOnce() -> R + std::panic::UnwindSafe,
 {
+    // Game code ran since Rust last had control.
+    crate::object_ref::invalidate_validity_cache();
     match std::panic::catch_unwind(f) {
         Ok(value) => value,
         Err(payload) => {
@@ -0,0 +1,378 @@
+// FFI instrumentation: per-entry call counts, inclusive time and a log2
+// latency histogram for every API sub-table entry, every func_table slot and
+// every inbound `UikaRustCallbacks` entry.
+//
+// Enabled by the `ffi-stats` feature. Without it every scope is a zero-sized
+// no-op and the dispatch wrappers compile down to the bare table call. The
+// `Uika.Stats` console command dumps the table through `dump`.
+
+/// Whether the crate was built with the `ffi-stats` feature.
+pub const ENABLED: bool = cfg!(feature = "ffi-stats");
+
+/// Inbound callbacks (C++ → Rust) tracked alongside the outbound entries.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+#[repr(u32)]
+pub enum CallbackSlot {
+    DropRustInstance,
+    InvokeRustFunction,
+    InvokeDelegateCallback,
+    ConstructRustInstance,
+    NotifyPinnedDestroyed,
+    DropRustInstances,
+    NotifyPinnedDestroyedMany,
+    SnapshotRustInstances,
+    RestoreRustInstances,
+    OnPoolRelease,
+    OnPoolAcquire,
+    RunJob,
+    RunJobRange,
+    DrainGameThreadQueue,
+    TickClass,
+}
+
+#[cfg(feature = "ffi-stats")]
+const CALLBACK_NAMES: [&str; 15] = [
+    "callback.drop_rust_instance",
+    "callback.invoke_rust_function",
+    "callback.invoke_delegate_callback",
+    "callback.construct_rust_instance",
+    "callback.notify_pinned_destroyed",
+    "callback.drop_rust_instances",
+    "callback.notify_pinned_destroyed_many",
+    "callback.snapshot_rust_instances",
+    "callback.restore_rust_instances",
+    "callback.on_pool_release",
+    "callback.on_pool_acquire",
+    "callback.run_job",
+    "callback.run_job_range",
+    "callback.drain_game_thread_queue",
+    "callback.tick_class",
+];
+
+/// Aggregated counters of one entry, as returned by [`collect`].
+#[derive(Clone, Debug, PartialEq, Eq)]
+pub struct EntryStats {
+    /// `module.field`, `func.<Class>.<Function>` (or `func#<id>` when the
+    /// bindings did not register names) or `callback.<field>`.
+    pub name: String,
+    pub calls: u64,
+    /// Inclusive: nested crossings are also counted in their caller.
+    pub total_ns: u64,
+    pub max_ns: u64,
+    /// Upper bound of the histogram bucket holding the 99th percentile.
+    pub p99_ns: u64,
+}
+
+impl EntryStats {
+    pub fn mean_ns(&self) -> u64 {
+        if self.calls == 0 { 0 } else { self.total_ns / self.calls }
+    }
+}
+
+/// Times one crossing; recorded on drop.
+#[must_use]
+pub struct Scope {
+    #[cfg(feature = "ffi-stats")]
+    inner: Option<(&'static imp::SlotStats, std::time::Instant)>,
+}
+
+impl Scope {
+    #[cfg(not(feature = "ffi-stats"))]
+    #[inline(always)]
+    const fn none() -> Self {
+        Scope {}
+    }
+}
+
+/// Scope for API sub-table entry `slot` (indices assigned by `build.rs`).
+#[inline(always)]
+pub fn api_scope(slot: u32) -> Scope {
+    #[cfg(feature = "ffi-stats")]
+    {
+        imp::scope(imp::API_STATS.get(slot as usize))
+    }
+    #[cfg(not(feature = "ffi-stats"))]
+    {
+        let _ = slot;
+        Scope::none()
+    }
+}
+
+/// Scope for generated func_table slot `func_id`.
+#[inline(always)]
+pub fn func_scope(func_id: u32) -> Scope {
+    #[cfg(feature = "ffi-stats")]
+    {
+        imp::scope(imp::func_stats().get(func_id as usize))
+    }
+    #[cfg(not(feature = "ffi-stats"))]
+    {
+        let _ = func_id;
+        Scope::none()
+    }
+}
+
+/// Scope for an inbound callback.
+#[inline(always)]
+pub fn callback_scope(slot: CallbackSlot) -> Scope {
+    #[cfg(feature = "ffi-stats")]
+    {
+        imp::scope(imp::CALLBACK_STATS.get(slot as usize))
+    }
+    #[cfg(not(feature = "ffi-stats"))]
+    {
+        let _ = slot;
+        Scope::none()
+    }
+}
+
+/// Names of the func_table slots, indexed by func id. Called by the
+/// generated bindings at startup; a no-op without `ffi-stats`.
+#[inline(always)]
+pub fn register_func_names(names: &'static [&'static str]) {
+    #[cfg(feature = "ffi-stats")]
+    {
+        let _ = imp::FUNC_NAMES.set(names);
+    }
+    #[cfg(not(feature = "ffi-stats"))]
+    {
+        let _ = names;
+    }
+}
+
+/// Every entry with at least one call, in no particular order.
+pub fn collect() -> Vec<EntryStats> {
+    #[cfg(feature = "ffi-stats")]
+    {
+        imp::collect()
+    }
+    #[cfg(not(feature = "ffi-stats"))]
+    {
+        Vec::new()
+    }
+}
+
+/// Zero all counters.
+pub fn reset() {
+    #[cfg(feature = "ffi-stats")]
+    imp::reset();
+}
+
+/// Log the `top_n` entries by total time and by call count, then optionally
+/// reset the counters.
+pub fn dump(top_n: usize, reset_after: bool) {
+    if !ENABLED {
+        log(crate::LOG_WARNING, "[Uika] FFI stats are not compiled in (build with the `ffi-stats` feature)");
+        return;
+    }
+    let mut entries = collect();
+    if reset_after {
+        reset();
+    }
+
+    let total_calls: u64 = entries.iter().map(|e| e.calls).sum();
+    let total_ns: u64 = entries.iter().map(|e| e.total_ns).sum();
+    let mut report = format!(
+        "[Uika] FFI stats: {} entries, {} calls, {:.3} ms inclusive\n  by time:\n",
+        entries.len(),
+        total_calls,
+        total_ns as f64 / 1.0e6,
+    );
+    entries.sort_by(|a, b| b.total_ns.cmp(&a.total_ns));
+    for e in entries.iter().take(top_n) {
+        report.push_str(&format_entry(e));
+    }
+    report.push_str("  by calls:\n");
+    entries.sort_by(|a, b| b.calls.cmp(&a.calls));
+    for e in entries.iter().take(top_n) {
+        report.push_str(&format_entry(e));
+    }
+    log(crate::LOG_DISPLAY, report.trim_end());
+}
+
+fn log(level: u8, msg: &str) {
+    unsafe { crate::ffi_dispatch::logging_log(level, msg.as_ptr(), msg.len() as u32) };
+}
+
+fn format_entry(e: &EntryStats) -> String {
+    format!(
+        "    {:<56} {:>10} calls {:>10.3} ms  mean {:>7} ns  p99 <{:>8} ns  max {:>8} ns\n",
+        e.name,
+        e.calls,
+        e.total_ns as f64 / 1.0e6,
+        e.mean_ns(),
+        e.p99_ns,
+        e.max_ns,
+    )
+}
+
+#[cfg(feature = "ffi-stats")]
+mod imp {
+    use std::sync::atomic::{AtomicU64, Ordering};
+    use std::sync::OnceLock;
+    use std::time::Instant;
+
+    use super::{EntryStats, Scope, CALLBACK_NAMES};
+    use crate::ffi_dispatch::{API_STAT_COUNT, API_STAT_NAMES};
+
+    /// Bucket `i` holds durations below `2^(FIRST_BUCKET_LOG2 + i)` ns; the
+    /// last bucket is open-ended.
+    const BUCKETS: usize = 16;
+    const FIRST_BUCKET_LOG2: u32 = 7;
+
+    pub(super) struct SlotStats {
+        calls: AtomicU64,
+        nanos: AtomicU64,
+        max: AtomicU64,
+        buckets: [AtomicU64; BUCKETS],
+    }
+
+    impl SlotStats {
+        pub(super) const fn new() -> Self {
+            Self {
+                calls: AtomicU64::new(0),
+                nanos: AtomicU64::new(0),
+                max: AtomicU64::new(0),
+                buckets: [const { AtomicU64::new(0) }; BUCKETS],
+            }
+        }
+
+        fn record(&self, ns: u64) {
+            self.calls.fetch_add(1, Ordering::Relaxed);
+            self.nanos.fetch_add(ns, Ordering::Relaxed);
+            self.max.fetch_max(ns, Ordering::Relaxed);
+            self.buckets[bucket_of(ns)].fetch_add(1, Ordering::Relaxed);
+        }
+
+        fn reset(&self) {
+            self.calls.store(0, Ordering::Relaxed);
+            self.nanos.store(0, Ordering::Relaxed);
+            self.max.store(0, Ordering::Relaxed);
+            for b in &self.buckets {
+                b.store(0, Ordering::Relaxed);
+            }
+        }
+
+        fn snapshot(&self, name: String) -> Option<EntryStats> {
+            let calls = self.calls.load(Ordering::Relaxed);
+            if calls == 0 {
+                return None;
+            }
+            let counts: [u64; BUCKETS] =
+                std::array::from_fn(|i| self.buckets[i].load(Ordering::Relaxed));
+            Some(EntryStats {
+                name,
+                calls,
+                total_ns: self.nanos.load(Ordering::Relaxed),
+                max_ns: self.max.load(Ordering::Relaxed),
+                p99_ns: percentile_bound(&counts, 0.99),
+            })
+        }
+    }
+
+    pub(super) fn bucket_of(ns: u64) -> usize {
+        let log2 = 63u32.saturating_sub(ns.max(1).leading_zeros());
+        (log2.saturating_sub(FIRST_BUCKET_LOG2 - 1) as usize).min(BUCKETS - 1)
+    }
+
+    pub(super) fn percentile_bound(counts: &[u64; BUCKETS], q: f64) -> u64 {
+        let total: u64 = counts.iter().sum();
+        let target = ((total as f64) * q).ceil() as u64;
+        let mut seen = 0;
+        for (i, &c) in counts.iter().enumerate() {
+            seen += c;
+            if seen >= target && c > 0 {
+                return if i == BUCKETS - 1 { u64::MAX } else { 1u64 << (FIRST_BUCKET_LOG2 + i as u32) };
+            }
+        }
+        0
+    }
+
+    pub(super) static API_STATS: [SlotStats; API_STAT_COUNT] =
+        [const { SlotStats::new() }; API_STAT_COUNT];
+    pub(super) static CALLBACK_STATS: [SlotStats; CALLBACK_NAMES.len()] =
+        [const { SlotStats::new() }; CALLBACK_NAMES.len()];
+    static FUNC_STATS: OnceLock<Box<[SlotStats]>> = OnceLock::new();
+    pub(super) static FUNC_NAMES: OnceLock<&'static [&'static str]> = OnceLock::new();
+
+    /// Sized from the API table on first use (func_table calls only happen
+    /// after `init_api`).
+    pub(super) fn func_stats() -> &'static [SlotStats] {
+        FUNC_STATS.get_or_init(|| {
+            let count = if crate::api::is_api_initialized() { crate::api::api().func_count } else { 0 };
+            (0..count).map(|_| SlotStats::new()).collect()
+        })
+    }
+
+    #[inline(always)]
+    pub(super) fn scope(slot: Option<&'static SlotStats>) -> Scope {
+        Scope { inner: slot.map(|s| (s, Instant::now())) }
+    }
+
+    impl Drop for Scope {
+        #[inline]
+        fn drop(&mut self) {
+            if let Some((slot, start)) = self.inner {
+                slot.record(start.elapsed().as_nanos() as u64);
+            }
+        }
+    }
+
+    pub(super) fn collect() -> Vec<EntryStats> {
+        let mut out = Vec::new();
+        for (slot, name) in API_STATS.iter().zip(API_STAT_NAMES) {
+            out.extend(slot.snapshot(name.to_string()));
+        }
+        for (slot, name) in CALLBACK_STATS.iter().zip(CALLBACK_NAMES) {
+            out.extend(slot.snapshot(name.to_string()));
+        }
+        let names = FUNC_NAMES.get().copied().unwrap_or(&[]);
+        if let Some(funcs) = FUNC_STATS.get() {
+            for (id, slot) in funcs.iter().enumerate() {
+                let name = match names.get(id) {
+                    Some(n) => format!("func.{n}"),
+                    None => format!("func#{id}"),
+                };
+                out.extend(slot.snapshot(name));
+            }
+        }
+        out
+    }
+
+    pub(super) fn reset() {
+        API_STATS.iter().chain(CALLBACK_STATS.iter()).for_each(SlotStats::reset);
+        if let Some(funcs) = FUNC_STATS.get() {
+            funcs.iter().for_each(SlotStats::reset);
+        }
+    }
+}
+
+#[cfg(all(test, feature = "ffi-stats"))]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn histogram_buckets() {
+        assert_eq!(imp::bucket_of(0), 0);
+        assert_eq!(imp::bucket_of(127), 0);
+        assert_eq!(imp::bucket_of(128), 1);
+        assert_eq!(imp::bucket_of(255), 1);
+        assert_eq!(imp::bucket_of(u64::MAX), 15);
+
+        let mut counts = [0u64; 16];
+        counts[0] = 98;
+        counts[3] = 2;
+        assert_eq!(imp::percentile_bound(&counts, 0.99), 1 << 10);
+        assert_eq!(imp::percentile_bound(&counts, 0.5), 1 << 7);
+    }
+
+    #[test]
+    fn callback_scope_records() {
+        reset();
+        drop(callback_scope(CallbackSlot::OnPoolAcquire));
+        drop(callback_scope(CallbackSlot::OnPoolAcquire));
+        let entries = collect();
+        let e = entries.iter().find(|e| e.name == "callback.on_pool_acquire").unwrap();
+        assert_eq!(e.calls, 2);
+    }
+}
@@ -0,0 +1,180 @@
+// FieldDesc: validated layout descriptor for direct (zero-crossing) access
+// to plain-old-data properties.
+//
+// Generated property accessors cache one FieldDesc per property next to the
+// FPropertyHandle. When the descriptor says the field is POD (or a bool) and
+// its element size matches the Rust type, reads and writes become a raw load
+// or store at `container + offset`; otherwise the accessor falls back to the
+// PropertyApi call.
+
+use uika_ffi::{
+    FPropertyHandle, UClassHandle, UObjectHandle, UikaErrorCode, UikaFieldDesc, UIKA_FIELD_BOOL,
+    UIKA_FIELD_OBJECT, UIKA_FIELD_POD,
+};
+
+use crate::ffi_dispatch;
+
+/// Cached layout of one property. A default (zeroed) descriptor permits no
+/// direct access, so lookup failures degrade to the FFI path.
+#[derive(Clone, Copy, Debug, Default)]
+pub struct FieldDesc {
+    raw: UikaFieldDesc,
+}
+
+impl FieldDesc {
+    /// Query the descriptor for `prop`. Never fails: a null or unknown
+    /// property yields a descriptor that reports no direct access.
+    pub fn query(prop: FPropertyHandle) -> Self {
+        let mut raw = UikaFieldDesc::default();
+        if prop.is_null() {
+            return Self { raw };
+        }
+        let code = unsafe { ffi_dispatch::reflection_get_field_desc(prop, &mut raw) };
+        if code != UikaErrorCode::Ok {
+            raw = UikaFieldDesc::default();
+        }
+        Self { raw }
+    }
+
+    /// Wrap a descriptor filled by another query (a resolved property path).
+    pub(crate) fn from_raw(raw: UikaFieldDesc) -> Self {
+        Self { raw }
+    }
+
+    /// Byte offset of the field inside its container.
+    #[inline]
+    pub fn offset(&self) -> u32 {
+        self.raw.offset
+    }
+
+    /// Size of one element (fixed arrays have `array_dim` of these).
+    #[inline]
+    pub fn elem_size(&self) -> u32 {
+        self.raw.elem_size
+    }
+
+    #[inline]
+    pub fn array_dim(&self) -> u32 {
+        self.raw.array_dim
+    }
+
+    #[inline]
+    pub fn is_pod(&self) -> bool {
+        self.raw.flags & UIKA_FIELD_POD != 0
+    }
+
+    #[inline]
+    pub fn is_bool(&self) -> bool {
+        self.raw.flags & UIKA_FIELD_BOOL != 0
+    }
+
+    /// Object property (hard, weak, soft or lazy), accessed as a
+    /// `UObjectHandle` through the PropertyApi.
+    #[inline]
+    pub fn is_object(&self) -> bool {
+        self.raw.flags & UIKA_FIELD_OBJECT != 0
+    }
+
+    /// True if `T` can be loaded/stored directly: the field is POD and its
+    /// element size equals `size_of::<T>()`.
+    #[inline]
+    pub fn is_direct<T: Copy>(&self) -> bool {
+        self.is_pod() && self.raw.elem_size as usize == core::mem::size_of::<T>()
+    }
+
+    /// Load the field value from container memory.
+    ///
+    /// # Safety
+    /// `container` must point to a live container of the property's owner type
+    /// and `is_direct::<T>()` must be true.
+    #[inline(always)]
+    pub unsafe fn read<T: Copy>(&self, container: UObjectHandle) -> T {
+        unsafe {
+            core::ptr::read_unaligned((container.0 as *const u8).add(self.raw.offset as usize) as *const T)
+        }
+    }
+
+    /// Store the field value into container memory.
+    ///
+    /// # Safety
+    /// Same requirements as [`read`](Self::read).
+    #[inline(always)]
+    pub unsafe fn write<T: Copy>(&self, container: UObjectHandle, value: T) {
+        unsafe {
+            core::ptr::write_unaligned((container.0 as *mut u8).add(self.raw.offset as usize) as *mut T, value)
+        }
+    }
+
+    #[inline(always)]
+    fn bool_byte(&self, container: UObjectHandle) -> *mut u8 {
+        let offset = self.raw.offset as usize + self.raw.bool_byte_offset as usize;
+        unsafe { (container.0 as *mut u8).add(offset) }
+    }
+
+    /// Read a bool (native or bit-field) property.
+    ///
+    /// # Safety
+    /// `container` must point to a live container and `is_bool()` must be true.
+    #[inline(always)]
+    pub unsafe fn read_bool(&self, container: UObjectHandle) -> bool {
+        unsafe { *self.bool_byte(container) & self.raw.bool_field_mask != 0 }
+    }
+
+    /// Write a bool (native or bit-field) property.
+    ///
+    /// # Safety
+    /// Same requirements as [`read_bool`](Self::read_bool).
+    #[inline(always)]
+    pub unsafe fn write_bool(&self, container: UObjectHandle, value: bool) {
+        unsafe {
+            let byte = self.bool_byte(container);
+            let set = if value { self.raw.bool_byte_mask } else { 0 };
+            *byte = (*byte & !self.raw.bool_field_mask) | set;
+        }
+    }
+}
+
+/// Hash of a class (or struct, cast to `UClassHandle`) property layout.
+/// Two equal hashes mean every property kept its name, type, offset and size.
+pub fn layout_hash(cls: UClassHandle) -> u64 {
+    if cls.is_null() {
+        return 0;
+    }
+    unsafe { ffi_dispatch::reflection_get_layout_hash(cls) }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn desc(flags: u32, offset: u32, elem_size: u32) -> FieldDesc {
+        FieldDesc {
+            raw: UikaFieldDesc { offset, elem_size, array_dim: 1, flags, ..Default::default() },
+        }
+    }
+
+    #[test]
+    fn direct_access_requires_pod_and_matching_size() {
+        assert!(desc(UIKA_FIELD_POD, 0, 4).is_direct::<f32>());
+        assert!(!desc(UIKA_FIELD_POD, 0, 2).is_direct::<i32>());
+        assert!(!desc(0, 0, 4).is_direct::<f32>());
+        assert!(!desc(UIKA_FIELD_OBJECT, 0, 8).is_direct::<UObjectHandle>());
+        assert!(!FieldDesc::default().is_direct::<u8>());
+    }
+
+    #[test]
+    fn bitfield_bool_round_trips() {
+        let mut mem = [0u8; 8];
+        let container = UObjectHandle(mem.as_mut_ptr() as *mut std::ffi::c_void);
+        let mut d = desc(UIKA_FIELD_BOOL, 4, 1);
+        d.raw.bool_byte_mask = 0b0100;
+        d.raw.bool_field_mask = 0b0100;
+        unsafe {
+            d.write_bool(container, true);
+            assert!(d.read_bool(container));
+            d.write_bool(container, false);
+            assert!(!d.read_bool(container));
+        }
+        assert_eq!(mem[4], 0);
+    }
+}
@@ -1,9 +1,18 @@
 // FName: ergonomic wrapper around FNameHandle.
 // Provides construction from &str and Display for string conversion.
+//
+// Construction goes through a string -> handle cache so names built every
+// frame (tags, sockets, montage sections) cost one hash lookup instead of an
+// FFI call. Each thread owns its cache, so lookups take no lock; a global
+// epoch bumped by `invalidate_cache` (hot reload / shutdown) makes every
+// thread drop its entries on next use.
 
+use std::cell::RefCell;
+use std::collections::HashMap;
 use std::fmt;
+use std::sync::atomic::{AtomicU32, Ordering};
 
-use uika_ffi::FNameHandle;
+use uika_ffi::{FNameHandle, UikaStrView};
 
 use crate::error::check_ffi;
 use crate::ffi_dispatch;
@@ -19,14 +28,71 @@ impl FName {
     /// The "None" name (index 0).
     pub const NONE: FName = FName(FNameHandle(0));
 
-    /// Create an FName from a string.
+    /// Create an FName from a string. Served from the name cache after the
+    /// first call with the same string on this thread.
     pub fn new(name: &str) -> Self {
+        if name.is_empty() {
+            return FName::NONE;
+        }
+        if let Some(handle) = cache_get(name) {
+            return FName(handle);
+        }
+        let handle = FName::new_uncached(name).0;
+        cache_insert(name, handle);
+        FName(handle)
+    }
+
+    /// Create an FName with a direct FFI call, bypassing the cache.
+    pub fn new_uncached(name: &str) -> Self {
         let handle = unsafe {
             ffi_dispatch::core_make_fname(name.as_ptr(), name.len() as u32)
         };
         FName(handle)
     }
 
+    /// Create many FNames at once. Cache misses are interned with a single
+    /// `make_fnames_bulk` FFI call.
+    pub fn new_many(names: &[&str]) -> Vec<FName> {
+        let mut out = vec![FName::NONE; names.len()];
+        let mut miss_idx = Vec::new();
+        let mut miss_views = Vec::new();
+        for (i, name) in names.iter().enumerate() {
+            if name.is_empty() {
+                continue;
+            }
+            match cache_get(name) {
+                Some(handle) => out[i] = FName(handle),
+                None => {
+                    miss_idx.push(i);
+                    miss_views.push(UikaStrView::new(name));
+                }
+            }
+        }
+        if miss_views.is_empty() {
+            return out;
+        }
+
+        let mut handles = vec![FNameHandle::default(); miss_views.len()];
+        let code = unsafe {
+            ffi_dispatch::core_make_fnames_bulk(
+                miss_views.as_ptr(),
+                miss_views.len() as u32,
+                handles.as_mut_ptr(),
+            )
+        };
+        if check_ffi(code).is_err() {
+            for &i in &miss_idx {
+                out[i] = FName::new_uncached(names[i]);
+            }
+            return out;
+        }
+        for (&i, &handle) in miss_idx.iter().zip(&handles) {
+            cache_insert(names[i], handle);
+            out[i] = FName(handle);
+        }
+        out
+    }
+
     /// Get the underlying FFI handle.
     #[inline]
     pub fn handle(&self) -> FNameHandle {
@@ -61,6 +127,69 @@ impl FName {
     }
 }
 
+// ---------------------------------------------------------------------------
+// Name cache
+// ---------------------------------------------------------------------------
+
+/// Entries per thread before the cache is flushed. Bounds memory when names
+/// are built from unbounded input (formatted strings etc).
+const CACHE_CAPACITY: usize = 4096;
+
+static CACHE_EPOCH: AtomicU32 = AtomicU32::new(0);
+
+struct NameCache {
+    epoch: u32,
+    map: HashMap<Box<str>, FNameHandle>,
+}
+
+thread_local! {
+    static CACHE: RefCell<NameCache> = RefCell::new(NameCache {
+        epoch: 0,
+        map: HashMap::new(),
+    });
+}
+
+impl NameCache {
+    #[inline]
+    fn sync_epoch(&mut self) {
+        let epoch = CACHE_EPOCH.load(Ordering::Acquire);
+        if self.epoch != epoch {
+            self.map.clear();
+            self.epoch = epoch;
+        }
+    }
+}
+
+fn cache_get(name: &str) -> Option<FNameHandle> {
+    CACHE
+        .try_with(|c| {
+            let mut c = c.borrow_mut();
+            c.sync_epoch();
+            c.map.get(name).copied()
+        })
+        .ok()
+        .flatten()
+}
+
+fn cache_insert(name: &str, handle: FNameHandle) {
+    let _ = CACHE.try_with(|c| {
+        let mut c = c.borrow_mut();
+        c.sync_epoch();
+        if c.map.len() >= CACHE_CAPACITY {
+            c.map.clear();
+        }
+        c.map.insert(name.into(), handle);
+    });
+}
+
+/// Drop every cached string -> FName mapping on all threads. Called during
+/// on_shutdown (hot reload / DLL unload); other threads flush lazily on
+/// their next lookup.
+pub fn invalidate_cache() {
+    CACHE_EPOCH.fetch_add(1, Ordering::AcqRel);
+    let _ = CACHE.try_with(|c| c.borrow_mut().map = HashMap::new());
+}
+
 impl Default for FName {
     fn default() -> Self {
         FName::NONE
@@ -96,3 +225,24 @@ impl From<FNameHandle> for FName {
         FName(handle)
     }
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn cache_round_trips_and_invalidates() {
+        cache_insert("Socket_Hand", FNameHandle(42));
+        assert_eq!(cache_get("Socket_Hand"), Some(FNameHandle(42)));
+        assert_eq!(cache_get("Socket_Foot"), None);
+
+        invalidate_cache();
+        assert_eq!(cache_get("Socket_Hand"), None);
+    }
+
+    #[test]
+    fn empty_names_are_none_without_ffi() {
+        assert!(FName::new("").is_none());
+        assert!(FName::new_many(&["", ""]).iter().all(FName::is_none));
+    }
+}
@@ -0,0 +1,365 @@
+// Hot-reload snapshot: compact binary image of Rust instance data that
+// survives a DLL swap.
+//
+// Before the old DLL is unloaded, every instance whose class opted in with
+// `#[uclass(..., snapshot)]` is written into one contiguous arena that the
+// C++ plugin maps from the OS (outside both DLL heaps). After the new DLL has
+// reconstructed default instances, it reads the arena in place and restores
+// the fields it still recognises.
+//
+// Layout (little-endian, no alignment requirements):
+//   header  [u32 magic][u16 version][u16 reserved][u32 entry_count][u32 len]
+//   entry   [u64 obj][u64 type_id][u32 field_count][u32 payload_len] fields
+//   field   [u32 name_hash][u32 type_hash][u32 len] bytes
+//
+// Fields are matched by name and declared type, so adding, removing or
+// reordering fields between builds keeps every field that still matches;
+// the rest keep their `Default` value.
+
+use uika_ffi::{FNameHandle, FWeakObjectHandle, UClassHandle, UObjectHandle};
+
+use crate::ffi_dispatch;
+use crate::object_ref::UObjectRef;
+use crate::traits::UeClass;
+
+pub const SNAPSHOT_MAGIC: u32 = u32::from_le_bytes(*b"UKSN");
+pub const SNAPSHOT_VERSION: u16 = 1;
+
+const HEADER_SIZE: usize = 16;
+const ENTRY_HEADER_SIZE: usize = 24;
+const FIELD_HEADER_SIZE: usize = 12;
+
+/// 32-bit FNV-1a, used for field name and type hashes in generated code.
+pub const fn field_hash(s: &str) -> u32 {
+    let bytes = s.as_bytes();
+    let mut hash: u32 = 0x811c_9dc5;
+    let mut i = 0;
+    while i < bytes.len() {
+        hash ^= bytes[i] as u32;
+        hash = hash.wrapping_mul(0x0100_0193);
+        i += 1;
+    }
+    hash
+}
+
+// ---------------------------------------------------------------------------
+// Field encoding
+// ---------------------------------------------------------------------------
+
+/// A `#[uclass]` Rust field that can be carried across a hot reload.
+///
+/// POD implementations store the raw bytes and restore with one unaligned
+/// load straight out of the mapped arena.
+pub trait SnapshotField: Sized {
+    fn save(&self, out: &mut Vec<u8>);
+    /// Rebuild the value; `None` leaves the field at its default.
+    fn restore(bytes: &[u8]) -> Option<Self>;
+}
+
+macro_rules! impl_snapshot_pod {
+    ($($t:ty),* $(,)?) => {$(
+        impl SnapshotField for $t {
+            #[inline]
+            fn save(&self, out: &mut Vec<u8>) {
+                let bytes = unsafe {
+                    std::slice::from_raw_parts(self as *const $t as *const u8, size_of::<$t>())
+                };
+                out.extend_from_slice(bytes);
+            }
+            #[inline]
+            fn restore(bytes: &[u8]) -> Option<Self> {
+                if bytes.len() != size_of::<$t>() {
+                    return None;
+                }
+                Some(unsafe { std::ptr::read_unaligned(bytes.as_ptr() as *const $t) })
+            }
+        }
+    )*};
+}
+
+// Object handles stay valid across a reload: the UObjects themselves are
+// untouched, only the Rust side is swapped.
+impl_snapshot_pod!(
+    i8, i16, i32, i64, u8, u16, u32, u64, f32, f64,
+    UObjectHandle, UClassHandle, FNameHandle, FWeakObjectHandle,
+);
+
+impl SnapshotField for bool {
+    fn save(&self, out: &mut Vec<u8>) {
+        out.push(*self as u8);
+    }
+    fn restore(bytes: &[u8]) -> Option<Self> {
+        match bytes {
+            [b] => Some(*b != 0),
+            _ => None,
+        }
+    }
+}
+
+impl<T: UeClass> SnapshotField for UObjectRef<T> {
+    fn save(&self, out: &mut Vec<u8>) {
+        self.raw().save(out);
+    }
+    fn restore(bytes: &[u8]) -> Option<Self> {
+        UObjectHandle::restore(bytes).map(|h| unsafe { UObjectRef::from_raw(h) })
+    }
+}
+
+impl SnapshotField for String {
+    fn save(&self, out: &mut Vec<u8>) {
+        out.extend_from_slice(self.as_bytes());
+    }
+    fn restore(bytes: &[u8]) -> Option<Self> {
+        std::str::from_utf8(bytes).ok().map(str::to_owned)
+    }
+}
+
+impl<T: SnapshotField, const N: usize> SnapshotField for [T; N] {
+    fn save(&self, out: &mut Vec<u8>) {
+        // Elements are length-prefixed so non-POD element types also work.
+        for v in self {
+            let len_at = out.len();
+            out.extend_from_slice(&0u32.to_le_bytes());
+            v.save(out);
+            let len = (out.len() - len_at - 4) as u32;
+            out[len_at..len_at + 4].copy_from_slice(&len.to_le_bytes());
+        }
+    }
+    fn restore(mut bytes: &[u8]) -> Option<Self> {
+        let mut items = Vec::with_capacity(N);
+        for _ in 0..N {
+            let len = read_u32(bytes, 0)? as usize;
+            let elem = bytes.get(4..4 + len)?;
+            items.push(T::restore(elem)?);
+            bytes = &bytes[4 + len..];
+        }
+        items.try_into().ok()
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Writer
+// ---------------------------------------------------------------------------
+
+/// Builds a snapshot image. Generated `save` functions call [`field`](Self::field)
+/// once per Rust field of the instance.
+pub struct SnapshotWriter {
+    buf: Vec<u8>,
+    entry_count: u32,
+    field_count: u32,
+}
+
+impl SnapshotWriter {
+    pub(crate) fn new() -> Self {
+        let mut buf = Vec::with_capacity(4096);
+        buf.resize(HEADER_SIZE, 0);
+        Self { buf, entry_count: 0, field_count: 0 }
+    }
+
+    /// Write one instance; `fill` writes its fields.
+    pub(crate) fn entry(&mut self, obj: u64, type_id: u64, fill: impl FnOnce(&mut Self)) {
+        let start = self.buf.len();
+        self.buf.extend_from_slice(&obj.to_le_bytes());
+        self.buf.extend_from_slice(&type_id.to_le_bytes());
+        self.buf.extend_from_slice(&[0u8; 8]);
+        self.field_count = 0;
+        fill(self);
+        let payload_len = (self.buf.len() - start - ENTRY_HEADER_SIZE) as u32;
+        self.buf[start + 16..start + 20].copy_from_slice(&self.field_count.to_le_bytes());
+        self.buf[start + 20..start + 24].copy_from_slice(&payload_len.to_le_bytes());
+        self.entry_count += 1;
+    }
+
+    /// Append one field record to the current entry.
+    pub fn field<T: SnapshotField>(&mut self, name_hash: u32, type_hash: u32, value: &T) {
+        let start = self.buf.len();
+        self.buf.extend_from_slice(&name_hash.to_le_bytes());
+        self.buf.extend_from_slice(&type_hash.to_le_bytes());
+        self.buf.extend_from_slice(&[0u8; 4]);
+        value.save(&mut self.buf);
+        let len = (self.buf.len() - start - FIELD_HEADER_SIZE) as u32;
+        self.buf[start + 8..start + 12].copy_from_slice(&len.to_le_bytes());
+        self.field_count += 1;
+    }
+
+    pub(crate) fn entry_count(&self) -> u32 {
+        self.entry_count
+    }
+
+    /// Finish the header and return the image.
+    pub(crate) fn finish(mut self) -> Vec<u8> {
+        let len = self.buf.len() as u32;
+        self.buf[0..4].copy_from_slice(&SNAPSHOT_MAGIC.to_le_bytes());
+        self.buf[4..6].copy_from_slice(&SNAPSHOT_VERSION.to_le_bytes());
+        self.buf[8..12].copy_from_slice(&self.entry_count.to_le_bytes());
+        self.buf[12..16].copy_from_slice(&len.to_le_bytes());
+        self.buf
+    }
+
+    /// Finish the image and copy it into a freshly mapped plugin arena.
+    /// Returns false if there was nothing to write or the arena could not be mapped.
+    pub(crate) fn commit(self) -> bool {
+        if self.entry_count == 0 {
+            return false;
+        }
+        let image = self.finish();
+        let Ok(len) = u32::try_from(image.len()) else {
+            return false;
+        };
+        let arena = unsafe { ffi_dispatch::reify_snapshot_alloc(len) };
+        if arena.is_null() {
+            return false;
+        }
+        unsafe { std::ptr::copy_nonoverlapping(image.as_ptr(), arena, image.len()) };
+        true
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Reader
+// ---------------------------------------------------------------------------
+
+#[inline]
+fn read_u32(bytes: &[u8], at: usize) -> Option<u32> {
+    bytes.get(at..at + 4).map(|b| u32::from_le_bytes(b.try_into().unwrap()))
+}
+
+#[inline]
+fn read_u64(bytes: &[u8], at: usize) -> Option<u64> {
+    bytes.get(at..at + 8).map(|b| u64::from_le_bytes(b.try_into().unwrap()))
+}
+
+/// A validated snapshot image (borrowed, typically from the plugin arena).
+pub(crate) struct SnapshotView<'a> {
+    entries: &'a [u8],
+    entry_count: u32,
+}
+
+impl<'a> SnapshotView<'a> {
+    /// Validate the header. Returns `None` for an empty, truncated, foreign
+    /// or differently versioned image.
+    pub(crate) fn parse(bytes: &'a [u8]) -> Option<Self> {
+        if read_u32(bytes, 0)? != SNAPSHOT_MAGIC {
+            return None;
+        }
+        let version = u16::from_le_bytes(bytes.get(4..6)?.try_into().unwrap());
+        if version != SNAPSHOT_VERSION {
+            return None;
+        }
+        let entry_count = read_u32(bytes, 8)?;
+        let len = read_u32(bytes, 12)? as usize;
+        let entries = bytes.get(HEADER_SIZE..len)?;
+        Some(Self { entries, entry_count })
+    }
+
+    /// The arena currently held by the plugin, if any.
+    ///
+    /// # Safety
+    /// The returned view borrows plugin memory that stays mapped until the
+    /// restore callback returns; it must not outlive that call.
+    pub(crate) unsafe fn current() -> Option<SnapshotView<'static>> {
+        let mut len = 0u32;
+        let data = unsafe { ffi_dispatch::reify_snapshot_data(&mut len) };
+        if data.is_null() || len == 0 {
+            return None;
+        }
+        SnapshotView::parse(unsafe { std::slice::from_raw_parts(data, len as usize) })
+    }
+
+    /// Iterate entries as `(obj_addr, type_id, fields)`. Stops at the first
+    /// malformed entry.
+    pub(crate) fn entries(&self) -> impl Iterator<Item = (u64, u64, SnapshotFields<'a>)> + 'a {
+        let mut rest = self.entries;
+        let mut remaining = self.entry_count;
+        std::iter::from_fn(move || {
+            if remaining == 0 {
+                return None;
+            }
+            let obj = read_u64(rest, 0)?;
+            let type_id = read_u64(rest, 8)?;
+            let field_count = read_u32(rest, 16)?;
+            let payload_len = read_u32(rest, 20)? as usize;
+            let payload = rest.get(ENTRY_HEADER_SIZE..ENTRY_HEADER_SIZE + payload_len)?;
+            rest = &rest[ENTRY_HEADER_SIZE + payload_len..];
+            remaining -= 1;
+            Some((obj, type_id, SnapshotFields { payload, field_count }))
+        })
+    }
+}
+
+/// Field records of one snapshotted instance. Generated `restore` functions
+/// look fields up with [`get`](Self::get).
+pub struct SnapshotFields<'a> {
+    payload: &'a [u8],
+    field_count: u32,
+}
+
+impl<'a> SnapshotFields<'a> {
+    /// The bytes recorded for a field, if its name and type both match.
+    pub fn bytes(&self, name_hash: u32, type_hash: u32) -> Option<&'a [u8]> {
+        let mut rest = self.payload;
+        for _ in 0..self.field_count {
+            let name = read_u32(rest, 0)?;
+            let ty = read_u32(rest, 4)?;
+            let len = read_u32(rest, 8)? as usize;
+            let bytes = rest.get(FIELD_HEADER_SIZE..FIELD_HEADER_SIZE + len)?;
+            if name == name_hash && ty == type_hash {
+                return Some(bytes);
+            }
+            rest = &rest[FIELD_HEADER_SIZE + len..];
+        }
+        None
+    }
+
+    /// Decode a field; `None` if it is absent, retyped or malformed.
+    pub fn get<T: SnapshotField>(&self, name_hash: u32, type_hash: u32) -> Option<T> {
+        self.bytes(name_hash, type_hash).and_then(T::restore)
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    const HP: u32 = field_hash("hp");
+    const NAME: u32 = field_hash("name");
+    const F32: u32 = field_hash("f32");
+    const STRING: u32 = field_hash("String");
+
+    #[test]
+    fn round_trips_fields_by_name_and_type() {
+        let mut w = SnapshotWriter::new();
+        w.entry(0x1000, 7, |w| {
+            w.field(HP, F32, &42.5f32);
+            w.field(NAME, STRING, &"crate".to_string());
+        });
+        w.entry(0x2000, 7, |w| w.field(HP, F32, &1.0f32));
+        let image = w.finish();
+
+        let view = SnapshotView::parse(&image).unwrap();
+        let entries: Vec<_> = view.entries().collect();
+        assert_eq!(entries.len(), 2);
+        let (obj, type_id, fields) = &entries[0];
+        assert_eq!((*obj, *type_id), (0x1000, 7));
+        assert_eq!(fields.get::<f32>(HP, F32), Some(42.5));
+        assert_eq!(fields.get::<String>(NAME, STRING).as_deref(), Some("crate"));
+        // Retyped field (same name, different type) is not restored.
+        assert_eq!(fields.get::<i32>(HP, field_hash("i32")), None);
+        assert_eq!(entries[1].2.get::<String>(NAME, STRING), None);
+    }
+
+    #[test]
+    fn rejects_foreign_or_truncated_images() {
+        let mut w = SnapshotWriter::new();
+        w.entry(1, 2, |w| w.field(HP, F32, &[1u8, 2, 3]));
+        let image = w.finish();
+        assert!(SnapshotView::parse(&image[..image.len() - 1]).is_none());
+        let mut bad = image.clone();
+        bad[4] = 99;
+        assert!(SnapshotView::parse(&bad).is_none());
+
+        let view = SnapshotView::parse(&image).unwrap();
+        let (_, _, fields) = view.entries().next().unwrap();
+        assert_eq!(fields.get::<[u8; 3]>(HP, F32), Some([1, 2, 3]));
+    }
+}
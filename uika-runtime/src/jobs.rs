@@ -0,0 +1,216 @@
+// Worker jobs: Rust closures on UE's task system (`task` sub-table), plus a
+// game-thread queue for continuations that need UObject access.
+//
+// Job bodies run on worker threads and must stay inside the thread-safe
+// subset: plain Rust data gathered beforehand, `ue_math`, `FName`
+// construction/lookup, logging and this module. Anything that takes a
+// `UObjectHandle`, `UObjectRef` or property handle is game-thread only —
+// hand the result to `run_on_game_thread` (or use `spawn_with_result`) and
+// touch UObjects there. The queue is drained at the start of every frame.
+
+use std::ops::Range;
+use std::panic::AssertUnwindSafe;
+use std::sync::Mutex;
+
+use crate::error::{UikaError, UikaResult};
+use crate::ffi_dispatch;
+use crate::lock_or_recover;
+
+type Job = Box<dyn FnOnce() + Send>;
+type RangeJob<'a> = &'a (dyn Fn(Range<usize>) + Sync);
+
+static GAME_THREAD_QUEUE: Mutex<Vec<Job>> = Mutex::new(Vec::new());
+
+/// A launched job. Dropping the handle does not cancel the job; it only
+/// releases the id on the C++ side.
+#[must_use = "dropping a JobHandle detaches the job"]
+pub struct JobHandle {
+    id: u64,
+}
+
+impl JobHandle {
+    /// Block until the job has finished.
+    pub fn wait(&self) {
+        unsafe { ffi_dispatch::task_wait(self.id, u32::MAX) };
+    }
+
+    /// Block for at most `timeout_ms`. Returns whether the job finished.
+    pub fn wait_timeout(&self, timeout_ms: u32) -> bool {
+        unsafe { ffi_dispatch::task_wait(self.id, timeout_ms) }
+    }
+
+    /// Non-blocking completion check.
+    pub fn is_complete(&self) -> bool {
+        unsafe { ffi_dispatch::task_is_completed(self.id) }
+    }
+}
+
+impl Drop for JobHandle {
+    fn drop(&mut self) {
+        unsafe { ffi_dispatch::task_release(self.id) };
+    }
+}
+
+/// Run `f` on a worker thread.
+pub fn spawn(f: impl FnOnce() + Send + 'static) -> UikaResult<JobHandle> {
+    spawn_after(&[], f)
+}
+
+/// Run `f` on a worker thread once every job in `prereqs` has finished.
+pub fn spawn_after(
+    prereqs: &[&JobHandle],
+    f: impl FnOnce() + Send + 'static,
+) -> UikaResult<JobHandle> {
+    let ids: Vec<u64> = prereqs.iter().map(|h| h.id).collect();
+    let job = Box::into_raw(Box::new(Box::new(f) as Job));
+    let id = unsafe { ffi_dispatch::task_launch(job as u64, ids.as_ptr(), ids.len() as u32) };
+    if id == 0 {
+        // Never launched: the job is still ours to free.
+        drop(unsafe { Box::from_raw(job) });
+        return Err(UikaError::InvalidOperation("task system unavailable".into()));
+    }
+    Ok(JobHandle { id })
+}
+
+/// Run `work` on a worker thread, then `then` with its result on the game
+/// thread at the start of the next frame after it finishes.
+pub fn spawn_with_result<T: Send + 'static>(
+    work: impl FnOnce() -> T + Send + 'static,
+    then: impl FnOnce(T) + Send + 'static,
+) -> UikaResult<JobHandle> {
+    spawn(move || {
+        let value = work();
+        run_on_game_thread(move || then(value));
+    })
+}
+
+/// Call `f(i)` for every `i` in `0..count` across the workers; the calling
+/// thread helps and the call returns when all indices are done. Each worker
+/// call covers at least `min_batch` indices.
+pub fn parallel_for(count: usize, min_batch: usize, f: impl Fn(usize) + Sync) {
+    parallel_for_chunks(count, min_batch, |range| range.for_each(&f));
+}
+
+/// Like [`parallel_for`], but `f` receives whole chunks.
+pub fn parallel_for_chunks(count: usize, min_batch: usize, f: impl Fn(Range<usize>) + Sync) {
+    if count == 0 {
+        return;
+    }
+    let count = u32::try_from(count).expect("parallel_for count exceeds u32::MAX");
+    let job: RangeJob<'_> = &f;
+    // `job` outlives the call: parallel_for only returns once every chunk is done.
+    unsafe {
+        ffi_dispatch::task_parallel_for(
+            &job as *const RangeJob<'_> as u64,
+            count,
+            min_batch.clamp(1, u32::MAX as usize) as u32,
+        )
+    };
+}
+
+/// Queue `f` to run on the game thread at the start of the next frame.
+/// Safe to call from any thread.
+pub fn run_on_game_thread(f: impl FnOnce() + Send + 'static) {
+    lock_or_recover(&GAME_THREAD_QUEUE).push(Box::new(f));
+}
+
+/// Whether the calling thread is the game thread.
+pub fn is_game_thread() -> bool {
+    unsafe { ffi_dispatch::task_is_game_thread() }
+}
+
+/// Number of task-graph worker threads.
+pub fn worker_count() -> u32 {
+    unsafe { ffi_dispatch::task_worker_count() }
+}
+
+// ---------------------------------------------------------------------------
+// Callback entry points (called from `uika`)
+// ---------------------------------------------------------------------------
+
+/// Run a job launched by [`spawn_after`].
+///
+/// # Safety
+/// `job` must come from `spawn_after` and must not have run yet.
+pub unsafe fn run_job(job: u64) {
+    let job = unsafe { Box::from_raw(job as *mut Job) };
+    job();
+}
+
+/// Run one chunk of a [`parallel_for_chunks`] call.
+///
+/// # Safety
+/// `job` must come from a `parallel_for_chunks` call that has not returned.
+pub unsafe fn run_job_range(job: u64, begin: u32, end: u32) {
+    let job = unsafe { *(job as *const RangeJob<'static>) };
+    job(begin as usize..end as usize);
+}
+
+/// Run every continuation queued so far. Continuations queued while
+/// draining wait for the next drain. A panicking continuation is logged and
+/// does not stop the rest. Returns how many ran.
+pub fn drain_game_thread_queue() -> usize {
+    let jobs = std::mem::take(&mut *lock_or_recover(&GAME_THREAD_QUEUE));
+    let count = jobs.len();
+    for job in jobs {
+        crate::ffi_boundary((), AssertUnwindSafe(job));
+    }
+    count
+}
+
+/// Drop every queued continuation without running it (shutdown/hot reload).
+pub fn clear_game_thread_queue() {
+    lock_or_recover(&GAME_THREAD_QUEUE).clear();
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use std::sync::atomic::{AtomicUsize, Ordering};
+    use std::sync::Arc;
+
+    #[test]
+    fn queue_and_job_entry_points() {
+        let hits = Arc::new(AtomicUsize::new(0));
+
+        // Game-thread queue: FIFO, one drain per batch.
+        for _ in 0..3 {
+            let hits = hits.clone();
+            run_on_game_thread(move || {
+                hits.fetch_add(1, Ordering::Relaxed);
+            });
+        }
+        run_on_game_thread(|| panic!("continuation panic"));
+        let requeue = hits.clone();
+        run_on_game_thread(move || {
+            run_on_game_thread(move || {
+                requeue.fetch_add(10, Ordering::Relaxed);
+            });
+        });
+        assert_eq!(drain_game_thread_queue(), 5);
+        assert_eq!(hits.load(Ordering::Relaxed), 3);
+        assert_eq!(drain_game_thread_queue(), 1);
+        assert_eq!(hits.load(Ordering::Relaxed), 13);
+
+        // run_job consumes the boxed job exactly as spawn_after boxes it.
+        let job_hits = hits.clone();
+        let job = Box::into_raw(Box::new(Box::new(move || {
+            job_hits.fetch_add(100, Ordering::Relaxed);
+        }) as Job));
+        unsafe { run_job(job as u64) };
+        assert_eq!(hits.load(Ordering::Relaxed), 113);
+
+        // run_job_range goes through the same reference parallel_for_chunks passes.
+        let sum = AtomicUsize::new(0);
+        let f = |r: Range<usize>| {
+            sum.fetch_add(r.sum::<usize>(), Ordering::Relaxed);
+        };
+        let range_job: RangeJob<'_> = &f;
+        let ptr = &range_job as *const RangeJob<'_> as u64;
+        unsafe {
+            run_job_range(ptr, 0, 4);
+            run_job_range(ptr, 4, 10);
+        }
+        assert_eq!(sum.load(Ordering::Relaxed), 45);
+    }
+}
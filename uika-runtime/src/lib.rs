@@ -21,11 +21,23 @@ pub mod ffi_guard;
 pub mod containers;
 pub mod delegate_registry;
 pub mod reify_registry;
+pub mod hot_snapshot;
 pub mod ue_math;
 pub mod fname;
 pub mod weak_ptr;
 pub mod widget;
 pub mod world;
+pub mod mirror;
+pub mod prop_batch;
+pub mod field_desc;
+pub mod property_path;
+pub mod reflection;
+pub mod ue_string;
+pub mod command_buffer;
+pub mod class_schema;
+pub mod ffi_stats;
+pub mod jobs;
+pub mod slab;
 
 // Re-export the primary public API surface.
 pub use api::{api, init_api};
@@ -34,11 +46,20 @@ pub use traits::{UeClass, UeStruct, UeEnum, UeHandle, ValidHandle, HasParent};
 pub use object_ref::{Checked, UObjectRef};
 pub use struct_ref::UStructRef;
 pub use pinned::Pinned;
-pub use dynamic_call::{DynamicCall, DynamicCallResult};
-pub use logging::{LOG_DISPLAY, LOG_WARNING, LOG_ERROR};
+pub use dynamic_call::{DynamicCall, DynamicCallResult, ParamFrame};
+pub use logging::{LogCategory, LOG_DISPLAY, LOG_WARNING, LOG_ERROR, LOG_VERBOSE, LOG_VERY_VERBOSE};
 pub use ffi_guard::ffi_boundary;
 pub use containers::{ContainerElement, OwnedStruct, UeArray, UeMap, UeSet};
-pub use delegate_registry::DelegateBinding;
+pub use delegate_registry::{drain_queued_events, DelegateBinding, QueuedParams};
+pub use prop_batch::{PropBatch, PropSlot, RawSlot};
+pub use field_desc::FieldDesc;
+pub use property_path::PropertyPath;
+pub use mirror::{MirrorSnapshot, MirrorSource, StateMirror};
+pub use reflection::{ResolveOwner, Resolver};
+pub use ue_string::Utf16View;
+pub use command_buffer::{CommandArgs, CommandBuffer, CommandScalar, CommandStats};
+pub use class_schema::{ClassSchema, SchemaDefault};
+pub use jobs::{parallel_for, run_on_game_thread, JobHandle};
 
 // Phase 10 re-exports.
 pub use fname::FName;
@@ -1,9 +1,175 @@
 // Logging bridge to UE_LOG.
+//
+// Records are filtered against the category's effective verbosity before
+// anything is formatted: C++ publishes one byte per category and keeps it
+// current, so a disabled `ulog!` costs two loads and a compare. Enabled
+// records are queued in the plugin's log ring and written to GLog by a
+// background thread, which makes `ulog!` safe from worker threads too.
+
+use std::cell::RefCell;
+use std::fmt::{self, Write};
+use std::sync::OnceLock;
+use std::sync::atomic::{AtomicU8, AtomicU32, Ordering};
+
+use uika_ffi::{UikaLogField, UikaStrView};
+
+use crate::ffi_dispatch;
 
 /// Log level constants for the `ulog!` macro.
 pub const LOG_DISPLAY: u8 = 0;
 pub const LOG_WARNING: u8 = 1;
 pub const LOG_ERROR: u8 = 2;
+pub const LOG_VERBOSE: u8 = 3;
+pub const LOG_VERY_VERBOSE: u8 = 4;
+
+/// Category id of `LogUika`, used by `ulog!` without a `target:`.
+pub const UIKA_CATEGORY: u16 = 0;
+
+const UNREGISTERED: u32 = u32::MAX;
+
+/// A UE log category owned by Rust code, registered on first use.
+///
+/// ```ignore
+/// static LOG_AI: LogCategory = LogCategory::new("LogRustAI");
+/// ulog!(target: LOG_AI, LOG_VERBOSE, "replanning"; agent = id, cost = cost);
+/// ```
+pub struct LogCategory {
+    name: &'static str,
+    id: AtomicU32,
+}
+
+impl LogCategory {
+    pub const fn new(name: &'static str) -> Self {
+        LogCategory { name, id: AtomicU32::new(UNREGISTERED) }
+    }
+
+    /// Category id, registering the category on first call.
+    #[inline]
+    pub fn id(&self) -> u16 {
+        match self.id.load(Ordering::Relaxed) {
+            UNREGISTERED => self.register(),
+            id => id as u16,
+        }
+    }
+
+    #[cold]
+    fn register(&self) -> u16 {
+        if !crate::api::is_api_initialized() {
+            return UIKA_CATEGORY;
+        }
+        // Registration is idempotent on the C++ side, so racing threads agree.
+        let id = unsafe {
+            ffi_dispatch::logging_register_category(self.name.as_ptr(), self.name.len() as u32)
+        };
+        self.id.store(id as u32, Ordering::Relaxed);
+        id
+    }
+
+    pub fn name(&self) -> &'static str {
+        self.name
+    }
+}
+
+static VERBOSITY_TABLE: OnceLock<usize> = OnceLock::new();
+
+/// `ELogVerbosity` a level needs to be shown (Error, Warning, Display, Verbose, VeryVerbose).
+#[inline]
+fn required_verbosity(level: u8) -> u8 {
+    match level {
+        LOG_DISPLAY => 4,
+        LOG_WARNING => 3,
+        LOG_VERBOSE => 6,
+        LOG_VERY_VERBOSE => 7,
+        _ => 2,
+    }
+}
+
+/// Whether a record at `level` in `category` would be written. Reads the
+/// C++ verbosity table; no crossing after the first call.
+#[inline]
+pub fn enabled(category: u16, level: u8) -> bool {
+    let table = match VERBOSITY_TABLE.get() {
+        Some(&table) => table,
+        None if crate::api::is_api_initialized() => *VERBOSITY_TABLE
+            .get_or_init(|| unsafe { ffi_dispatch::logging_verbosity_table() } as usize),
+        None => return false,
+    };
+    if table == 0 {
+        return false;
+    }
+    // SAFETY: C++ keeps 256 lock-free std::atomic<uint8> at this address for
+    // the lifetime of the module; ids are u8-range by construction.
+    let verbosity = unsafe { &*(table as *const AtomicU8).add(category as u8 as usize) };
+    verbosity.load(Ordering::Relaxed) >= required_verbosity(level)
+}
+
+#[derive(Default)]
+struct Scratch {
+    text: String,
+    spans: Vec<(usize, usize)>,
+    fields: Vec<UikaLogField>,
+}
+
+thread_local! {
+    static SCRATCH: RefCell<Scratch> = RefCell::new(Scratch::default());
+}
+
+/// Format and queue one record. Called by `ulog!` once `enabled` passed.
+#[doc(hidden)]
+pub fn emit(category: u16, level: u8, args: fmt::Arguments<'_>, fields: &[(&str, &dyn fmt::Display)]) {
+    if fields.is_empty() {
+        // Literal messages go out without a copy.
+        if let Some(msg) = args.as_str() {
+            return send(category, level, msg, &[]);
+        }
+    }
+    // A Display impl that logs re-enters here; give it its own buffers.
+    let _ = SCRATCH.try_with(|scratch| match scratch.try_borrow_mut() {
+        Ok(mut scratch) => emit_with(&mut scratch, category, level, args, fields),
+        Err(_) => emit_with(&mut Scratch::default(), category, level, args, fields),
+    });
+}
+
+fn emit_with(
+    scratch: &mut Scratch,
+    category: u16,
+    level: u8,
+    args: fmt::Arguments<'_>,
+    fields: &[(&str, &dyn fmt::Display)],
+) {
+    let Scratch { text, spans, fields: views } = scratch;
+    text.clear();
+    spans.clear();
+    views.clear();
+
+    let _ = text.write_fmt(args);
+    let msg_len = text.len();
+    for (_, value) in fields {
+        let start = text.len();
+        let _ = write!(text, "{value}");
+        spans.push((start, text.len()));
+    }
+    // Views are taken only now: `text` may have reallocated while growing.
+    views.extend(fields.iter().zip(spans.iter()).map(|((key, _), &(start, end))| UikaLogField {
+        key: UikaStrView::new(key),
+        value: UikaStrView::new(&text[start..end]),
+    }));
+    send(category, level, &text[..msg_len], views);
+}
+
+fn send(category: u16, level: u8, msg: &str, fields: &[UikaLogField]) {
+    // SAFETY: C++ copies the record before returning.
+    unsafe {
+        ffi_dispatch::logging_log_record(
+            level,
+            category,
+            msg.as_ptr(),
+            msg.len() as u32,
+            fields.as_ptr(),
+            fields.len() as u32,
+        );
+    }
+}
 
 /// Log a message through UE_LOG.
 ///
@@ -12,18 +178,51 @@ pub const LOG_ERROR: u8 = 2;
 /// ulog!(LOG_DISPLAY, "Actor {} has {} health", name, hp);
 /// ulog!(LOG_WARNING, "something suspicious");
 /// ulog!(LOG_ERROR, "fatal: {err}");
+///
+/// // Own category, structured fields after `;` (written as `{key=value, ...}`).
+/// ulog!(target: LOG_AI, LOG_VERBOSE, "path found"; agent = id, nodes = path.len());
 /// ```
 ///
-/// Level constants: `LOG_DISPLAY` (0), `LOG_WARNING` (1), `LOG_ERROR` (2).
+/// Level constants: `LOG_DISPLAY` (0), `LOG_WARNING` (1), `LOG_ERROR` (2),
+/// `LOG_VERBOSE` (3), `LOG_VERY_VERBOSE` (4). Nothing is evaluated or
+/// formatted when the category's verbosity drops the level. With fields,
+/// format arguments must be positional or inline (`{name}`).
 #[macro_export]
 macro_rules! ulog {
-    ($level:expr, $($arg:tt)*) => {{
-        let msg = format!($($arg)*);
-        let bytes = msg.as_bytes();
-        // SAFETY: api() is initialized before any Rust code can run, and the
-        // logging sub-table pointer is always valid after init.
-        unsafe {
-            $crate::ffi_dispatch::logging_log($level, bytes.as_ptr(), bytes.len() as u32);
+    (target: $cat:expr, $level:expr, $fmt:literal $(, $arg:expr)* ; $($key:ident = $val:expr),+ $(,)?) => {{
+        let level: u8 = $level;
+        let category = $crate::logging::LogCategory::id(&$cat);
+        if $crate::logging::enabled(category, level) {
+            $crate::logging::emit(
+                category,
+                level,
+                format_args!($fmt $(, $arg)*),
+                &[$((stringify!($key), &$val as &dyn ::core::fmt::Display)),+],
+            );
+        }
+    }};
+    (target: $cat:expr, $level:expr, $($arg:tt)+) => {{
+        let level: u8 = $level;
+        let category = $crate::logging::LogCategory::id(&$cat);
+        if $crate::logging::enabled(category, level) {
+            $crate::logging::emit(category, level, format_args!($($arg)+), &[]);
+        }
+    }};
+    ($level:expr, $fmt:literal $(, $arg:expr)* ; $($key:ident = $val:expr),+ $(,)?) => {{
+        let level: u8 = $level;
+        if $crate::logging::enabled($crate::logging::UIKA_CATEGORY, level) {
+            $crate::logging::emit(
+                $crate::logging::UIKA_CATEGORY,
+                level,
+                format_args!($fmt $(, $arg)*),
+                &[$((stringify!($key), &$val as &dyn ::core::fmt::Display)),+],
+            );
+        }
+    }};
+    ($level:expr, $($arg:tt)+) => {{
+        let level: u8 = $level;
+        if $crate::logging::enabled($crate::logging::UIKA_CATEGORY, level) {
+            $crate::logging::emit($crate::logging::UIKA_CATEGORY, level, format_args!($($arg)+), &[]);
         }
     }};
 }
@@ -0,0 +1,304 @@
+// StateMirror: per-frame, C++-filled snapshot of selected state of a set of
+// objects.
+//
+// Instead of one property read per object per frame, Rust subscribes the
+// objects and the columns it needs once. A tick function in the chosen tick
+// group copies every column of every row into a double-buffered SoA block and
+// marks the rows that changed; Rust then reads the published snapshot in
+// place — contiguous slices, no crossings — and can skip clean rows.
+//
+// ```ignore
+// let mirror = StateMirror::create(
+//     world,
+//     &[MirrorSource::Transform, MirrorSource::path(&HEALTH)],
+//     &handles,
+//     UIKA_TICK_GROUP_POST_PHYSICS,
+// )?;
+// // Later, each frame:
+// let snap = mirror.snapshot();
+// let transforms = snap.column::<UikaTransform>(0)?;
+// for row in snap.dirty_rows() { /* ... transforms[row] ... */ }
+// ```
+
+use std::marker::PhantomData;
+use std::mem::{align_of, size_of, MaybeUninit};
+use std::sync::atomic::{fence, AtomicU64, Ordering};
+
+use uika_ffi::{
+    FPropertyHandle, UObjectHandle, UikaMirrorColumn, UikaMirrorView, UIKA_MIRROR_PROPERTY,
+    UIKA_MIRROR_TRANSFORM, UIKA_MIRROR_VELOCITY,
+};
+
+use crate::error::{check_ffi, UikaError, UikaResult};
+use crate::ffi_dispatch;
+use crate::field_desc::FieldDesc;
+use crate::property_path::PropertyPath;
+use crate::traits::UeClass;
+
+/// Alignment of every column in the mirror buffers.
+const COLUMN_ALIGN: usize = 16;
+
+/// What one mirror column holds for each row.
+#[derive(Clone, Copy, Debug)]
+pub enum MirrorSource {
+    /// A plain-old-data property (or a leaf of a property path) at `offset`
+    /// from the object base, copied as raw bytes.
+    Property { prop: FPropertyHandle, offset: u32 },
+    /// Component-to-world transform of the actor's root component (or of the
+    /// scene component itself), as a `UikaTransform`.
+    Transform,
+    /// Actor or scene-component velocity, as a `UikaVector`.
+    Velocity,
+}
+
+impl MirrorSource {
+    /// A top-level property of the mirrored objects.
+    pub fn property(prop: FPropertyHandle) -> Self {
+        MirrorSource::Property { prop, offset: FieldDesc::query(prop).offset() }
+    }
+
+    /// The leaf of a resolved property path.
+    pub fn path<T: UeClass>(path: &PropertyPath<T>) -> Self {
+        MirrorSource::Property { prop: path.leaf(), offset: path.field().offset() }
+    }
+
+    fn to_raw(self) -> UikaMirrorColumn {
+        match self {
+            MirrorSource::Property { prop, offset } => {
+                UikaMirrorColumn { prop, kind: UIKA_MIRROR_PROPERTY, offset }
+            }
+            MirrorSource::Transform => {
+                UikaMirrorColumn { prop: FPropertyHandle::null(), kind: UIKA_MIRROR_TRANSFORM, offset: 0 }
+            }
+            MirrorSource::Velocity => {
+                UikaMirrorColumn { prop: FPropertyHandle::null(), kind: UIKA_MIRROR_VELOCITY, offset: 0 }
+            }
+        }
+    }
+}
+
+/// A subscription to a per-frame state mirror. Dropping it unsubscribes.
+///
+/// `create`, `set_objects` and `drop` must run on the game thread; snapshots
+/// may be read from any thread (the mirror is `Sync`), but see
+/// [`MirrorSnapshot`] for how long one stays intact.
+pub struct StateMirror {
+    id: u64,
+    view: UikaMirrorView,
+    _marker: PhantomData<*const ()>, // !Send: destroyed on the game thread
+}
+
+// Shared access only reads the C++ buffers and the atomic sequence.
+unsafe impl Sync for StateMirror {}
+
+impl StateMirror {
+    /// Mirror `columns` of `objs` in `world`, filled every frame at
+    /// `tick_group` (`UIKA_TICK_GROUP_*`). Row `i` is `objs[i]`; the first
+    /// snapshot (every row dirty) is available immediately.
+    pub fn create(
+        world: UObjectHandle,
+        columns: &[MirrorSource],
+        objs: &[UObjectHandle],
+        tick_group: u32,
+    ) -> UikaResult<Self> {
+        let raw: Vec<UikaMirrorColumn> = columns.iter().map(|c| c.to_raw()).collect();
+        let mut id = 0u64;
+        let mut view = MaybeUninit::<UikaMirrorView>::uninit();
+        check_ffi(unsafe {
+            ffi_dispatch::world_mirror_create(
+                world,
+                raw.as_ptr(),
+                raw.len() as u32,
+                objs.as_ptr(),
+                objs.len() as u32,
+                tick_group,
+                &mut id,
+                view.as_mut_ptr(),
+            )
+        })?;
+        // SAFETY: C++ fills the view whenever it returns Ok.
+        Ok(StateMirror { id, view: unsafe { view.assume_init() }, _marker: PhantomData })
+    }
+
+    /// Replace the mirrored objects. Takes a fresh snapshot in which every
+    /// row is dirty; the buffers are reallocated, which `&mut self` keeps
+    /// from invalidating a live [`MirrorSnapshot`].
+    pub fn set_objects(&mut self, objs: &[UObjectHandle]) -> UikaResult<()> {
+        let mut view = MaybeUninit::<UikaMirrorView>::uninit();
+        check_ffi(unsafe {
+            ffi_dispatch::world_mirror_set_objects(self.id, objs.as_ptr(), objs.len() as u32, view.as_mut_ptr())
+        })?;
+        // SAFETY: as in `create`.
+        self.view = unsafe { view.assume_init() };
+        Ok(())
+    }
+
+    /// Number of rows (mirrored objects).
+    #[inline]
+    pub fn row_count(&self) -> usize {
+        self.view.row_count as usize
+    }
+
+    /// Number of columns.
+    #[inline]
+    pub fn column_count(&self) -> usize {
+        self.view.column_count as usize
+    }
+
+    /// Sequence number of the latest published snapshot; increases by one
+    /// per fill.
+    #[inline]
+    pub fn sequence(&self) -> u64 {
+        self.sequence_atomic().load(Ordering::Acquire)
+    }
+
+    /// The latest published snapshot.
+    #[inline]
+    pub fn snapshot(&self) -> MirrorSnapshot<'_> {
+        let sequence = self.sequence();
+        MirrorSnapshot { mirror: self, sequence, base: self.view.buffers[(sequence & 1) as usize] }
+    }
+
+    #[inline]
+    fn sequence_atomic(&self) -> &AtomicU64 {
+        // SAFETY: C++ keeps a lock-free std::atomic<uint64> at this address
+        // until the mirror is destroyed.
+        unsafe { &*(self.view.sequence as *const AtomicU64) }
+    }
+}
+
+impl Drop for StateMirror {
+    fn drop(&mut self) {
+        // After a DLL unload the C++ side has already freed every mirror.
+        if crate::api::is_api_initialized() {
+            let _ = unsafe { ffi_dispatch::world_mirror_destroy(self.id) };
+        }
+    }
+}
+
+impl std::fmt::Debug for StateMirror {
+    fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+        f.debug_struct("StateMirror")
+            .field("id", &self.id)
+            .field("rows", &self.row_count())
+            .field("columns", &self.column_count())
+            .field("sequence", &self.sequence())
+            .finish()
+    }
+}
+
+/// One published snapshot of a [`StateMirror`].
+///
+/// The snapshot's buffer is rewritten by the fill after the next one, so
+/// read it within the frame it was taken; a worker reading across frames
+/// checks [`is_current`](Self::is_current) after copying out of it.
+///
+/// Dirty bits compare against the immediately preceding snapshot: if
+/// [`sequence`](Self::sequence) advanced by more than one since you last
+/// looked, treat every row as dirty.
+#[derive(Clone, Copy)]
+pub struct MirrorSnapshot<'a> {
+    mirror: &'a StateMirror,
+    sequence: u64,
+    base: *const u8,
+}
+
+unsafe impl Send for MirrorSnapshot<'_> {}
+unsafe impl Sync for MirrorSnapshot<'_> {}
+
+impl<'a> MirrorSnapshot<'a> {
+    /// Sequence number of this snapshot.
+    #[inline]
+    pub fn sequence(&self) -> u64 {
+        self.sequence
+    }
+
+    /// Number of rows.
+    #[inline]
+    pub fn row_count(&self) -> usize {
+        self.mirror.row_count()
+    }
+
+    /// Column `column` as one `V` per row. `V` must have the column's value
+    /// size (`UikaTransform` for `Transform`, `UikaVector` for `Velocity`,
+    /// the property's element type otherwise).
+    pub fn column<V: Copy>(&self, column: usize) -> UikaResult<&'a [V]> {
+        let view = &self.mirror.view;
+        if column >= view.column_count as usize {
+            return Err(UikaError::IndexOutOfRange);
+        }
+        // SAFETY: both arrays have `column_count` entries.
+        let (offset, size) = unsafe {
+            (*view.column_offsets.add(column) as usize, *view.column_sizes.add(column) as usize)
+        };
+        if size != size_of::<V>() || align_of::<V>() > COLUMN_ALIGN {
+            return Err(UikaError::TypeMismatch);
+        }
+        // SAFETY: the column holds `row_count` contiguous, 16-byte aligned
+        // values of `size_of::<V>()` bytes in this snapshot's buffer.
+        Ok(unsafe { std::slice::from_raw_parts(self.base.add(offset) as *const V, self.row_count()) })
+    }
+
+    /// Whether row `row` changed (value or liveness) since the previous snapshot.
+    #[inline]
+    pub fn is_dirty(&self, row: usize) -> bool {
+        self.bit(self.mirror.view.dirty_offset, row)
+    }
+
+    /// Whether the object of row `row` was alive when this snapshot was
+    /// taken. Values of dead rows are zeroed.
+    #[inline]
+    pub fn is_alive(&self, row: usize) -> bool {
+        self.bit(self.mirror.view.alive_offset, row)
+    }
+
+    /// Indices of the dirty rows, in order.
+    pub fn dirty_rows(&self) -> impl Iterator<Item = usize> + 'a {
+        let words = self.words(self.mirror.view.dirty_offset);
+        words.iter().enumerate().flat_map(|(i, &word)| {
+            let mut bits = word;
+            std::iter::from_fn(move || {
+                if bits == 0 {
+                    return None;
+                }
+                let bit = bits.trailing_zeros() as usize;
+                bits &= bits - 1;
+                Some(i * 64 + bit)
+            })
+        })
+    }
+
+    /// Whether no newer snapshot has been published. Call after reading from a
+    /// worker thread: `true` means what was read is consistent (the fill that
+    /// reuses this buffer only starts after the next publish).
+    #[inline]
+    pub fn is_current(&self) -> bool {
+        fence(Ordering::Acquire);
+        self.mirror.sequence_atomic().load(Ordering::Relaxed) == self.sequence
+    }
+
+    #[inline]
+    fn bit(&self, offset: u32, row: usize) -> bool {
+        if row >= self.row_count() {
+            return false;
+        }
+        (self.words(offset)[row / 64] >> (row % 64)) & 1 != 0
+    }
+
+    #[inline]
+    fn words(&self, offset: u32) -> &'a [u64] {
+        let count = self.row_count().div_ceil(64);
+        // SAFETY: each bitset has `ceil(row_count / 64)` u64 words at a
+        // 16-byte aligned offset.
+        unsafe { std::slice::from_raw_parts(self.base.add(offset as usize) as *const u64, count) }
+    }
+}
+
+impl std::fmt::Debug for MirrorSnapshot<'_> {
+    fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+        f.debug_struct("MirrorSnapshot")
+            .field("sequence", &self.sequence)
+            .field("rows", &self.row_count())
+            .finish()
+    }
+}
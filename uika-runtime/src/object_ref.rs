@@ -3,9 +3,18 @@
 // Does NOT prevent garbage collection — the referenced object may become
 // invalid at any time between GC sweeps. Use `Pinned<T>` when you need
 // to guarantee liveness.
+//
+// `is_valid` results are cached per handle against the object epoch: a
+// counter C++ bumps on every delete, at GC start and after calls that run
+// game code, plus a Rust-side counter bumped on every entry from C++ and
+// after generated calls that may destroy objects (`EpochFence`). While both
+// are unchanged, re-validating a handle is one atomic load and no crossing.
 
+use std::cell::Cell;
 use std::marker::PhantomData;
 use std::ops::Deref;
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::sync::OnceLock;
 
 use uika_ffi::{UClassHandle, UObjectHandle};
 
@@ -54,7 +63,7 @@ impl<T: UeClass> UObjectRef<T> {
     /// Check whether the underlying UObject is still alive.
     #[inline]
     pub fn is_valid(&self) -> bool {
-        unsafe { ffi_dispatch::core_is_valid(self.handle) }
+        is_valid_cached(self.handle)
     }
 
     /// Validate that the object is still alive, returning a `Checked<T>`
@@ -127,6 +136,74 @@ impl<T: UeClass> UObjectRef<T> {
     }
 }
 
+// ---------------------------------------------------------------------------
+// Validity cache
+// ---------------------------------------------------------------------------
+
+const VALIDITY_SLOTS: usize = 64;
+
+static SHARED_EPOCH: OnceLock<usize> = OnceLock::new();
+static LOCAL_EPOCH: AtomicU64 = AtomicU64::new(0);
+
+thread_local! {
+    // Direct-mapped (handle, epoch) pairs of handles last seen valid.
+    static VALIDATED: [Cell<(u64, u64)>; VALIDITY_SLOTS] =
+        const { [const { Cell::new((0, 0)) }; VALIDITY_SLOTS] };
+}
+
+/// Current object epoch. Both counters only grow, so their sum changes
+/// whenever either does.
+#[inline]
+fn object_epoch() -> u64 {
+    let shared = *SHARED_EPOCH.get_or_init(|| unsafe { ffi_dispatch::lifecycle_object_epoch() } as usize);
+    let shared = if shared == 0 {
+        0
+    } else {
+        // SAFETY: C++ keeps a lock-free std::atomic<uint64> at this address
+        // for the lifetime of the module.
+        unsafe { &*(shared as *const AtomicU64) }.load(Ordering::Acquire)
+    };
+    shared.wrapping_add(LOCAL_EPOCH.load(Ordering::Relaxed))
+}
+
+#[inline]
+fn is_valid_cached(handle: UObjectHandle) -> bool {
+    let addr = handle.to_addr();
+    if addr == 0 {
+        return false;
+    }
+    let epoch = object_epoch();
+    // UObjects are at least 16-byte aligned; drop the low bits before hashing.
+    let slot = (addr >> 4) as usize % VALIDITY_SLOTS;
+    if VALIDATED.with(|v| v[slot].get()) == (addr, epoch) {
+        return true;
+    }
+    let valid = unsafe { ffi_dispatch::core_is_valid(handle) };
+    if valid {
+        VALIDATED.with(|v| v[slot].set((addr, epoch)));
+    }
+    valid
+}
+
+/// Forget every cached `is_valid` result. Called on each entry from C++
+/// (see `ffi_boundary`): game code may have destroyed objects in between.
+#[inline]
+pub fn invalidate_validity_cache() {
+    LOCAL_EPOCH.fetch_add(1, Ordering::Relaxed);
+}
+
+/// Invalidates the validity cache when dropped. Generated bindings hold one
+/// across func_table calls that are neither pure nor const, since those may
+/// destroy objects without C++ noticing.
+pub struct EpochFence;
+
+impl Drop for EpochFence {
+    #[inline]
+    fn drop(&mut self) {
+        invalidate_validity_cache();
+    }
+}
+
 impl<T: HasParent> UObjectRef<T> {
     /// Infallible upcast to the parent class. Zero-cost (same handle).
     #[inline]
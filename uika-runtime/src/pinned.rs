@@ -4,9 +4,14 @@
 // + remove_gc_root. The GC root prevents garbage collection, while the pinned
 // registration enables fast alive-flag checking via a local AtomicBool instead
 // of an FFI is_valid call on every method invocation.
+//
+// GC roots live in the plugin's root set (one FGCObject), so pinning is cheap
+// on the C++ side; `pin_many` / `release_many` pin or release a whole batch
+// (pooled actors, spawned squads) in two crossings.
 
 use std::collections::HashMap;
 use std::marker::PhantomData;
+use std::mem::ManuallyDrop;
 use std::ops::Deref;
 use std::sync::atomic::{AtomicBool, Ordering};
 use std::sync::{Arc, Mutex, OnceLock};
@@ -40,6 +45,17 @@ pub fn notify_pinned_destroyed(handle: UObjectHandle) {
     }
 }
 
+/// Batched [`notify_pinned_destroyed`] under a single registry lock.
+/// Called from the C++ object tracker after a GC purge.
+pub fn notify_pinned_destroyed_many(handles: &[UObjectHandle]) {
+    let registry = lock_or_recover(alive_registry());
+    for handle in handles {
+        if let Some(flag) = registry.get(&handle.to_addr()) {
+            flag.store(false, Ordering::Relaxed);
+        }
+    }
+}
+
 /// Clear all alive flags. Called during on_shutdown (hot reload / DLL unload).
 pub fn clear_all() {
     if let Ok(mut registry) = alive_registry().lock() {
@@ -80,14 +96,16 @@ impl<T: UeClass> Pinned<T> {
             return Err(UikaError::ObjectDestroyed);
         }
         let alive = Arc::new(AtomicBool::new(true));
-        // Register in alive registry (for C++ destroy notification → Rust alive flag).
-        lock_or_recover(alive_registry())
-            .insert(obj.raw().to_addr(), alive.clone());
-        // GC root + destroy notification registration.
+        // GC root + destroy notification registration. Registration first
+        // delivers any buffered death of an earlier object at this address,
+        // so it must precede inserting the new alive flag.
         unsafe {
             ffi_dispatch::lifecycle_add_gc_root(obj.raw());
             ffi_dispatch::lifecycle_register_pinned(obj.raw());
         }
+        // Register in alive registry (for C++ destroy notification → Rust alive flag).
+        lock_or_recover(alive_registry())
+            .insert(obj.raw().to_addr(), alive.clone());
         Ok(Pinned {
             handle: obj.raw(),
             alive,
@@ -95,6 +113,49 @@ impl<T: UeClass> Pinned<T> {
         })
     }
 
+    /// Pin every object in `objs` with one root-set and one registration
+    /// crossing. Fails without pinning anything if any object is destroyed.
+    pub fn pin_many(objs: &[UObjectRef<T>]) -> UikaResult<Vec<Self>> {
+        if !objs.iter().all(|obj| obj.is_valid()) {
+            return Err(UikaError::ObjectDestroyed);
+        }
+        let handles: Vec<UObjectHandle> = objs.iter().map(|obj| obj.raw()).collect();
+        // Same order as `new`: registration before the alive flags.
+        unsafe {
+            ffi_dispatch::lifecycle_add_gc_root_many(handles.as_ptr(), handles.len() as u32);
+            ffi_dispatch::lifecycle_register_pinned_many(handles.as_ptr(), handles.len() as u32);
+        }
+        let mut registry = lock_or_recover(alive_registry());
+        Ok(handles
+            .into_iter()
+            .map(|handle| {
+                let alive = Arc::new(AtomicBool::new(true));
+                registry.insert(handle.to_addr(), alive.clone());
+                Pinned { handle, alive, _marker: PhantomData }
+            })
+            .collect())
+    }
+
+    /// Drop a batch of pins with one registration and one root-set crossing
+    /// instead of two crossings per pin.
+    pub fn release_many(pins: Vec<Self>) {
+        let mut handles = Vec::with_capacity(pins.len());
+        {
+            let mut registry = lock_or_recover(alive_registry());
+            for pin in pins {
+                let pin = ManuallyDrop::new(pin);
+                registry.remove(&pin.handle.to_addr());
+                handles.push(pin.handle);
+                // SAFETY: `pin` is never used or dropped again.
+                drop(unsafe { std::ptr::read(&pin.alive) });
+            }
+        }
+        unsafe {
+            ffi_dispatch::lifecycle_unregister_pinned_many(handles.as_ptr(), handles.len() as u32);
+            ffi_dispatch::lifecycle_remove_gc_root_many(handles.as_ptr(), handles.len() as u32);
+        }
+    }
+
     /// Check whether the pinned object is still alive (local memory read).
     #[inline]
     pub fn is_alive(&self) -> bool {
@@ -0,0 +1,416 @@
+// PropBatch: read/write many properties of one object in a single FFI crossing.
+//
+// Build the op list once (typically cached next to the property handles),
+// then `execute` it against any number of objects. Reads land in the batch's
+// I/O buffer and are fetched through typed slots; writes are staged with
+// `set` before each execute.
+//
+// `gather`/`scatter` cover the other axis: one property across many objects,
+// copied to/from a dense (optionally strided) buffer in one crossing.
+
+use std::marker::PhantomData;
+
+use uika_ffi::{
+    FNameHandle, FPropertyHandle, UObjectHandle, UikaPropKind, UikaPropOp, UIKA_GATHER_ANY,
+    UIKA_GATHER_BOOL, UIKA_PROP_OP_READ, UIKA_PROP_OP_WRITE,
+};
+
+use crate::error::{check_ffi, UikaError, UikaResult};
+use crate::ffi_dispatch;
+
+/// A fixed-size value that can travel through a [`PropBatch`] I/O buffer.
+pub trait BatchValue: Copy {
+    /// Kind discriminant sent to C++.
+    const KIND: UikaPropKind;
+    /// Bytes reserved in the I/O buffer.
+    const SIZE: u32;
+    fn load(bytes: &[u8]) -> Self;
+    fn store(self, bytes: &mut [u8]);
+}
+
+macro_rules! impl_batch_value_num {
+    ($ty:ty, $kind:ident) => {
+        impl BatchValue for $ty {
+            const KIND: UikaPropKind = UikaPropKind::$kind;
+            const SIZE: u32 = core::mem::size_of::<$ty>() as u32;
+            #[inline]
+            fn load(bytes: &[u8]) -> Self {
+                <$ty>::from_ne_bytes(bytes[..Self::SIZE as usize].try_into().unwrap())
+            }
+            #[inline]
+            fn store(self, bytes: &mut [u8]) {
+                bytes[..Self::SIZE as usize].copy_from_slice(&self.to_ne_bytes());
+            }
+        }
+    };
+}
+
+impl_batch_value_num!(i32, I32);
+impl_batch_value_num!(i64, I64);
+impl_batch_value_num!(u8, U8);
+impl_batch_value_num!(f32, F32);
+impl_batch_value_num!(f64, F64);
+
+impl BatchValue for bool {
+    const KIND: UikaPropKind = UikaPropKind::Bool;
+    const SIZE: u32 = 1;
+    #[inline]
+    fn load(bytes: &[u8]) -> Self {
+        bytes[0] != 0
+    }
+    #[inline]
+    fn store(self, bytes: &mut [u8]) {
+        bytes[0] = self as u8;
+    }
+}
+
+impl BatchValue for FNameHandle {
+    const KIND: UikaPropKind = UikaPropKind::Name;
+    const SIZE: u32 = 8;
+    #[inline]
+    fn load(bytes: &[u8]) -> Self {
+        FNameHandle(u64::from_ne_bytes(bytes[..8].try_into().unwrap()))
+    }
+    #[inline]
+    fn store(self, bytes: &mut [u8]) {
+        bytes[..8].copy_from_slice(&self.0.to_ne_bytes());
+    }
+}
+
+impl BatchValue for UObjectHandle {
+    const KIND: UikaPropKind = UikaPropKind::Object;
+    const SIZE: u32 = core::mem::size_of::<UObjectHandle>() as u32;
+    #[inline]
+    fn load(bytes: &[u8]) -> Self {
+        UObjectHandle(usize::from_ne_bytes(bytes[..Self::SIZE as usize].try_into().unwrap())
+            as *mut std::ffi::c_void)
+    }
+    #[inline]
+    fn store(self, bytes: &mut [u8]) {
+        bytes[..Self::SIZE as usize].copy_from_slice(&(self.0 as usize).to_ne_bytes());
+    }
+}
+
+/// Typed position of a value inside a [`PropBatch`].
+#[derive(Debug)]
+pub struct PropSlot<T> {
+    index: u32,
+    _marker: PhantomData<T>,
+}
+
+impl<T> Clone for PropSlot<T> {
+    fn clone(&self) -> Self {
+        *self
+    }
+}
+impl<T> Copy for PropSlot<T> {}
+
+/// Position of a variable-size value (struct bytes or string) inside a batch.
+#[derive(Clone, Copy, Debug)]
+pub struct RawSlot {
+    index: u32,
+}
+
+/// Marker type for enum slots (values are widened to i64 on the wire).
+#[derive(Debug)]
+pub enum EnumValue {}
+
+/// A reusable list of property ops against a single object.
+#[derive(Default)]
+pub struct PropBatch {
+    ops: Vec<UikaPropOp>,
+    buf: Vec<u8>,
+}
+
+impl PropBatch {
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Number of queued ops.
+    pub fn len(&self) -> usize {
+        self.ops.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.ops.is_empty()
+    }
+
+    fn push(&mut self, prop: FPropertyHandle, kind: UikaPropKind, op: u32, size: u32) -> u32 {
+        let offset = self.buf.len() as u32;
+        self.buf.resize(self.buf.len() + size as usize, 0);
+        let index = self.ops.len() as u32;
+        self.ops.push(UikaPropOp {
+            prop,
+            kind: kind as u32,
+            op,
+            buf_offset: offset,
+            buf_size: size,
+        });
+        index
+    }
+
+    fn slot_bytes(&self, index: u32) -> &[u8] {
+        let op = &self.ops[index as usize];
+        &self.buf[op.buf_offset as usize..(op.buf_offset + op.buf_size) as usize]
+    }
+
+    fn slot_bytes_mut(&mut self, index: u32) -> &mut [u8] {
+        let op = self.ops[index as usize];
+        &mut self.buf[op.buf_offset as usize..(op.buf_offset + op.buf_size) as usize]
+    }
+
+    // -- Fixed-size values --
+
+    /// Queue a read of `prop`. Fetch the result with [`get`](Self::get) after `execute`.
+    pub fn read<T: BatchValue>(&mut self, prop: FPropertyHandle) -> PropSlot<T> {
+        let index = self.push(prop, T::KIND, UIKA_PROP_OP_READ, T::SIZE);
+        PropSlot { index, _marker: PhantomData }
+    }
+
+    /// Queue a write of `value` to `prop`. The value can be changed before a
+    /// later execute with [`set`](Self::set).
+    pub fn write<T: BatchValue>(&mut self, prop: FPropertyHandle, value: T) -> PropSlot<T> {
+        let index = self.push(prop, T::KIND, UIKA_PROP_OP_WRITE, T::SIZE);
+        value.store(self.slot_bytes_mut(index));
+        PropSlot { index, _marker: PhantomData }
+    }
+
+    /// Read the value held in a slot (result of a read, or the staged write value).
+    pub fn get<T: BatchValue>(&self, slot: PropSlot<T>) -> T {
+        T::load(self.slot_bytes(slot.index))
+    }
+
+    /// Stage a new value for a write slot.
+    pub fn set<T: BatchValue>(&mut self, slot: PropSlot<T>, value: T) {
+        value.store(self.slot_bytes_mut(slot.index));
+    }
+
+    // -- Enum (FEnumProperty or enum-backed FByteProperty) --
+
+    pub fn read_enum(&mut self, prop: FPropertyHandle) -> PropSlot<EnumValue> {
+        let index = self.push(prop, UikaPropKind::Enum, UIKA_PROP_OP_READ, 8);
+        PropSlot { index, _marker: PhantomData }
+    }
+
+    pub fn write_enum(&mut self, prop: FPropertyHandle, value: i64) -> PropSlot<EnumValue> {
+        let index = self.push(prop, UikaPropKind::Enum, UIKA_PROP_OP_WRITE, 8);
+        value.store(self.slot_bytes_mut(index));
+        PropSlot { index, _marker: PhantomData }
+    }
+
+    pub fn get_enum(&self, slot: PropSlot<EnumValue>) -> i64 {
+        i64::load(self.slot_bytes(slot.index))
+    }
+
+    pub fn set_enum(&mut self, slot: PropSlot<EnumValue>, value: i64) {
+        value.store(self.slot_bytes_mut(slot.index));
+    }
+
+    // -- Variable-size values --
+
+    /// Queue a struct read. `size` must be at least the UScriptStruct size.
+    /// Only plain-old-data structs can be batched; `execute` reports
+    /// `TypeMismatch` for any other.
+    pub fn read_struct(&mut self, prop: FPropertyHandle, size: u32) -> RawSlot {
+        RawSlot { index: self.push(prop, UikaPropKind::Struct, UIKA_PROP_OP_READ, size) }
+    }
+
+    /// Queue a struct write from raw struct bytes.
+    pub fn write_struct(&mut self, prop: FPropertyHandle, bytes: &[u8]) -> RawSlot {
+        let index = self.push(prop, UikaPropKind::Struct, UIKA_PROP_OP_WRITE, bytes.len() as u32);
+        self.slot_bytes_mut(index).copy_from_slice(bytes);
+        RawSlot { index }
+    }
+
+    /// Queue an FString/FText read of up to `max_len` UTF-8 bytes.
+    /// Longer strings make `execute` fail with `BufferTooSmall`.
+    pub fn read_string(&mut self, prop: FPropertyHandle, max_len: u32) -> RawSlot {
+        RawSlot { index: self.push(prop, UikaPropKind::String, UIKA_PROP_OP_READ, 4 + max_len) }
+    }
+
+    /// Queue an FString/FText write.
+    pub fn write_string(&mut self, prop: FPropertyHandle, value: &str) -> RawSlot {
+        let len = value.len() as u32;
+        let index = self.push(prop, UikaPropKind::String, UIKA_PROP_OP_WRITE, 4 + len);
+        let bytes = self.slot_bytes_mut(index);
+        bytes[..4].copy_from_slice(&len.to_ne_bytes());
+        bytes[4..].copy_from_slice(value.as_bytes());
+        RawSlot { index }
+    }
+
+    /// Raw bytes of a struct slot.
+    pub fn struct_bytes(&self, slot: RawSlot) -> &[u8] {
+        self.slot_bytes(slot.index)
+    }
+
+    /// Decoded contents of a string slot.
+    pub fn string(&self, slot: RawSlot) -> String {
+        let bytes = self.slot_bytes(slot.index);
+        let len = u32::from_ne_bytes(bytes[..4].try_into().unwrap()) as usize;
+        let len = len.min(bytes.len() - 4);
+        String::from_utf8_lossy(&bytes[4..4 + len]).into_owned()
+    }
+
+    /// Run every queued op against `obj` in one crossing. Stops at the first
+    /// failing op; ops before it have already been applied.
+    pub fn execute(&mut self, obj: UObjectHandle) -> UikaResult<()> {
+        if self.ops.is_empty() {
+            return Ok(());
+        }
+        check_ffi(unsafe {
+            ffi_dispatch::property_batch(
+                obj,
+                self.ops.as_ptr(),
+                self.ops.len() as u32,
+                self.buf.as_mut_ptr(),
+            )
+        })
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Gather / scatter
+// ---------------------------------------------------------------------------
+
+/// The element check C++ runs for `T` in the same crossing: a bool property
+/// for `bool`, a non-bool one of exactly `size_of::<T>()` bytes otherwise.
+fn expected_element<T: BatchValue>() -> u32 {
+    if T::KIND == UikaPropKind::Bool {
+        UIKA_GATHER_BOOL
+    } else {
+        core::mem::size_of::<T>() as u32
+    }
+}
+
+/// Read `prop` from every object into a dense `Vec<T>`. Null handles yield
+/// zeroed values. `T` must have the property's element size (e.g. `f32` for
+/// a float property, `bool` for a bool property); `TypeMismatch` otherwise.
+pub fn gather<T: BatchValue>(objs: &[UObjectHandle], prop: FPropertyHandle) -> UikaResult<Vec<T>> {
+    let mut out: Vec<T> = Vec::with_capacity(objs.len());
+    unsafe {
+        // All-zero bytes are a valid value of every BatchValue type.
+        core::ptr::write_bytes(out.as_mut_ptr(), 0, objs.len());
+        check_ffi(ffi_dispatch::property_gather(
+            objs.as_ptr(),
+            objs.len() as u32,
+            prop,
+            out.as_mut_ptr() as *mut u8,
+            core::mem::size_of::<T>() as u32,
+            expected_element::<T>(),
+        ))?;
+        // SAFETY: the buffer was zeroed and C++ wrote one whole element of
+        // exactly `size_of::<T>()` bytes per object (bool as 0/1).
+        out.set_len(objs.len());
+    }
+    Ok(out)
+}
+
+/// Write `values[i]` into `prop` on `objs[i]`. Null handles are skipped.
+/// `objs` and `values` must have the same length; nothing is written
+/// otherwise.
+pub fn scatter<T: BatchValue>(objs: &[UObjectHandle], prop: FPropertyHandle, values: &[T]) -> UikaResult<()> {
+    if objs.len() != values.len() {
+        return Err(UikaError::InvalidOperation(format!(
+            "scatter of {} values onto {} objects",
+            values.len(),
+            objs.len()
+        )));
+    }
+    check_ffi(unsafe {
+        ffi_dispatch::property_scatter(
+            objs.as_ptr(),
+            objs.len() as u32,
+            prop,
+            values.as_ptr() as *const u8,
+            core::mem::size_of::<T>() as u32,
+            expected_element::<T>(),
+        )
+    })
+}
+
+/// Strided gather into caller-owned memory (e.g. one field of an SoA/AoS
+/// buffer, or plain-old-data struct properties). `stride` 0 means the element
+/// size; each slot receives exactly the element size in bytes.
+///
+/// # Safety
+/// `out` must be writable for `objs.len()` elements at `stride` bytes apart.
+pub unsafe fn gather_raw(
+    objs: &[UObjectHandle],
+    prop: FPropertyHandle,
+    out: *mut u8,
+    stride: u32,
+) -> UikaResult<()> {
+    check_ffi(unsafe {
+        ffi_dispatch::property_gather(objs.as_ptr(), objs.len() as u32, prop, out, stride, UIKA_GATHER_ANY)
+    })
+}
+
+/// Strided scatter from caller-owned memory. `stride` 0 means the element size.
+///
+/// # Safety
+/// `input` must be readable for `objs.len()` elements at `stride` bytes apart.
+pub unsafe fn scatter_raw(
+    objs: &[UObjectHandle],
+    prop: FPropertyHandle,
+    input: *const u8,
+    stride: u32,
+) -> UikaResult<()> {
+    check_ffi(unsafe {
+        ffi_dispatch::property_scatter(objs.as_ptr(), objs.len() as u32, prop, input, stride, UIKA_GATHER_ANY)
+    })
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn ops_are_packed_in_declaration_order() {
+        let mut batch = PropBatch::new();
+        let a = batch.read::<f32>(FPropertyHandle::null());
+        let b = batch.write::<bool>(FPropertyHandle::null(), true);
+        let c = batch.read_string(FPropertyHandle::null(), 16);
+        assert_eq!(batch.len(), 3);
+        assert_eq!(batch.ops[a.index as usize].buf_offset, 0);
+        assert_eq!(batch.ops[b.index as usize].buf_offset, 4);
+        assert_eq!(batch.ops[c.index as usize].buf_offset, 5);
+        assert_eq!(batch.ops[c.index as usize].buf_size, 20);
+        assert_eq!(batch.buf.len(), 25);
+    }
+
+    #[test]
+    fn staged_values_round_trip() {
+        let mut batch = PropBatch::new();
+        let f = batch.write(FPropertyHandle::null(), 1.5f64);
+        let e = batch.write_enum(FPropertyHandle::null(), -3);
+        let s = batch.write_string(FPropertyHandle::null(), "hello");
+        assert_eq!(batch.get(f), 1.5);
+        batch.set(f, -2.0);
+        assert_eq!(batch.get(f), -2.0);
+        assert_eq!(batch.get_enum(e), -3);
+        assert_eq!(batch.string(s), "hello");
+        assert_eq!(batch.ops[f.index as usize].op, UIKA_PROP_OP_WRITE);
+    }
+
+    #[test]
+    fn scatter_rejects_mismatched_lengths() {
+        let objs = [UObjectHandle::null(); 2];
+        assert!(matches!(
+            scatter(&objs, FPropertyHandle::null(), &[1.0f32]),
+            Err(UikaError::InvalidOperation(_))
+        ));
+    }
+
+    #[test]
+    fn gather_element_must_match_property() {
+        assert_eq!(expected_element::<f32>(), 4);
+        assert_eq!(expected_element::<f64>(), 8);
+        assert_eq!(expected_element::<FNameHandle>(), 8);
+        assert_eq!(expected_element::<UObjectHandle>(), 8);
+        // A u8 must not read a bool property, nor a bool a u8 one.
+        assert_eq!(expected_element::<u8>(), 1);
+        assert_eq!(expected_element::<bool>(), UIKA_GATHER_BOOL);
+        assert_ne!(expected_element::<bool>(), UIKA_GATHER_ANY);
+    }
+}
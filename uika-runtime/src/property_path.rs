@@ -0,0 +1,160 @@
+// PropertyPath<T>: a dotted property path resolved once into a leaf property
+// and a byte offset from the object base.
+//
+// Struct properties and fixed-array elements are stored inline, so
+// `"Transform.Translation.X"` collapses to one offset. POD and bool leaves are
+// then read or written directly (no crossing); object leaves go through
+// `property.get_at_offset` / `set_at_offset`, which touch only the leaf
+// element — never a `get_struct` copy of the enclosing structs. Other leaves
+// (strings, non-POD structs, containers) are not supported.
+//
+// Resolve once and cache, like generated property handles:
+//
+// ```ignore
+// static X: OnceLock<PropertyPath<Actor>> = OnceLock::new();
+// let x = X.get_or_init(|| PropertyPath::resolve("Transform.Translation.X").unwrap());
+// let v: f64 = x.get(actor)?;
+// ```
+
+use std::marker::PhantomData;
+use std::mem::{size_of, MaybeUninit};
+
+use uika_ffi::{FPropertyHandle, UObjectHandle, UikaFieldDesc};
+
+use crate::error::{check_ffi, UikaError, UikaResult};
+use crate::ffi_dispatch;
+use crate::field_desc::FieldDesc;
+use crate::object_ref::UObjectRef;
+use crate::traits::UeClass;
+
+/// A resolved path into instances of `T` (or subclasses).
+pub struct PropertyPath<T: UeClass> {
+    leaf: FPropertyHandle,
+    field: FieldDesc,
+    _marker: PhantomData<fn() -> T>,
+}
+
+impl<T: UeClass> Clone for PropertyPath<T> {
+    fn clone(&self) -> Self {
+        *self
+    }
+}
+
+impl<T: UeClass> Copy for PropertyPath<T> {}
+
+// Only holds an FFI handle and a plain layout descriptor.
+unsafe impl<T: UeClass> Send for PropertyPath<T> {}
+unsafe impl<T: UeClass> Sync for PropertyPath<T> {}
+
+impl<T: UeClass> PropertyPath<T> {
+    /// Resolve `path` (`"Stats.Health"`, `"Slots[2].Count"`) against `T`.
+    pub fn resolve(path: &str) -> UikaResult<Self> {
+        let mut leaf = FPropertyHandle::null();
+        let mut raw = UikaFieldDesc::default();
+        check_ffi(unsafe {
+            ffi_dispatch::reflection_resolve_property_path(
+                T::static_class(),
+                path.as_ptr(),
+                path.len() as u32,
+                &mut leaf,
+                &mut raw,
+            )
+        })?;
+        Ok(PropertyPath { leaf, field: FieldDesc::from_raw(raw), _marker: PhantomData })
+    }
+
+    /// The leaf FProperty.
+    #[inline]
+    pub fn leaf(&self) -> FPropertyHandle {
+        self.leaf
+    }
+
+    /// Layout of the leaf; `offset()` is measured from the object base.
+    #[inline]
+    pub fn field(&self) -> &FieldDesc {
+        &self.field
+    }
+
+    /// Read the leaf as `V`, which must match the leaf's element layout
+    /// (`f64` for a double, `UObjectHandle` for an object, ...). Leaves that
+    /// are neither POD nor objects are `TypeMismatch`.
+    pub fn get<V: Copy>(&self, obj: UObjectRef<T>) -> UikaResult<V> {
+        let h = obj.checked()?.raw();
+        if self.field.is_direct::<V>() {
+            // SAFETY: `obj` is a live `T` and the path was resolved on `T`.
+            return Ok(unsafe { self.field.read::<V>(h) });
+        }
+        self.check_object::<V>()?;
+        let mut out = MaybeUninit::<V>::uninit();
+        check_ffi(unsafe {
+            ffi_dispatch::property_get_at_offset(
+                h,
+                self.leaf,
+                self.field.offset(),
+                out.as_mut_ptr() as *mut u8,
+                size_of::<V>() as u32,
+            )
+        })?;
+        // SAFETY: C++ wrote one object handle, whose size is `V`'s.
+        Ok(unsafe { out.assume_init() })
+    }
+
+    /// Write the leaf from `value` (same layout rules as [`get`](Self::get)).
+    pub fn set<V: Copy>(&self, obj: UObjectRef<T>, value: V) -> UikaResult<()> {
+        let h = obj.checked()?.raw();
+        if self.field.is_direct::<V>() {
+            // SAFETY: as in `get`.
+            unsafe { self.field.write::<V>(h, value) };
+            return Ok(());
+        }
+        self.check_object::<V>()?;
+        check_ffi(unsafe {
+            ffi_dispatch::property_set_at_offset(
+                h,
+                self.leaf,
+                self.field.offset(),
+                &value as *const V as *const u8,
+                size_of::<V>() as u32,
+            )
+        })
+    }
+
+    /// Read a bool (native or bit-field) leaf.
+    pub fn get_bool(&self, obj: UObjectRef<T>) -> UikaResult<bool> {
+        let h = obj.checked()?.raw();
+        if !self.field.is_bool() {
+            return Err(UikaError::TypeMismatch);
+        }
+        // SAFETY: as in `get`.
+        Ok(unsafe { self.field.read_bool(h) })
+    }
+
+    /// Write a bool (native or bit-field) leaf.
+    pub fn set_bool(&self, obj: UObjectRef<T>, value: bool) -> UikaResult<()> {
+        let h = obj.checked()?.raw();
+        if !self.field.is_bool() {
+            return Err(UikaError::TypeMismatch);
+        }
+        // SAFETY: as in `get`.
+        unsafe { self.field.write_bool(h, value) };
+        Ok(())
+    }
+
+    /// The only leaves left for the FFI path are objects, read and written
+    /// as a `UObjectHandle`.
+    fn check_object<V>(&self) -> UikaResult<()> {
+        if !self.field.is_object() || size_of::<V>() != size_of::<UObjectHandle>() {
+            return Err(UikaError::TypeMismatch);
+        }
+        Ok(())
+    }
+}
+
+impl<T: UeClass> std::fmt::Debug for PropertyPath<T> {
+    fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+        f.debug_struct("PropertyPath")
+            .field("leaf", &self.leaf)
+            .field("offset", &self.field.offset())
+            .finish()
+    }
+}
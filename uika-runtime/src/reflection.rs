@@ -0,0 +1,202 @@
+// Reflection batch resolution: resolve many class/struct/property/function
+// handles in one FFI call through the C++ reflection cache.
+//
+// Generated bindings use `prefetch_classes` / `prefetch_structs` at startup to
+// fill their `OnceLock` handle caches in one batch per module instead of one
+// lookup per type on first use.
+
+use std::ffi::c_void;
+use std::sync::OnceLock;
+
+use uika_ffi::{
+    FPropertyHandle, UClassHandle, UFunctionHandle, UStructHandle, UikaResolveKind, UikaResolveReq,
+    UikaStrView, UIKA_RESOLVE_NO_OWNER_INDEX,
+};
+
+use crate::ffi_dispatch;
+
+/// Owner of a member lookup: a known handle, or the result of an earlier
+/// entry in the same `Resolver` batch.
+#[derive(Clone, Copy, Debug)]
+pub enum ResolveOwner {
+    Handle(*mut c_void),
+    Entry(usize),
+}
+
+impl From<UClassHandle> for ResolveOwner {
+    fn from(h: UClassHandle) -> Self {
+        ResolveOwner::Handle(h.0)
+    }
+}
+
+impl From<UStructHandle> for ResolveOwner {
+    fn from(h: UStructHandle) -> Self {
+        ResolveOwner::Handle(h.0)
+    }
+}
+
+impl From<UFunctionHandle> for ResolveOwner {
+    fn from(h: UFunctionHandle) -> Self {
+        ResolveOwner::Handle(h.0)
+    }
+}
+
+/// Builder for a `reflection.resolve_many` batch. Each `add_*` call returns
+/// the entry index used to read the result after `resolve`.
+pub struct Resolver<'a> {
+    reqs: Vec<UikaResolveReq>,
+    _names: std::marker::PhantomData<&'a str>,
+}
+
+impl<'a> Resolver<'a> {
+    pub fn new() -> Self {
+        Self::with_capacity(0)
+    }
+
+    pub fn with_capacity(n: usize) -> Self {
+        Resolver { reqs: Vec::with_capacity(n), _names: std::marker::PhantomData }
+    }
+
+    pub fn len(&self) -> usize {
+        self.reqs.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.reqs.is_empty()
+    }
+
+    fn push(&mut self, kind: UikaResolveKind, owner: Option<ResolveOwner>, name: &'a str) -> usize {
+        let (owner_ptr, owner_index) = match owner {
+            None => (std::ptr::null_mut(), UIKA_RESOLVE_NO_OWNER_INDEX),
+            Some(ResolveOwner::Handle(p)) => (p, UIKA_RESOLVE_NO_OWNER_INDEX),
+            Some(ResolveOwner::Entry(i)) => (std::ptr::null_mut(), i as u32),
+        };
+        self.reqs.push(UikaResolveReq {
+            kind: kind as u32,
+            owner_index,
+            owner: owner_ptr,
+            name: UikaStrView::new(name),
+            result: std::ptr::null_mut(),
+        });
+        self.reqs.len() - 1
+    }
+
+    pub fn add_class(&mut self, name: &'a str) -> usize {
+        self.push(UikaResolveKind::Class, None, name)
+    }
+
+    pub fn add_struct(&mut self, name: &'a str) -> usize {
+        self.push(UikaResolveKind::Struct, None, name)
+    }
+
+    pub fn add_property(&mut self, class: impl Into<ResolveOwner>, name: &'a str) -> usize {
+        self.push(UikaResolveKind::Property, Some(class.into()), name)
+    }
+
+    pub fn add_struct_property(&mut self, ustruct: impl Into<ResolveOwner>, name: &'a str) -> usize {
+        self.push(UikaResolveKind::StructProperty, Some(ustruct.into()), name)
+    }
+
+    pub fn add_function(&mut self, class: impl Into<ResolveOwner>, name: &'a str) -> usize {
+        self.push(UikaResolveKind::Function, Some(class.into()), name)
+    }
+
+    pub fn add_function_param(&mut self, func: impl Into<ResolveOwner>, name: &'a str) -> usize {
+        self.push(UikaResolveKind::FunctionParam, Some(func.into()), name)
+    }
+
+    /// Resolve every entry in one FFI call. Returns the number of entries
+    /// that resolved to a non-null handle.
+    pub fn resolve(&mut self) -> usize {
+        if self.reqs.is_empty() {
+            return 0;
+        }
+        unsafe { ffi_dispatch::reflection_resolve_many(self.reqs.as_mut_ptr(), self.reqs.len() as u32) as usize }
+    }
+
+    #[inline]
+    fn raw(&self, index: usize) -> *mut c_void {
+        self.reqs.get(index).map_or(std::ptr::null_mut(), |r| r.result)
+    }
+
+    pub fn class(&self, index: usize) -> UClassHandle {
+        UClassHandle(self.raw(index))
+    }
+
+    pub fn ustruct(&self, index: usize) -> UStructHandle {
+        UStructHandle(self.raw(index))
+    }
+
+    pub fn property(&self, index: usize) -> FPropertyHandle {
+        FPropertyHandle(self.raw(index))
+    }
+
+    pub fn function(&self, index: usize) -> UFunctionHandle {
+        UFunctionHandle(self.raw(index))
+    }
+}
+
+impl Default for Resolver<'_> {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+/// Fill uninitialized class handle caches in one batch. Null results are
+/// left unset so the lazy lookup can retry later.
+pub fn prefetch_classes(entries: &[(&OnceLock<UClassHandle>, &str)]) {
+    let mut resolver = Resolver::with_capacity(entries.len());
+    let mut pending = Vec::with_capacity(entries.len());
+    for &(cache, name) in entries {
+        if cache.get().is_none() {
+            pending.push((cache, resolver.add_class(name)));
+        }
+    }
+    if resolver.resolve() == 0 {
+        return;
+    }
+    for (cache, index) in pending {
+        let handle = resolver.class(index);
+        if !handle.is_null() {
+            let _ = cache.set(handle);
+        }
+    }
+}
+
+/// Fill uninitialized struct handle caches in one batch (see `prefetch_classes`).
+pub fn prefetch_structs(entries: &[(&OnceLock<UStructHandle>, &str)]) {
+    let mut resolver = Resolver::with_capacity(entries.len());
+    let mut pending = Vec::with_capacity(entries.len());
+    for &(cache, name) in entries {
+        if cache.get().is_none() {
+            pending.push((cache, resolver.add_struct(name)));
+        }
+    }
+    if resolver.resolve() == 0 {
+        return;
+    }
+    for (cache, index) in pending {
+        let handle = resolver.ustruct(index);
+        if !handle.is_null() {
+            let _ = cache.set(handle);
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn entries_chain_to_earlier_results() {
+        let mut r = Resolver::new();
+        let cls = r.add_class("Actor");
+        let func = r.add_function(ResolveOwner::Entry(cls), "K2_GetActorLocation");
+        let param = r.add_function_param(ResolveOwner::Entry(func), "ReturnValue");
+        assert_eq!(r.reqs[cls].owner_index, UIKA_RESOLVE_NO_OWNER_INDEX);
+        assert_eq!(r.reqs[func].owner_index, cls as u32);
+        assert_eq!(r.reqs[param].owner_index, func as u32);
+        assert_eq!(r.reqs[param].kind, UikaResolveKind::FunctionParam as u32);
+        assert!(r.property(99).is_null());
+    }
+}
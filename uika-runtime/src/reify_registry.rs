@@ -2,12 +2,15 @@
 // for runtime-created UE classes.
 //
 // Three registries:
-// 1. Type registry: maps type_id -> RustTypeInfo (constructor, destructor, name)
+// 1. Type registry: maps type_id -> RustTypeInfo (constructor, destructor, name,
+//    optional hot-reload snapshot hooks)
 // 2. Function registry: maps callback_id -> Rust function closure
-// 3. Instance data: maps UObject pointer -> allocated Rust data
+// 3. Instance data: maps UObject pointer -> allocated Rust data (lifecycle
+//    paths; function calls and class ticks read the pointer C++ keeps in the
+//    object's instance slot)
 
 use std::collections::HashMap;
-use std::sync::{Arc, Mutex, OnceLock, RwLock};
+use std::sync::{Mutex, OnceLock, RwLock};
 
 use crate::{lock_or_recover, read_or_recover, write_or_recover};
 
@@ -15,48 +18,92 @@ use crate::{lock_or_recover, read_or_recover, write_or_recover};
 // Inventory-based auto-registration
 // ---------------------------------------------------------------------------
 
-/// Submitted by `#[uclass]` — holds register + finalize fn pointers.
+/// Submitted by `#[uclass]`.
 pub struct ClassRegistration {
-    pub register: fn(),
-    pub finalize: fn(),
+    /// UE class name.
+    pub name: &'static str,
+    /// UE name of the parent class (native or another `#[uclass]`).
+    pub parent_name: &'static str,
+    /// Rust type id, shared with the class's `ClassFunctionRegistration`s.
+    pub type_id: u64,
+    /// Register the Rust type info and describe the class (properties,
+    /// default subobjects) into the schema.
+    pub describe: fn(&mut ClassSchema),
 }
 inventory::collect!(ClassRegistration);
 
-/// Submitted by `#[uclass_impl]` — holds register_functions fn pointer.
+/// Submitted by `#[uclass_impl]` — describes the functions of one impl block.
 pub struct ClassFunctionRegistration {
-    pub register_functions: fn(),
+    pub type_id: u64,
+    pub describe_functions: fn(&mut ClassSchema),
 }
 inventory::collect!(ClassFunctionRegistration);
 
-/// Three-phase iteration: register all → register all functions → finalize all.
+/// Describe every inventory class (with the functions of all of its impl
+/// blocks) into one schema and register it in a single crossing.
 pub fn register_all_from_inventory() {
-    let mut class_count = 0u32;
-    for reg in inventory::iter::<ClassRegistration> {
-        (reg.register)();
-        class_count += 1;
-    }
+    let mut functions: HashMap<u64, Vec<fn(&mut ClassSchema)>> = HashMap::new();
     let mut func_reg_count = 0u32;
     for freg in inventory::iter::<ClassFunctionRegistration> {
-        (freg.register_functions)();
+        functions.entry(freg.type_id).or_default().push(freg.describe_functions);
         func_reg_count += 1;
     }
-    for reg in inventory::iter::<ClassRegistration> {
-        (reg.finalize)();
+
+    // Parents registered by Rust must come before their subclasses.
+    let mut classes: Vec<&ClassRegistration> = inventory::iter::<ClassRegistration>.into_iter().collect();
+    let depth = |reg: &ClassRegistration| {
+        let mut depth = 0usize;
+        let mut parent = reg.parent_name;
+        while let Some(p) = classes.iter().find(|c| c.name == parent) {
+            depth += 1;
+            parent = p.parent_name;
+            if depth > classes.len() {
+                break; // cycle; let registration report it
+            }
+        }
+        depth
+    };
+    let mut ordered: Vec<(usize, &ClassRegistration)> = classes.iter().map(|c| (depth(c), *c)).collect();
+    ordered.sort_by_key(|(d, _)| *d);
+    classes = ordered.into_iter().map(|(_, c)| c).collect();
+
+    let mut schema = ClassSchema::new();
+    for reg in &classes {
+        let before = schema.class_count();
+        (reg.describe)(&mut schema);
+        if schema.class_count() == before {
+            continue;
+        }
+        for describe_functions in functions.get(&reg.type_id).into_iter().flatten() {
+            describe_functions(&mut schema);
+        }
     }
+    let described = schema.class_count();
+    let result = schema.submit();
 
     // Log registration summary (helps diagnose hot-reload issues).
-    let total_funcs = read_or_recover(func_registry()).len();
+    let total_funcs = FUNC_REGISTRY.len();
     let msg = format!(
-        "[Uika] register_all_from_inventory: {} classes, {} impl blocks, {} function callbacks",
-        class_count, func_reg_count, total_funcs,
+        "[Uika] register_all_from_inventory: {} of {} classes described, {} impl blocks, {} function callbacks{}",
+        described,
+        classes.len(),
+        func_reg_count,
+        total_funcs,
+        if result.is_ok() { "" } else { " (registration reported errors)" },
     );
     let bytes = msg.as_bytes();
     unsafe {
-        crate::ffi_dispatch::logging_log(0, bytes.as_ptr(), bytes.len() as u32);
+        crate::ffi_dispatch::logging_log(if result.is_ok() { 0 } else { 1 }, bytes.as_ptr(), bytes.len() as u32);
     }
 }
 
-use uika_ffi::UObjectHandle;
+use uika_ffi::{UClassHandle, UObjectHandle, UikaDeadInstance, UikaErrorCode};
+
+use crate::class_schema::ClassSchema;
+use crate::error::{check_ffi, UikaResult};
+use crate::hot_snapshot::{SnapshotFields, SnapshotView, SnapshotWriter};
+use crate::object_ref::UObjectRef;
+use crate::traits::UeClass;
 
 /// Information about a Rust type registered for reification.
 pub struct RustTypeInfo {
@@ -67,23 +114,78 @@ pub struct RustTypeInfo {
     pub construct_fn: fn() -> *mut u8,
     /// Drop and deallocate an instance previously created by `construct_fn`.
     pub drop_fn: unsafe fn(*mut u8),
+    /// Hot-reload state hooks; `Some` only for `#[uclass(..., snapshot)]`.
+    pub snapshot: Option<SnapshotFns>,
+    /// Actor-pool hooks; `Some` only for `#[uclass(..., pooled)]`.
+    pub pool: Option<PoolFns>,
+    /// Class tick; `Some` only for `#[uclass(..., batch_tick)]`.
+    pub batch_tick: Option<unsafe fn(&mut [TickInstance], f32)>,
+}
+
+/// One instance in a class tick batch. `#[uclass]` handle structs share this
+/// layout, so the generated code reinterprets the batch as `&mut [Self]`.
+pub type TickInstance = uika_ffi::UikaTickInstance;
+
+/// Class-level tick for `#[uclass(parent = Actor, batch_tick)]`.
+///
+/// Instead of a per-actor `ReceiveTick`, the class registers one tick
+/// function per world (`reify.enable_class_tick`) and receives every
+/// instance that is in play in one call, in no particular order. The slice
+/// is rebuilt every frame; do not keep it. Instances are raw handles and
+/// stay game-thread only; to spread work across workers, gather plain data
+/// from them first and run it through `jobs::parallel_for`.
+pub trait BatchTick: Sized {
+    /// Tick group (`UIKA_TICK_GROUP_*`).
+    const TICK_GROUP: u32 = uika_ffi::UIKA_TICK_GROUP_PRE_PHYSICS;
+
+    fn tick_batch(instances: &mut [Self], delta_seconds: f32);
 }
 
-use crate::ffi_dispatch::NativePtr;
+/// Per-type actor-pool hooks generated by `#[uclass(..., pooled)]`; they
+/// forward to the type's [`PoolHooks`] impl.
+#[derive(Clone, Copy)]
+pub struct PoolFns {
+    pub acquire: unsafe fn(UObjectHandle, *mut u8),
+    pub release: unsafe fn(UObjectHandle, *mut u8),
+}
+
+/// Lifecycle hooks for reified actors recycled through the world actor pool
+/// (`#[uclass(parent = Actor, pooled)]`).
+///
+/// A pooled instance keeps its Rust data across release/acquire, so these
+/// hooks replace construction and drop: reset per-use state in
+/// `on_pool_acquire` and let go of per-use resources in `on_pool_release`.
+/// `on_pool_acquire` only runs for a recycled actor; one spawned because the
+/// pool was empty is freshly constructed. Types without `pooled` get no
+/// hooks and keep their Rust state across the cycle.
+pub trait PoolHooks {
+    fn on_pool_acquire(&mut self) {}
+    fn on_pool_release(&mut self) {}
+}
+
+/// Per-type hot-reload hooks generated by `#[uclass(..., snapshot)]`.
+pub struct SnapshotFns {
+    /// Write the fields of an instance created by `construct_fn`.
+    pub save: unsafe fn(*const u8, &mut SnapshotWriter),
+    /// Overwrite the matching fields of a freshly constructed instance.
+    pub restore: unsafe fn(*mut u8, &SnapshotFields<'_>),
+}
+
+use crate::ffi_dispatch::{self, NativePtr};
+use crate::slab::CallbackSlab;
 
 // Type for reify function callbacks: (obj, rust_data, params)
-// Uses Arc so we can clone the reference out of the registry and release
-// the lock before invoking the callback (prevents deadlock if the callback
-// makes FFI calls that re-enter Rust).
+// Stored in a lock-free slab and called in place, so a callback may make FFI
+// calls that re-enter Rust (including itself).
 // `params` is an opaque FFI buffer pointer (`NativePtr` = `*mut u8`).
-type ReifyFunctionCallback = Arc<dyn Fn(UObjectHandle, *mut u8, NativePtr) + Send + Sync>;
+type ReifyFunctionCallback = Box<dyn Fn(UObjectHandle, *mut u8, NativePtr) + Send + Sync>;
 
 // ---------------------------------------------------------------------------
 // Statics
 // ---------------------------------------------------------------------------
 
 static TYPE_REGISTRY: OnceLock<Mutex<HashMap<u64, RustTypeInfo>>> = OnceLock::new();
-static FUNC_REGISTRY: OnceLock<RwLock<Vec<ReifyFunctionCallback>>> = OnceLock::new();
+static FUNC_REGISTRY: CallbackSlab<ReifyFunctionCallback> = CallbackSlab::new();
 static INSTANCE_DATA: OnceLock<RwLock<HashMap<u64, InstanceEntry>>> = OnceLock::new();
 
 struct InstanceEntry {
@@ -99,10 +201,6 @@ fn type_registry() -> &'static Mutex<HashMap<u64, RustTypeInfo>> {
     TYPE_REGISTRY.get_or_init(|| Mutex::new(HashMap::new()))
 }
 
-fn func_registry() -> &'static RwLock<Vec<ReifyFunctionCallback>> {
-    FUNC_REGISTRY.get_or_init(|| RwLock::new(Vec::new()))
-}
-
 fn instance_data() -> &'static RwLock<HashMap<u64, InstanceEntry>> {
     INSTANCE_DATA.get_or_init(|| RwLock::new(HashMap::new()))
 }
@@ -126,19 +224,17 @@ pub fn register_function<F>(f: F) -> u64
 where
     F: Fn(UObjectHandle, *mut u8, NativePtr) + Send + Sync + 'static,
 {
-    let mut vec = write_or_recover(func_registry());
-    let id = vec.len() as u64;
-    vec.push(Arc::new(f));
-    id
+    FUNC_REGISTRY.insert(Box::new(f))
 }
 
 // ---------------------------------------------------------------------------
 // Instance lifecycle
 // ---------------------------------------------------------------------------
 
-/// Construct a Rust instance for a newly created UObject.
+/// Construct a Rust instance for a newly created UObject and return its data
+/// pointer (null for an unknown type), which C++ stores in the object's slot.
 /// Called from the C++ class constructor via `construct_rust_instance` callback.
-pub fn construct_instance(obj: UObjectHandle, type_id: u64) {
+pub fn construct_instance(obj: UObjectHandle, type_id: u64) -> *mut u8 {
     let types = lock_or_recover(type_registry());
     let Some(info) = types.get(&type_id) else {
         // Log warning — type not registered (might be a CDO before registration completes)
@@ -149,14 +245,17 @@ pub fn construct_instance(obj: UObjectHandle, type_id: u64) {
                 crate::ffi_dispatch::logging_log(1, bytes.as_ptr(), bytes.len() as u32);
             }
         }
-        return;
+        return std::ptr::null_mut();
     };
     let data = (info.construct_fn)();
     drop(types); // Release lock before acquiring instance_data lock
 
+    // The map backs lifecycle paths keyed by handle (drop, pool, snapshot,
+    // `from_obj`); calls and ticks get `data` from the slot instead.
     let key = obj.to_addr();
     write_or_recover(instance_data())
         .insert(key, InstanceEntry { data, type_id });
+    data
 }
 
 /// Drop and remove the Rust instance for a destroyed UObject.
@@ -175,32 +274,90 @@ pub fn drop_instance(obj: UObjectHandle, _type_id: u64) {
     }
 }
 
-/// Invoke a registered Rust function callback.
-/// Called from the C++ thunk via `invoke_rust_function` callback.
-pub fn invoke_function(callback_id: u64, obj: UObjectHandle, params: NativePtr) {
-    let key = obj.to_addr();
+/// Batched [`drop_instance`]: removes every entry under one write lock, then
+/// runs the drop functions with no registry lock held.
+/// Called from the C++ object tracker via `drop_rust_instances` after a GC purge.
+pub fn drop_instances(dead: &[UikaDeadInstance]) {
+    let entries: Vec<InstanceEntry> = {
+        let mut data = write_or_recover(instance_data());
+        dead.iter().filter_map(|d| data.remove(&d.handle.to_addr())).collect()
+    };
+    if entries.is_empty() {
+        return;
+    }
+    let types = lock_or_recover(type_registry());
+    for entry in entries {
+        if let Some(info) = types.get(&entry.type_id) {
+            unsafe {
+                (info.drop_fn)(entry.data);
+            }
+        }
+    }
+}
 
-    // Look up instance data for this object (read lock — non-exclusive).
-    let rust_data = read_or_recover(instance_data())
-        .get(&key)
-        .map(|e| e.data)
-        .unwrap_or(std::ptr::null_mut());
-
-    // Clone the callback Arc out of the registry and release the read lock
-    // BEFORE invoking the callback. This prevents deadlocks if the callback
-    // makes FFI calls that re-enter Rust.
-    let func = {
-        let vec = read_or_recover(func_registry());
-        vec.get(callback_id as usize).cloned()
+// ---------------------------------------------------------------------------
+// Actor pooling
+// ---------------------------------------------------------------------------
+
+/// Look up the instance data and pool behaviour of `obj`, releasing every
+/// lock before returning so the hooks may re-enter the registry.
+fn pool_target(obj: UObjectHandle, type_id: u64) -> Option<(*mut u8, PoolFns)> {
+    let data = read_or_recover(instance_data()).get(&obj.to_addr()).map(|e| e.data)?;
+    let pool = lock_or_recover(type_registry()).get(&type_id)?.pool?;
+    Some((data, pool))
+}
+
+/// A reified actor left play through the actor pool.
+/// Called from C++ via the `on_pool_release` callback.
+pub fn pool_release_instance(obj: UObjectHandle, type_id: u64) {
+    if let Some((data, pool)) = pool_target(obj, type_id) {
+        unsafe { (pool.release)(obj, data) };
+    }
+}
+
+/// A pooled reified actor was recycled back into play. Types without
+/// `#[uclass(..., pooled)]` hooks are left untouched.
+/// Called from C++ via the `on_pool_acquire` callback.
+pub fn pool_acquire_instance(obj: UObjectHandle, type_id: u64) {
+    if let Some((data, pool)) = pool_target(obj, type_id) {
+        unsafe { (pool.acquire)(obj, data) };
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Class tick
+// ---------------------------------------------------------------------------
+
+/// Opt `cls` into the class tick (see [`BatchTick`]).
+pub fn enable_class_tick(cls: UClassHandle, tick_group: u32) -> UikaResult<()> {
+    check_ffi(unsafe { ffi_dispatch::reify_enable_class_tick(cls, tick_group) })
+}
+
+/// Run the class tick of `type_id` over `instances` (handles and data
+/// pointers read from the instance slots by C++, all of type `type_id`).
+/// Called from C++ via the `tick_class` callback.
+pub fn tick_class(type_id: u64, instances: &mut [TickInstance], delta_seconds: f32) {
+    let Some(tick) = lock_or_recover(type_registry()).get(&type_id).and_then(|t| t.batch_tick) else {
+        return;
     };
+    if !instances.is_empty() {
+        unsafe { tick(instances, delta_seconds) };
+    }
+}
+
+/// Invoke a registered Rust function callback. `rust_data` comes from the
+/// object's instance slot; the handle-keyed map is only consulted when the
+/// slot is empty.
+/// Called from the C++ thunk via `invoke_rust_function` callback.
+pub fn invoke_function(callback_id: u64, obj: UObjectHandle, rust_data: *mut u8, params: NativePtr) {
+    let rust_data = if rust_data.is_null() { get_instance_data(obj) } else { rust_data };
 
-    if let Some(func) = func {
-        func(obj, rust_data, params);
-    } else if crate::api::is_api_initialized() {
-        let vec_len = read_or_recover(func_registry()).len();
+    let called = FUNC_REGISTRY.call(callback_id, |func| func(obj, rust_data, params));
+    if called.is_none() && crate::api::is_api_initialized() {
         let msg = format!(
-            "[Uika] invoke_function: callback_id {} not found (registry size = {})",
-            callback_id, vec_len,
+            "[Uika] invoke_function: callback_id {:#x} not found (registry size = {})",
+            callback_id,
+            FUNC_REGISTRY.len(),
         );
         let bytes = msg.as_bytes();
         unsafe {
@@ -209,6 +366,54 @@ pub fn invoke_function(callback_id: u64, obj: UObjectHandle, params: NativePtr)
     }
 }
 
+// ---------------------------------------------------------------------------
+// Hot-reload snapshot
+// ---------------------------------------------------------------------------
+
+/// Serialize every instance whose type has snapshot hooks into the plugin's
+/// snapshot arena. Called from the outgoing DLL before teardown; returns the
+/// number of instances written.
+pub fn snapshot_instances() -> u32 {
+    let mut writer = SnapshotWriter::new();
+    {
+        let map = read_or_recover(instance_data());
+        let types = lock_or_recover(type_registry());
+        for (&addr, entry) in map.iter() {
+            let Some(fns) = types.get(&entry.type_id).and_then(|t| t.snapshot.as_ref()) else {
+                continue;
+            };
+            writer.entry(addr, entry.type_id, |w| unsafe { (fns.save)(entry.data, w) });
+        }
+    }
+    let count = writer.entry_count();
+    if writer.commit() { count } else { 0 }
+}
+
+/// Restore instance data from the plugin's snapshot arena, reading it in
+/// place. Called from the incoming DLL after every instance was reconstructed;
+/// entries whose object is gone or whose class changed are skipped.
+pub fn restore_instances() -> u32 {
+    // SAFETY: the arena stays mapped until this callback returns.
+    let Some(view) = (unsafe { SnapshotView::current() }) else {
+        return 0;
+    };
+    let map = read_or_recover(instance_data());
+    let types = lock_or_recover(type_registry());
+    let mut restored = 0u32;
+    for (addr, type_id, fields) in view.entries() {
+        let Some(entry) = map.get(&addr) else { continue };
+        if entry.type_id != type_id {
+            continue;
+        }
+        let Some(fns) = types.get(&type_id).and_then(|t| t.snapshot.as_ref()) else {
+            continue;
+        };
+        unsafe { (fns.restore)(entry.data, &fields) };
+        restored += 1;
+    }
+    restored
+}
+
 /// Clear all registries and drop all instance data.
 /// Called during shutdown before DLL unload (enables hot reload).
 pub fn clear_all() {
@@ -226,9 +431,7 @@ pub fn clear_all() {
         drop(types);
     }
     // 2. Clear function registry.
-    if let Some(funcs) = FUNC_REGISTRY.get() {
-        write_or_recover(funcs).clear();
-    }
+    FUNC_REGISTRY.clear();
     // 3. Clear type registry.
     if let Some(types) = TYPE_REGISTRY.get() {
         lock_or_recover(types).clear();
@@ -244,3 +447,92 @@ pub fn get_instance_data(obj: UObjectHandle) -> *mut u8 {
         .map(|e| e.data)
         .unwrap_or(std::ptr::null_mut())
 }
+
+// ---------------------------------------------------------------------------
+// Instance enumeration
+// ---------------------------------------------------------------------------
+
+/// Collect the live instances of every reified class that is `cls` or derives
+/// from it (`cls` may be a native class such as AActor) into `out`, replacing
+/// its contents. Reuse `out` across frames to avoid reallocating.
+///
+/// Backed by per-class registries on the C++ side, so the cost is proportional
+/// to the number of Rust-backed objects, not to every object in the world.
+pub fn instances_of_into(cls: UClassHandle, out: &mut Vec<UObjectHandle>) -> UikaResult<()> {
+    out.clear();
+    loop {
+        let capacity = out.capacity().min(u32::MAX as usize) as u32;
+        let mut count = 0u32;
+        let code = unsafe {
+            ffi_dispatch::reify_get_instances(cls, out.as_mut_ptr(), capacity, &mut count)
+        };
+        match code {
+            UikaErrorCode::Ok => {
+                unsafe { out.set_len(count as usize) };
+                return Ok(());
+            }
+            UikaErrorCode::BufferTooSmall => out.reserve(count as usize),
+            other => return check_ffi(other),
+        }
+    }
+}
+
+/// Typed variant of [`instances_of_into`] for a reified (or native base) class.
+pub fn instances_of<T: UeClass>() -> UikaResult<Vec<UObjectRef<T>>> {
+    let mut handles = Vec::new();
+    instances_of_into(T::static_class(), &mut handles)?;
+    Ok(handles.into_iter().map(|h| unsafe { UObjectRef::from_raw(h) }).collect())
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use std::sync::atomic::{AtomicU32, Ordering};
+
+    static TICKED: AtomicU32 = AtomicU32::new(0);
+
+    fn info(batch_tick: Option<unsafe fn(&mut [TickInstance], f32)>) -> RustTypeInfo {
+        RustTypeInfo {
+            name: "TickTest",
+            construct_fn: || Box::into_raw(Box::new(0u32)) as *mut u8,
+            drop_fn: |ptr| drop(unsafe { Box::from_raw(ptr as *mut u32) }),
+            snapshot: None,
+            pool: None,
+            batch_tick,
+        }
+    }
+
+    #[test]
+    fn construct_returns_slot_data_for_tick() {
+        const TICKING: u64 = 0x7101;
+        register_type(TICKING, info(Some(|batch, dt| {
+            for inst in batch.iter() {
+                unsafe { *(inst.data as *mut u32) += dt as u32 };
+            }
+            TICKED.fetch_add(batch.len() as u32, Ordering::Relaxed);
+        })));
+
+        let a = UObjectHandle::from_addr(0x7101_0010);
+        let b = UObjectHandle::from_addr(0x7101_0020);
+        let data_a = construct_instance(a, TICKING);
+        let data_b = construct_instance(b, TICKING);
+        assert_eq!(data_a, get_instance_data(a));
+        assert!(construct_instance(UObjectHandle::from_addr(0x7101_0030), 0x7199).is_null());
+
+        let mut batch = [
+            TickInstance { handle: a, data: data_a },
+            TickInstance { handle: b, data: data_b },
+        ];
+        tick_class(TICKING, &mut batch, 2.0);
+        assert_eq!(TICKED.load(Ordering::Relaxed), 2);
+        assert_eq!(unsafe { *(data_b as *const u32) }, 2);
+
+        // Types without a class tick are ignored.
+        tick_class(0x7199, &mut batch, 1.0);
+        assert_eq!(TICKED.load(Ordering::Relaxed), 2);
+
+        drop_instance(a, TICKING);
+        drop_instance(b, TICKING);
+        assert!(get_instance_data(a).is_null());
+    }
+}
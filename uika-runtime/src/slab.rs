@@ -0,0 +1,417 @@
+// Callback slab: fixed-address slots addressed by (epoch, generation, index)
+// ids, backing the delegate and reify function registries.
+//
+// Lookups and calls take no lock: a slot's stamp (the id it currently holds)
+// is checked with atomics and the value is called in place. Only insert,
+// remove and clear serialize on a writer mutex. Slots live in chunks that are
+// allocated once and never move, so a callback may register or remove other
+// callbacks while it runs. `clear` bumps the epoch, so every outstanding id
+// goes stale at once, and drops every value; slots are then reused in order.
+//
+// Id layout: bits 48..64 epoch (starts at 1, so ids are never 0), 32..48
+// slot generation, 0..32 slot index.
+
+use std::cell::UnsafeCell;
+use std::ptr;
+use std::sync::atomic::{AtomicBool, AtomicPtr, AtomicU32, AtomicU64, Ordering::SeqCst};
+use std::sync::Mutex;
+
+use crate::lock_or_recover;
+
+const CHUNK_SIZE: usize = 1024;
+const MAX_CHUNKS: usize = 4096;
+
+struct Slot<T> {
+    /// Id stored in this slot, 0 when vacant.
+    stamp: AtomicU64,
+    /// Calls currently running on the value.
+    active: AtomicU32,
+    /// Removed while active: the last call out drops the value.
+    doomed: AtomicBool,
+    /// A `call_mut` is running on the value.
+    busy: AtomicBool,
+    /// Bumped on every reuse (writer lock only).
+    generation: UnsafeCell<u16>,
+    value: UnsafeCell<Option<T>>,
+}
+
+struct Writer {
+    epoch: u16,
+    free: Vec<u32>,
+    /// Slots below this index were handed out in the current epoch.
+    fresh: u32,
+    /// Slots allocated in total.
+    allocated: u32,
+}
+
+pub struct CallbackSlab<T> {
+    chunks: [AtomicPtr<Slot<T>>; MAX_CHUNKS],
+    epoch: AtomicU32,
+    writer: Mutex<Writer>,
+}
+
+// SAFETY: values are only reached through `call` (shared, needs `T: Sync`)
+// or `call_mut` (exclusive via the `busy` flag) and are taken out under the
+// writer lock once no call is running.
+unsafe impl<T: Send> Sync for CallbackSlab<T> {}
+unsafe impl<T: Send> Send for CallbackSlab<T> {}
+
+impl<T> Default for CallbackSlab<T> {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+fn pack(epoch: u16, generation: u16, index: u32) -> u64 {
+    ((epoch as u64) << 48) | ((generation as u64) << 32) | index as u64
+}
+
+impl<T> CallbackSlab<T> {
+    pub const fn new() -> Self {
+        Self {
+            chunks: [const { AtomicPtr::new(ptr::null_mut()) }; MAX_CHUNKS],
+            epoch: AtomicU32::new(1),
+            writer: Mutex::new(Writer { epoch: 1, free: Vec::new(), fresh: 0, allocated: 0 }),
+        }
+    }
+
+    /// Store `value` and return its id.
+    pub fn insert(&self, value: T) -> u64 {
+        let mut w = lock_or_recover(&self.writer);
+        let index = loop {
+            if let Some(index) = w.free.pop() {
+                break index;
+            }
+            if w.fresh < w.allocated {
+                let index = w.fresh;
+                w.fresh += 1;
+                let slot = self.slot(index).expect("slab slot below allocated");
+                // Retire the previous epoch's id first so a late caller backs
+                // out, then skip the slot if one is still inside it (it is
+                // picked up again after the next clear).
+                slot.stamp.store(0, SeqCst);
+                if slot.active.load(SeqCst) == 0 {
+                    break index;
+                }
+                continue;
+            }
+            let index = w.allocated;
+            self.ensure_chunk(index);
+            w.allocated += 1;
+            w.fresh = w.allocated;
+            break index;
+        };
+
+        let slot = self.slot(index).expect("slab slot allocated above");
+        // SAFETY: writer lock held and no call is running on this slot.
+        let generation = unsafe {
+            let g = &mut *slot.generation.get();
+            *g = g.wrapping_add(1);
+            *slot.value.get() = Some(value);
+            *g
+        };
+        let id = pack(w.epoch, generation, index);
+        slot.doomed.store(false, SeqCst);
+        slot.stamp.store(id, SeqCst);
+        id
+    }
+
+    /// Remove `id`. A value whose call is still running is dropped when that
+    /// call returns. Returns whether `id` was live.
+    pub fn remove(&self, id: u64) -> bool {
+        let mut w = lock_or_recover(&self.writer);
+        // Ids from before a clear are already dead; their slots come back
+        // through the fresh cursor, never the free list.
+        if (id >> 48) as u16 != w.epoch {
+            return false;
+        }
+        let index = id as u32;
+        let Some(slot) = self.slot(index) else { return false };
+        if slot.stamp.compare_exchange(id, 0, SeqCst, SeqCst).is_err() {
+            return false;
+        }
+        let value = if self.claim_doomed(slot) {
+            w.free.push(index);
+            // SAFETY: writer lock held, no call running.
+            unsafe { (*slot.value.get()).take() }
+        } else {
+            None
+        };
+        drop(w);
+        // Outside the lock: dropping a callback may remove others.
+        drop(value);
+        true
+    }
+
+    /// Invalidate every id at once and drop every value. A value whose call
+    /// is still running is dropped when that call returns.
+    pub fn clear(&self) {
+        let mut w = lock_or_recover(&self.writer);
+        // Skip 0 on wrap so ids stay non-zero.
+        w.epoch = w.epoch.checked_add(1).unwrap_or(1);
+        w.free.clear();
+        w.fresh = 0;
+        self.epoch.store(w.epoch as u32, SeqCst);
+
+        let mut drained = Vec::new();
+        for index in 0..w.allocated {
+            let Some(slot) = self.slot(index) else { continue };
+            // Same handshake as `remove`: a caller past its stamp check is
+            // visible in `active` and drops the value on its way out.
+            if slot.stamp.swap(0, SeqCst) == 0 {
+                continue;
+            }
+            if self.claim_doomed(slot) {
+                // SAFETY: writer lock held, no call running.
+                drained.extend(unsafe { (*slot.value.get()).take() });
+            }
+        }
+        drop(w);
+        // Outside the lock: dropping a callback may remove others.
+        drop(drained);
+    }
+
+    /// Number of live ids.
+    pub fn len(&self) -> usize {
+        let w = lock_or_recover(&self.writer);
+        let epoch = w.epoch as u64;
+        (0..w.fresh)
+            .filter_map(|i| self.slot(i))
+            .filter(|s| {
+                let stamp = s.stamp.load(SeqCst);
+                stamp != 0 && stamp >> 48 == epoch
+            })
+            .count()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    /// Call `f` with exclusive access to the value of `id`. Returns `None`
+    /// if `id` is stale or its value is already running (re-entrant call).
+    pub fn call_mut<R>(&self, id: u64, f: impl FnOnce(&mut T) -> R) -> Option<R> {
+        let slot = self.enter(id, true)?;
+        // SAFETY: `enter` made this the only running call on the slot.
+        let result = unsafe { (*slot.value.get()).as_mut().map(f) };
+        slot.busy.store(false, SeqCst);
+        self.leave(slot, id);
+        result
+    }
+
+    fn enter(&self, id: u64, exclusive: bool) -> Option<&Slot<T>> {
+        if (id >> 48) as u32 != self.epoch.load(SeqCst) {
+            return None;
+        }
+        let slot = self.slot(id as u32)?;
+        if slot.stamp.load(SeqCst) != id {
+            return None;
+        }
+        slot.active.fetch_add(1, SeqCst);
+        // Re-check after announcing the call: a concurrent remove either saw
+        // us and deferred the drop, or cleared the stamp before we got here.
+        // Exclusivity is claimed only past this check, so a caller still
+        // holding the slot's previous id cannot make a valid one back out.
+        if slot.stamp.load(SeqCst) != id || (exclusive && slot.busy.swap(true, SeqCst)) {
+            self.leave(slot, id);
+            return None;
+        }
+        Some(slot)
+    }
+
+    fn leave(&self, slot: &Slot<T>, id: u64) {
+        if slot.active.fetch_sub(1, SeqCst) == 1 && slot.doomed.swap(false, SeqCst) {
+            let mut w = lock_or_recover(&self.writer);
+            // SAFETY: writer lock held, last call has returned.
+            let value = unsafe { (*slot.value.get()).take() };
+            // After a clear the fresh cursor owns the slot again.
+            if (id >> 48) as u16 == w.epoch {
+                w.free.push(id as u32);
+            }
+            drop(w);
+            drop(value);
+        }
+    }
+
+    /// Mark a retired slot's value for dropping and return whether the caller
+    /// drops it now. `doomed` is set before `active` is read, so either this
+    /// sees no call running or the last call out sees `doomed`; the swap lets
+    /// exactly one side win (writer lock held).
+    fn claim_doomed(&self, slot: &Slot<T>) -> bool {
+        slot.doomed.store(true, SeqCst);
+        slot.active.load(SeqCst) == 0 && slot.doomed.swap(false, SeqCst)
+    }
+
+    fn slot(&self, index: u32) -> Option<&Slot<T>> {
+        let index = index as usize;
+        let chunk = self.chunks.get(index / CHUNK_SIZE)?.load(SeqCst);
+        if chunk.is_null() {
+            return None;
+        }
+        // SAFETY: chunks are CHUNK_SIZE slots and live as long as the slab.
+        Some(unsafe { &*chunk.add(index % CHUNK_SIZE) })
+    }
+
+    /// Allocate the chunk holding `index` (writer lock held).
+    fn ensure_chunk(&self, index: u32) {
+        let c = index as usize / CHUNK_SIZE;
+        assert!(c < MAX_CHUNKS, "callback slab exhausted");
+        if self.chunks[c].load(SeqCst).is_null() {
+            let chunk: Box<[Slot<T>]> = (0..CHUNK_SIZE)
+                .map(|_| Slot {
+                    stamp: AtomicU64::new(0),
+                    active: AtomicU32::new(0),
+                    doomed: AtomicBool::new(false),
+                    busy: AtomicBool::new(false),
+                    generation: UnsafeCell::new(0),
+                    value: UnsafeCell::new(None),
+                })
+                .collect();
+            self.chunks[c].store(Box::into_raw(chunk) as *mut Slot<T>, SeqCst);
+        }
+    }
+}
+
+impl<T: Sync> CallbackSlab<T> {
+    /// Call `f` with shared access to the value of `id`; re-entrant calls
+    /// are allowed. Returns `None` if `id` is stale.
+    pub fn call<R>(&self, id: u64, f: impl FnOnce(&T) -> R) -> Option<R> {
+        let slot = self.enter(id, false)?;
+        // SAFETY: the value is only dropped once `active` drops back to 0.
+        let result = unsafe { (*slot.value.get()).as_ref().map(f) };
+        self.leave(slot, id);
+        result
+    }
+}
+
+impl<T> Drop for CallbackSlab<T> {
+    fn drop(&mut self) {
+        for chunk in &self.chunks {
+            let chunk = chunk.load(SeqCst);
+            if !chunk.is_null() {
+                drop(unsafe { Box::from_raw(ptr::slice_from_raw_parts_mut(chunk, CHUNK_SIZE)) });
+            }
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use std::cell::Cell;
+    use std::rc::Rc;
+
+    #[test]
+    fn ids_generations_and_clear() {
+        let slab: CallbackSlab<u32> = CallbackSlab::new();
+        let a = slab.insert(1);
+        let b = slab.insert(2);
+        assert_ne!(a, 0);
+        assert_eq!(slab.call(b, |v| *v), Some(2));
+
+        // A removed id stays dead after its slot is reused.
+        assert!(slab.remove(a));
+        assert!(!slab.remove(a));
+        let c = slab.insert(3);
+        assert_eq!(c as u32, a as u32);
+        assert_eq!(slab.call(a, |v| *v), None);
+        assert_eq!(slab.call(c, |v| *v), Some(3));
+        assert_eq!(slab.len(), 2);
+
+        // Clear invalidates everything; slots come back in order.
+        slab.clear();
+        assert_eq!(slab.len(), 0);
+        assert_eq!(slab.call(b, |v| *v), None);
+        let d = slab.insert(4);
+        assert_eq!(d as u32, 0);
+        assert_eq!(slab.call(d, |v| *v), Some(4));
+    }
+
+    #[test]
+    fn call_mut_guards_reentry_and_defers_removal() {
+        struct Dropped(Rc<Cell<bool>>);
+        impl Drop for Dropped {
+            fn drop(&mut self) {
+                self.0.set(true);
+            }
+        }
+        let flag = Rc::new(Cell::new(false));
+        let slab: CallbackSlab<Dropped> = CallbackSlab::new();
+        let id = slab.insert(Dropped(flag.clone()));
+
+        let inner = slab.call_mut(id, |_| {
+            // Re-entrant exclusive call is refused.
+            assert!(slab.call_mut(id, |_| ()).is_none());
+            // Removing ourselves defers the drop until we return.
+            assert!(slab.remove(id));
+            flag.get()
+        });
+        assert_eq!(inner, Some(false));
+        assert!(flag.get());
+        assert!(slab.call_mut(id, |_| ()).is_none());
+    }
+
+    #[test]
+    fn stale_caller_does_not_block_call_mut() {
+        let slab: CallbackSlab<u32> = CallbackSlab::new();
+        let old = slab.insert(1);
+        assert!(slab.remove(old));
+        let id = slab.insert(2);
+        assert_eq!(id as u32, old as u32);
+
+        // A caller holding `old` between its two stamp checks.
+        let slot = slab.slot(id as u32).unwrap();
+        slot.active.fetch_add(1, SeqCst);
+        assert_eq!(slab.call_mut(id, |v| *v), Some(2));
+        slab.leave(slot, old);
+        assert_eq!(slab.call_mut(id, |v| *v), Some(2));
+    }
+
+    #[test]
+    fn clear_drops_values_and_defers_running_ones() {
+        let drops = Rc::new(Cell::new(0));
+        struct Counted(Rc<Cell<u32>>);
+        impl Drop for Counted {
+            fn drop(&mut self) {
+                self.0.set(self.0.get() + 1);
+            }
+        }
+        let slab: CallbackSlab<Counted> = CallbackSlab::new();
+        slab.insert(Counted(drops.clone()));
+        let running = slab.insert(Counted(drops.clone()));
+
+        slab.call_mut(running, |_| {
+            slab.clear();
+            // The idle value is gone, the running one waits for us.
+            assert_eq!(drops.get(), 1);
+        });
+        assert_eq!(drops.get(), 2);
+        assert_eq!(slab.len(), 0);
+        assert!(slab.call_mut(running, |_| ()).is_none());
+    }
+
+    #[test]
+    fn dropping_a_value_may_remove_others() {
+        // Like a delegate closure that owns another binding.
+        struct Owns(&'static CallbackSlab<Owns>, Option<u64>);
+        impl Drop for Owns {
+            fn drop(&mut self) {
+                if let Some(id) = self.1 {
+                    assert!(self.0.remove(id));
+                }
+            }
+        }
+        let slab: &'static CallbackSlab<Owns> = Box::leak(Box::new(CallbackSlab::new()));
+
+        let inner = slab.insert(Owns(slab, None));
+        let outer = slab.insert(Owns(slab, Some(inner)));
+        assert!(slab.remove(outer));
+        assert!(slab.is_empty());
+
+        // Same when the drop is deferred to the end of a running call.
+        let inner = slab.insert(Owns(slab, None));
+        let outer = slab.insert(Owns(slab, Some(inner)));
+        slab.call_mut(outer, |_| assert!(slab.remove(outer)));
+        assert!(slab.is_empty());
+    }
+}
@@ -2,12 +2,17 @@
 // These are simple Rust structs with conversions to/from glam types where applicable.
 
 use glam::{DQuat, DVec2, DVec3, Vec4};
+use uika_ffi::{FPropertyHandle, UObjectHandle, UikaQuat, UikaRotator, UikaTransform, UikaVector};
+
+use crate::error::{check_ffi, UikaResult};
+use crate::ffi_dispatch;
 
 // ---------------------------------------------------------------------------
 // Rotator (FRotator equivalent — pitch/yaw/roll in degrees)
 // ---------------------------------------------------------------------------
 
 #[derive(Clone, Copy, Debug, PartialEq)]
+#[repr(C)]
 pub struct Rotator {
     pub pitch: f64,
     pub yaw: f64,
@@ -100,12 +105,117 @@ impl Transform {
     }
 }
 
+// ---------------------------------------------------------------------------
+// FFI math ABI conversions (uika_ffi::math_types)
+// ---------------------------------------------------------------------------
+
+// glam types are foreign to this crate, so vectors and quats convert through
+// free functions; Rotator and Transform get plain `From` impls.
+
+#[inline]
+pub fn vector_to_ffi(v: DVec3) -> UikaVector {
+    UikaVector { x: v.x, y: v.y, z: v.z, _pad: 0.0 }
+}
+
+#[inline]
+pub fn vector_from_ffi(v: UikaVector) -> DVec3 {
+    DVec3::new(v.x, v.y, v.z)
+}
+
+#[inline]
+pub fn quat_to_ffi(q: DQuat) -> UikaQuat {
+    UikaQuat { x: q.x, y: q.y, z: q.z, w: q.w }
+}
+
+#[inline]
+pub fn quat_from_ffi(q: UikaQuat) -> DQuat {
+    DQuat::from_xyzw(q.x, q.y, q.z, q.w)
+}
+
+impl From<Rotator> for UikaRotator {
+    #[inline]
+    fn from(r: Rotator) -> UikaRotator {
+        UikaRotator { pitch: r.pitch, yaw: r.yaw, roll: r.roll, _pad: 0.0 }
+    }
+}
+
+impl From<UikaRotator> for Rotator {
+    #[inline]
+    fn from(r: UikaRotator) -> Rotator {
+        Rotator { pitch: r.pitch, yaw: r.yaw, roll: r.roll }
+    }
+}
+
+impl From<Transform> for UikaTransform {
+    #[inline]
+    fn from(t: Transform) -> UikaTransform {
+        UikaTransform {
+            rotation: quat_to_ffi(t.rotation),
+            translation: vector_to_ffi(t.translation),
+            scale: vector_to_ffi(t.scale),
+        }
+    }
+}
+
+impl From<UikaTransform> for Transform {
+    #[inline]
+    fn from(t: UikaTransform) -> Transform {
+        Transform {
+            rotation: quat_from_ffi(t.rotation),
+            translation: vector_from_ffi(t.translation),
+            scale: vector_from_ffi(t.scale),
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Property fast paths
+// ---------------------------------------------------------------------------
+//
+// Typed reads/writes of FVector / FRotator / FTransform struct properties
+// through the math ABI, without going through a generic struct copy. A
+// property of any other struct type fails with TypeMismatch.
+
+pub fn get_vector(obj: UObjectHandle, prop: FPropertyHandle) -> UikaResult<DVec3> {
+    let mut out = UikaVector::default();
+    check_ffi(unsafe { ffi_dispatch::property_get_vector(obj, prop, &mut out) })?;
+    Ok(vector_from_ffi(out))
+}
+
+pub fn set_vector(obj: UObjectHandle, prop: FPropertyHandle, value: DVec3) -> UikaResult<()> {
+    let raw = vector_to_ffi(value);
+    check_ffi(unsafe { ffi_dispatch::property_set_vector(obj, prop, &raw) })
+}
+
+pub fn get_rotator(obj: UObjectHandle, prop: FPropertyHandle) -> UikaResult<Rotator> {
+    let mut out = UikaRotator::default();
+    check_ffi(unsafe { ffi_dispatch::property_get_rotator(obj, prop, &mut out) })?;
+    Ok(out.into())
+}
+
+pub fn set_rotator(obj: UObjectHandle, prop: FPropertyHandle, value: Rotator) -> UikaResult<()> {
+    let raw = UikaRotator::from(value);
+    check_ffi(unsafe { ffi_dispatch::property_set_rotator(obj, prop, &raw) })
+}
+
+pub fn get_transform(obj: UObjectHandle, prop: FPropertyHandle) -> UikaResult<Transform> {
+    let mut out = UikaTransform::default();
+    check_ffi(unsafe { ffi_dispatch::property_get_transform(obj, prop, &mut out) })?;
+    Ok(out.into())
+}
+
+pub fn set_transform(obj: UObjectHandle, prop: FPropertyHandle, value: Transform) -> UikaResult<()> {
+    let raw = UikaTransform::from(value);
+    check_ffi(unsafe { ffi_dispatch::property_set_transform(obj, prop, &raw) })
+}
+
 // ---------------------------------------------------------------------------
 // Color types
 // ---------------------------------------------------------------------------
 
 /// Linear color (float RGBA, 0.0–1.0 range). Maps to FLinearColor.
 #[derive(Clone, Copy, Debug, PartialEq)]
+#[repr(C)]
 pub struct LinearColor {
     pub r: f32,
     pub g: f32,
@@ -165,6 +275,7 @@ impl Color {
 
 /// A plane defined by normal + distance from origin. Maps to FPlane.
 #[derive(Clone, Copy, Debug, PartialEq)]
+#[repr(C)]
 pub struct Plane {
     pub normal: DVec3,
     pub d: f64,
@@ -178,6 +289,7 @@ impl Plane {
 
 /// A ray defined by origin + direction. Maps to FRay.
 #[derive(Clone, Copy, Debug, PartialEq)]
+#[repr(C)]
 pub struct Ray {
     pub origin: DVec3,
     pub direction: DVec3,
@@ -191,6 +303,7 @@ impl Ray {
 
 /// A sphere defined by center + radius. Maps to FSphere.
 #[derive(Clone, Copy, Debug, PartialEq)]
+#[repr(C)]
 pub struct Sphere {
     pub center: DVec3,
     pub radius: f64,
@@ -235,6 +348,7 @@ impl UeBox2d {
 
 /// Combined box + sphere bounds. Maps to FBoxSphereBounds.
 #[derive(Clone, Copy, Debug, PartialEq)]
+#[repr(C)]
 pub struct BoxSphereBounds {
     pub origin: DVec3,
     pub box_extent: DVec3,
@@ -268,6 +382,20 @@ mod tests {
         assert!((r.roll - r2.roll).abs() < 1e-10);
     }
 
+    #[test]
+    fn transform_ffi_roundtrip() {
+        let t = Transform::new(
+            Rotator::new(10.0, 20.0, 30.0).into(),
+            DVec3::new(1.0, -2.0, 3.5),
+            DVec3::new(2.0, 2.0, 0.5),
+        );
+        let raw = UikaTransform::from(t);
+        assert_eq!(raw.translation._pad, 0.0);
+        assert_eq!(raw.scale._pad, 0.0);
+        assert_eq!(Transform::from(raw), t);
+        assert_eq!(Transform::from(UikaTransform::default()), Transform::IDENTITY);
+    }
+
     #[test]
     fn linear_color_vec4_roundtrip() {
         let c = LinearColor::new(0.5, 0.3, 0.8, 1.0);
@@ -0,0 +1,147 @@
+// UE string property reads without temporary FString copies.
+//
+// `read_string_into` asks the C++ side to convert straight from the live
+// FString/FText storage: a stack buffer covers short strings, and longer
+// ones get exactly one allocation of the size reported by BufferTooSmall.
+// `Utf16View` borrows the UTF-16 storage itself for lazy decoding.
+
+use uika_ffi::{FPropertyHandle, UObjectHandle, UikaErrorCode, UikaUtf16View};
+
+use crate::error::{check_ffi, UikaResult};
+use crate::ffi_dispatch;
+
+/// Strings up to this many UTF-8 bytes are read without a heap buffer.
+const STACK_BUF_LEN: usize = 256;
+
+/// Read an FString/FText property of `container` into `out` (replacing its
+/// contents). Returns the FFI error code; `out` is left empty on failure.
+pub fn read_string_into(container: UObjectHandle, prop: FPropertyHandle, out: &mut String) -> UikaErrorCode {
+    out.clear();
+    let mut stack = [0u8; STACK_BUF_LEN];
+    let mut len: u32 = 0;
+    let code = unsafe {
+        ffi_dispatch::property_get_string_exact(container, prop, stack.as_mut_ptr(), STACK_BUF_LEN as u32, &mut len)
+    };
+    match code {
+        UikaErrorCode::Ok => {
+            out.push_str(&String::from_utf8_lossy(&stack[..len as usize]));
+            return UikaErrorCode::Ok;
+        }
+        UikaErrorCode::BufferTooSmall => {}
+        other => return other,
+    }
+
+    // Exact-size retry. Loop in case the string grew between the two calls.
+    loop {
+        let mut buf = vec![0u8; len as usize];
+        let mut needed: u32 = 0;
+        let code = unsafe {
+            ffi_dispatch::property_get_string_exact(container, prop, buf.as_mut_ptr(), len, &mut needed)
+        };
+        match code {
+            UikaErrorCode::Ok => {
+                buf.truncate(needed as usize);
+                *out = String::from_utf8(buf)
+                    .unwrap_or_else(|e| String::from_utf8_lossy(e.as_bytes()).into_owned());
+                return UikaErrorCode::Ok;
+            }
+            UikaErrorCode::BufferTooSmall => len = needed,
+            other => return other,
+        }
+    }
+}
+
+/// Read an FString/FText property of `container` as an owned `String`.
+pub fn read_string(container: UObjectHandle, prop: FPropertyHandle) -> UikaResult<String> {
+    let mut out = String::new();
+    check_ffi(read_string_into(container, prop, &mut out))?;
+    Ok(out)
+}
+
+/// Borrowed UTF-16 contents of a live FString/FText property.
+#[derive(Clone, Copy, Debug)]
+pub struct Utf16View<'a> {
+    units: &'a [u16],
+}
+
+impl<'a> Utf16View<'a> {
+    /// Borrow the string storage of `prop` on `container`.
+    ///
+    /// # Safety
+    /// The view points into the live property. It must not be used after the
+    /// property is written (from Rust or UE) or the container is destroyed.
+    pub unsafe fn borrow(container: UObjectHandle, prop: FPropertyHandle) -> UikaResult<Utf16View<'a>> {
+        let mut raw = UikaUtf16View::default();
+        check_ffi(unsafe { ffi_dispatch::property_get_string_view(container, prop, &mut raw) })?;
+        let units = if raw.ptr.is_null() || raw.len == 0 {
+            &[][..]
+        } else {
+            unsafe { std::slice::from_raw_parts(raw.ptr, raw.len as usize) }
+        };
+        Ok(Utf16View { units })
+    }
+
+    /// Build a view over existing UTF-16 code units.
+    pub fn from_units(units: &'a [u16]) -> Self {
+        Utf16View { units }
+    }
+
+    #[inline]
+    pub fn as_units(&self) -> &'a [u16] {
+        self.units
+    }
+
+    /// Length in UTF-16 code units.
+    #[inline]
+    pub fn len(&self) -> usize {
+        self.units.len()
+    }
+
+    #[inline]
+    pub fn is_empty(&self) -> bool {
+        self.units.is_empty()
+    }
+
+    /// Decode lazily; unpaired surrogates become U+FFFD.
+    pub fn chars(&self) -> impl Iterator<Item = char> + 'a {
+        char::decode_utf16(self.units.iter().copied()).map(|r| r.unwrap_or(char::REPLACEMENT_CHARACTER))
+    }
+
+    /// Compare against a Rust string without allocating.
+    pub fn eq_str(&self, s: &str) -> bool {
+        let mut units = self.units.iter().copied();
+        for u in s.encode_utf16() {
+            if units.next() != Some(u) {
+                return false;
+            }
+        }
+        units.next().is_none()
+    }
+
+    pub fn to_string_lossy(&self) -> String {
+        String::from_utf16_lossy(self.units)
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn view_decodes_and_compares_without_allocating() {
+        let units: Vec<u16> = "Hand_R \u{00e9}".encode_utf16().collect();
+        let view = Utf16View::from_units(&units);
+        assert!(view.eq_str("Hand_R \u{00e9}"));
+        assert!(!view.eq_str("Hand_R"));
+        assert!(!view.eq_str("Hand_R \u{00e9}x"));
+        assert_eq!(view.chars().count(), 8);
+        assert_eq!(view.to_string_lossy(), "Hand_R \u{00e9}");
+    }
+
+    #[test]
+    fn unpaired_surrogate_is_replaced() {
+        let units = [0x0041u16, 0xD800, 0x0042];
+        let view = Utf16View::from_units(&units);
+        assert_eq!(view.chars().collect::<String>(), "A\u{FFFD}B");
+    }
+}
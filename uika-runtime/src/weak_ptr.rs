@@ -1,15 +1,111 @@
 // TWeakObjectPtr<T>: typed weak reference to a UObject.
 // Does not prevent garbage collection. Can be resolved to UObjectRef<T>
 // if the object is still alive.
+//
+// Resolution normally runs inline: C++ publishes a read-only view of
+// GUObjectArray (`core.get_object_array_view`) and the index/serial check
+// that `FWeakObjectPtr::Get` does is repeated here on the published chunks.
+// Handles in chunks not yet published, or engine builds without a view, go
+// through `resolve_weak` / `resolve_weak_many`.
 
 use std::marker::PhantomData;
+use std::sync::OnceLock;
 
-use uika_ffi::FWeakObjectHandle;
+use uika_ffi::{FWeakObjectHandle, UObjectHandle, UikaErrorCode, UikaObjectArrayView};
 
+use crate::error::{check_ffi, UikaResult};
 use crate::ffi_dispatch;
 use crate::object_ref::UObjectRef;
 use crate::traits::UeClass;
 
+static OBJECT_ARRAY: OnceLock<Option<UikaObjectArrayView>> = OnceLock::new();
+
+fn object_array() -> Option<&'static UikaObjectArrayView> {
+    OBJECT_ARRAY
+        .get_or_init(|| {
+            let mut view = UikaObjectArrayView {
+                chunks: std::ptr::null(),
+                num_chunks: std::ptr::null(),
+                elements_per_chunk: 0,
+                item_size: 0,
+                object_offset: 0,
+                flags_offset: 0,
+                serial_offset: 0,
+                dead_flags: 0,
+            };
+            let code = unsafe { ffi_dispatch::core_get_object_array_view(&mut view) };
+            (code == UikaErrorCode::Ok && view.elements_per_chunk != 0).then_some(view)
+        })
+        .as_ref()
+}
+
+/// Resolve `weak` against the published object array. `None` when the
+/// handle's chunk is not published yet and C++ has to answer.
+///
+/// # Safety
+/// Game thread only; `view` must come from `get_object_array_view`.
+unsafe fn resolve_inline(view: &UikaObjectArrayView, weak: FWeakObjectHandle) -> Option<UObjectHandle> {
+    if weak.object_index < 0 || weak.object_serial_number == 0 {
+        return Some(UObjectHandle::null());
+    }
+    let index = weak.object_index as u32;
+    let chunk = index / view.elements_per_chunk;
+    unsafe {
+        if chunk >= view.num_chunks.read_volatile() {
+            return None;
+        }
+        let item = (*view.chunks.add(chunk as usize))
+            .add((index % view.elements_per_chunk) as usize * view.item_size as usize);
+        let serial = item.add(view.serial_offset as usize).cast::<i32>().read();
+        let flags = item.add(view.flags_offset as usize).cast::<i32>().read();
+        if serial != weak.object_serial_number || flags & view.dead_flags != 0 {
+            return Some(UObjectHandle::null());
+        }
+        Some(UObjectHandle(item.add(view.object_offset as usize).cast::<*mut std::ffi::c_void>().read()))
+    }
+}
+
+/// Resolve one weak handle: inline when possible, otherwise one crossing.
+pub fn resolve_weak(weak: FWeakObjectHandle) -> UObjectHandle {
+    if let Some(obj) = object_array().and_then(|view| unsafe { resolve_inline(view, weak) }) {
+        return obj;
+    }
+    unsafe { ffi_dispatch::core_resolve_weak(weak) }
+}
+
+/// Resolve every handle in `weak` into `out` (null for expired entries).
+/// Entries the inline path cannot answer are resolved in at most one
+/// `resolve_weak_many` crossing.
+pub fn resolve_weak_many(weak: &[FWeakObjectHandle], out: &mut [UObjectHandle]) -> UikaResult<()> {
+    assert_eq!(weak.len(), out.len(), "resolve_weak_many: length mismatch");
+    let mut first_miss = weak.len();
+    if let Some(view) = object_array() {
+        for (i, (&w, slot)) in weak.iter().zip(out.iter_mut()).enumerate() {
+            match unsafe { resolve_inline(view, w) } {
+                Some(obj) => *slot = obj,
+                None => {
+                    first_miss = i;
+                    break;
+                }
+            }
+        }
+    } else {
+        first_miss = 0;
+    }
+    if first_miss == weak.len() {
+        return Ok(());
+    }
+    // The crossing publishes any new chunks, so the next call stays inline.
+    let rest = &weak[first_miss..];
+    check_ffi(unsafe {
+        ffi_dispatch::core_resolve_weak_many(
+            rest.as_ptr(),
+            rest.len() as u32,
+            out[first_miss..].as_mut_ptr(),
+        )
+    })
+}
+
 /// A typed weak reference to a UObject.
 ///
 /// Unlike `UObjectRef<T>`, a weak pointer uses UE's internal weak reference
@@ -18,6 +114,7 @@ use crate::traits::UeClass;
 ///
 /// Use `get()` to attempt to resolve to a strong `UObjectRef<T>`.
 #[derive(Clone, Copy, PartialEq, Eq, Hash, Debug)]
+#[repr(transparent)]
 pub struct TWeakObjectPtr<T: UeClass> {
     handle: FWeakObjectHandle,
     _marker: PhantomData<*const T>,
@@ -38,7 +135,7 @@ impl<T: UeClass> TWeakObjectPtr<T> {
     /// Attempt to resolve to a strong reference. Returns `None` if the
     /// object has been garbage collected.
     pub fn get(&self) -> Option<UObjectRef<T>> {
-        let obj = unsafe { ffi_dispatch::core_resolve_weak(self.handle) };
+        let obj = resolve_weak(self.handle);
         if obj.is_null() {
             None
         } else {
@@ -48,7 +145,27 @@ impl<T: UeClass> TWeakObjectPtr<T> {
 
     /// Check if the referenced object is still alive.
     pub fn is_valid(&self) -> bool {
-        unsafe { ffi_dispatch::core_is_weak_valid(self.handle) }
+        match object_array().and_then(|view| unsafe { resolve_inline(view, self.handle) }) {
+            Some(obj) => !obj.is_null(),
+            None => unsafe { ffi_dispatch::core_is_weak_valid(self.handle) },
+        }
+    }
+
+    /// Resolve many weak pointers at once (AI target lists, threat tables).
+    /// `out` is cleared and receives one entry per pointer, in order.
+    pub fn resolve_many(ptrs: &[Self], out: &mut Vec<Option<UObjectRef<T>>>) -> UikaResult<()> {
+        // SAFETY: TWeakObjectPtr<T> is repr(transparent) over FWeakObjectHandle.
+        let handles = unsafe {
+            std::slice::from_raw_parts(ptrs.as_ptr() as *const FWeakObjectHandle, ptrs.len())
+        };
+        let mut objs = vec![UObjectHandle::null(); ptrs.len()];
+        resolve_weak_many(handles, &mut objs)?;
+        out.clear();
+        out.extend(
+            objs.into_iter()
+                .map(|obj| (!obj.is_null()).then(|| unsafe { UObjectRef::from_raw(obj) })),
+        );
+        Ok(())
     }
 
     /// Get the underlying FFI handle.
@@ -66,3 +183,48 @@ impl<T: UeClass> Default for TWeakObjectPtr<T> {
         }
     }
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    // Mirrors the unpacked FUObjectItem: Object, Flags, ClusterRootIndex, SerialNumber.
+    #[repr(C)]
+    struct Item {
+        object: *mut std::ffi::c_void,
+        flags: i32,
+        cluster_root: i32,
+        serial: i32,
+    }
+
+    #[test]
+    fn inline_resolution_matches_weak_get() {
+        let mut target = 0u8;
+        let obj = &mut target as *mut u8 as *mut std::ffi::c_void;
+        let item = |serial, flags| Item { object: obj, flags, cluster_root: -1, serial };
+        let chunk0 = [item(0, 0), item(7, 0), item(8, 1 << 2)];
+        let chunks = [chunk0.as_ptr() as *const u8];
+        let published = 1u32;
+        let view = UikaObjectArrayView {
+            chunks: chunks.as_ptr(),
+            num_chunks: &published,
+            elements_per_chunk: 3,
+            item_size: size_of::<Item>() as u32,
+            object_offset: 0,
+            flags_offset: 8,
+            serial_offset: 16,
+            dead_flags: 1 << 2,
+        };
+        let weak = |object_index, object_serial_number| FWeakObjectHandle { object_index, object_serial_number };
+        let resolve = |w| unsafe { resolve_inline(&view, w) };
+
+        assert_eq!(resolve(weak(1, 7)), Some(UObjectHandle(obj)));
+        // Serial mismatch (slot reused), dead flag, unset serial, null handle.
+        assert_eq!(resolve(weak(1, 6)), Some(UObjectHandle::null()));
+        assert_eq!(resolve(weak(2, 8)), Some(UObjectHandle::null()));
+        assert_eq!(resolve(weak(0, 0)), Some(UObjectHandle::null()));
+        assert_eq!(resolve(FWeakObjectHandle::default()), Some(UObjectHandle::null()));
+        // Unpublished chunk: C++ has to answer.
+        assert_eq!(resolve(weak(3, 1)), None);
+    }
+}
@@ -1,7 +1,10 @@
 // Widget creation and WidgetTree management (raw handle versions).
 // Type-safe wrappers live in uika-bindings/src/manual/widget_ext.rs.
 
-use uika_ffi::{UClassHandle, UObjectHandle};
+use uika_ffi::{
+    UClassHandle, UObjectHandle, UikaErrorCode, UIKA_WIDGET_INIT_SLOT, UIKA_WIDGET_INIT_WIDGET,
+    UIKA_WIDGET_NODE_KEEP, UIKA_WIDGET_VALUE_RAW, UIKA_WIDGET_VALUE_TEXT,
+};
 
 use crate::error::{check_ffi, UikaError, UikaResult};
 use crate::ffi_dispatch;
@@ -47,3 +50,206 @@ pub fn get_widget_tree_raw(
         Ok(result)
     }
 }
+
+// ---------------------------------------------------------------------------
+// Declarative construction
+// ---------------------------------------------------------------------------
+
+/// Index of a node inside a [`WidgetTreeDesc`].
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub struct WidgetNode(u32);
+
+/// Serialized description of a widget hierarchy, built on the C++ side in a
+/// single `build_widget_tree` call instead of one crossing per widget, slot
+/// and property.
+///
+/// Nodes are added parents-first; the initializer and flag methods apply to
+/// the most recently added node.
+///
+/// ```ignore
+/// let mut desc = WidgetTreeDesc::new();
+/// let root = desc.node(UCanvasPanel::static_class(), None);
+/// desc.node(UVerticalBox::static_class(), Some(root));
+/// desc.keep().slot_text("LayoutData", "(Offsets=(Left=40,Top=40,Right=300,Bottom=600))");
+/// let handles = build_widget_tree_raw(user_widget, &desc)?;
+/// ```
+#[derive(Clone, Debug)]
+pub struct WidgetTreeDesc {
+    buf: Vec<u8>,
+    node_count: u32,
+    keep_count: u32,
+    /// Offsets of the current node's `flags` and `init_count` fields.
+    current: Option<(usize, usize)>,
+}
+
+impl Default for WidgetTreeDesc {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl WidgetTreeDesc {
+    pub fn new() -> Self {
+        WidgetTreeDesc { buf: vec![0; 4], node_count: 0, keep_count: 0, current: None }
+    }
+
+    /// Add a widget of `class` under `parent` (a panel widget), or as the
+    /// tree root if `parent` is `None`.
+    pub fn node(&mut self, class: UClassHandle, parent: Option<WidgetNode>) -> WidgetNode {
+        self.node_named(class, parent, "")
+    }
+
+    /// Like [`node`](Self::node), with an explicit widget name.
+    pub fn node_named(&mut self, class: UClassHandle, parent: Option<WidgetNode>, name: &str) -> WidgetNode {
+        let index = self.node_count;
+        self.node_count += 1;
+        self.buf[..4].copy_from_slice(&self.node_count.to_le_bytes());
+
+        self.buf.extend_from_slice(&class.to_addr().to_le_bytes());
+        let parent = parent.map_or(-1i32, |p| p.0 as i32);
+        self.buf.extend_from_slice(&parent.to_le_bytes());
+        let flags_at = self.buf.len();
+        self.buf.extend_from_slice(&0u32.to_le_bytes());
+        self.push_str16(name);
+        let inits_at = self.buf.len();
+        self.buf.extend_from_slice(&0u16.to_le_bytes());
+
+        self.current = Some((flags_at, inits_at));
+        WidgetNode(index)
+    }
+
+    /// Return the current node's handle from the build.
+    pub fn keep(&mut self) -> &mut Self {
+        let (flags_at, _) = self.current.expect("WidgetTreeDesc::keep called before any node");
+        let mut flags = u32::from_le_bytes(self.buf[flags_at..flags_at + 4].try_into().unwrap());
+        if flags & UIKA_WIDGET_NODE_KEEP == 0 {
+            flags |= UIKA_WIDGET_NODE_KEEP;
+            self.keep_count += 1;
+        }
+        self.buf[flags_at..flags_at + 4].copy_from_slice(&flags.to_le_bytes());
+        self
+    }
+
+    /// Set a widget property from UE export text.
+    pub fn widget_text(&mut self, prop: &str, text: &str) -> &mut Self {
+        self.push_init(UIKA_WIDGET_INIT_WIDGET, UIKA_WIDGET_VALUE_TEXT, prop, text.as_bytes())
+    }
+
+    /// Set a slot property from UE export text.
+    pub fn slot_text(&mut self, prop: &str, text: &str) -> &mut Self {
+        self.push_init(UIKA_WIDGET_INIT_SLOT, UIKA_WIDGET_VALUE_TEXT, prop, text.as_bytes())
+    }
+
+    /// Set a plain-old-data widget property from its in-memory bytes.
+    pub fn widget_raw(&mut self, prop: &str, bytes: &[u8]) -> &mut Self {
+        self.push_init(UIKA_WIDGET_INIT_WIDGET, UIKA_WIDGET_VALUE_RAW, prop, bytes)
+    }
+
+    /// Set a plain-old-data slot property from its in-memory bytes.
+    pub fn slot_raw(&mut self, prop: &str, bytes: &[u8]) -> &mut Self {
+        self.push_init(UIKA_WIDGET_INIT_SLOT, UIKA_WIDGET_VALUE_RAW, prop, bytes)
+    }
+
+    pub fn node_count(&self) -> u32 {
+        self.node_count
+    }
+
+    /// Number of handles a build returns.
+    pub fn keep_count(&self) -> u32 {
+        self.keep_count
+    }
+
+    pub fn as_bytes(&self) -> &[u8] {
+        &self.buf
+    }
+
+    fn push_init(&mut self, target: u8, kind: u8, prop: &str, value: &[u8]) -> &mut Self {
+        let (_, inits_at) = self.current.expect("WidgetTreeDesc initializer added before any node");
+        let count = u16::from_le_bytes([self.buf[inits_at], self.buf[inits_at + 1]]);
+        let count = count.checked_add(1).expect("too many initializers on one widget");
+        self.buf[inits_at..inits_at + 2].copy_from_slice(&count.to_le_bytes());
+
+        self.buf.push(target);
+        self.buf.push(kind);
+        self.push_str16(prop);
+        let len = u32::try_from(value.len()).expect("widget initializer value too large");
+        self.buf.extend_from_slice(&len.to_le_bytes());
+        self.buf.extend_from_slice(value);
+        self
+    }
+
+    fn push_str16(&mut self, s: &str) {
+        let len = u16::try_from(s.len()).expect("widget/property name too long");
+        self.buf.extend_from_slice(&len.to_le_bytes());
+        self.buf.extend_from_slice(s.as_bytes());
+    }
+}
+
+/// Build `desc` under `user_widget`'s WidgetTree and install its root.
+///
+/// Returns the handles of the nodes marked with [`WidgetTreeDesc::keep`], in
+/// node order.
+pub fn build_widget_tree_raw(
+    user_widget: UObjectHandle,
+    desc: &WidgetTreeDesc,
+) -> UikaResult<Vec<UObjectHandle>> {
+    let bytes = desc.as_bytes();
+    let len = u32::try_from(bytes.len())
+        .map_err(|_| UikaError::InvalidOperation("widget tree description too large".into()))?;
+
+    let mut handles = vec![UObjectHandle::null(); desc.keep_count() as usize];
+    let mut count = 0u32;
+    let code = unsafe {
+        ffi_dispatch::widget_build_widget_tree(
+            user_widget,
+            bytes.as_ptr(),
+            len,
+            handles.as_mut_ptr(),
+            handles.len() as u32,
+            &mut count,
+        )
+    };
+    debug_assert!(code != UikaErrorCode::BufferTooSmall, "keep_count out of sync with description");
+    check_ffi(code)?;
+    handles.truncate(count as usize);
+    Ok(handles)
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn widget_tree_desc_layout() {
+        let mut desc = WidgetTreeDesc::new();
+        let root = desc.node(UClassHandle::from_addr(0x10), None);
+        desc.node_named(UClassHandle::from_addr(0x20), Some(root), "Ok");
+        desc.keep().keep().slot_text("Padding", "(Left=4)");
+
+        assert_eq!(desc.node_count(), 2);
+        assert_eq!(desc.keep_count(), 1);
+
+        let mut expected = Vec::new();
+        expected.extend_from_slice(&2u32.to_le_bytes());
+        // root
+        expected.extend_from_slice(&0x10u64.to_le_bytes());
+        expected.extend_from_slice(&(-1i32).to_le_bytes());
+        expected.extend_from_slice(&0u32.to_le_bytes());
+        expected.extend_from_slice(&0u16.to_le_bytes());
+        expected.extend_from_slice(&0u16.to_le_bytes());
+        // child
+        expected.extend_from_slice(&0x20u64.to_le_bytes());
+        expected.extend_from_slice(&0i32.to_le_bytes());
+        expected.extend_from_slice(&UIKA_WIDGET_NODE_KEEP.to_le_bytes());
+        expected.extend_from_slice(&2u16.to_le_bytes());
+        expected.extend_from_slice(b"Ok");
+        expected.extend_from_slice(&1u16.to_le_bytes());
+        expected.extend_from_slice(&[UIKA_WIDGET_INIT_SLOT, UIKA_WIDGET_VALUE_TEXT]);
+        expected.extend_from_slice(&7u16.to_le_bytes());
+        expected.extend_from_slice(b"Padding");
+        expected.extend_from_slice(&8u32.to_le_bytes());
+        expected.extend_from_slice(b"(Left=4)");
+
+        assert_eq!(desc.as_bytes(), &expected[..]);
+    }
+}
@@ -1,10 +1,20 @@
 // World-level gameplay template function wrappers (raw handle versions).
 // Type-safe wrappers live in uika-bindings/src/manual/world_ext.rs.
 
-use uika_ffi::{UClassHandle, UObjectHandle};
+use std::future::Future;
+use std::pin::Pin;
+use std::sync::{Arc, Mutex};
+use std::task::{Context, Poll, Waker};
 
+use uika_ffi::{
+    UClassHandle, UObjectHandle, UikaActorChange, UikaAssetLoadResult, UikaErrorCode, UikaStrView,
+    UikaTraceBatchResult, UikaTraceHit, UikaTraceRequest, UIKA_ASSET_LOAD_OK, UIKA_TRACE_BATCH_OK,
+};
+
+use crate::delegate_registry;
 use crate::error::{check_ffi, UikaError, UikaResult};
 use crate::ffi_dispatch;
+use crate::lock_or_recover;
 
 /// Spawn an actor in the world.
 ///
@@ -115,63 +125,610 @@ pub fn finish_spawning_raw(
     })
 }
 
-/// Get the UWorld from an actor handle.
-pub fn get_world_raw(actor: UObjectHandle) -> UikaResult<UObjectHandle> {
-    let result = unsafe { ffi_dispatch::world_get_world(actor) };
-    if result.is_null() {
-        Err(UikaError::InvalidOperation("get_world returned null".into()))
-    } else {
-        Ok(result)
+/// Check that `transforms` holds `count` buffers of `stride` bytes.
+fn check_transform_batch(transforms: &[u8], stride: usize, count: usize) -> UikaResult<()> {
+    if stride == 0 || transforms.len() < stride * count {
+        return Err(UikaError::InvalidOperation(format!(
+            "transform batch of {} bytes does not hold {count} x {stride}-byte transforms",
+            transforms.len()
+        )));
     }
+    Ok(())
 }
 
-/// Get all actors of a given class in the world.
-pub fn get_all_actors_of_class_raw(
+/// Spawn one actor per transform in a single FFI call.
+///
+/// `transforms` holds `count` FTransform buffers of `stride` bytes each
+/// (as produced by `OwnedStruct::as_bytes`). The returned vector has one
+/// entry per transform; entries are null where the spawn failed (e.g. a
+/// `DontSpawnIfColliding` hit).
+pub fn spawn_actors_batch_raw(
     world: UObjectHandle,
     class: UClassHandle,
+    transforms: &[u8],
+    stride: usize,
+    count: usize,
+    owner: UObjectHandle,
+    collision_method: u8,
 ) -> UikaResult<Vec<UObjectHandle>> {
-    let handle_size = core::mem::size_of::<UObjectHandle>() as u32;
-
-    // First call with zero capacity to get the count.
-    let mut count: u32 = 0;
+    if count == 0 {
+        return Ok(Vec::new());
+    }
+    check_transform_batch(transforms, stride, count)?;
+    let mut handles = vec![UObjectHandle::null(); count];
+    let mut spawned: u32 = 0;
     check_ffi(unsafe {
-        ffi_dispatch::world_get_all_actors_of_class(
+        ffi_dispatch::world_spawn_actors_batch(
             world,
             class,
-            std::ptr::null_mut(),
-            0,
-            &mut count,
+            transforms.as_ptr(),
+            stride as u32,
+            count as u32,
+            owner,
+            collision_method,
+            handles.as_mut_ptr(),
+            &mut spawned,
         )
     })?;
+    Ok(handles)
+}
 
+/// Deferred-construction batch spawn: spawns every actor, runs
+/// `init(index, actor)` for each successful spawn, then finishes them all.
+///
+/// Two FFI calls in total regardless of `count`. Layout of `transforms` and
+/// the returned vector are as in [`spawn_actors_batch_raw`]. If `init`
+/// panics, every spawned actor is still finished before the panic propagates.
+pub fn spawn_actors_deferred_batch_raw(
+    world: UObjectHandle,
+    class: UClassHandle,
+    transforms: &[u8],
+    stride: usize,
+    count: usize,
+    owner: UObjectHandle,
+    instigator: UObjectHandle,
+    collision_method: u8,
+    mut init: impl FnMut(usize, UObjectHandle),
+) -> UikaResult<Vec<UObjectHandle>> {
     if count == 0 {
         return Ok(Vec::new());
     }
+    check_transform_batch(transforms, stride, count)?;
+    let mut handles = vec![UObjectHandle::null(); count];
+    let mut spawned: u32 = 0;
+    check_ffi(unsafe {
+        ffi_dispatch::world_spawn_actors_deferred_batch(
+            world,
+            class,
+            transforms.as_ptr(),
+            stride as u32,
+            count as u32,
+            owner,
+            instigator,
+            collision_method,
+            handles.as_mut_ptr(),
+            &mut spawned,
+        )
+    })?;
+
+    // Finishes the batch on unwind, so no actor is left mid-construction.
+    let pending = PendingSpawnBatch { handles: &handles, transforms, stride };
+    for (index, &actor) in handles.iter().enumerate() {
+        if !actor.is_null() {
+            init(index, actor);
+        }
+    }
+    let result = pending.finish();
+    std::mem::forget(pending);
+    check_ffi(result)?;
+    Ok(handles)
+}
+
+/// Deferred-spawned actors still awaiting `finish_spawning_batch`; finishes
+/// them on drop.
+struct PendingSpawnBatch<'a> {
+    handles: &'a [UObjectHandle],
+    transforms: &'a [u8],
+    stride: usize,
+}
+
+impl PendingSpawnBatch<'_> {
+    fn finish(&self) -> UikaErrorCode {
+        unsafe {
+            ffi_dispatch::world_finish_spawning_batch(
+                self.handles.as_ptr(),
+                self.transforms.as_ptr(),
+                self.stride as u32,
+                self.handles.len() as u32,
+            )
+        }
+    }
+}
+
+impl Drop for PendingSpawnBatch<'_> {
+    fn drop(&mut self) {
+        let _ = self.finish();
+    }
+}
 
-    // Second call: allocate a byte buffer and pass byte size.
-    let byte_size = count * handle_size;
-    let mut buf = vec![0u8; byte_size as usize];
-    let mut actual_count: u32 = 0;
+/// Spawn `count` actors of `class` straight into the world's actor pool.
+/// Returns how many were spawned.
+pub fn pool_prewarm_raw(world: UObjectHandle, class: UClassHandle, count: u32) -> UikaResult<u32> {
+    let mut spawned: u32 = 0;
+    check_ffi(unsafe { ffi_dispatch::world_pool_prewarm(world, class, count, &mut spawned) })?;
+    Ok(spawned)
+}
+
+/// Take an actor of `class` from the world's actor pool and place it at
+/// `transform_buf` (raw FTransform bytes). If the pool is empty a fresh
+/// actor is spawned; the returned flag is `true` only for reused actors.
+pub fn pool_acquire_raw(
+    world: UObjectHandle,
+    class: UClassHandle,
+    transform_buf: &[u8],
+) -> UikaResult<(UObjectHandle, bool)> {
+    let mut actor = UObjectHandle::null();
+    let mut reused = false;
     check_ffi(unsafe {
-        ffi_dispatch::world_get_all_actors_of_class(
+        ffi_dispatch::world_pool_acquire(
             world,
             class,
-            buf.as_mut_ptr(),
-            byte_size,
-            &mut actual_count,
+            transform_buf.as_ptr(),
+            transform_buf.len() as u32,
+            &mut actor,
+            &mut reused,
         )
     })?;
+    Ok((actor, reused))
+}
+
+/// Deactivate `actor` and return it to its world's actor pool.
+pub fn pool_release_raw(actor: UObjectHandle) -> UikaResult<()> {
+    check_ffi(unsafe { ffi_dispatch::world_pool_release(actor) })
+}
+
+/// Destroy the pooled (inactive) actors of `class`, or of every class if
+/// `class` is null. Returns how many were destroyed.
+pub fn pool_clear_raw(world: UObjectHandle, class: UClassHandle) -> UikaResult<u32> {
+    let mut destroyed: u32 = 0;
+    check_ffi(unsafe { ffi_dispatch::world_pool_clear(world, class, &mut destroyed) })?;
+    Ok(destroyed)
+}
+
+/// Get the UWorld from an actor handle.
+pub fn get_world_raw(actor: UObjectHandle) -> UikaResult<UObjectHandle> {
+    let result = unsafe { ffi_dispatch::world_get_world(actor) };
+    if result.is_null() {
+        Err(UikaError::InvalidOperation("get_world returned null".into()))
+    } else {
+        Ok(result)
+    }
+}
+
+/// Initial handle capacity for actor queries; most class queries fit, so the
+/// common case is a single FFI call.
+const ACTOR_QUERY_INITIAL_CAPACITY: usize = 256;
+
+/// Run an actor-handle query, growing the buffer once if the first guess was
+/// too small. `call(buf, byte_size, out_count)` reports the total count even
+/// when only part of it fit.
+fn query_actor_handles(
+    mut call: impl FnMut(*mut u8, u32, &mut u32) -> UikaResult<()>,
+) -> UikaResult<Vec<UObjectHandle>> {
+    let mut handles = vec![UObjectHandle::null(); ACTOR_QUERY_INITIAL_CAPACITY];
+    loop {
+        let byte_size = (handles.len() * core::mem::size_of::<UObjectHandle>()) as u32;
+        let mut count: u32 = 0;
+        call(handles.as_mut_ptr() as *mut u8, byte_size, &mut count)?;
+        if count as usize <= handles.len() {
+            handles.truncate(count as usize);
+            return Ok(handles);
+        }
+        handles.resize(count as usize, UObjectHandle::null());
+    }
+}
 
-    // Reinterpret byte buffer as UObjectHandle array.
-    let handles = buf
-        .chunks_exact(handle_size as usize)
-        .take(actual_count as usize)
-        .map(|chunk| {
-            let bytes: [u8; 8] = chunk.try_into().expect("handle is 8 bytes");
-            let ptr = usize::from_ne_bytes(bytes) as *mut std::ffi::c_void;
-            UObjectHandle(ptr)
+/// Get all actors of a given class in the world.
+pub fn get_all_actors_of_class_raw(
+    world: UObjectHandle,
+    class: UClassHandle,
+) -> UikaResult<Vec<UObjectHandle>> {
+    query_actor_handles(|buf, byte_size, count| {
+        check_ffi(unsafe {
+            ffi_dispatch::world_get_all_actors_of_class(world, class, buf, byte_size, count)
         })
-        .collect();
+    })
+}
 
-    Ok(handles)
+/// One add/remove reported by [`actor_changes_raw`].
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub struct ActorChange {
+    /// For removals this is identity only: the actor is being destroyed or
+    /// streamed out and must not be dereferenced.
+    pub actor: UObjectHandle,
+    pub added: bool,
+}
+
+/// Get all actors of a given class from the world's per-class actor index,
+/// together with the index generation the result reflects.
+///
+/// Feed the generation to [`actor_changes_raw`] on later frames to process
+/// only actors spawned or removed since.
+pub fn get_actors_of_class_indexed_raw(
+    world: UObjectHandle,
+    class: UClassHandle,
+) -> UikaResult<(Vec<UObjectHandle>, u64)> {
+    let mut generation: u64 = 0;
+    let handles = query_actor_handles(|buf, byte_size, count| {
+        check_ffi(unsafe {
+            ffi_dispatch::world_get_actors_of_class_indexed(
+                world, class, buf, byte_size, count, &mut generation,
+            )
+        })
+    })?;
+    Ok((handles, generation))
+}
+
+/// Changes to actors of `class` (and subclasses) after generation `since`,
+/// oldest first, plus the current generation.
+///
+/// Returns `Ok(None)` if the index no longer holds that much history; call
+/// [`get_actors_of_class_indexed_raw`] to resynchronize.
+pub fn actor_changes_raw(
+    world: UObjectHandle,
+    class: UClassHandle,
+    since: u64,
+) -> UikaResult<Option<(Vec<ActorChange>, u64)>> {
+    let mut raw: Vec<UikaActorChange> = Vec::new();
+    loop {
+        let mut count: u32 = 0;
+        let mut generation: u64 = 0;
+        let code = unsafe {
+            ffi_dispatch::world_get_actor_changes(
+                world,
+                class,
+                since,
+                raw.as_mut_ptr(),
+                raw.len() as u32,
+                &mut count,
+                &mut generation,
+            )
+        };
+        match code {
+            UikaErrorCode::Ok => {
+                let changes = raw[..count as usize]
+                    .iter()
+                    .map(|c| ActorChange { actor: c.actor, added: c.added != 0 })
+                    .collect();
+                return Ok(Some((changes, generation)));
+            }
+            UikaErrorCode::IndexOutOfRange => return Ok(None),
+            // The log may grow between calls; retry with the reported size.
+            UikaErrorCode::BufferTooSmall => raw.resize(count as usize, UikaActorChange::default()),
+            other => return Err(UikaError::from(other)),
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// One-shot completions (asset loads, trace batches)
+// ---------------------------------------------------------------------------
+
+struct CompletionState<T> {
+    callback_id: u64,
+    result: Option<UikaResult<T>>,
+    waker: Option<Waker>,
+}
+
+/// The Rust half of a C++ request that completes once through
+/// `invoke_delegate_callback`.
+struct Completion<T> {
+    request: u64,
+    state: Arc<Mutex<CompletionState<T>>>,
+}
+
+impl<T: Send + 'static> Completion<T> {
+    /// Register a one-shot callback that turns the C++ params pointer into
+    /// the result with `decode`, then start the request with `call`.
+    fn start(
+        decode: impl Fn(*mut u8) -> UikaResult<T> + Send + 'static,
+        call: impl FnOnce(u64, &mut u64) -> UikaErrorCode,
+    ) -> UikaResult<Self> {
+        let state = Arc::new(Mutex::new(CompletionState { callback_id: 0, result: None, waker: None }));
+        let shared = Arc::clone(&state);
+        let callback_id = delegate_registry::register_callback(move |params| {
+            let outcome = decode(params);
+            let (callback_id, waker) = {
+                let mut st = lock_or_recover(&shared);
+                st.result = Some(outcome);
+                (st.callback_id, st.waker.take())
+            };
+            delegate_registry::unregister_callback(callback_id);
+            if let Some(waker) = waker {
+                waker.wake();
+            }
+        });
+        lock_or_recover(&state).callback_id = callback_id;
+
+        let mut request: u64 = 0;
+        if let Err(e) = check_ffi(call(callback_id, &mut request)) {
+            delegate_registry::unregister_callback(callback_id);
+            return Err(e);
+        }
+        Ok(Self { request, state })
+    }
+
+    fn is_ready(&self) -> bool {
+        lock_or_recover(&self.state).result.is_some()
+    }
+
+    fn try_take(&self) -> Option<UikaResult<T>> {
+        lock_or_recover(&self.state).result.take()
+    }
+
+    fn poll(&self, cx: &mut Context<'_>) -> Poll<UikaResult<T>> {
+        let mut st = lock_or_recover(&self.state);
+        match st.result.take() {
+            Some(result) => Poll::Ready(result),
+            None => {
+                st.waker = Some(cx.waker().clone());
+                Poll::Pending
+            }
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Asynchronous asset loading
+// ---------------------------------------------------------------------------
+
+/// Default `TAsyncLoadPriority` for async asset loads.
+pub const ASSET_LOAD_PRIORITY_DEFAULT: i32 = 0;
+
+/// An in-flight `FStreamableManager` load, started by [`load_object_async_raw`]
+/// or [`load_objects_async_raw`].
+///
+/// Resolves (as a `Future`, or through [`try_take`](Self::try_take) for code
+/// that polls once per frame) to [`LoadedAssets`]: one handle per requested
+/// path, null where that path failed to load. The load completes on the game
+/// thread; nothing blocks while it is pending. Dropping an unfinished load
+/// cancels it.
+pub struct AssetLoad {
+    inner: Completion<LoadedAssets>,
+}
+
+impl AssetLoad {
+    fn start(call: impl FnOnce(u64, &mut u64) -> UikaErrorCode) -> UikaResult<Self> {
+        let inner = Completion::start(
+            |params| {
+                let result = unsafe { &*(params as *const UikaAssetLoadResult) };
+                if result.status != UIKA_ASSET_LOAD_OK {
+                    return Err(UikaError::InvalidOperation("asset load cancelled".into()));
+                }
+                if result.objects.is_null() || result.count == 0 {
+                    return Ok(LoadedAssets { handles: Vec::new() });
+                }
+                let handles = unsafe { std::slice::from_raw_parts(result.objects, result.count as usize) }.to_vec();
+                Ok(LoadedAssets::root(handles))
+            },
+            call,
+        )?;
+        Ok(Self { inner })
+    }
+
+    /// The C++ request id (stable for the lifetime of the load).
+    pub fn request_id(&self) -> u64 {
+        self.inner.request
+    }
+
+    /// True once the load has completed or been cancelled.
+    pub fn is_ready(&self) -> bool {
+        self.inner.is_ready()
+    }
+
+    /// Take the result if the load has finished; `None` while pending or once
+    /// the result was taken.
+    pub fn try_take(&mut self) -> Option<UikaResult<LoadedAssets>> {
+        self.inner.try_take()
+    }
+
+    /// Cancel the load. The result becomes an `InvalidOperation` error.
+    pub fn cancel(&self) {
+        if !self.is_ready() && crate::api::is_api_initialized() {
+            let _ = unsafe { ffi_dispatch::world_cancel_async_load(self.inner.request) };
+        }
+    }
+}
+
+impl Future for AssetLoad {
+    type Output = UikaResult<LoadedAssets>;
+
+    fn poll(self: Pin<&mut Self>, cx: &mut Context<'_>) -> Poll<Self::Output> {
+        self.inner.poll(cx)
+    }
+}
+
+impl Drop for AssetLoad {
+    fn drop(&mut self) {
+        self.cancel();
+    }
+}
+
+/// The objects of a completed [`AssetLoad`], indexed like the requested
+/// paths (null where a path failed to load).
+///
+/// The objects are GC-rooted while this value exists: once the load's
+/// streamable handle is released nothing else may reference them. Keep it
+/// (or pin what you need with `Pinned`) for as long as the handles are used.
+pub struct LoadedAssets {
+    handles: Vec<UObjectHandle>,
+}
+
+impl LoadedAssets {
+    /// Root `handles`; called inside the completion callback, while the
+    /// streamable handle still keeps them loaded.
+    fn root(handles: Vec<UObjectHandle>) -> Self {
+        // Null entries are skipped by the root set.
+        unsafe { ffi_dispatch::lifecycle_add_gc_root_many(handles.as_ptr(), handles.len() as u32) };
+        Self { handles }
+    }
+
+    /// One handle per requested path.
+    pub fn handles(&self) -> &[UObjectHandle] {
+        &self.handles
+    }
+}
+
+impl std::ops::Deref for LoadedAssets {
+    type Target = [UObjectHandle];
+
+    fn deref(&self) -> &[UObjectHandle] {
+        &self.handles
+    }
+}
+
+impl Drop for LoadedAssets {
+    fn drop(&mut self) {
+        // After a DLL unload the C++ side has already emptied the root set.
+        if !self.handles.is_empty() && crate::api::is_api_initialized() {
+            unsafe {
+                ffi_dispatch::lifecycle_remove_gc_root_many(self.handles.as_ptr(), self.handles.len() as u32)
+            };
+        }
+    }
+}
+
+impl std::fmt::Debug for LoadedAssets {
+    fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+        f.debug_tuple("LoadedAssets").field(&self.handles).finish()
+    }
+}
+
+/// Start loading the object at `path` without blocking the game thread.
+/// `class` may be null; a loaded object of another class resolves to null.
+pub fn load_object_async_raw(class: UClassHandle, path: &str, priority: i32) -> UikaResult<AssetLoad> {
+    AssetLoad::start(|callback_id, request| unsafe {
+        ffi_dispatch::world_load_object_async(
+            class,
+            path.as_ptr(),
+            path.len() as u32,
+            priority,
+            callback_id,
+            request,
+        )
+    })
+}
+
+/// Start loading every path in one request; the result has one handle per
+/// path, in order.
+pub fn load_objects_async_raw(
+    class: UClassHandle,
+    paths: &[&str],
+    priority: i32,
+) -> UikaResult<AssetLoad> {
+    let views: Vec<UikaStrView> = paths.iter().map(|p| UikaStrView::new(p)).collect();
+    AssetLoad::start(|callback_id, request| unsafe {
+        ffi_dispatch::world_load_objects_async(
+            class,
+            views.as_ptr(),
+            views.len() as u32,
+            priority,
+            callback_id,
+            request,
+        )
+    })
+}
+
+// ---------------------------------------------------------------------------
+// Batched collision queries
+// ---------------------------------------------------------------------------
+
+/// Run every query in `requests` synchronously, in one crossing. `hits` is
+/// refilled with one entry per request; reuse it across frames to avoid
+/// reallocating.
+pub fn trace_batch_raw(
+    world: UObjectHandle,
+    requests: &[UikaTraceRequest],
+    hits: &mut Vec<UikaTraceHit>,
+) -> UikaResult<()> {
+    hits.clear();
+    hits.resize(requests.len(), UikaTraceHit::default());
+    check_ffi(unsafe {
+        ffi_dispatch::world_trace_batch(world, requests.as_ptr(), requests.len() as u32, hits.as_mut_ptr())
+    })
+}
+
+/// A batch of `UWorld` async traces, started by [`trace_batch_async_raw`].
+///
+/// Resolves during the next world tick (as a `Future`, or through
+/// [`try_take`](Self::try_take) once per frame) to one hit per request, in
+/// request order. Dropping an unfinished batch cancels it; a batch whose
+/// world is torn down resolves to an `InvalidOperation` error.
+pub struct TraceBatch {
+    inner: Completion<Vec<UikaTraceHit>>,
+}
+
+impl TraceBatch {
+    /// The C++ batch id.
+    pub fn batch_id(&self) -> u64 {
+        self.inner.request
+    }
+
+    /// True once the results arrived or the batch was cancelled.
+    pub fn is_ready(&self) -> bool {
+        self.inner.is_ready()
+    }
+
+    /// Take the hits if they have arrived; `None` while pending or once taken.
+    pub fn try_take(&mut self) -> Option<UikaResult<Vec<UikaTraceHit>>> {
+        self.inner.try_take()
+    }
+
+    /// Cancel the batch. The result becomes an `InvalidOperation` error.
+    pub fn cancel(&self) {
+        if !self.is_ready() && crate::api::is_api_initialized() {
+            let _ = unsafe { ffi_dispatch::world_cancel_trace_batch(self.inner.request) };
+        }
+    }
+}
+
+impl Future for TraceBatch {
+    type Output = UikaResult<Vec<UikaTraceHit>>;
+
+    fn poll(self: Pin<&mut Self>, cx: &mut Context<'_>) -> Poll<Self::Output> {
+        self.inner.poll(cx)
+    }
+}
+
+impl Drop for TraceBatch {
+    fn drop(&mut self) {
+        self.cancel();
+    }
+}
+
+/// Submit `requests` as async traces; the physics work runs off the game
+/// thread after this frame. Call from the game thread while `world` ticks.
+pub fn trace_batch_async_raw(world: UObjectHandle, requests: &[UikaTraceRequest]) -> UikaResult<TraceBatch> {
+    let inner = Completion::start(
+        |params| {
+            let result = unsafe { &*(params as *const UikaTraceBatchResult) };
+            if result.status != UIKA_TRACE_BATCH_OK {
+                return Err(UikaError::InvalidOperation("trace batch cancelled".into()));
+            }
+            if result.hits.is_null() || result.count == 0 {
+                return Ok(Vec::new());
+            }
+            Ok(unsafe { std::slice::from_raw_parts(result.hits, result.count as usize) }.to_vec())
+        },
+        |callback_id, batch| unsafe {
+            ffi_dispatch::world_trace_batch_async(
+                world,
+                requests.as_ptr(),
+                requests.len() as u32,
+                callback_id,
+                batch,
+            )
+        },
+    )?;
+    Ok(TraceBatch { inner })
 }
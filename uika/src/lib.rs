@@ -16,6 +16,7 @@
 //! | `level-sequence`     | Level Sequence / Sequencer types            |
 //! | `cinematic`          | Cinematic camera types                      |
 //! | `movie`              | Movie scene types                           |
+//! | `ffi-stats`          | FFI call counters for `Uika.Stats`          |
 
 // Re-exports for proc macro path resolution and user access.
 pub use uika_ffi as ffi;
@@ -37,11 +38,14 @@ pub use glam;
 // Callbacks (shared between init and entry! macro)
 // ---------------------------------------------------------------------------
 
+use runtime::ffi_stats::{callback_scope, CallbackSlot};
+
 extern "C" fn real_drop_rust_instance(
     handle: ffi::UObjectHandle,
     type_id: u64,
     _rust_data: *mut u8,
 ) {
+    let _stats = callback_scope(CallbackSlot::DropRustInstance);
     runtime::ffi_boundary((), || {
         runtime::reify_registry::drop_instance(handle, type_id);
     });
@@ -50,14 +54,17 @@ extern "C" fn real_drop_rust_instance(
 extern "C" fn real_invoke_rust_function(
     callback_id: u64,
     obj: ffi::UObjectHandle,
+    rust_data: *mut u8,
     params: *mut u8,
 ) {
+    let _stats = callback_scope(CallbackSlot::InvokeRustFunction);
     runtime::ffi_boundary((), || {
-        runtime::reify_registry::invoke_function(callback_id, obj, params);
+        runtime::reify_registry::invoke_function(callback_id, obj, rust_data, params);
     });
 }
 
 extern "C" fn real_invoke_delegate_callback(callback_id: u64, params: *mut u8) {
+    let _stats = callback_scope(CallbackSlot::InvokeDelegateCallback);
     runtime::ffi_boundary((), || {
         runtime::delegate_registry::invoke(callback_id, params);
     });
@@ -67,10 +74,11 @@ extern "C" fn real_construct_rust_instance(
     obj: ffi::UObjectHandle,
     type_id: u64,
     _is_cdo: bool,
-) {
-    runtime::ffi_boundary((), || {
-        runtime::reify_registry::construct_instance(obj, type_id);
-    });
+) -> *mut u8 {
+    let _stats = callback_scope(CallbackSlot::ConstructRustInstance);
+    runtime::ffi_boundary(std::ptr::null_mut(), || {
+        runtime::reify_registry::construct_instance(obj, type_id)
+    })
 }
 
 extern "C" fn real_on_shutdown() {
@@ -78,15 +86,103 @@ extern "C" fn real_on_shutdown() {
         runtime::reify_registry::clear_all();
         runtime::delegate_registry::clear_all();
         runtime::pinned::clear_all();
+        runtime::fname::invalidate_cache();
+        runtime::jobs::clear_game_thread_queue();
     });
 }
 
 extern "C" fn real_notify_pinned_destroyed(handle: ffi::UObjectHandle) {
+    let _stats = callback_scope(CallbackSlot::NotifyPinnedDestroyed);
     runtime::ffi_boundary((), || {
         runtime::pinned::notify_pinned_destroyed(handle);
     });
 }
 
+extern "C" fn real_drop_rust_instances(entries: *const ffi::UikaDeadInstance, count: u32) {
+    let _stats = callback_scope(CallbackSlot::DropRustInstances);
+    runtime::ffi_boundary((), || {
+        if entries.is_null() || count == 0 {
+            return;
+        }
+        let dead = unsafe { std::slice::from_raw_parts(entries, count as usize) };
+        runtime::reify_registry::drop_instances(dead);
+    });
+}
+
+extern "C" fn real_notify_pinned_destroyed_many(handles: *const ffi::UObjectHandle, count: u32) {
+    let _stats = callback_scope(CallbackSlot::NotifyPinnedDestroyedMany);
+    runtime::ffi_boundary((), || {
+        if handles.is_null() || count == 0 {
+            return;
+        }
+        let handles = unsafe { std::slice::from_raw_parts(handles, count as usize) };
+        runtime::pinned::notify_pinned_destroyed_many(handles);
+    });
+}
+
+extern "C" fn real_snapshot_rust_instances() -> u32 {
+    let _stats = callback_scope(CallbackSlot::SnapshotRustInstances);
+    runtime::ffi_boundary(0, runtime::reify_registry::snapshot_instances)
+}
+
+extern "C" fn real_restore_rust_instances() -> u32 {
+    let _stats = callback_scope(CallbackSlot::RestoreRustInstances);
+    runtime::ffi_boundary(0, runtime::reify_registry::restore_instances)
+}
+
+extern "C" fn real_on_pool_release(handle: ffi::UObjectHandle, type_id: u64) {
+    let _stats = callback_scope(CallbackSlot::OnPoolRelease);
+    runtime::ffi_boundary((), || {
+        runtime::reify_registry::pool_release_instance(handle, type_id);
+    });
+}
+
+extern "C" fn real_on_pool_acquire(handle: ffi::UObjectHandle, type_id: u64) {
+    let _stats = callback_scope(CallbackSlot::OnPoolAcquire);
+    runtime::ffi_boundary((), || {
+        runtime::reify_registry::pool_acquire_instance(handle, type_id);
+    });
+}
+
+extern "C" fn real_dump_ffi_stats(top_n: u32, reset: bool) {
+    runtime::ffi_boundary((), || {
+        runtime::ffi_stats::dump(top_n as usize, reset);
+    });
+}
+
+extern "C" fn real_run_job(job: u64) {
+    let _stats = callback_scope(CallbackSlot::RunJob);
+    runtime::ffi_boundary((), || unsafe { runtime::jobs::run_job(job) });
+}
+
+extern "C" fn real_run_job_range(job: u64, begin: u32, end: u32) {
+    let _stats = callback_scope(CallbackSlot::RunJobRange);
+    runtime::ffi_boundary((), || unsafe { runtime::jobs::run_job_range(job, begin, end) });
+}
+
+extern "C" fn real_drain_game_thread_queue() {
+    let _stats = callback_scope(CallbackSlot::DrainGameThreadQueue);
+    runtime::ffi_boundary((), || {
+        runtime::jobs::drain_game_thread_queue();
+    });
+}
+
+extern "C" fn real_tick_class(
+    type_id: u64,
+    instances: *mut ffi::UikaTickInstance,
+    count: u32,
+    delta_seconds: f32,
+) {
+    let _stats = callback_scope(CallbackSlot::TickClass);
+    runtime::ffi_boundary((), || {
+        if instances.is_null() || count == 0 {
+            return;
+        }
+        let instances = unsafe { std::slice::from_raw_parts_mut(instances, count as usize) };
+        runtime::reify_registry::tick_class(type_id, instances, delta_seconds);
+    });
+}
+
 #[doc(hidden)]
 pub static __CALLBACKS: ffi::UikaRustCallbacks = ffi::UikaRustCallbacks {
     drop_rust_instance: real_drop_rust_instance,
@@ -95,6 +191,17 @@ pub static __CALLBACKS: ffi::UikaRustCallbacks = ffi::UikaRustCallbacks {
     on_shutdown: real_on_shutdown,
     construct_rust_instance: real_construct_rust_instance,
     notify_pinned_destroyed: real_notify_pinned_destroyed,
+    drop_rust_instances: real_drop_rust_instances,
+    notify_pinned_destroyed_many: real_notify_pinned_destroyed_many,
+    snapshot_rust_instances: real_snapshot_rust_instances,
+    restore_rust_instances: real_restore_rust_instances,
+    on_pool_release: real_on_pool_release,
+    on_pool_acquire: real_on_pool_acquire,
+    dump_ffi_stats: real_dump_ffi_stats,
+    run_job: real_run_job,
+    run_job_range: real_run_job_range,
+    drain_game_thread_queue: real_drain_game_thread_queue,
+    tick_class: real_tick_class,
 };
 
 // ---------------------------------------------------------------------------
@@ -113,6 +220,7 @@ pub fn init(api_table: *const ffi::UikaApiTable) -> *const ffi::UikaRustCallback
 
         // Delegate API table storage to uika-runtime.
         runtime::init_api(api_table);
+        bindings::prefetch_handles();
 
         log_greeting();
         register_all_classes();
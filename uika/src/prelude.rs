@@ -8,7 +8,7 @@ pub use uika_runtime::{
     OwnedStruct, UStructRef, UeArray, UeMap, UeSet,
     DynamicCall, DynamicCallResult, DelegateBinding,
     FName, TWeakObjectPtr,
-    LOG_DISPLAY, LOG_WARNING, LOG_ERROR,
+    LogCategory, LOG_DISPLAY, LOG_WARNING, LOG_ERROR, LOG_VERBOSE, LOG_VERY_VERBOSE,
 };
 
 // UE math types (uika-runtime)
@@ -75,4 +75,4 @@ pub use uika_bindings::manual::fkey::FKeyExt;
 
 // World spawn/query extensions (feature-gated)
 #[cfg(feature = "engine")]
-pub use uika_bindings::manual::world_ext::{WorldSpawnExt, find_object, load_object};
+pub use uika_bindings::manual::world_ext::{WorldSpawnExt, WorldTraceExt, find_object, load_object};